@@ -0,0 +1,242 @@
+"""
+C++ 推論エンジン (共有ライブラリ libdistpredict.so) の ctypes ラッパー
+
+学習時の検証や alloutput_* の格子出力を、Teensy に載せるものと同じ推論コードで行うためのもの。
+ライブラリは CMake でビルドする (cmake -S . -B build && cmake --build build)。
+場所は環境変数 DISTPREDICT_LIB で指定でき、指定がなければ このファイルと同じ階層の build/ を探す。
+"""
+
+import ctypes
+import os
+from typing import Dict, List, Optional, Tuple
+
+import numpy as np
+
+# host/distpredict_capi.h の DISTPREDICT_ABI_VERSION と一致させること
+ABI_VERSION = 1
+LIBRARY_NAMES = ['libdistpredict.so', 'libdistpredict.dylib']
+
+_FLOAT_ARRAY = np.ctypeslib.ndpointer(dtype=np.float32, flags='C_CONTIGUOUS')
+_DOUBLE_ARRAY = np.ctypeslib.ndpointer(dtype=np.float64, flags='C_CONTIGUOUS')
+
+_library = None
+
+
+class DistpredictError(RuntimeError):
+    """ライブラリが見つからない・版が合わない・モデルが不正な場合の例外"""
+
+
+def find_library() -> Optional[str]:
+    """
+    libdistpredict の場所を探す関数
+
+    Returns:
+        Optional[str]: 見つかったパス (なければ None)
+    """
+    path = os.environ.get('DISTPREDICT_LIB')
+    if path:
+        return path if os.path.exists(path) else None
+    build_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'build')
+    for name in LIBRARY_NAMES:
+        candidate = os.path.join(build_dir, name)
+        if os.path.exists(candidate):
+            return candidate
+    return None
+
+
+def load_library() -> ctypes.CDLL:
+    """
+    libdistpredict を読み込み、関数の型を設定する関数 (2回目以降は読み込み済みのものを返す)
+
+    Returns:
+        ctypes.CDLL: 読み込んだライブラリ
+    """
+    global _library
+    if _library is not None:
+        return _library
+    path = find_library()
+    if path is None:
+        raise DistpredictError('libdistpredict が見つかりません (cmake --build build でビルドするか DISTPREDICT_LIB を指定)')
+    lib = ctypes.CDLL(path)
+
+    lib.distpredict_abi_version.restype = ctypes.c_int
+    lib.distpredict_abi_version.argtypes = []
+    version = lib.distpredict_abi_version()
+    if version != ABI_VERSION:
+        raise DistpredictError(f'{path} の ABI 版数 {version} がラッパーの {ABI_VERSION} と一致しません')
+
+    lib.distpredict_engine_count.restype = ctypes.c_int
+    lib.distpredict_engine_count.argtypes = []
+    lib.distpredict_engine_name.restype = ctypes.c_char_p
+    lib.distpredict_engine_name.argtypes = [ctypes.c_int]
+    lib.distpredict_engine_description.restype = ctypes.c_char_p
+    lib.distpredict_engine_description.argtypes = [ctypes.c_int]
+    lib.distpredict_predict.restype = ctypes.c_int
+    lib.distpredict_predict.argtypes = [ctypes.c_char_p, _FLOAT_ARRAY, _FLOAT_ARRAY, _FLOAT_ARRAY, ctypes.c_size_t]
+
+    lib.distpredict_model_load.restype = ctypes.c_void_p
+    lib.distpredict_model_load.argtypes = [ctypes.c_char_p, ctypes.c_size_t, ctypes.POINTER(ctypes.c_int)]
+    lib.distpredict_model_free.restype = None
+    lib.distpredict_model_free.argtypes = [ctypes.c_void_p]
+    lib.distpredict_status_name.restype = ctypes.c_char_p
+    lib.distpredict_status_name.argtypes = [ctypes.c_int]
+    lib.distpredict_model_degree.restype = ctypes.c_int
+    lib.distpredict_model_degree.argtypes = [ctypes.c_void_p]
+    lib.distpredict_model_evaluate.restype = None
+    lib.distpredict_model_evaluate.argtypes = [ctypes.c_void_p, _DOUBLE_ARRAY, _DOUBLE_ARRAY, _DOUBLE_ARRAY,
+                                               ctypes.c_size_t]
+    lib.distpredict_model_predict.restype = None
+    lib.distpredict_model_predict.argtypes = [ctypes.c_void_p, _FLOAT_ARRAY, _FLOAT_ARRAY, _FLOAT_ARRAY,
+                                              ctypes.c_size_t]
+    _library = lib
+    return lib
+
+
+def available() -> bool:
+    """
+    libdistpredict が使えるかを返す関数
+
+    Returns:
+        bool: 読み込めれば True
+    """
+    try:
+        load_library()
+        return True
+    except (DistpredictError, OSError):
+        return False
+
+
+def _inputs(under_y, theta, dtype) -> Tuple[np.ndarray, np.ndarray]:
+    """入力を同じ長さの1次元の連続配列にそろえる"""
+    under_y = np.ascontiguousarray(np.ravel(under_y), dtype=dtype)
+    theta = np.ascontiguousarray(np.ravel(theta), dtype=dtype)
+    if under_y.shape != theta.shape:
+        raise ValueError(f'under_y ({under_y.size}) と theta ({theta.size}) の要素数が一致しません')
+    return under_y, theta
+
+
+def engines() -> List[Tuple[str, str]]:
+    """
+    組み込みのエンジンの一覧を返す関数
+
+    Returns:
+        List[Tuple[str, str]]: (名前, 説明) のリスト
+    """
+    lib = load_library()
+    return [(lib.distpredict_engine_name(i).decode(), lib.distpredict_engine_description(i).decode())
+            for i in range(lib.distpredict_engine_count())]
+
+
+def predict(engine: str, under_y, theta) -> np.ndarray:
+    """
+    組み込みのエンジン (Teensy に埋め込まれた17次モデルなど) で予測する関数
+
+    Args:
+        engine (str): エンジン名 (engines() の名前, 例: 'horner')
+        under_y: under_y の配列
+        theta: theta の配列
+
+    Returns:
+        np.ndarray: 予測距離 (float32, 入力検証範囲外は -1)
+    """
+    lib = load_library()
+    under_y, theta = _inputs(under_y, theta, np.float32)
+    out = np.empty_like(under_y)
+    if lib.distpredict_predict(engine.encode(), under_y, theta, out, under_y.size) != 0:
+        raise DistpredictError(f'不明なエンジン: {engine}')
+    return out
+
+
+class RuntimeModel:
+    """
+    任意の学習済み多項式モデルを、実機の predict_distance_runtime と同じ評価器で予測するクラス
+
+    モデルはバイナリモデル (.dpm) のバイト列としてライブラリに渡す (StandardScaler を畳み込んだHorner評価順の係数)
+    """
+
+    def __init__(self, blob: bytes):
+        """
+        Args:
+            blob (bytes): .dpm の内容
+        """
+        self._handle = None
+        self._lib = load_library()
+        status = ctypes.c_int(0)
+        handle = self._lib.distpredict_model_load(blob, len(blob), ctypes.byref(status))
+        if not handle:
+            raise DistpredictError(f'バイナリモデルが不正です: {self._lib.distpredict_status_name(status.value).decode()}')
+        self._handle = handle
+        self.degree = self._lib.distpredict_model_degree(handle)
+
+    @classmethod
+    def from_model_data(cls, data: Dict) -> 'RuntimeModel':
+        """
+        train.py が保存する辞書 (model, scaler, degree) から作る関数
+
+        Args:
+            data (Dict): model (LinearRegression), scaler (StandardScaler), degree を含む辞書
+
+        Returns:
+            RuntimeModel: 作成したモデル
+        """
+        from export_teensy_model import encode_model_blob
+        blob, _ = encode_model_blob(data)
+        return cls(blob)
+
+    @classmethod
+    def from_file(cls, path: str) -> 'RuntimeModel':
+        """
+        .joblib (train.py の出力) または .dpm (export_teensy_model.py blob の出力) から作る関数
+
+        Args:
+            path (str): ファイルのパス
+
+        Returns:
+            RuntimeModel: 作成したモデル
+        """
+        if path.endswith('.dpm'):
+            with open(path, 'rb') as f:
+                return cls(f.read())
+        import joblib
+        return cls.from_model_data(joblib.load(path))
+
+    def evaluate(self, under_y, theta) -> np.ndarray:
+        """
+        倍精度・入力検証なしで評価する関数 (学習時の検証・格子出力用, scikit-learn の predict に相当)
+
+        Args:
+            under_y: under_y の配列
+            theta: theta の配列
+
+        Returns:
+            np.ndarray: 予測距離 (float64)
+        """
+        under_y, theta = _inputs(under_y, theta, np.float64)
+        out = np.empty_like(under_y)
+        self._lib.distpredict_model_evaluate(self._handle, under_y, theta, out, under_y.size)
+        return out
+
+    def predict(self, under_y, theta) -> np.ndarray:
+        """
+        実機と同じ単精度の入出力・入力検証付きで予測する関数
+
+        Args:
+            under_y: under_y の配列
+            theta: theta の配列
+
+        Returns:
+            np.ndarray: 予測距離 (float32, 入力検証範囲外は -1)
+        """
+        under_y, theta = _inputs(under_y, theta, np.float32)
+        out = np.empty_like(under_y)
+        self._lib.distpredict_model_predict(self._handle, under_y, theta, out, under_y.size)
+        return out
+
+    def close(self):
+        """ライブラリ側のモデルを解放する"""
+        if getattr(self, '_handle', None):
+            self._lib.distpredict_model_free(self._handle)
+            self._handle = None
+
+    def __del__(self):
+        self.close()
@@ -0,0 +1,1837 @@
+import argparse
+import os
+import struct
+import zlib
+from datetime import datetime
+from fractions import Fraction
+from math import comb
+from typing import Dict, List, Tuple
+
+import joblib
+import numpy as np
+import pandas as pd
+
+# Teensy版に埋め込まれている学習済みモデル (17次, LNN蒸留)
+DEFAULT_MODEL_PATH = os.path.join(
+    'models', '20250721_233056-LNN蒸留多項式', 'polynomial_degree17_mae0.90.joblib'
+)
+DEFAULT_OUT_DIR = 'teensy_distance_predictor_degree17'
+# 区分モデル (tiled) の学習データ (LNN蒸留出力) と検証データ (実測)
+DEFAULT_TILED_DATA = os.path.join('data', 'alloutput_polynomial_degree17_mae0.90(LNN蒸留多項式).csv')
+DEFAULT_VALIDATION_DATA = os.path.join('data', 'All measurement data.csv')
+# 組み込みの組み合わせ ENSEMBLE_DEFAULT のモデル (DEFAULT_MEMBERS と同じ順序)
+DEFAULT_ENSEMBLE_MODELS = [
+    ('degree6', os.path.join('models', '20250719_191645-全データそのまま多項式', 'polynomial_degree6_mae0.70.joblib')),
+    ('degree17', DEFAULT_MODEL_PATH),
+]
+# 誤差表で点の少ないセルを全体のMAEへ寄せる強さ (全体のMAEを何点分の誤差として混ぜるか)
+ENSEMBLE_ERROR_PRIOR_POINTS = 3
+# 誤差表の当てはめに使わず、選択・加重平均の誤差の確認用に残す行 (行番号 % 間隔 == 間隔 - 1, 行番号はヘッダを除き0から)
+ENSEMBLE_ERROR_HOLDOUT_STRIDE = 4
+
+# バイナリモデルファイル (.dpm) の形式 (teensy_model_blob.h と一致させること)
+BLOB_MAGIC = b'DPMB'
+BLOB_VERSION = 1
+BLOB_HEADER_SIZE = 64
+BLOB_BASIS_MONOMIAL_HORNER = 0
+# magic, version, header_size, degree, basis, term_count, coefficient_offset, flags, intercept,
+# under_y_min/max, theta_min/max, validation_mae, reserved x2 (crc32 は末尾に別途追加)
+BLOB_HEADER_FORMAT = '<4sHHHHIIIdfffffII'
+# validate_input_range() と同じ入力検証範囲
+BLOB_INPUT_RANGE = (-100.0, 100.0, -180.0, 180.0)
+
+
+def load_model(model_path: str) -> Dict:
+    """
+    train.pyが保存した.joblibを読み込む関数
+
+    Args:
+        model_path (str): .joblibファイルのパス
+
+    Returns:
+        Dict: model, scaler, degree, 各種MAEを含む辞書
+    """
+    data = joblib.load(model_path)
+    data['path'] = model_path
+    return data
+
+
+def monomial_powers(degree: int) -> List[Tuple[int, int]]:
+    """
+    PolynomialFeaturesと同じ順序 (次数昇順, under_yの次数降順) で指数の組を返す関数
+
+    Args:
+        degree (int): 多項式の次数
+
+    Returns:
+        List[Tuple[int, int]]: (under_yの指数, thetaの指数) のリスト
+    """
+    powers = []
+    for total in range(degree + 1):
+        for j in range(total + 1):
+            powers.append((total - j, j))
+    return powers
+
+
+def fold_scaler(data: Dict) -> Tuple[np.ndarray, float]:
+    """
+    StandardScalerを係数と切片に畳み込む関数
+
+    intercept + Σ c_k (f_k - m_k) / s_k = (intercept - Σ c_k m_k / s_k) + Σ (c_k / s_k) f_k
+
+    Args:
+        data (Dict): load_model()の戻り値
+
+    Returns:
+        Tuple[np.ndarray, float]: 生の単項式に対する係数 (sklearn順) と畳み込み済み切片
+    """
+    model = data['model']
+    scaler = data['scaler']
+    weights = model.coef_ / scaler.scale_
+    intercept = model.intercept_ - np.sum(model.coef_ * scaler.mean_ / scaler.scale_)
+    return weights, float(intercept)
+
+
+def coefficient_matrix(data: Dict) -> Tuple[np.ndarray, float]:
+    """
+    畳み込み済み係数を A[i, j] (under_y^i * theta^j) の行列に並べ替える関数
+
+    Args:
+        data (Dict): load_model()の戻り値
+
+    Returns:
+        Tuple[np.ndarray, float]: (degree+1)x(degree+1)の係数行列と切片
+    """
+    degree = data['degree']
+    weights, intercept = fold_scaler(data)
+    matrix = np.zeros((degree + 1, degree + 1))
+    for k, (i, j) in enumerate(monomial_powers(degree)):
+        matrix[i, j] += weights[k]
+    return matrix, intercept
+
+
+def horner_order(degree: int) -> List[Tuple[int, int]]:
+    """
+    ネストしたHorner評価で読み出す順序 (外側under_y降順, 内側theta降順) を返す関数
+
+    Args:
+        degree (int): 多項式の次数
+
+    Returns:
+        List[Tuple[int, int]]: (under_yの指数, thetaの指数) のリスト
+    """
+    return [(i, j) for i in range(degree, -1, -1) for j in range(degree - i, -1, -1)]
+
+
+def evaluate_horner(matrix: np.ndarray, intercept: float, under_y: float, theta: float) -> float:
+    """
+    C++版と同じ順序でHorner評価を行う参照実装
+
+    Args:
+        matrix (np.ndarray): coefficient_matrix()の係数行列
+        intercept (float): 畳み込み済み切片
+        under_y (float): 入力 under_y
+        theta (float): 入力 theta
+
+    Returns:
+        float: 予測距離
+    """
+    degree = matrix.shape[0] - 1
+    acc = 0.0
+    for i in range(degree, -1, -1):
+        q = 0.0
+        for j in range(degree - i, -1, -1):
+            q = q * theta + matrix[i, j]
+        acc = acc * under_y + q
+    return acc + intercept
+
+
+def max_deviation_from_sklearn(data: Dict, matrix: np.ndarray, intercept: float) -> float:
+    """
+    畳み込み後のHorner評価とscikit-learnの予測の最大差を学習領域の格子上で求める関数
+
+    Args:
+        data (Dict): load_model()の戻り値
+        matrix (np.ndarray): coefficient_matrix()の係数行列
+        intercept (float): 畳み込み済み切片
+
+    Returns:
+        float: 最大絶対差
+    """
+    from sklearn.preprocessing import PolynomialFeatures
+
+    grid = np.array([(u, t) for u in np.linspace(0.0, 120.0, 13) for t in np.linspace(-45.0, 55.0, 11)])
+    poly = PolynomialFeatures(degree=data['degree'])
+    reference = data['model'].predict(data['scaler'].transform(poly.fit_transform(grid)))
+    folded = np.array([evaluate_horner(matrix, intercept, u, t) for u, t in grid])
+    return float(np.max(np.abs(folded - reference)))
+
+
+def float_literal(value: float) -> str:
+    """
+    単精度のC++リテラル (例: 93.0f, -1.5e-07f) に変換する関数
+    """
+    text = '{:.9g}'.format(value)
+    if '.' not in text and 'e' not in text:
+        text += '.0'
+    return text + 'f'
+
+
+def format_array(values: List[float], per_line: int = 4, fmt='{:24.16e}') -> str:
+    """
+    C++配列初期化子の本体を整形する関数 (fmtは書式文字列または変換関数)
+    """
+    convert = fmt if callable(fmt) else fmt.format
+    lines = []
+    for start in range(0, len(values), per_line):
+        chunk = values[start:start + per_line]
+        lines.append('    ' + ', '.join(convert(v) for v in chunk))
+    return ',\n'.join(lines)
+
+
+def source_label(data: Dict) -> str:
+    return os.path.relpath(data['path']).replace(os.sep, '/')
+
+
+def write_horner_header(data: Dict, out_dir: str) -> str:
+    """
+    畳み込み済みHorner係数表 teensy_horner_model.h を生成する関数
+
+    Args:
+        data (Dict): load_model()の戻り値
+        out_dir (str): 出力先ディレクトリ
+
+    Returns:
+        str: 生成したファイルのパス
+    """
+    degree = data['degree']
+    matrix, intercept = coefficient_matrix(data)
+    order = horner_order(degree)
+
+    rows = []
+    for i in range(degree, -1, -1):
+        row = [matrix[i, j] for j in range(degree - i, -1, -1)]
+        rows.append('    // under_y^{} : theta^{}..0\n{}'.format(i, degree - i, format_array(row)))
+    body = ',\n'.join(rows)
+
+    text = f"""/*
+ * Teensy 4.1 多項式回帰モデル ({degree}次) - Horner評価用係数
+ * 自動生成元: {source_label(data)}
+ * 生成日時: {datetime.now().strftime('%Y-%m-%d %H:%M:%S')}
+ * 生成スクリプト: export_teensy_model.py horner
+ *
+ * StandardScalerを係数に畳み込み済み:
+ *   distance = HORNER_INTERCEPT + Σ (coef_k / scale_k) * under_y^i * theta^j
+ * 係数は評価順 (外側under_y^{degree}→^0, 内側theta降順) に格納
+ */
+
+#ifndef TEENSY_HORNER_MODEL_H
+#define TEENSY_HORNER_MODEL_H
+
+#include "teensy_polynomial_model.h"
+
+const int HORNER_TERM_COUNT = {len(order)};
+
+// 畳み込み済み切片: intercept - Σ coef_k * mean_k / scale_k
+const double HORNER_INTERCEPT = {intercept!r};
+
+// 畳み込み済み係数 coef_k / scale_k (倍精度でFlashメモリに格納)
+const double HORNER_COEFFICIENTS[HORNER_TERM_COUNT] PROGMEM = {{
+{body}
+}};
+
+// Horner法による予測関数 (特徴量バッファ・除算なし)
+float predict_distance_horner(float under_y, float theta);
+double evaluate_horner_double(double under_y, double theta);
+
+#endif // TEENSY_HORNER_MODEL_H
+"""
+    path = os.path.join(out_dir, 'teensy_horner_model.h')
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(text)
+    return path
+
+
+def recentered_fractions(matrix: np.ndarray, intercept: float, under_y_range: Tuple[float, float],
+                         theta_range: Tuple[float, float]) -> List[List[Fraction]]:
+    """
+    係数行列を正規化変数 x = (under_y - c_u) / h_u, y = (theta - c_t) / h_t の係数に変換する関数
+
+    領域 [under_y_range] x [theta_range] が [-1, 1]^2 に写るように中心・半幅を取る。
+    二項展開の桁落ちを避けるため有理数で厳密に計算する。
+    切片は定数項 (x^0 * y^0) に含める。
+
+    Args:
+        matrix (np.ndarray): coefficient_matrix()の係数行列
+        intercept (float): 畳み込み済み切片
+        under_y_range (Tuple[float, float]): 正規化する under_y の範囲
+        theta_range (Tuple[float, float]): 正規化する theta の範囲
+
+    Returns:
+        List[List[Fraction]]: 正規化変数に対する係数 B[i][j] (x^i * y^j, 有理数)
+    """
+    degree = matrix.shape[0] - 1
+    center_u = Fraction(under_y_range[0] + under_y_range[1]) / 2
+    half_u = Fraction(under_y_range[1] - under_y_range[0]) / 2
+    center_t = Fraction(theta_range[0] + theta_range[1]) / 2
+    half_t = Fraction(theta_range[1] - theta_range[0]) / 2
+
+    result = [[Fraction(0)] * (degree + 1) for _ in range(degree + 1)]
+    result[0][0] = Fraction(intercept)
+    for i in range(degree + 1):
+        for j in range(degree + 1 - i):
+            a = Fraction(matrix[i, j])
+            if a == 0:
+                continue
+            # (c_u + h_u x)^i (c_t + h_t y)^j を展開
+            for p in range(i + 1):
+                a_p = a * comb(i, p) * center_u ** (i - p) * half_u ** p
+                for q in range(j + 1):
+                    result[p][q] += a_p * comb(j, q) * center_t ** (j - q) * half_t ** q
+    return result
+
+
+def recentered_matrix(matrix: np.ndarray, intercept: float, under_y_range: Tuple[float, float],
+                      theta_range: Tuple[float, float]) -> np.ndarray:
+    """
+    recentered_fractions()の結果を倍精度の係数行列 B[i, j] (x^i * y^j) に丸める関数
+    """
+    exact = recentered_fractions(matrix, intercept, under_y_range, theta_range)
+    return np.array([[float(v) for v in row] for row in exact])
+
+
+def power_to_chebyshev(degree: int) -> List[List[Fraction]]:
+    """
+    単項式 x^n をチェビシェフ多項式 T_k(x) で表す係数表 M[n][k] を返す関数
+
+    x * T_0 = T_1, x * T_k = (T_(k+1) + T_(k-1)) / 2 を繰り返し適用する。
+
+    Args:
+        degree (int): 最大次数
+
+    Returns:
+        List[List[Fraction]]: x^n = Σ_k M[n][k] T_k(x)
+    """
+    table = [[Fraction(0)] * (degree + 1) for _ in range(degree + 1)]
+    table[0][0] = Fraction(1)
+    for n in range(degree):
+        for k, value in enumerate(table[n]):
+            if value == 0:
+                continue
+            if k == 0:
+                table[n + 1][1] += value
+            else:
+                table[n + 1][k + 1] += value / 2
+                table[n + 1][k - 1] += value / 2
+    return table
+
+
+def chebyshev_matrix(matrix: np.ndarray, intercept: float, under_y_range: Tuple[float, float],
+                     theta_range: Tuple[float, float]) -> np.ndarray:
+    """
+    係数行列を正規化変数上のチェビシェフテンソル基底 T_i(x) * T_j(y) の係数に変換する関数
+
+    x^p y^q は次数 p 以下・q 以下のチェビシェフ多項式の積で表せるため、
+    i + j <= degree の三角形の形 (項数 171) は保たれる。
+
+    Args:
+        matrix (np.ndarray): coefficient_matrix()の係数行列
+        intercept (float): 畳み込み済み切片
+        under_y_range (Tuple[float, float]): [-1, 1] に正規化する under_y の範囲
+        theta_range (Tuple[float, float]): [-1, 1] に正規化する theta の範囲
+
+    Returns:
+        np.ndarray: チェビシェフ係数行列 C[i, j] (T_i(x) * T_j(y))
+    """
+    degree = matrix.shape[0] - 1
+    power = recentered_fractions(matrix, intercept, under_y_range, theta_range)
+    table = power_to_chebyshev(degree)
+    result = [[Fraction(0)] * (degree + 1) for _ in range(degree + 1)]
+    for p in range(degree + 1):
+        for q in range(degree + 1 - p):
+            b = power[p][q]
+            if b == 0:
+                continue
+            for i in range(p + 1):
+                if table[p][i] == 0:
+                    continue
+                b_i = b * table[p][i]
+                for j in range(q + 1):
+                    if table[q][j] != 0:
+                        result[i][j] += b_i * table[q][j]
+    return np.array([[float(v) for v in row] for row in result])
+
+
+def float32_horner_deviation(recentered: np.ndarray, matrix: np.ndarray, intercept: float,
+                             under_y_range: Tuple[float, float], theta_range: Tuple[float, float]) -> Tuple[float, float]:
+    """
+    正規化変数での単精度Horner評価と倍精度参照の差を格子上で見積もる関数 (numpyのfloat32で模擬)
+
+    Returns:
+        Tuple[float, float]: 最大絶対差と平均絶対差
+    """
+    from numpy.polynomial import polynomial as P
+
+    degree = matrix.shape[0] - 1
+    under_y = np.linspace(under_y_range[0], under_y_range[1], 241).astype(np.float32)
+    theta = np.linspace(theta_range[0], theta_range[1], 211).astype(np.float32)
+    reference = P.polygrid2d(under_y.astype(np.float64), theta.astype(np.float64), matrix) + intercept
+
+    f32 = np.float32
+    center_u = f32((under_y_range[0] + under_y_range[1]) / 2)
+    inv_half_u = f32(2.0 / (under_y_range[1] - under_y_range[0]))
+    center_t = f32((theta_range[0] + theta_range[1]) / 2)
+    inv_half_t = f32(2.0 / (theta_range[1] - theta_range[0]))
+    x = ((under_y - center_u) * inv_half_u)[:, None]
+    y = ((theta - center_t) * inv_half_t)[None, :]
+    coefficients = recentered.astype(np.float32)
+    acc = np.zeros((len(under_y), len(theta)), dtype=np.float32)
+    for i in range(degree, -1, -1):
+        q = np.full_like(acc, coefficients[i, degree - i])
+        for j in range(degree - i - 1, -1, -1):
+            q = q * y + coefficients[i, j]
+        acc = acc * x + q
+    error = np.abs(acc.astype(np.float64) - reference)
+    return float(error.max()), float(error.mean())
+
+
+def write_precision_header(data: Dict, out_dir: str, under_y_range: Tuple[float, float],
+                           theta_range: Tuple[float, float]) -> Tuple[str, float, float]:
+    """
+    単精度・混合精度Horner用の正規化係数表 teensy_precision_model.h を生成する関数
+
+    Args:
+        data (Dict): load_model()の戻り値
+        out_dir (str): 出力先ディレクトリ
+        under_y_range (Tuple[float, float]): [-1, 1] に正規化する under_y の範囲
+        theta_range (Tuple[float, float]): [-1, 1] に正規化する theta の範囲
+
+    Returns:
+        Tuple[str, float, float]: 生成したファイルのパスと単精度評価の最大・平均差 (見積もり)
+    """
+    degree = data['degree']
+    matrix, intercept = coefficient_matrix(data)
+    recentered = recentered_matrix(matrix, intercept, under_y_range, theta_range)
+    max_error, mean_error = float32_horner_deviation(recentered, matrix, intercept, under_y_range, theta_range)
+
+    def rows_text(fmt) -> str:
+        rows = []
+        for i in range(degree, -1, -1):
+            row = [recentered[i, j] for j in range(degree - i, -1, -1)]
+            rows.append('    // x^{} : y^{}..0\n{}'.format(i, degree - i, format_array(row, fmt=fmt)))
+        return ',\n'.join(rows)
+
+    center_u = (under_y_range[0] + under_y_range[1]) / 2
+    center_t = (theta_range[0] + theta_range[1]) / 2
+    inv_half_u = 2.0 / (under_y_range[1] - under_y_range[0])
+    inv_half_t = 2.0 / (theta_range[1] - theta_range[0])
+
+    text = f"""/*
+ * Teensy 4.1 多項式回帰モデル ({degree}次) - 単精度・混合精度Horner評価用係数
+ * 自動生成元: {source_label(data)}
+ * 生成日時: {datetime.now().strftime('%Y-%m-%d %H:%M:%S')}
+ * 生成スクリプト: export_teensy_model.py precision
+ *
+ * 正規化変数 x = (under_y - {center_u:g}) / {1 / inv_half_u:g}, y = (theta - {center_t:g}) / {1 / inv_half_t:g}
+ * (under_y {under_y_range[0]:g}..{under_y_range[1]:g}, theta {theta_range[0]:g}..{theta_range[1]:g} が [-1, 1]^2 に写る) に対する係数:
+ *   distance = Σ b_ij * x^i * y^j (切片は b_00 に含む)
+ * 係数は評価順 (外側x^{degree}→^0, 内側y降順) に格納
+ * 単精度評価の倍精度参照との差 (生成時の見積もり): 最大 {max_error:.3e}, 平均 {mean_error:.3e}
+ */
+
+#ifndef TEENSY_PRECISION_MODEL_H
+#define TEENSY_PRECISION_MODEL_H
+
+#include <stddef.h>
+#include "teensy_horner_model.h"
+
+// 正規化の中心と半幅の逆数
+const double PRECISION_UNDER_Y_CENTER = {center_u!r};
+const double PRECISION_UNDER_Y_INV_HALF_WIDTH = {inv_half_u!r};
+const double PRECISION_THETA_CENTER = {center_t!r};
+const double PRECISION_THETA_INV_HALF_WIDTH = {inv_half_t!r};
+
+// 正規化係数 b_ij (単精度, 単精度・混合精度モード用)
+const float PRECISION_COEFFICIENTS_F[HORNER_TERM_COUNT] PROGMEM = {{
+{rows_text(float_literal)}
+}};
+
+// 正規化係数 b_ij (倍精度, 混合精度モードで倍精度評価する行用)
+const double PRECISION_COEFFICIENTS[HORNER_TERM_COUNT] PROGMEM = {{
+{rows_text('{:24.16e}')}
+}};
+
+// 混合精度モードで倍精度評価する行数 (x^0..x^(n-1) の行, 0なら内側はすべて単精度)
+// 既定値は precision_report の実測で決めた: 倍精度行を1..8行に増やしても最悪誤差は
+// 0行 (3.3e-2) から下がらず (2行で 4.0e-2)、はっきり改善するのは9行以上 (倍精度演算137以上) から。
+// build/precision_report --tolerance で許容誤差を満たす最小値を確認できる
+#ifndef MIXED_DOUBLE_ROWS
+#define MIXED_DOUBLE_ROWS 0
+#endif
+
+// 単精度・混合精度の予測関数 (入力検証付き)
+float predict_distance_horner_float(float under_y, float theta);
+float predict_distance_horner_mixed(float under_y, float theta);
+
+// 入力検証なしの評価関数 (precision_reportが直接呼び出す)
+float evaluate_horner_float(float under_y, float theta);
+double evaluate_horner_mixed(float under_y, float theta, int double_rows);
+
+// USE_DOUBLE_PRECISION / USE_MIXED_PRECISION / USE_HORNER で選択した精度モードの予測関数
+// (スケッチ・シリアルプロトコル・サンプルパイプラインの予測はすべてここを通る)
+float predict_distance_selected(float under_y, float theta);
+void predict_distance_selected_batch(const float* under_y, const float* theta, float* out, size_t n);
+const char* selected_precision_name();
+
+#endif // TEENSY_PRECISION_MODEL_H
+"""
+    path = os.path.join(out_dir, 'teensy_precision_model.h')
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(text)
+    return path, max_error, mean_error
+
+
+def lut_axis(lower: float, upper: float, step: float) -> Tuple[float, int]:
+    """
+    補間表の1軸分の標本位置を決める関数
+
+    [lower, upper] を覆う等間隔標本に、双3次補間の4点ステンシル用として
+    前に1点・後ろに1点の余白を加える。
+
+    Returns:
+        Tuple[float, int]: 表の有効範囲の上端 (lower + m * step) と余白込みの標本数
+    """
+    cells = int(np.ceil((upper - lower) / step - 1e-9))
+    return lower + cells * step, cells + 3
+
+
+def write_lut_header(data: Dict, out_dir: str, under_y_range: Tuple[float, float],
+                     theta_range: Tuple[float, float], step: Tuple[float, float]) -> str:
+    """
+    モデルを格子上で標本化した補間表 teensy_lut_model.h を生成する関数
+
+    Args:
+        data (Dict): load_model()の戻り値
+        out_dir (str): 出力先ディレクトリ
+        under_y_range (Tuple[float, float]): 表がカバーする under_y の範囲
+        theta_range (Tuple[float, float]): 表がカバーする theta の範囲
+        step (Tuple[float, float]): (under_y, theta) の標本間隔
+
+    Returns:
+        str: 生成したファイルのパス
+    """
+    from numpy.polynomial import polynomial as P
+
+    matrix, intercept = coefficient_matrix(data)
+    under_y_max, under_y_count = lut_axis(under_y_range[0], under_y_range[1], step[0])
+    theta_max, theta_count = lut_axis(theta_range[0], theta_range[1], step[1])
+    under_y_samples = under_y_range[0] + (np.arange(under_y_count) - 1) * step[0]
+    theta_samples = theta_range[0] + (np.arange(theta_count) - 1) * step[1]
+    table = P.polygrid2d(under_y_samples, theta_samples, matrix) + intercept
+
+    rows = []
+    for i, under_y in enumerate(under_y_samples):
+        rows.append('    // under_y = {:g}\n{}'.format(under_y, format_array(list(table[i]), per_line=8, fmt=float_literal)))
+    body = ',\n'.join(rows)
+
+    text = f"""/*
+ * Teensy 4.1 多項式回帰モデル ({data['degree']}次) - 補間用ルックアップテーブル
+ * 自動生成元: {source_label(data)}
+ * 生成日時: {datetime.now().strftime('%Y-%m-%d %H:%M:%S')}
+ * 生成スクリプト: export_teensy_model.py lut
+ *
+ * 有効範囲: under_y {under_y_range[0]:g}..{under_y_max:g} (間隔 {step[0]:g}), theta {theta_range[0]:g}..{theta_max:g} (間隔 {step[1]:g})
+ * 双3次補間の4点ステンシル用に各軸の前後へ1標本ずつ余白を含む
+ * 表サイズ: {under_y_count} x {theta_count} (float, {under_y_count * theta_count * 4} バイト)
+ */
+
+#ifndef TEENSY_LUT_MODEL_H
+#define TEENSY_LUT_MODEL_H
+
+#include "teensy_horner_model.h"
+
+// 表の有効範囲 (この外側はHorner法で厳密に評価)
+const float LUT_UNDER_Y_MIN = {float_literal(under_y_range[0])};
+const float LUT_UNDER_Y_MAX = {float_literal(under_y_max)};
+const float LUT_UNDER_Y_INV_STEP = {float_literal(1.0 / step[0])};
+const float LUT_THETA_MIN = {float_literal(theta_range[0])};
+const float LUT_THETA_MAX = {float_literal(theta_max)};
+const float LUT_THETA_INV_STEP = {float_literal(1.0 / step[1])};
+
+// 余白込みの標本数
+const int LUT_UNDER_Y_COUNT = {under_y_count};
+const int LUT_THETA_COUNT = {theta_count};
+
+// 標本値 [under_y][theta] (単精度でFlashメモリに格納)
+const float LUT_VALUES[LUT_UNDER_Y_COUNT * LUT_THETA_COUNT] PROGMEM = {{
+{body}
+}};
+
+// 補間による高速予測関数 (表の範囲外はHorner法にフォールバック)
+float predict_distance_lut_bilinear(float under_y, float theta);
+float predict_distance_lut_bicubic(float under_y, float theta);
+
+#endif // TEENSY_LUT_MODEL_H
+"""
+    path = os.path.join(out_dir, 'teensy_lut_model.h')
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(text)
+    return path
+
+
+def write_chebyshev_header(data: Dict, out_dir: str, under_y_range: Tuple[float, float],
+                           theta_range: Tuple[float, float]) -> Tuple[str, float, float]:
+    """
+    チェビシェフテンソル基底の係数表 teensy_chebyshev_model.h を生成する関数
+
+    Args:
+        data (Dict): load_model()の戻り値
+        out_dir (str): 出力先ディレクトリ
+        under_y_range (Tuple[float, float]): [-1, 1] に正規化する under_y の範囲
+        theta_range (Tuple[float, float]): [-1, 1] に正規化する theta の範囲
+
+    Returns:
+        Tuple[str, float, float]: 生成したファイルのパス、係数の最大絶対値と絶対値の総和
+    """
+    degree = data['degree']
+    matrix, intercept = coefficient_matrix(data)
+    chebyshev = chebyshev_matrix(matrix, intercept, under_y_range, theta_range)
+    power = recentered_matrix(matrix, intercept, under_y_range, theta_range)
+
+    def rows_text(fmt) -> str:
+        rows = []
+        for i in range(degree, -1, -1):
+            row = [chebyshev[i, j] for j in range(degree - i, -1, -1)]
+            rows.append('    // T_{}(x) : T_{}..0(y)\n{}'.format(i, degree - i, format_array(row, fmt=fmt)))
+        return ',\n'.join(rows)
+
+    center_u = (under_y_range[0] + under_y_range[1]) / 2
+    center_t = (theta_range[0] + theta_range[1]) / 2
+    inv_half_u = 2.0 / (under_y_range[1] - under_y_range[0])
+    inv_half_t = 2.0 / (theta_range[1] - theta_range[0])
+    max_coefficient = float(np.abs(chebyshev).max())
+    sum_coefficient = float(np.abs(chebyshev).sum())
+
+    text = f"""/*
+ * Teensy 4.1 多項式回帰モデル ({degree}次) - チェビシェフ基底 (Clenshaw評価) 用係数
+ * 自動生成元: {source_label(data)}
+ * 生成日時: {datetime.now().strftime('%Y-%m-%d %H:%M:%S')}
+ * 生成スクリプト: export_teensy_model.py chebyshev
+ *
+ * 正規化変数 x = (under_y - {center_u:g}) / {1 / inv_half_u:g}, y = (theta - {center_t:g}) / {1 / inv_half_t:g}
+ * (under_y {under_y_range[0]:g}..{under_y_range[1]:g}, theta {theta_range[0]:g}..{theta_range[1]:g} が [-1, 1]^2 に写る) 上のテンソル基底:
+ *   distance = Σ c_ij * T_i(x) * T_j(y)  (i + j <= {degree}, 切片は c_00 に含む)
+ * 係数の大きさ: 最大 {max_coefficient:.3e}, 絶対値の総和 {sum_coefficient:.3e}
+ *   (単項式基底では最大 {np.abs(power).max():.3e}, 総和 {np.abs(power).sum():.3e})
+ * 係数は評価順 (外側T_{degree}(x)→T_0(x), 内側T_j(y)降順) に格納
+ */
+
+#ifndef TEENSY_CHEBYSHEV_MODEL_H
+#define TEENSY_CHEBYSHEV_MODEL_H
+
+#include "teensy_horner_model.h"
+
+// 正規化の中心と半幅の逆数
+const double CHEBYSHEV_UNDER_Y_CENTER = {center_u!r};
+const double CHEBYSHEV_UNDER_Y_INV_HALF_WIDTH = {inv_half_u!r};
+const double CHEBYSHEV_THETA_CENTER = {center_t!r};
+const double CHEBYSHEV_THETA_INV_HALF_WIDTH = {inv_half_t!r};
+
+// チェビシェフ係数 c_ij (単精度)
+const float CHEBYSHEV_COEFFICIENTS_F[HORNER_TERM_COUNT] PROGMEM = {{
+{rows_text(float_literal)}
+}};
+
+// チェビシェフ係数 c_ij (倍精度)
+const double CHEBYSHEV_COEFFICIENTS[HORNER_TERM_COUNT] PROGMEM = {{
+{rows_text('{:24.16e}')}
+}};
+
+// Clenshaw漸化式による予測関数 (入力検証付き)
+float predict_distance_chebyshev(float under_y, float theta);
+float predict_distance_chebyshev_double(float under_y, float theta);
+
+// 入力検証なしの評価関数
+float evaluate_chebyshev_float(float under_y, float theta);
+double evaluate_chebyshev_double(double under_y, double theta);
+
+#endif // TEENSY_CHEBYSHEV_MODEL_H
+"""
+    path = os.path.join(out_dir, 'teensy_chebyshev_model.h')
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(text)
+    return path, max_coefficient, sum_coefficient
+
+
+def write_template_header(data: Dict, out_dir: str, name: str) -> str:
+    """
+    PolynomialModel<Degree> 用の係数表 teensy_model_<name>.h を生成する関数
+
+    係数は並べ替えずにscikit-learnの順序のまま出力する (評価順への展開はテンプレート側で行う)
+
+    Args:
+        data (Dict): load_model()の戻り値
+        out_dir (str): 出力先ディレクトリ
+        name (str): モデル名 (ファイル名と識別子に使用)
+
+    Returns:
+        str: 生成したファイルのパス
+    """
+    degree = data['degree']
+    weights, intercept = fold_scaler(data)
+    identifier = 'MODEL_' + name.upper()
+
+    rows = []
+    offset = 0
+    for total in range(degree + 1):
+        row = list(weights[offset:offset + total + 1])
+        rows.append('    // 次数 {}: under_y^{}..^0 * theta^0..^{}\n{}'.format(total, total, total, format_array(row)))
+        offset += total + 1
+    body = ',\n'.join(rows)
+
+    text = f"""/*
+ * Teensy 4.1 多項式回帰モデル ({degree}次) - PolynomialModel<{degree}> 用係数
+ * 自動生成元: {source_label(data)}
+ * 生成日時: {datetime.now().strftime('%Y-%m-%d %H:%M:%S')}
+ * 生成スクリプト: export_teensy_model.py template --name {name}
+ * 検証MAE: {data.get('val_mae', float('nan')):.4f}
+ *
+ * StandardScalerを係数に畳み込み済み、PolynomialFeaturesの順序のまま格納
+ */
+
+#ifndef TEENSY_MODEL_{name.upper()}_H
+#define TEENSY_MODEL_{name.upper()}_H
+
+#include "teensy_polynomial_template.h"
+
+// 畳み込み済み切片: intercept - Σ coef_k * mean_k / scale_k
+constexpr double {identifier}_INTERCEPT = {intercept!r};
+
+// 畳み込み済み係数 coef_k / scale_k (倍精度でFlashメモリに格納)
+constexpr double {identifier}_COEFFICIENTS[PolynomialModel<{degree}>::TERM_COUNT] PROGMEM = {{
+{body}
+}};
+
+constexpr PolynomialModel<{degree}> {identifier}({identifier}_COEFFICIENTS, {identifier}_INTERCEPT);
+
+#endif // TEENSY_MODEL_{name.upper()}_H
+"""
+    path = os.path.join(out_dir, f'teensy_model_{name}.h')
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(text)
+    return path
+
+
+def write_gradient_header(data: Dict, out_dir: str) -> str:
+    """
+    predict_distance_gradient 用の勾配の重み表 teensy_gradient_weights.h を生成する関数
+
+    重みは teensy_polynomial_model.h の MODEL_COEFFICIENTS[k] / SCALER_SCALE[k]。
+    同ファイルは係数・尺度を有効数字13桁で格納しているため、同じ桁に丸めてから割る
+    (実機で割り算した値と一致する)
+
+    Args:
+        data (Dict): load_model()の戻り値
+        out_dir (str): 出力先ディレクトリ
+
+    Returns:
+        str: 生成したファイルのパス
+    """
+    degree = data['degree']
+    coefficients = [float(f'{value:.12e}') for value in data['model'].coef_]
+    scales = [float(f'{value:.12e}') for value in data['scaler'].scale_]
+    weights = [c / s for c, s in zip(coefficients, scales)]
+
+    rows = []
+    offset = 0
+    for total in range(degree + 1):
+        row = weights[offset:offset + total + 1]
+        rows.append('    // 次数 {}: under_y^{}..^0 * theta^0..^{}\n{}'.format(total, total, total, format_array(row)))
+        offset += total + 1
+    body = ',\n'.join(rows)
+
+    text = f"""/*
+ * Teensy 4.1 多項式回帰モデル ({degree}次) - 勾配の重み
+ * 自動生成元: {source_label(data)}
+ * 生成日時: {datetime.now().strftime('%Y-%m-%d %H:%M:%S')}
+ * 生成スクリプト: export_teensy_model.py gradient
+ *
+ * GRADIENT_WEIGHTS[k] = MODEL_COEFFICIENTS[k] / SCALER_SCALE[k] (特徴量 f_k の偏微分に掛ける値)
+ * PolynomialFeaturesの順序のまま格納
+ */
+
+#ifndef TEENSY_GRADIENT_WEIGHTS_H
+#define TEENSY_GRADIENT_WEIGHTS_H
+
+#include "teensy_polynomial_model.h"
+
+// 勾配の重み (倍精度でFlashメモリに格納)
+const double GRADIENT_WEIGHTS[FEATURE_COUNT] PROGMEM = {{
+{body}
+}};
+
+#endif // TEENSY_GRADIENT_WEIGHTS_H
+"""
+    path = os.path.join(out_dir, 'teensy_gradient_weights.h')
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(text)
+    return path
+
+
+def region_error_grid(data: Dict, under_y: np.ndarray, theta: np.ndarray, distance: np.ndarray,
+                      cells: Tuple[int, int], under_y_range: Tuple[float, float],
+                      theta_range: Tuple[float, float]) -> Tuple[np.ndarray, float, np.ndarray]:
+    """
+    入力領域をセルに分け、セルごとのモデルの平均絶対誤差を求める関数
+
+    点の少ないセルは全体のMAEへ寄せる: (Σ誤差 + P * 全体MAE) / (点数 + P), P = ENSEMBLE_ERROR_PRIOR_POINTS
+    セルの添字は ensemble_combine と同じく floor((値 - 下限) * セル数 / 幅) を範囲内に丸めたもの
+
+    Args:
+        data (Dict): load_model()の戻り値
+        under_y, theta, distance (np.ndarray): 検証データ
+        cells (Tuple[int, int]): under_y, theta 方向のセル数
+        under_y_range, theta_range (Tuple[float, float]): 誤差表がカバーする範囲
+
+    Returns:
+        Tuple[np.ndarray, float, np.ndarray]: セルごとのMAE (under_y, theta), 全体のMAE, セルごとの点数
+    """
+    from numpy.polynomial import polynomial as P
+
+    matrix, intercept = coefficient_matrix(data)
+    error = np.abs(P.polyval2d(under_y, theta, matrix) + intercept - distance)
+    overall = float(error.mean())
+
+    def cell_index(values, value_range, count):
+        index = np.floor((values - value_range[0]) * count / (value_range[1] - value_range[0])).astype(int)
+        return np.clip(index, 0, count - 1)
+
+    iu = cell_index(under_y, under_y_range, cells[0])
+    it = cell_index(theta, theta_range, cells[1])
+    sums = np.zeros(cells)
+    counts = np.zeros(cells, dtype=int)
+    np.add.at(sums, (iu, it), error)
+    np.add.at(counts, (iu, it), 1)
+    grid = (sums + ENSEMBLE_ERROR_PRIOR_POINTS * overall) / (counts + ENSEMBLE_ERROR_PRIOR_POINTS)
+    return grid, overall, counts
+
+
+def write_ensemble_errors_header(members: List[Tuple[str, Dict]], validation_path: str, out_dir: str,
+                                 cells: Tuple[int, int], under_y_range: Tuple[float, float],
+                                 theta_range: Tuple[float, float]) -> Tuple[str, Dict[str, Tuple[np.ndarray, float]]]:
+    """
+    複数モデルの選択・加重平均用の入力領域ごとの誤差表 teensy_ensemble_errors.h を生成する関数
+
+    誤差表は検証データのうち確認用に残す行 (ENSEMBLE_ERROR_HOLDOUT_STRIDE) を除いた行だけで求める。
+    残した行は ensemble_report / engine_regression が選択・加重平均の誤差を測るのに使う
+
+    Args:
+        members (List[Tuple[str, Dict]]): (モデル名, load_model()の戻り値) のリスト (DEFAULT_MEMBERS と同じ順序)
+        validation_path (str): 誤差を測る検証データCSV
+        out_dir (str): 出力先ディレクトリ
+        cells (Tuple[int, int]): under_y, theta 方向のセル数
+        under_y_range, theta_range (Tuple[float, float]): 誤差表がカバーする範囲
+
+    Returns:
+        Tuple[str, Dict]: 生成したファイルのパスと、モデル名ごとの (セルごとのMAE, 当てはめた行の全体のMAE)
+    """
+    under_y, theta, distance = load_points(validation_path)
+    fit = np.arange(len(distance)) % ENSEMBLE_ERROR_HOLDOUT_STRIDE != ENSEMBLE_ERROR_HOLDOUT_STRIDE - 1
+    under_y, theta, distance = under_y[fit], theta[fit], distance[fit]
+    held_out = int((~fit).sum())
+    report = {}
+    sections = []
+    for name, data in members:
+        grid, overall, counts = region_error_grid(data, under_y, theta, distance, cells, under_y_range, theta_range)
+        report[name] = (grid, overall)
+        identifier = name.upper()
+        rows = []
+        for a in range(cells[0]):
+            lower = under_y_range[0] + (under_y_range[1] - under_y_range[0]) * a / cells[0]
+            upper = under_y_range[0] + (under_y_range[1] - under_y_range[0]) * (a + 1) / cells[0]
+            rows.append('    // under_y {:g}..{:g} (点数 {})\n{}'.format(
+                round(lower, 2), round(upper, 2), ' '.join(str(c) for c in counts[a]),
+                format_array(list(grid[a]), per_line=cells[1], fmt='{:10.4f}f')))
+        rows_text = ',\n'.join(rows)
+        sections.append(f"""// {name}: {source_label(data)} (当てはめた行の全体のMAE {overall:.4f})
+const float ENSEMBLE_ERROR_MAE_{identifier}[ENSEMBLE_ERROR_CELLS_U * ENSEMBLE_ERROR_CELLS_T] PROGMEM = {{
+{rows_text}
+}};
+const EnsembleErrorGrid ENSEMBLE_ERROR_GRID_{identifier} = {{
+    ENSEMBLE_ERROR_CELLS_U, ENSEMBLE_ERROR_CELLS_T, {under_y_range[0]!r}f, {under_y_range[1]!r}f, {theta_range[0]!r}f, {theta_range[1]!r}f,
+    ENSEMBLE_ERROR_MAE_{identifier}
+}};""")
+    body = '\n\n'.join(sections)
+
+    text = f"""/*
+ * Teensy 4.1 多項式回帰モデル - 入力領域ごとの誤差表 (複数モデルの選択・加重平均用)
+ * 検証データ: {os.path.relpath(validation_path).replace(os.sep, '/')} ({len(distance) + held_out} 点のうち誤差表の当てはめに {len(distance)} 点)
+ * 生成日時: {datetime.now().strftime('%Y-%m-%d %H:%M:%S')}
+ * 生成スクリプト: export_teensy_model.py ensemble
+ *
+ * under_y {under_y_range[0]:g}..{under_y_range[1]:g} を {cells[0]} セル, theta {theta_range[0]:g}..{theta_range[1]:g} を {cells[1]} セルに分け、
+ * 各モデルのセル内の平均絶対誤差を格納する (行: under_y, 列: theta 昇順)。
+ * 点の少ないセルは全体のMAEへ寄せる: (Σ誤差 + {ENSEMBLE_ERROR_PRIOR_POINTS} * 全体MAE) / (点数 + {ENSEMBLE_ERROR_PRIOR_POINTS})
+ * 行番号 % {ENSEMBLE_ERROR_HOLDOUT_STRIDE} == {ENSEMBLE_ERROR_HOLDOUT_STRIDE - 1} の {held_out} 点は当てはめに使わず、選択・加重平均の誤差の確認用に残す
+ */
+
+#ifndef TEENSY_ENSEMBLE_ERRORS_H
+#define TEENSY_ENSEMBLE_ERRORS_H
+
+#include "teensy_ensemble_model.h"
+
+const int ENSEMBLE_ERROR_CELLS_U = {cells[0]};
+const int ENSEMBLE_ERROR_CELLS_T = {cells[1]};
+
+// 誤差表を当てはめた検証データのファイル名と、当てはめに使わず残した行の間隔
+const char* const ENSEMBLE_ERROR_SOURCE = "{os.path.basename(validation_path)}";
+const int ENSEMBLE_ERROR_HOLDOUT_STRIDE = {ENSEMBLE_ERROR_HOLDOUT_STRIDE};
+
+// ENSEMBLE_ERROR_SOURCE の行 (ヘッダを除き0から) が誤差表の当てはめに使われていないか
+inline bool ensemble_error_held_out(int row) {{
+    return row % ENSEMBLE_ERROR_HOLDOUT_STRIDE == ENSEMBLE_ERROR_HOLDOUT_STRIDE - 1;
+}}
+
+{body}
+
+#endif // TEENSY_ENSEMBLE_ERRORS_H
+"""
+    path = os.path.join(out_dir, 'teensy_ensemble_errors.h')
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(text)
+    return path, report
+
+
+def encode_model_blob(data: Dict) -> Tuple[bytes, int]:
+    """
+    バイナリモデル (.dpm) のバイト列を作る関数
+
+    係数はHorner評価順 (teensy_horner_model.h と同じ並び) の倍精度リトルエンディアンで、
+    ヘッダ直後の8バイト境界 (BLOB_HEADER_SIZE) から格納する
+
+    Args:
+        data (Dict): load_model()の戻り値 (model, scaler, degree があればよい)
+
+    Returns:
+        Tuple[bytes, int]: .dpm の内容とCRC32
+    """
+    degree = data['degree']
+    matrix, intercept = coefficient_matrix(data)
+    order = horner_order(degree)
+    coefficients = struct.pack(f'<{len(order)}d', *[matrix[i, j] for i, j in order])
+
+    header = struct.pack(BLOB_HEADER_FORMAT, BLOB_MAGIC, BLOB_VERSION, BLOB_HEADER_SIZE, degree,
+                         BLOB_BASIS_MONOMIAL_HORNER, len(order), BLOB_HEADER_SIZE, 0, intercept,
+                         *BLOB_INPUT_RANGE, data.get('val_mae', float('nan')), 0, 0)
+    crc = zlib.crc32(coefficients, zlib.crc32(header))
+    assert len(header) + 4 == BLOB_HEADER_SIZE
+    return header + struct.pack('<I', crc) + coefficients, crc
+
+
+def write_model_blob(data: Dict, out_dir: str, name: str) -> Tuple[str, int]:
+    """
+    バイナリモデルファイル <name>.dpm を生成する関数
+
+    Args:
+        data (Dict): load_model()の戻り値
+        out_dir (str): 出力先ディレクトリ
+        name (str): ファイル名 (拡張子なし)
+
+    Returns:
+        Tuple[str, int]: 生成したファイルのパスとCRC32
+    """
+    blob, crc = encode_model_blob(data)
+    path = os.path.join(out_dir, f'{name}.dpm')
+    with open(path, 'wb') as f:
+        f.write(blob)
+    return path, crc
+
+
+def load_points(csv_path: str) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+    """
+    under_y, theta, distance 列を持つCSVを読み込む関数
+
+    Args:
+        csv_path (str): CSVファイルのパス
+
+    Returns:
+        Tuple[np.ndarray, np.ndarray, np.ndarray]: under_y, theta, distance
+    """
+    df = pd.read_csv(csv_path)
+    return (df['under_y'].to_numpy(dtype=np.float64), df['theta'].to_numpy(dtype=np.float64),
+            df['distance'].to_numpy(dtype=np.float64))
+
+
+def local_design(x: np.ndarray, y: np.ndarray, degree: int) -> np.ndarray:
+    """
+    タイル内の正規化座標 (x, y) の単項式を Horner評価順 (horner_order) に並べた計画行列を返す関数
+
+    Args:
+        x (np.ndarray): タイル内で [-1, 1] に正規化した under_y
+        y (np.ndarray): タイル内で [-1, 1] に正規化した theta
+        degree (int): 多項式の次数
+
+    Returns:
+        np.ndarray: (点数, 項数) の行列
+    """
+    return np.stack([x ** i * y ** j for i, j in horner_order(degree)], axis=1)
+
+
+def fit_tile(under_y: np.ndarray, theta: np.ndarray, distance: np.ndarray, bounds: Tuple[float, float, float, float],
+             degree: int) -> Tuple[np.ndarray, float]:
+    """
+    1タイルの局所多項式を最小二乗法で当てはめる関数
+
+    境界での段差を抑えるためタイルを各方向に25%広げた範囲の点を使い、
+    点が項数の3倍に満たない場合 (データの外側のタイル) は十分な点が入るまで範囲を広げる
+
+    Args:
+        under_y (np.ndarray): 学習点の under_y
+        theta (np.ndarray): 学習点の theta
+        distance (np.ndarray): 学習点の距離
+        bounds (Tuple[float, float, float, float]): タイルの範囲 (under_y 下限, 上限, theta 下限, 上限)
+        degree (int): 多項式の次数
+
+    Returns:
+        Tuple[np.ndarray, float]: 正規化座標の係数 (Horner評価順) とタイル内の点での最大誤差
+    """
+    center_u = (bounds[0] + bounds[1]) / 2
+    center_t = (bounds[2] + bounds[3]) / 2
+    half_u = (bounds[1] - bounds[0]) / 2
+    half_t = (bounds[3] - bounds[2]) / 2
+    x = (under_y - center_u) / half_u
+    y = (theta - center_t) / half_t
+    terms = len(horner_order(degree))
+
+    window = 1.25
+    while True:
+        selected = (np.abs(x) <= window) & (np.abs(y) <= window)
+        if selected.sum() >= 3 * terms:
+            break
+        window *= 1.5
+    coefficients = np.linalg.lstsq(local_design(x[selected], y[selected], degree), distance[selected], rcond=None)[0]
+
+    inside = (np.abs(x) <= 1.0) & (np.abs(y) <= 1.0)
+    max_error = 0.0
+    if inside.any():
+        max_error = float(np.abs(local_design(x[inside], y[inside], degree) @ coefficients - distance[inside]).max())
+    return coefficients, max_error
+
+
+def fit_tiled_model(under_y: np.ndarray, theta: np.ndarray, distance: np.ndarray, cells: Tuple[int, int],
+                    degree: int, tolerance: float, max_level: int, under_y_range: Tuple[float, float],
+                    theta_range: Tuple[float, float]) -> Dict:
+    """
+    2段の均一分割による区分多項式モデルを当てはめる関数
+
+    領域を cells[0] × cells[1] のセルに分け、各セルを 2^k × 2^k のタイルに等分する (k = 0..max_level)。
+    k はセル内のすべてのタイルで学習点の最大誤差が tolerance 以下になる最小値 (実行時の探索はO(1))
+
+    Args:
+        under_y (np.ndarray): 学習点の under_y
+        theta (np.ndarray): 学習点の theta
+        distance (np.ndarray): 学習点の距離
+        cells (Tuple[int, int]): under_y, theta 方向のセル数
+        degree (int): タイルの多項式の次数
+        tolerance (float): タイル内の最大誤差の許容値 [cm]
+        max_level (int): セルの最大分割段数
+        under_y_range (Tuple[float, float]): 表の under_y の範囲
+        theta_range (Tuple[float, float]): 表の theta の範囲
+
+    Returns:
+        Dict: cells, degree, ranges, levels (セルごとの分割段数), offsets (セルの先頭タイル番号),
+              coefficients (タイル数 × 項数), max_error (学習点での最大誤差)
+    """
+    cell_u = (under_y_range[1] - under_y_range[0]) / cells[0]
+    cell_t = (theta_range[1] - theta_range[0]) / cells[1]
+    levels = []
+    offsets = []
+    coefficients = []
+    max_error = 0.0
+    for a in range(cells[0]):
+        for b in range(cells[1]):
+            for level in range(max_level + 1):
+                n = 2 ** level
+                tiles = []
+                cell_error = 0.0
+                for i in range(n):
+                    for j in range(n):
+                        bounds = (under_y_range[0] + (a + i / n) * cell_u, under_y_range[0] + (a + (i + 1) / n) * cell_u,
+                                  theta_range[0] + (b + j / n) * cell_t, theta_range[0] + (b + (j + 1) / n) * cell_t)
+                        tile, error = fit_tile(under_y, theta, distance, bounds, degree)
+                        tiles.append(tile)
+                        cell_error = max(cell_error, error)
+                if cell_error <= tolerance or level == max_level:
+                    break
+            levels.append(level)
+            offsets.append(len(coefficients))
+            coefficients.extend(tiles)
+            max_error = max(max_error, cell_error)
+    return {
+        'cells': cells, 'degree': degree, 'under_y_range': under_y_range, 'theta_range': theta_range,
+        'levels': levels, 'offsets': offsets, 'coefficients': np.array(coefficients), 'max_error': max_error
+    }
+
+
+def evaluate_tiled(model: Dict, under_y: np.ndarray, theta: np.ndarray) -> np.ndarray:
+    """
+    C++版と同じ手順 (セル → タイル → 正規化座標のHorner評価) で区分モデルを評価する参照実装 (倍精度)
+
+    Args:
+        model (Dict): fit_tiled_model()の戻り値
+        under_y (np.ndarray): 入力 under_y
+        theta (np.ndarray): 入力 theta
+
+    Returns:
+        np.ndarray: 予測距離
+    """
+    cells_u, cells_t = model['cells']
+    fu = (under_y - model['under_y_range'][0]) / (model['under_y_range'][1] - model['under_y_range'][0]) * cells_u
+    ft = (theta - model['theta_range'][0]) / (model['theta_range'][1] - model['theta_range'][0]) * cells_t
+    a = np.clip(np.floor(fu).astype(int), 0, cells_u - 1)
+    b = np.clip(np.floor(ft).astype(int), 0, cells_t - 1)
+    cell = a * cells_t + b
+    n = 2 ** np.array(model['levels'])[cell]
+    su = (fu - a) * n
+    st = (ft - b) * n
+    i = np.clip(np.floor(su).astype(int), 0, n - 1)
+    j = np.clip(np.floor(st).astype(int), 0, n - 1)
+    tile = np.array(model['offsets'])[cell] + i * n + j
+    x = 2.0 * (su - i) - 1.0
+    y = 2.0 * (st - j) - 1.0
+    return np.sum(local_design(x, y, model['degree']) * model['coefficients'][tile], axis=1)
+
+
+def write_tiled_header(model: Dict, data_path: str, out_dir: str, fit_mae: float,
+                       validation: Tuple[str, float]) -> str:
+    """
+    区分多項式モデルの係数表 teensy_tiled_model.h を生成する関数
+
+    Args:
+        model (Dict): fit_tiled_model()の戻り値
+        data_path (str): 学習に使ったCSVのパス
+        out_dir (str): 出力先ディレクトリ
+        fit_mae (float): 学習点での平均絶対誤差
+        validation (Tuple[str, float]): 検証CSVのパスとそのMAE
+
+    Returns:
+        str: 生成したファイルのパス
+    """
+    degree = model['degree']
+    cells_u, cells_t = model['cells']
+    coefficients = model['coefficients']
+    terms = coefficients.shape[1]
+    tile_rows = []
+    for tile, row in enumerate(coefficients):
+        tile_rows.append('    {{ // タイル {}\n{}\n    }}'.format(tile, format_array(list(row), fmt=float_literal)))
+    tile_text = ',\n'.join(tile_rows)
+    level_counts = np.bincount(model['levels'])
+    level_text = ', '.join(f'{2 ** k}x{2 ** k}: {count}' for k, count in enumerate(level_counts) if count > 0)
+
+    text = f"""/*
+ * Teensy 4.1 区分多項式モデル - タイルごとの{degree}次局所多項式
+ * 学習データ: {os.path.relpath(data_path).replace(os.sep, '/')}
+ * 生成日時: {datetime.now().strftime('%Y-%m-%d %H:%M:%S')}
+ * 生成スクリプト: export_teensy_model.py tiled
+ *
+ * under_y {model['under_y_range'][0]:g}..{model['under_y_range'][1]:g}, theta {model['theta_range'][0]:g}..{model['theta_range'][1]:g} を {cells_u} × {cells_t} のセルに分け、
+ * 各セルを 2^k × 2^k のタイルに等分する (セル数 {level_text}, 合計 {len(coefficients)} タイル)
+ * タイル内の正規化変数 x, y ∈ [-1, 1] に対する係数:
+ *   distance = Σ c_ij * x^i * y^j
+ * 係数は評価順 (外側x^{degree}→^0, 内側y降順) に格納
+ * 学習点での誤差: 平均 {fit_mae:.4f}, 最大 {model['max_error']:.4f}
+ * 検証MAE ({os.path.basename(validation[0])}): {validation[1]:.4f}
+ */
+
+#ifndef TEENSY_TILED_MODEL_H
+#define TEENSY_TILED_MODEL_H
+
+#include "teensy_horner_model.h"
+
+const int TILED_DEGREE = {degree};
+const int TILED_TERM_COUNT = {terms};
+const int TILED_CELLS_U = {cells_u};
+const int TILED_CELLS_T = {cells_t};
+const int TILED_TILE_COUNT = {len(coefficients)};
+
+// 表の範囲とセル幅の逆数
+const float TILED_UNDER_Y_MIN = {float_literal(model['under_y_range'][0])};
+const float TILED_UNDER_Y_MAX = {float_literal(model['under_y_range'][1])};
+const float TILED_THETA_MIN = {float_literal(model['theta_range'][0])};
+const float TILED_THETA_MAX = {float_literal(model['theta_range'][1])};
+const float TILED_UNDER_Y_INV_CELL = {float_literal(cells_u / (model['under_y_range'][1] - model['under_y_range'][0]))};
+const float TILED_THETA_INV_CELL = {float_literal(cells_t / (model['theta_range'][1] - model['theta_range'][0]))};
+
+// セル (a * TILED_CELLS_T + b) の分割段数 k と先頭タイル番号 (タイル番号 = 先頭 + i * 2^k + j)
+const uint8_t TILED_CELL_LEVEL[TILED_CELLS_U * TILED_CELLS_T] PROGMEM = {{
+{format_array(model['levels'], per_line=16, fmt='{:2d}')}
+}};
+const uint16_t TILED_CELL_OFFSET[TILED_CELLS_U * TILED_CELLS_T] PROGMEM = {{
+{format_array(model['offsets'], per_line=16, fmt='{:4d}')}
+}};
+
+// タイルごとの正規化係数 (単精度)
+const float TILED_COEFFICIENTS[TILED_TILE_COUNT][TILED_TERM_COUNT] PROGMEM = {{
+{tile_text}
+}};
+
+// 区分モデルによる予測関数 (入力検証付き, 表の範囲外はHorner法)
+float predict_distance_tiled(float under_y, float theta);
+
+// 入力検証なしの評価関数 (表の範囲外は端のタイルで外挿)
+float evaluate_tiled(float under_y, float theta);
+
+#endif // TEENSY_TILED_MODEL_H
+"""
+    path = os.path.join(out_dir, 'teensy_tiled_model.h')
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(text)
+    return path
+
+
+def sparse_design(x: np.ndarray, y: np.ndarray, terms: List[Tuple[int, int]]) -> np.ndarray:
+    """
+    正規化変数 (x, y) の単項式 x^i * y^j を terms の順に並べた計画行列を返す関数
+    """
+    return np.stack([x ** i * y ** j for i, j in terms], axis=1)
+
+
+def normalize_inputs(under_y: np.ndarray, theta: np.ndarray, under_y_range: Tuple[float, float],
+                     theta_range: Tuple[float, float]) -> Tuple[np.ndarray, np.ndarray]:
+    """
+    入力を recentered_fractions() と同じ正規化変数 x, y に変換する関数
+    """
+    center_u = (under_y_range[0] + under_y_range[1]) / 2
+    half_u = (under_y_range[1] - under_y_range[0]) / 2
+    center_t = (theta_range[0] + theta_range[1]) / 2
+    half_t = (theta_range[1] - theta_range[0]) / 2
+    return (under_y - center_u) / half_u, (theta - center_t) / half_t
+
+
+def prune_terms(design: np.ndarray, target: np.ndarray, terms: List[Tuple[int, int]], sizes: List[int],
+                coefficients: np.ndarray = None) -> Dict[int, Tuple[List[Tuple[int, int]], np.ndarray]]:
+    """
+    項を1つずつ削って指定した項数のスパースモデルを作る関数
+
+    coefficients を渡した場合 (再当てはめなし): 元の係数のまま、学習点での寄与 max|c_k * x^i * y^j| が
+    大きい順に項を残す。単項式基底では高次の項どうしが大きく打ち消し合うため、寄与の小さい項でも
+    削ると誤差が大きくなる (比較用)
+    coefficients が None の場合 (再当てはめ): 残った項で最小二乗法を解き直し、削ったときの二乗誤差の
+    増加 c_k^2 / [(X^T X)^-1]_kk が最小の項を削ることを繰り返す (後退ステップワイズ法)
+
+    Args:
+        design (np.ndarray): 学習点での全項の計画行列
+        target (np.ndarray): 学習点の目標値
+        terms (List[Tuple[int, int]]): 計画行列の列に対応する (x の指数, y の指数)
+        sizes (List[int]): 出力する項数
+        coefficients (np.ndarray): 再当てはめしない場合の元の係数 (正規化変数)
+
+    Returns:
+        Dict[int, Tuple[List[Tuple[int, int]], np.ndarray]]: 項数 → (残った項, 係数)
+    """
+    result = {}
+    if coefficients is not None:
+        order = np.argsort(-np.abs(design * coefficients).max(axis=0))
+        for size in sizes:
+            keep = sorted(order[:size], key=lambda k: terms[k])
+            result[size] = ([terms[k] for k in keep], coefficients[keep])
+        return result
+
+    active = list(range(len(terms)))
+    while True:
+        # QR分解で解く (正規方程式は条件数が2乗になるため使わない)
+        q, r = np.linalg.qr(design[:, active])
+        solution = np.linalg.solve(r, q.T @ target)
+        if len(active) in sizes:
+            keep = sorted(range(len(active)), key=lambda k: terms[active[k]])
+            result[len(active)] = ([terms[active[k]] for k in keep], solution[keep])
+        if len(active) <= min(sizes):
+            return result
+        inverse_r = np.linalg.inv(r)
+        increase = solution ** 2 / np.sum(inverse_r ** 2, axis=1)
+        active.pop(int(np.argmin(increase)))
+
+
+def power_chain(powers: List[int]) -> List[Tuple[int, int, int]]:
+    """
+    必要な指数のべき乗を求める乗算の列 (k = a + b) を返す関数
+
+    k を k//2 と k - k//2 に分けて再帰的に必要な指数を集めるため、使わない指数は計算しない
+
+    Args:
+        powers (List[int]): 必要な指数 (2以上)
+
+    Returns:
+        List[Tuple[int, int, int]]: 指数の小さい順の (k, a, b)
+    """
+    needed = set()
+
+    def require(k):
+        if k <= 1 or k in needed:
+            return
+        needed.add(k)
+        require(k // 2)
+        require(k - k // 2)
+
+    for k in powers:
+        require(k)
+    return [(k, k // 2, k - k // 2) for k in sorted(needed)]
+
+
+def sparse_evaluator_lines(terms: List[Tuple[int, int]], coefficients: np.ndarray) -> List[str]:
+    """
+    スパースモデルの評価関数の本体 (必要なべき乗だけを計算する直線的なコード) を生成する関数
+    x の指数ごとに y の多項式の行をまとめ、行ごとに x のべき乗を1回掛ける
+    """
+    def name(variable, k):
+        return variable if k == 1 else f'{variable}{k}'
+
+    lines = []
+    for variable, index in (('x', 0), ('y', 1)):
+        for k, a, b in power_chain([term[index] for term in terms]):
+            lines.append(f'    const double {name(variable, k)} = {name(variable, a)} * {name(variable, b)};')
+
+    rows = {}
+    for (i, j), c in zip(terms, coefficients):
+        rows.setdefault(i, []).append((j, c))
+    lines.append('    double acc = 0.0;')
+    for i in sorted(rows):
+        row = ''
+        for j, c in sorted(rows[i]):
+            literal = f'{abs(c):.17g}' if j == 0 else f'{abs(c):.17g} * {name("y", j)}'
+            if not row:
+                row = literal if c >= 0 else f'-{literal}'
+            else:
+                row += f' + {literal}' if c >= 0 else f' - {literal}'
+        if i == 0:
+            lines.append(f'    acc += {row};')
+        else:
+            lines.append(f'    acc += {name("x", i)} * ({row});')
+    lines.append('    return acc;')
+    return lines
+
+
+def write_sparse_header(models: Dict[int, Tuple[List[Tuple[int, int]], np.ndarray]], reports: Dict[int, Dict],
+                        degree: int, default_size: int, data_path: str, refit: bool, out_dir: str,
+                        under_y_range: Tuple[float, float], theta_range: Tuple[float, float]) -> str:
+    """
+    スパースモデル (項の一覧と生成した評価関数) の teensy_sparse_model.h を生成する関数
+
+    Args:
+        models (Dict): prune_terms()の戻り値
+        reports (Dict): 項数 → {'fit_mae', 'fit_max', 'validation_mae'}
+        degree (int): 枝刈り前の多項式の次数
+        default_size (int): predict_distance_sparse が使う項数
+        data_path (str): 学習データCSVのパス
+        refit (bool): 再当てはめしたか
+        out_dir (str): 出力先ディレクトリ
+        under_y_range (Tuple[float, float]): 正規化する under_y の範囲
+        theta_range (Tuple[float, float]): 正規化する theta の範囲
+
+    Returns:
+        str: 生成したファイルのパス
+    """
+    sizes = sorted(models, reverse=True)
+    full_terms = monomial_powers(degree)
+    center_u = (under_y_range[0] + under_y_range[1]) / 2
+    half_u = (under_y_range[1] - under_y_range[0]) / 2
+    center_t = (theta_range[0] + theta_range[1]) / 2
+    half_t = (theta_range[1] - theta_range[0]) / 2
+    method = '後退ステップワイズ法で再当てはめ' if refit else '17次モデルの係数のまま寄与の大きい項を残す (再当てはめなし)'
+
+    summary = []
+    blocks = []
+    for size in sizes:
+        terms, coefficients = models[size]
+        report = reports[size]
+        summary.append(f" *   {size:3d} 項 (最高次数 {max(i + j for i, j in terms):2d}): "
+                       f"学習点MAE {report['fit_mae']:.4f} (最大 {report['fit_max']:.3f}), "
+                       f"検証MAE {report['validation_mae']:.4f}")
+        entries = [f'{{{i:2d}, {j:2d}, {c:.17g}}}' for (i, j), c in zip(terms, coefficients)]
+        entry_text = format_array(entries, per_line=3, fmt=str)
+        evaluator = '\n'.join(sparse_evaluator_lines(terms, coefficients))
+        blocks.append(f"""// {size} 項: 学習点MAE {report['fit_mae']:.4f}, 検証MAE {report['validation_mae']:.4f}
+const SparseTerm SPARSE{size}_TERMS[{size}] PROGMEM = {{
+{entry_text}
+}};
+
+static TEENSY_INLINE double evaluate_sparse{size}(double x, double y) {{
+{evaluator}
+}}
+""")
+
+    registry = ',\n'.join(
+        f"    {{{size}, SPARSE{size}_TERMS, evaluate_sparse{size}, {reports[size]['fit_mae']:.6f}f, "
+        f"{reports[size]['validation_mae']:.6f}f}}" for size in sizes)
+    blocks_text = '\n'.join(blocks)
+    summary_text = '\n'.join(summary)
+    default_index = sizes.index(default_size)
+
+    text = f"""/*
+ * Teensy 4.1 多項式回帰モデル - スパース (枝刈り) 多項式
+ * 学習データ: {os.path.relpath(data_path).replace(os.sep, '/')}
+ * 生成日時: {datetime.now().strftime('%Y-%m-%d %H:%M:%S')}
+ * 生成スクリプト: export_teensy_model.py sparse
+ *
+ * 正規化変数 x = (under_y - {center_u:g}) / {half_u:g}, y = (theta - {center_t:g}) / {half_t:g} の{degree}次多項式 ({len(full_terms)}項) から
+ * 項を削ったモデル ({method}):
+{summary_text}
+ * 各モデルは (指数の組, 係数) の一覧と、使う項とべき乗だけを計算する生成済みの評価関数を持つ
+ */
+
+#ifndef TEENSY_SPARSE_MODEL_H
+#define TEENSY_SPARSE_MODEL_H
+
+#include "teensy_polynomial_model.h"
+
+const int SPARSE_DEGREE = {degree};  // 枝刈り前の次数 (指数の上限)
+const double SPARSE_UNDER_Y_CENTER = {center_u!r};
+const double SPARSE_UNDER_Y_INV_HALF = {1.0 / half_u!r};
+const double SPARSE_THETA_CENTER = {center_t!r};
+const double SPARSE_THETA_INV_HALF = {1.0 / half_t!r};
+
+// x^under_y_power * y^theta_power の係数
+struct SparseTerm {{
+    uint8_t under_y_power;
+    uint8_t theta_power;
+    double coefficient;
+}};
+
+struct SparseModel {{
+    int term_count;
+    const SparseTerm* terms;
+    double (*evaluate)(double x, double y);  // 生成済みの評価関数 (正規化変数)
+    float fit_mae;                           // 学習点での平均絶対誤差
+    float validation_mae;                    // 実測検証データでのMAE
+}};
+
+{blocks_text}
+const SparseModel SPARSE_MODELS[] = {{
+{registry}
+}};
+
+const int SPARSE_MODEL_COUNT = {len(sizes)};
+const int SPARSE_DEFAULT_MODEL = {default_index};  // predict_distance_sparse が使うモデル ({default_size} 項)
+
+// 既定のモデルによる予測関数 (入力検証付き)
+float predict_distance_sparse(float under_y, float theta);
+
+// 指定したモデルによる予測 (生成済みの評価関数 / 項の一覧をたどる汎用ループ)
+float predict_distance_sparse_model(const SparseModel& model, float under_y, float theta);
+float predict_distance_sparse_terms(const SparseModel& model, float under_y, float theta);
+
+#endif // TEENSY_SPARSE_MODEL_H
+"""
+    path = os.path.join(out_dir, 'teensy_sparse_model.h')
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(text)
+    return path
+
+
+# 固定小数点 (Q形式) 評価器の形式
+FIXED_INPUT_FRAC_BITS = 29   # 正規化入力 x, y (int32, |x|, |y| < 4)
+FIXED_IO_FRAC_BITS = 16      # 入出力 under_y, theta, distance (int32 Q16.16)
+FIXED_NORM_FRAC_BITS = 38    # 正規化の半幅の逆数 (int64, (入力 - 中心) との積が 2^58 未満)
+FIXED_VALUE_BITS = 62        # 各段の値の上限 |v| < 2^62 (int64 に1ビットの余裕)
+FIXED_MAX_FRAC_BITS = 60
+FIXED_MAX_SHIFT = 62         # シフト量の上限 (int64 の64ビット以上のシフトは未定義)
+
+
+def fixed_frac_bits(bound: float) -> int:
+    """
+    絶対値の上限 bound の値を |v| < 2^FIXED_VALUE_BITS で表せる最大の小数ビット数を返す関数
+    """
+    if bound <= 0.0:
+        return FIXED_MAX_FRAC_BITS
+    return min(FIXED_MAX_FRAC_BITS, FIXED_VALUE_BITS - int(np.ceil(np.log2(bound * 1.01))))
+
+
+def fixed_point_formats(exact: List[List[Fraction]], degree: int, x_max: float, y_max: float) -> Dict:
+    """
+    固定小数点Horner評価の段ごとの小数ビット数とシフト量を決める関数
+
+    各段の値の上限を区間演算 (|partial * z + c| <= B * z_max + |c|) で求めるため、
+    |x| <= x_max, |y| <= y_max の入力ではどの段も int64 であふれないことが保証される。
+    上限の小さい段ほど小数ビットを多く取り、後段へ伝わる丸め誤差を最終段の1ulp程度に揃える。
+
+    Args:
+        exact (List[List[Fraction]]): recentered_fractions()の正規化係数
+        degree (int): 次数
+        x_max (float): 入力範囲での |x| の最大値
+        y_max (float): 入力範囲での |y| の最大値
+
+    Returns:
+        Dict: 'inner' (行ごとの内側の段の小数ビット数, y降順), 'outer' (行ごとの外側の段の小数ビット数),
+              評価順 (外側x^degree→^0)
+    """
+    inner = []
+    outer = []
+    outer_bound = 0.0
+    for i in range(degree, -1, -1):
+        bounds = []
+        bound = 0.0
+        for j in range(degree - i, -1, -1):
+            bound = bound * y_max + abs(float(exact[i][j]))
+            bounds.append(bound)
+        inner.append([fixed_frac_bits(b) for b in bounds])
+        outer_bound = outer_bound * x_max + bounds[-1]
+        outer.append(fixed_frac_bits(outer_bound))
+
+    # シフト量を FIXED_MAX_SHIFT 以下に収めるため、後段より極端に細かい前段の小数ビットを減らす
+    for row in range(degree + 1):
+        inner[row][-1] = min(inner[row][-1], outer[row] + FIXED_MAX_SHIFT)
+        for k in range(len(inner[row]) - 2, -1, -1):
+            inner[row][k] = min(inner[row][k], inner[row][k + 1] + FIXED_MAX_SHIFT - FIXED_INPUT_FRAC_BITS)
+    for row in range(degree - 1, -1, -1):
+        outer[row] = min(outer[row], outer[row + 1] + FIXED_MAX_SHIFT - FIXED_INPUT_FRAC_BITS)
+    return {'inner': inner, 'outer': outer}
+
+
+def fixed_point_tables(exact: List[List[Fraction]], degree: int, formats: Dict) -> Dict:
+    """
+    固定小数点評価の係数表 (int64) とシフト量の表を作る関数 (いずれも評価順)
+
+    Returns:
+        Dict: 'coefficients', 'term_shifts' (各項の前の乗算後の右シフト, 行の先頭は0),
+              'row_shifts' (行の値を外側の形式に揃える右シフト), 'outer_shifts' (外側の乗算後の右シフト, 先頭は0),
+              'output_frac_bits' (最終段の小数ビット数)
+    """
+    coefficients, term_shifts, row_shifts, outer_shifts = [], [], [], []
+    for row, i in enumerate(range(degree, -1, -1)):
+        bits = formats['inner'][row]
+        for k, j in enumerate(range(degree - i, -1, -1)):
+            value = exact[i][j] * (Fraction(2) ** bits[k])
+            coefficients.append(int(value.numerator // value.denominator
+                                    if value >= 0 else -((-value.numerator) // value.denominator)))
+            term_shifts.append(0 if k == 0 else bits[k - 1] + FIXED_INPUT_FRAC_BITS - bits[k])
+        row_shifts.append(bits[-1] - formats['outer'][row])
+        outer_shifts.append(0 if row == 0 else formats['outer'][row - 1] + FIXED_INPUT_FRAC_BITS - formats['outer'][row])
+    assert all(0 <= v <= FIXED_MAX_SHIFT for v in term_shifts + row_shifts + outer_shifts)
+    return {'coefficients': coefficients, 'term_shifts': term_shifts, 'row_shifts': row_shifts,
+            'outer_shifts': outer_shifts, 'output_frac_bits': formats['outer'][-1]}
+
+
+def fixed_normalization(center: float, half: float) -> Tuple[int, int]:
+    """
+    Q16 の入力から正規化入力への変換定数 (中心の Q16 値, 半幅の逆数の Q38 値) を返す関数
+    """
+    return int(round(center * 2 ** FIXED_IO_FRAC_BITS)), int(round(2 ** FIXED_NORM_FRAC_BITS / half))
+
+
+def emulate_fixed_horner(tables: Dict, degree: int, under_y_q16: np.ndarray, theta_q16: np.ndarray,
+                         under_y_norm: Tuple[int, int], theta_norm: Tuple[int, int]) -> np.ndarray:
+    """
+    teensy_fixed_model.cpp の整数演算を numpy の int64 でビット単位に模擬する関数 (飽和は起きない前提)
+
+    Returns:
+        np.ndarray: 予測値 (Q16, int64, int32 の範囲に飽和済み)
+    """
+    norm_shift = FIXED_IO_FRAC_BITS + FIXED_NORM_FRAC_BITS - FIXED_INPUT_FRAC_BITS
+    x = ((under_y_q16.astype(np.int64) - under_y_norm[0]) * under_y_norm[1] + (1 << (norm_shift - 1))) >> norm_shift
+    y = ((theta_q16.astype(np.int64) - theta_norm[0]) * theta_norm[1] + (1 << (norm_shift - 1))) >> norm_shift
+
+    def mul_shift(value, factor, shift):
+        high = (value >> 31) * factor
+        low = (value & 0x7FFFFFFF) * factor
+        if shift >= 31:
+            return (high >> (shift - 31)) + (low >> shift)
+        return (high << (31 - shift)) + (low >> shift)
+
+    coefficients = iter(tables['coefficients'])
+    term_shifts = iter(tables['term_shifts'])
+    acc = np.zeros_like(x)
+    for row, i in enumerate(range(degree, -1, -1)):
+        next(term_shifts)
+        q = np.full_like(x, next(coefficients))
+        for _ in range(degree - i):
+            q = mul_shift(q, y, next(term_shifts)) + next(coefficients)
+        acc = mul_shift(acc, x, tables['outer_shifts'][row]) + (q >> tables['row_shifts'][row])
+    shift = tables['output_frac_bits'] - FIXED_IO_FRAC_BITS
+    if shift > 0:
+        acc = (acc + (1 << (shift - 1))) >> shift
+    else:
+        acc = acc << -shift
+    return np.clip(acc, -2 ** 31, 2 ** 31 - 1)
+
+
+def write_fixed_header(data: Dict, out_dir: str, under_y_range: Tuple[float, float],
+                       theta_range: Tuple[float, float]) -> Tuple[str, Dict]:
+    """
+    整数演算のみの固定小数点Horner評価用の係数表 teensy_fixed_model.h を生成する関数
+
+    正規化変数 (precision と同じ [-1, 1]^2 の写像) の係数を、段ごとに小数ビット数を変えた
+    int64 の Q形式で格納する。小数ビット数は入力検証範囲全体 (BLOB_INPUT_RANGE) で各段があふれないように選ぶ。
+
+    Args:
+        data (Dict): load_model()の戻り値
+        out_dir (str): 出力先ディレクトリ
+        under_y_range (Tuple[float, float]): [-1, 1] に正規化する under_y の範囲
+        theta_range (Tuple[float, float]): [-1, 1] に正規化する theta の範囲
+
+    Returns:
+        Tuple[str, Dict]: 生成したファイルのパスと誤差の見積もり ('max_error', 'max_error_measured', 'output_frac_bits')
+    """
+    from numpy.polynomial import polynomial as P
+
+    degree = data['degree']
+    matrix, intercept = coefficient_matrix(data)
+    exact = recentered_fractions(matrix, intercept, under_y_range, theta_range)
+    center_u = (under_y_range[0] + under_y_range[1]) / 2
+    half_u = (under_y_range[1] - under_y_range[0]) / 2
+    center_t = (theta_range[0] + theta_range[1]) / 2
+    half_t = (theta_range[1] - theta_range[0]) / 2
+    u_min, u_max, t_min, t_max = BLOB_INPUT_RANGE
+    x_max = max(abs(u_min - center_u), abs(u_max - center_u)) / half_u
+    y_max = max(abs(t_min - center_t), abs(t_max - center_t)) / half_t
+    # 正規化入力の丸めの分だけ上限に余裕を持たせる
+    formats = fixed_point_formats(exact, degree, x_max * (1 + 1e-6), y_max * (1 + 1e-6))
+    tables = fixed_point_tables(exact, degree, formats)
+    under_y_norm = fixed_normalization(center_u, half_u)
+    theta_norm = fixed_normalization(center_t, half_t)
+
+    # 入力検証範囲全体 (0.25 刻み) での倍精度参照 (Q16 の範囲に飽和) との差の見積もり
+    scale = 2 ** FIXED_IO_FRAC_BITS
+    under_y = np.arange(u_min, u_max + 0.125, 0.25)
+    theta = np.arange(t_min, t_max + 0.125, 0.25)
+    grid_u, grid_t = np.meshgrid(under_y, theta, indexing='ij')
+    fixed = emulate_fixed_horner(tables, degree, (grid_u * scale).astype(np.int64), (grid_t * scale).astype(np.int64),
+                                 under_y_norm, theta_norm) / scale
+    reference = np.clip(P.polygrid2d(under_y, theta, matrix) + intercept, -2 ** 15, (2 ** 31 - 1) / scale)
+    error = np.abs(fixed - reference)
+    measured = (grid_u >= 0) & (grid_u <= 100) & (grid_t >= -48.1) & (grid_t <= 55.2)
+    report = {'max_error': float(error.max()), 'max_error_measured': float(error[measured].max()),
+              'output_frac_bits': tables['output_frac_bits']}
+
+    def rows_text(values, fmt) -> str:
+        rows = []
+        position = 0
+        for i in range(degree, -1, -1):
+            count = degree - i + 1
+            rows.append('    // x^{} : y^{}..0\n{}'.format(i, degree - i,
+                                                          format_array(values[position:position + count], fmt=fmt)))
+            position += count
+        return ',\n'.join(rows)
+
+    coefficient_text = rows_text(tables['coefficients'], 'INT64_C({})')
+    term_shift_text = rows_text(tables['term_shifts'], '{:2d}')
+    row_shift_text = format_array(tables['row_shifts'], per_line=9, fmt='{:2d}')
+    outer_shift_text = format_array(tables['outer_shifts'], per_line=9, fmt='{:2d}')
+    all_bits = [b for row in formats['inner'] for b in row] + formats['outer']
+
+    text = f"""/*
+ * Teensy 4.1 多項式回帰モデル ({degree}次) - 固定小数点 (Q形式) 整数Horner評価用係数
+ * 自動生成元: {source_label(data)}
+ * 生成日時: {datetime.now().strftime('%Y-%m-%d %H:%M:%S')}
+ * 生成スクリプト: export_teensy_model.py fixed
+ *
+ * 正規化変数 x = (under_y - {center_u:g}) / {half_u:g}, y = (theta - {center_t:g}) / {half_t:g} (precision と同じ) の係数 b_ij を
+ * 段ごとに小数ビット数を変えた int64 の Q形式で格納 (評価順: 外側x^{degree}→^0, 内側y降順)
+ * - 入出力: int32 Q{32 - FIXED_IO_FRAC_BITS}.{FIXED_IO_FRAC_BITS} (under_y, theta, distance), 正規化入力: int32 Q{32 - FIXED_INPUT_FRAC_BITS}.{FIXED_INPUT_FRAC_BITS}
+ * - 各段の小数ビット数 ({min(all_bits)}〜{max(all_bits)}) は入力検証範囲全体 (|x| <= {x_max:.4f}, |y| <= {y_max:.4f}) での
+ *   値の上限 (区間演算) が 2^{FIXED_VALUE_BITS} 未満になるように選択 (通常の入力では途中の段はあふれない)
+ * - 出力は Q16.16 の範囲 (約 ±32768 cm) に飽和
+ * 倍精度参照 (同じ範囲に飽和) との差 (生成時の見積もり, 0.25 刻みの格子):
+ *   入力検証範囲全体 最大 {report['max_error']:.3e} cm, 実測範囲 最大 {report['max_error_measured']:.3e} cm
+ */
+
+#ifndef TEENSY_FIXED_MODEL_H
+#define TEENSY_FIXED_MODEL_H
+
+#include "teensy_horner_model.h"
+
+const int FIXED_IO_FRAC_BITS = {FIXED_IO_FRAC_BITS};
+const int FIXED_INPUT_FRAC_BITS = {FIXED_INPUT_FRAC_BITS};
+const int FIXED_NORM_FRAC_BITS = {FIXED_NORM_FRAC_BITS};
+const int FIXED_OUTPUT_FRAC_BITS = {tables['output_frac_bits']};  // 最終段の小数ビット数
+
+// 入出力 (Q16.16) の 1.0 と、入力範囲外を表す -1.0
+const int32_t FIXED_ONE = 1 << FIXED_IO_FRAC_BITS;
+const int32_t FIXED_ERROR = -FIXED_ONE;
+
+// 正規化: x (Q{FIXED_INPUT_FRAC_BITS}) = ((under_y (Q16) - 中心 (Q16)) * 半幅の逆数 (Q{FIXED_NORM_FRAC_BITS})) >> (16 + {FIXED_NORM_FRAC_BITS} - {FIXED_INPUT_FRAC_BITS}), 丸めあり
+// 入力検証範囲の隅ではモデルの桁落ちが大きく、正規化入力の1ulpの丸めが 0.1 cm 程度の差になる
+const int32_t FIXED_UNDER_Y_CENTER = {under_y_norm[0]};
+const int64_t FIXED_UNDER_Y_INV_HALF = INT64_C({under_y_norm[1]});
+const int32_t FIXED_THETA_CENTER = {theta_norm[0]};
+const int64_t FIXED_THETA_INV_HALF = INT64_C({theta_norm[1]});
+
+// 入力検証範囲 (Q16, validate_input_range と同じ)
+const int32_t FIXED_UNDER_Y_MIN = {int(u_min * scale)};
+const int32_t FIXED_UNDER_Y_MAX = {int(u_max * scale)};
+const int32_t FIXED_THETA_MIN = {int(t_min * scale)};
+const int32_t FIXED_THETA_MAX = {int(t_max * scale)};
+
+// 係数 b_ij (int64, その項を加える段の Q形式)
+const int64_t FIXED_COEFFICIENTS[HORNER_TERM_COUNT] PROGMEM = {{
+{coefficient_text}
+}};
+
+// 各項を加える前の乗算 (前段の値 * y) の右シフト量 (行の先頭は0)
+const uint8_t FIXED_TERM_SHIFTS[HORNER_TERM_COUNT] PROGMEM = {{
+{term_shift_text}
+}};
+
+// 行の値 q_i(y) を外側の段の Q形式に揃える右シフト量 (評価順)
+const uint8_t FIXED_ROW_SHIFTS[POLY_DEGREE + 1] PROGMEM = {{
+{row_shift_text}
+}};
+
+// 外側の乗算 (前段の値 * x) の右シフト量 (評価順, 先頭は0)
+const uint8_t FIXED_OUTER_SHIFTS[POLY_DEGREE + 1] PROGMEM = {{
+{outer_shift_text}
+}};
+
+// 生成時に見積もった倍精度参照との差の最大値 [cm] (入力検証範囲全体 / 実測範囲)
+const float FIXED_ESTIMATED_MAX_ERROR = {report['max_error']:.6e}f;
+const float FIXED_ESTIMATED_MAX_ERROR_MEASURED = {report['max_error_measured']:.6e}f;
+
+// 整数演算のみの予測 (Q16.16 の入出力, 範囲外は FIXED_ERROR, 出力は int32 の範囲に飽和)
+// saturations が非NULLなら途中の段で飽和した回数を加える (入力検証範囲では 0 のはず)
+int32_t predict_distance_fixed_q16(int32_t under_y_q16, int32_t theta_q16, uint32_t* saturations = nullptr);
+
+// 浮動小数点の入出力 (Q16.16 に丸めて評価, ホストでの比較用)
+float predict_distance_fixed(float under_y, float theta);
+
+#endif // TEENSY_FIXED_MODEL_H
+"""
+    path = os.path.join(out_dir, 'teensy_fixed_model.h')
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(text)
+    return path, report
+
+
+def main():
+    parser = argparse.ArgumentParser(description='学習済み多項式モデルをTeensy向けC++コードに変換する')
+    parser.add_argument('target', choices=['horner', 'lut', 'precision', 'chebyshev', 'template', 'blob', 'tiled', 'sparse', 'fixed', 'gradient', 'ensemble'], help='生成する係数表の種類')
+    parser.add_argument('--model', default=DEFAULT_MODEL_PATH, help='入力する.joblibのパス')
+    parser.add_argument('--out-dir', default=DEFAULT_OUT_DIR, help='出力先ディレクトリ')
+    parser.add_argument('--name', default=None,
+                        help='モデル名 (template, 既定は degree<次数> / blob, 既定は.joblibのファイル名)')
+    parser.add_argument('--under-y-range', type=float, nargs=2, default=[0.0, 121.0],
+                        help='補間表・誤差表がカバーする / 正規化する under_y の範囲 (lut, precision, chebyshev, fixed, ensemble)')
+    parser.add_argument('--theta-range', type=float, nargs=2, default=[-49.0, 56.0],
+                        help='補間表・誤差表がカバーする / 正規化する theta の範囲 (lut, precision, chebyshev, fixed, ensemble)')
+    parser.add_argument('--step', type=float, nargs=2, default=[1.0, 1.0],
+                        help='補間表の標本間隔 under_y theta (lut)')
+    parser.add_argument('--error-cells', type=int, nargs=2, default=[6, 4],
+                        help='誤差表の under_y, theta 方向のセル数 (ensemble)')
+    parser.add_argument('--data', default=DEFAULT_TILED_DATA, help='区分モデル・スパースモデルの学習データCSV (tiled, sparse)')
+    parser.add_argument('--validation', default=DEFAULT_VALIDATION_DATA,
+                        help='区分モデル・スパースモデルの検証データ, 誤差表を測るデータのCSV (tiled, sparse, ensemble)')
+    parser.add_argument('--cells', type=int, nargs=2, default=[8, 7], help='under_y, theta 方向のセル数 (tiled)')
+    parser.add_argument('--tile-degree', type=int, default=4, help='タイルの多項式の次数 (tiled)')
+    parser.add_argument('--tolerance', type=float, default=0.25,
+                        help='タイル内の学習点の最大誤差がこれを超えるセルを分割する [cm] (tiled)')
+    parser.add_argument('--max-level', type=int, default=3, help='セルの最大分割段数 (tiled)')
+    parser.add_argument('--degree', type=int, default=17, help='枝刈り前の多項式の次数 (sparse)')
+    parser.add_argument('--terms', type=int, nargs='+', default=[40, 50, 60, 70, 80, 100],
+                        help='生成するスパースモデルの項数 (sparse)')
+    parser.add_argument('--default-terms', type=int, default=60, help='predict_distance_sparse の項数 (sparse)')
+    parser.add_argument('--no-refit', action='store_true',
+                        help='係数を再当てはめせず寄与の大きい項を残す (sparse, 比較用)')
+    args = parser.parse_args()
+
+    if args.target == 'tiled':
+        # 区分モデルは.joblibではなく学習データCSVから直接当てはめる
+        under_y, theta, distance = load_points(args.data)
+        model = fit_tiled_model(under_y, theta, distance, tuple(args.cells), args.tile_degree, args.tolerance,
+                                args.max_level, tuple(args.under_y_range), tuple(args.theta_range))
+        fit_mae = float(np.mean(np.abs(evaluate_tiled(model, under_y, theta) - distance)))
+        val_under_y, val_theta, val_distance = load_points(args.validation)
+        val_mae = float(np.mean(np.abs(evaluate_tiled(model, val_under_y, val_theta) - val_distance)))
+        path = write_tiled_header(model, args.data, args.out_dir, fit_mae, (args.validation, val_mae))
+        print(f"区分モデル ({len(model['coefficients'])} タイル, {args.tile_degree}次) を {path} に保存しました。")
+        print(f"学習点での誤差: 平均 {fit_mae:.4f}, 最大 {model['max_error']:.4f}")
+        print(f"検証MAE ({args.validation}): {val_mae:.4f}")
+        return
+
+    if args.target == 'sparse':
+        if args.default_terms not in args.terms:
+            parser.error('--default-terms は --terms のいずれかを指定してください')
+        under_y_range = tuple(args.under_y_range)
+        theta_range = tuple(args.theta_range)
+        under_y, theta, distance = load_points(args.data)
+        x, y = normalize_inputs(under_y, theta, under_y_range, theta_range)
+        terms = sorted(monomial_powers(args.degree))
+        design = sparse_design(x, y, terms)
+        coefficients = None
+        if args.no_refit:
+            matrix, intercept = coefficient_matrix(load_model(args.model))
+            recentered = recentered_matrix(matrix, intercept, under_y_range, theta_range)
+            coefficients = np.array([recentered[i, j] for i, j in terms])
+        models = prune_terms(design, distance, terms, sorted(set(args.terms)), coefficients)
+
+        # 学習点・実測検証データでの誤差 (入力検証を通る under_y ≤ 100 の行)
+        val_under_y, val_theta, val_distance = load_points(args.validation)
+        valid = (np.abs(val_under_y) <= 100.0) & (np.abs(val_theta) <= 180.0)
+        val_x, val_y = normalize_inputs(val_under_y[valid], val_theta[valid], under_y_range, theta_range)
+        reports = {}
+        print(f"{'項数':>4} {'最高次数':>8} {'学習点MAE':>10} {'学習点最大':>10} {'検証MAE':>8}")
+        for size in sorted(models, reverse=True):
+            kept, kept_coefficients = models[size]
+            error = np.abs(sparse_design(x, y, kept) @ kept_coefficients - distance)
+            val_error = np.abs(sparse_design(val_x, val_y, kept) @ kept_coefficients - val_distance[valid])
+            reports[size] = {'fit_mae': float(error.mean()), 'fit_max': float(error.max()),
+                             'validation_mae': float(val_error.mean())}
+            print(f"{size:6d} {max(i + j for i, j in kept):10d} {error.mean():12.4f} {error.max():12.3f} "
+                  f"{val_error.mean():10.4f}")
+        path = write_sparse_header(models, reports, args.degree, args.default_terms, args.data, not args.no_refit, args.out_dir,
+                                   under_y_range, theta_range)
+        print(f"スパースモデルを {path} に保存しました。速度は build/sparse_report で確認してください。")
+        return
+
+    if args.target == 'ensemble':
+        # 組み込みの組み合わせのモデルを DEFAULT_MEMBERS と同じ順序で読み込む
+        members = [(name, load_model(path)) for name, path in DEFAULT_ENSEMBLE_MODELS]
+        path, report = write_ensemble_errors_header(members, args.validation, args.out_dir, tuple(args.error_cells),
+                                                    tuple(args.under_y_range), tuple(args.theta_range))
+        print(f"入力領域ごとの誤差表 ({args.error_cells[0]} x {args.error_cells[1]} セル) を {path} に保存しました。")
+        for name, (grid, overall) in report.items():
+            print(f"{name}: 当てはめた行の全体のMAE {overall:.4f}, セルのMAE {grid.min():.4f}..{grid.max():.4f}")
+        print("選択・加重平均の誤差 (当てはめに使わなかった行) は build/ensemble_report で確認してください。")
+        return
+
+    data = load_model(args.model)
+    print(f"モデル: {args.model} (次数 {data['degree']})")
+
+    if args.target == 'horner':
+        path = write_horner_header(data, args.out_dir)
+        matrix, intercept = coefficient_matrix(data)
+        print(f"Horner係数表を {path} に保存しました。")
+        print(f"scikit-learnとの最大差 (学習領域): {max_deviation_from_sklearn(data, matrix, intercept):.3e}")
+    elif args.target == 'lut':
+        path = write_lut_header(data, args.out_dir, tuple(args.under_y_range), tuple(args.theta_range), tuple(args.step))
+        print(f"補間表を {path} に保存しました。補間誤差は build/accuracy_report で確認してください。")
+    elif args.target == 'precision':
+        path, max_error, mean_error = write_precision_header(data, args.out_dir, tuple(args.under_y_range),
+                                                             tuple(args.theta_range))
+        print(f"正規化係数表を {path} に保存しました。")
+        print(f"単精度評価の倍精度参照との差 (見積もり): 最大 {max_error:.3e}, 平均 {mean_error:.3e}")
+        print("実機コードでの最悪誤差と混合精度の行数は build/precision_report で確認してください。")
+    elif args.target == 'chebyshev':
+        path, max_coefficient, sum_coefficient = write_chebyshev_header(data, args.out_dir, tuple(args.under_y_range),
+                                                                        tuple(args.theta_range))
+        print(f"チェビシェフ係数表を {path} に保存しました。")
+        print(f"係数の最大絶対値: {max_coefficient:.3e}, 絶対値の総和: {sum_coefficient:.3e}")
+        print("単精度評価の最悪誤差は build/precision_report で確認してください。")
+    elif args.target == 'fixed':
+        path, report = write_fixed_header(data, args.out_dir, tuple(args.under_y_range), tuple(args.theta_range))
+        print(f"固定小数点係数表を {path} に保存しました (最終段 Q{report['output_frac_bits']})。")
+        print(f"倍精度参照との差 (見積もり): 入力検証範囲全体 最大 {report['max_error']:.3e}, "
+              f"実測範囲 最大 {report['max_error_measured']:.3e}")
+        print("実機コードでの最悪誤差は build/fixed_report で確認してください。")
+    elif args.target == 'template':
+        name = args.name if args.name else f"degree{data['degree']}"
+        path = write_template_header(data, args.out_dir, name)
+        print(f"PolynomialModel<{data['degree']}> 用係数表を {path} に保存しました。")
+    elif args.target == 'gradient':
+        path = write_gradient_header(data, args.out_dir)
+        print(f"勾配の重み表を {path} に保存しました。解析的な勾配の誤差は build/gradient_report で確認してください。")
+    elif args.target == 'blob':
+        name = args.name if args.name else os.path.splitext(os.path.basename(args.model))[0]
+        path, crc = write_model_blob(data, args.out_dir, name)
+        print(f"バイナリモデルを {path} に保存しました ({os.path.getsize(path)} bytes, CRC32 {crc:08x})。")
+
+
+if __name__ == "__main__":
+    main()
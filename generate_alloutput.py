@@ -0,0 +1,78 @@
+import argparse
+import os
+from typing import Tuple
+
+import numpy as np
+import pandas as pd
+
+import distpredict
+
+# 画素ごとの入力 (x, under_y, theta) の格子。既存の alloutput_* と同じ格子を使う
+DEFAULT_GRID = os.path.join('data', 'alloutput_polynomial_degree6_mae0.70(全データ多項式回帰).csv')
+DEFAULT_OUT_DIR = 'data'
+# _cleaned 版に残す距離の範囲 [cm]
+DEFAULT_CLEAN_RANGE = (-5.0, 80.0)
+
+
+def load_grid(grid_path: str) -> pd.DataFrame:
+    """
+    格子 (x, under_y, theta の列) を読み込む関数
+
+    Args:
+        grid_path (str): 既存の alloutput_* などのCSV
+
+    Returns:
+        pd.DataFrame: x, under_y, theta の列
+    """
+    df = pd.read_csv(grid_path)
+    columns = [c for c in ['x', 'under_y', 'theta'] if c in df.columns]
+    if 'under_y' not in columns or 'theta' not in columns:
+        raise ValueError(f'{grid_path} に under_y, theta の列がありません')
+    return df[columns].copy()
+
+
+def output_paths(model_path: str, out_dir: str, label: str, clean_range: Tuple[float, float]) -> Tuple[str, str]:
+    """
+    出力ファイル名を既存の命名 (alloutput_<モデル名>(<ラベル>).csv と _cleaned(<下限>~<上限>)) に合わせて作る関数
+
+    Args:
+        model_path (str): モデルのパス
+        out_dir (str): 出力先ディレクトリ
+        label (str): 括弧内の説明 (空なら付けない)
+        clean_range (Tuple[float, float]): _cleaned 版の距離の範囲
+
+    Returns:
+        Tuple[str, str]: 全格子の出力と _cleaned 版のパス
+    """
+    stem = os.path.splitext(os.path.basename(model_path))[0]
+    name = f'alloutput_{stem}({label})' if label else f'alloutput_{stem}'
+    cleaned = f'{name}_cleaned({clean_range[0]:g}~{clean_range[1]:g})'
+    return os.path.join(out_dir, f'{name}.csv'), os.path.join(out_dir, f'{cleaned}.csv')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='学習済み多項式モデルの全画素格子の出力 (alloutput_*) を C++ 推論エンジンで生成する')
+    parser.add_argument('--model', required=True, help='.joblib (train.py の出力) または .dpm (export_teensy_model.py blob の出力)')
+    parser.add_argument('--grid', default=DEFAULT_GRID, help='入力格子のCSV (x, under_y, theta の列)')
+    parser.add_argument('--out-dir', default=DEFAULT_OUT_DIR, help='出力先ディレクトリ')
+    parser.add_argument('--label', default='', help='ファイル名の括弧内に付ける説明')
+    parser.add_argument('--clean-range', type=float, nargs=2, default=list(DEFAULT_CLEAN_RANGE),
+                        help='_cleaned 版に残す距離の範囲 [cm]')
+    args = parser.parse_args()
+
+    grid = load_grid(args.grid)
+    model = distpredict.RuntimeModel.from_file(args.model)
+    # 学習時の検証と同じく倍精度・入力検証なし (格子は入力検証範囲の外の under_y 121 まで含む)
+    grid['distance'] = model.evaluate(grid['under_y'].values, grid['theta'].values)
+
+    path, cleaned_path = output_paths(args.model, args.out_dir, args.label, tuple(args.clean_range))
+    grid.to_csv(path, index=False)
+    keep = (grid['distance'] >= args.clean_range[0]) & (grid['distance'] <= args.clean_range[1])
+    grid[keep].to_csv(cleaned_path, index=False)
+    print(f"モデル: {args.model} (次数 {model.degree})")
+    print(f"{len(grid)} 点を {path} に保存しました。")
+    print(f"距離 {args.clean_range[0]:g}〜{args.clean_range[1]:g} の {int(np.sum(keep))} 点を {cleaned_path} に保存しました。")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,138 @@
+/*
+ * ホスト用 近似エンジンの精度レポート
+ * 各エンジンの予測を厳密な倍精度モデル (Horner法) と比較し、
+ * data/ の検証セットと実測範囲の密な格子それぞれで最大・平均絶対誤差を表示する
+ *
+ * 使い方: accuracy_report [--engine NAME] [--data-dir DIR] [--grid-size S]
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "predictor_engines.h"
+#include "teensy_horner_model.h"
+#include "validation_data.h"
+
+namespace {
+
+struct ReportOptions {
+    const char* engine = nullptr;  // nullptrなら参照以外の全エンジン
+    std::string data_dir = DISTPREDICT_DATA_DIR;
+    size_t grid_size = 1000;
+};
+
+// 比較の基準: 倍精度Horner評価 (scikit-learnとの差 ~1e-7)
+const char* REFERENCE_ENGINE = "horner";
+
+struct ErrorSummary {
+    size_t count = 0;
+    double max_error = 0.0;
+    double sum_error = 0.0;
+    float worst_under_y = 0.0f;
+    float worst_theta = 0.0f;
+
+    void add(float under_y, float theta, double error) {
+        count++;
+        sum_error += error;
+        if (error > max_error || count == 1) {
+            max_error = error;
+            worst_under_y = under_y;
+            worst_theta = theta;
+        }
+    }
+};
+
+// 有効範囲内の入力のみ比較する (範囲外はどのエンジンも -1 を返すため)
+ErrorSummary compare_with_reference(const PredictorEngine& engine, const float* under_y, const float* theta, size_t n) {
+    ErrorSummary summary;
+    std::vector<float> out(n);
+    run_engine_batch(engine, under_y, theta, out.data(), n);
+    for (size_t i = 0; i < n; i++) {
+        if (!validate_input_range(under_y[i], theta[i])) {
+            continue;
+        }
+        double reference = evaluate_horner_double((double)under_y[i], (double)theta[i]);
+        summary.add(under_y[i], theta[i], std::fabs((double)out[i] - reference));
+    }
+    return summary;
+}
+
+void print_summary(const char* engine, const char* set, const ErrorSummary& summary) {
+    std::printf("%-14s %-58s %8zu %12.3e %12.3e   (%.2f, %.2f)\n",
+                engine, set, summary.count, summary.max_error,
+                summary.count > 0 ? summary.sum_error / (double)summary.count : 0.0,
+                summary.worst_under_y, summary.worst_theta);
+}
+
+bool parse_options(int argc, char** argv, ReportOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--engine") == 0 && has_value) {
+            options.engine = argv[++i];
+        } else if (std::strcmp(argv[i], "--data-dir") == 0 && has_value) {
+            options.data_dir = argv[++i];
+        } else if (std::strcmp(argv[i], "--grid-size") == 0 && has_value) {
+            options.grid_size = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            return false;
+        }
+    }
+    return options.grid_size > 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    ReportOptions options;
+    if (!parse_options(argc, argv, options)) {
+        std::printf("usage: accuracy_report [--engine NAME] [--data-dir DIR] [--grid-size S]\n");
+        return 1;
+    }
+    if (options.engine != nullptr && find_predictor_engine(options.engine) == nullptr) {
+        std::fprintf(stderr, "unknown engine: %s\n", options.engine);
+        return 1;
+    }
+
+    std::vector<ValidationSet> sets = load_validation_sets(options.data_dir);
+    if (sets.empty()) {
+        std::fprintf(stderr, "no validation CSV found in %s\n", options.data_dir.c_str());
+        return 1;
+    }
+
+    // 実測範囲の密な格子
+    std::vector<float> grid_under_y;
+    std::vector<float> grid_theta;
+    for (size_t i = 0; i < options.grid_size; i++) {
+        for (size_t j = 0; j < options.grid_size; j++) {
+            grid_under_y.push_back(MEASUREMENT_DOMAIN.under_y_min +
+                                   (MEASUREMENT_DOMAIN.under_y_max - MEASUREMENT_DOMAIN.under_y_min) * (float)i / (float)(options.grid_size - 1));
+            grid_theta.push_back(MEASUREMENT_DOMAIN.theta_min +
+                                 (MEASUREMENT_DOMAIN.theta_max - MEASUREMENT_DOMAIN.theta_min) * (float)j / (float)(options.grid_size - 1));
+        }
+    }
+    char grid_name[64];
+    std::snprintf(grid_name, sizeof(grid_name), "[grid %zux%zu measurement domain]", options.grid_size, options.grid_size);
+
+    std::printf("=== accuracy_report (reference: %s, valid inputs only) ===\n", REFERENCE_ENGINE);
+    std::printf("%-14s %-58s %8s %12s %12s   %s\n", "engine", "set", "rows", "max |err|", "mean |err|", "worst (under_y, theta)");
+
+    for (int e = 0; e < PREDICTOR_ENGINE_COUNT; e++) {
+        const PredictorEngine& engine = PREDICTOR_ENGINES[e];
+        if (options.engine != nullptr ? std::strcmp(engine.name, options.engine) != 0
+                                       : std::strcmp(engine.name, REFERENCE_ENGINE) == 0) {
+            continue;
+        }
+        for (const ValidationSet& set : sets) {
+            print_summary(engine.name, set.name.c_str(),
+                          compare_with_reference(engine, set.under_y.data(), set.theta.data(), set.under_y.size()));
+        }
+        print_summary(engine.name, grid_name,
+                      compare_with_reference(engine, grid_under_y.data(), grid_theta.data(), grid_under_y.size()));
+    }
+    return 0;
+}
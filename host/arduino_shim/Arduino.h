@@ -0,0 +1,53 @@
+/*
+ * ホスト (x86/Linux) ビルド用 Arduino.h 代替
+ * 推論ライブラリが使用する最小限の API (PROGMEM, Serial, micros/millis) のみを提供
+ */
+
+#ifndef HOST_ARDUINO_SHIM_H
+#define HOST_ARDUINO_SHIM_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// ホストではFlash/RAMの区別がないため空定義
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+// 経過時間 (プロセス起動からの単調時間)
+uint32_t micros();
+uint32_t millis();
+void delay(uint32_t ms);
+
+// Serial出力を標準出力へ転送する最小実装
+class HostSerial {
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    int available() { return 0; }
+    int read() { return -1; }
+
+    size_t write(const uint8_t* data, size_t length);
+
+    void print(const char* text);
+    void print(char value);
+    void print(int value);
+    void print(unsigned int value);
+    void print(long value);
+    void print(unsigned long value);
+    void print(double value, int digits = 2);
+
+    // Teensy の Print::printf と同じ書式付き出力
+    int printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+    void println();
+    template <typename T>
+    void println(T value) { print(value); println(); }
+    void println(double value, int digits) { print(value, digits); println(); }
+
+    explicit operator bool() const { return true; }
+};
+
+extern HostSerial Serial;
+
+#endif // HOST_ARDUINO_SHIM_H
@@ -0,0 +1,53 @@
+/*
+ * ホストビルド用 Arduino API 実装
+ */
+
+#include "Arduino.h"
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <thread>
+
+namespace {
+
+const std::chrono::steady_clock::time_point process_start = std::chrono::steady_clock::now();
+
+}  // namespace
+
+HostSerial Serial;
+
+uint32_t micros() {
+    auto elapsed = std::chrono::steady_clock::now() - process_start;
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+uint32_t millis() {
+    auto elapsed = std::chrono::steady_clock::now() - process_start;
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+}
+
+void delay(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+size_t HostSerial::write(const uint8_t* data, size_t length) { return std::fwrite(data, 1, length, stdout); }
+void HostSerial::print(const char* text) { std::fputs(text, stdout); }
+void HostSerial::print(char value) { std::putchar(value); }
+void HostSerial::print(int value) { std::printf("%d", value); }
+void HostSerial::print(unsigned int value) { std::printf("%u", value); }
+void HostSerial::print(long value) { std::printf("%ld", value); }
+void HostSerial::print(unsigned long value) { std::printf("%lu", value); }
+
+// Arduinoと同じく固定小数点表記で digits 桁まで出力
+void HostSerial::print(double value, int digits) { std::printf("%.*f", digits, value); }
+
+void HostSerial::println() { std::putchar('\n'); }
+
+int HostSerial::printf(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int written = std::vprintf(format, args);
+    va_end(args);
+    return written;
+}
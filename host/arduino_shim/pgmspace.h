@@ -0,0 +1,16 @@
+/*
+ * ホストビルド用 pgmspace.h 代替
+ * PROGMEM配列は通常のメモリ上にあるため読み出しマクロは直接アクセスに展開する
+ */
+
+#ifndef HOST_PGMSPACE_SHIM_H
+#define HOST_PGMSPACE_SHIM_H
+
+#include "Arduino.h"
+
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_float(addr) (*(const float*)(addr))
+
+#endif // HOST_PGMSPACE_SHIM_H
@@ -0,0 +1,242 @@
+/*
+ * ホスト用 推論ベンチマーク
+ * 実測範囲を掃引した多数の入力で各エンジンの ns/予測・スループット・レイテンシ分布を計測
+ *
+ * 使い方: bench_predictor [--samples N] [--latency-samples N] [--engine NAME]
+ *                        [--scaling MAX_THREADS] [--grid-size S]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "inference_engine.h"
+#include "predictor_engines.h"
+#include "simd_predictor.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct BenchOptions {
+    size_t samples = 4000000;
+    size_t latency_samples = 1000000;
+    const char* engine = nullptr;  // nullptrなら全エンジン
+    unsigned scaling_threads = 0;  // 0ならスケーリング計測なし
+    size_t grid_size = 2048;       // スケーリング計測の格子 (S × S)
+};
+
+// 最適化による計算の除去を防ぐ
+inline void keep_value(float value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline double elapsed_ns(Clock::time_point start, Clock::time_point end) {
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+// 計測区間に含まれるタイマー読み出し自体のコスト (中央値)
+double calibrate_timer_overhead_ns() {
+    std::vector<double> samples(10000);
+    for (double& sample : samples) {
+        Clock::time_point start = Clock::now();
+        asm volatile("" : : : "memory");
+        Clock::time_point end = Clock::now();
+        sample = elapsed_ns(start, end);
+    }
+    std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+    return samples[samples.size() / 2];
+}
+
+double percentile(std::vector<double>& sorted, double p) {
+    size_t index = (size_t)(p / 100.0 * (double)(sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+void run_engine(const PredictorEngine& engine, const BenchOptions& options,
+                const std::vector<float>& under_y, const std::vector<float>& theta,
+                double timer_overhead_ns) {
+    const size_t n = under_y.size();
+
+    // ウォームアップ
+    for (size_t i = 0; i < std::min<size_t>(n, 65536); i++) {
+        keep_value(engine.predict(under_y[i], theta[i]));
+    }
+
+    // スループット: 全入力を連続実行
+    double checksum = 0.0;
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < n; i++) {
+        checksum += engine.predict(under_y[i], theta[i]);
+    }
+    Clock::time_point end = Clock::now();
+    double total_ns = elapsed_ns(start, end);
+    double ns_per_prediction = total_ns / (double)n;
+
+    // バッチAPI: 全入力を1回の呼び出しで処理し、単一予測との最大差も確認
+    double batch_ns_per_prediction = 0.0;
+    double batch_max_deviation = 0.0;
+    if (engine.predict_batch != nullptr) {
+        std::vector<float> out(n);
+        engine.predict_batch(under_y.data(), theta.data(), out.data(), std::min<size_t>(n, 65536));
+        Clock::time_point batch_start = Clock::now();
+        engine.predict_batch(under_y.data(), theta.data(), out.data(), n);
+        Clock::time_point batch_end = Clock::now();
+        keep_value(out[n - 1]);
+        batch_ns_per_prediction = elapsed_ns(batch_start, batch_end) / (double)n;
+
+        for (size_t i = 0; i < n; i++) {
+            double deviation = std::fabs((double)out[i] - (double)engine.predict(under_y[i], theta[i]));
+            batch_max_deviation = std::max(batch_max_deviation, deviation);
+        }
+    }
+
+    // レイテンシ: 1呼び出しごとに計測しタイマーコストを差し引く
+    size_t latency_count = std::min(options.latency_samples, n);
+    std::vector<double> latencies(latency_count);
+    for (size_t i = 0; i < latency_count; i++) {
+        Clock::time_point call_start = Clock::now();
+        float result = engine.predict(under_y[i], theta[i]);
+        keep_value(result);
+        Clock::time_point call_end = Clock::now();
+        latencies[i] = std::max(0.0, elapsed_ns(call_start, call_end) - timer_overhead_ns);
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    char batch_column[32] = "-";
+    char deviation_column[32] = "-";
+    if (engine.predict_batch != nullptr) {
+        std::snprintf(batch_column, sizeof(batch_column), "%.2f", batch_ns_per_prediction);
+        std::snprintf(deviation_column, sizeof(deviation_column), "%.2e", batch_max_deviation);
+    }
+
+    std::printf("%-12s %10.2f %12.3f %10s %10s %9.1f %9.1f %9.1f %9.1f %9.1f   %.6e\n",
+                engine.name, ns_per_prediction, 1e3 / ns_per_prediction, batch_column, deviation_column,
+                percentile(latencies, 50.0), percentile(latencies, 90.0),
+                percentile(latencies, 99.0), percentile(latencies, 99.9),
+                latencies.back(), checksum / (double)n);
+}
+
+// 格子推論を1..max_threadsスレッドで実行し、スループットと並列効率を表示
+void run_scaling_report(const BenchOptions& options) {
+    GridSpec grid = {MEASUREMENT_DOMAIN.under_y_min, MEASUREMENT_DOMAIN.under_y_max, options.grid_size,
+                     MEASUREMENT_DOMAIN.theta_min, MEASUREMENT_DOMAIN.theta_max, options.grid_size};
+    std::vector<float> reference(grid.size());
+    std::vector<float> out(grid.size());
+
+    std::printf("\n=== thread scaling (grid %zu x %zu = %zu predictions, kernel %s) ===\n",
+                grid.under_y_steps, grid.theta_steps, grid.size(), simd_kernel_name());
+    std::printf("%8s %10s %12s %9s %11s %10s %12s\n",
+                "threads", "ms", "Mpred/s", "speedup", "efficiency", "stolen", "max |diff|");
+
+    double single_thread_ms = 0.0;
+    for (unsigned threads = 1; threads <= options.scaling_threads; threads++) {
+        InferenceEngine engine(threads);
+        engine.predict_grid(grid, out.data());  // ウォームアップ
+
+        // 3回の最良値
+        double best_ms = 0.0;
+        for (int repeat = 0; repeat < 3; repeat++) {
+            Clock::time_point start = Clock::now();
+            engine.predict_grid(grid, out.data());
+            double ms = elapsed_ns(start, Clock::now()) / 1e6;
+            if (repeat == 0 || ms < best_ms) best_ms = ms;
+        }
+
+        if (threads == 1) {
+            single_thread_ms = best_ms;
+            reference = out;
+        }
+        double max_diff = 0.0;
+        for (size_t i = 0; i < out.size(); i++) {
+            max_diff = std::max(max_diff, std::fabs((double)out[i] - (double)reference[i]));
+        }
+
+        double speedup = single_thread_ms / best_ms;
+        std::printf("%8u %10.2f %12.2f %9.2f %10.1f%% %10llu %12.2e\n",
+                    threads, best_ms, (double)grid.size() / best_ms / 1e3, speedup,
+                    speedup / threads * 100.0, (unsigned long long)engine.last_steal_count(), max_diff);
+    }
+}
+
+void print_usage() {
+    std::printf("usage: bench_predictor [--samples N] [--latency-samples N] [--engine NAME]\n");
+    std::printf("                       [--scaling MAX_THREADS] [--grid-size S]\n");
+    std::printf("engines:\n");
+    for (int i = 0; i < PREDICTOR_ENGINE_COUNT; i++) {
+        std::printf("  %-12s %s\n", PREDICTOR_ENGINES[i].name, PREDICTOR_ENGINES[i].description);
+    }
+}
+
+bool parse_options(int argc, char** argv, BenchOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--samples") == 0 && has_value) {
+            options.samples = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--latency-samples") == 0 && has_value) {
+            options.latency_samples = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--engine") == 0 && has_value) {
+            options.engine = argv[++i];
+        } else if (std::strcmp(argv[i], "--scaling") == 0 && has_value) {
+            options.scaling_threads = (unsigned)std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--grid-size") == 0 && has_value) {
+            options.grid_size = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            return false;
+        }
+    }
+    return options.samples > 0 && options.grid_size > 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage();
+        return 1;
+    }
+
+    const PredictorEngine* selected = nullptr;
+    if (options.engine != nullptr) {
+        selected = find_predictor_engine(options.engine);
+        if (selected == nullptr) {
+            std::fprintf(stderr, "unknown engine: %s\n", options.engine);
+            print_usage();
+            return 1;
+        }
+    }
+
+    std::vector<float> under_y(options.samples);
+    std::vector<float> theta(options.samples);
+    generate_domain_sweep(MEASUREMENT_DOMAIN, under_y.data(), theta.data(), options.samples);
+
+    double timer_overhead_ns = calibrate_timer_overhead_ns();
+
+    std::printf("=== bench_predictor ===\n");
+    std::printf("inputs: %zu (under_y %.1f..%.1f, theta %.1f..%.1f), latency samples: %zu\n",
+                options.samples, MEASUREMENT_DOMAIN.under_y_min, MEASUREMENT_DOMAIN.under_y_max,
+                MEASUREMENT_DOMAIN.theta_min, MEASUREMENT_DOMAIN.theta_max,
+                std::min(options.latency_samples, options.samples));
+    std::printf("timer overhead: %.1f ns (subtracted from latency)\n", timer_overhead_ns);
+    std::printf("simd kernel: %s\n\n", simd_kernel_name());
+    std::printf("%-12s %10s %12s %10s %10s %9s %9s %9s %9s %9s   %s\n",
+                "engine", "ns/pred", "Mpred/s", "batch ns", "batch dev", "p50 ns", "p90 ns", "p99 ns", "p99.9 ns", "max ns", "mean");
+
+    for (int i = 0; i < PREDICTOR_ENGINE_COUNT; i++) {
+        if (selected != nullptr && selected != &PREDICTOR_ENGINES[i]) {
+            continue;
+        }
+        run_engine(PREDICTOR_ENGINES[i], options, under_y, theta, timer_overhead_ns);
+    }
+
+    if (options.scaling_threads > 0) {
+        run_scaling_report(options);
+    }
+
+    return 0;
+}
@@ -0,0 +1,182 @@
+/*
+ * ホスト用 予測結果キャッシュ (PredictionCache) のベンチマーク
+ *
+ * 入力列ごとに Horner法を直接呼ぶ場合とキャッシュ経由の ns/予測、ヒット率・追い出し回数、
+ * 量子化による Horner法 (量子化前の入力) との最大差を表示する
+ *   measurement: data/All measurement data.csv の有効な行を繰り返し再生 (実測の入力分布)
+ *   tracking:    under_y (整数の行) は時々 ±1 行だけ動き、theta はセンサ分解能で刻まれた酔歩
+ *   random:      実測範囲の低食い違い量列 (ほぼすべてミスする最悪の場合)
+ *
+ * 使い方: cache_bench [--samples N] [--under-y-step S] [--theta-step S] [--sensor-theta-step S]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "predictor_engines.h"
+#include "teensy_horner_model.h"
+#include "teensy_prediction_cache.h"
+#include "validation_data.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct Stream {
+    const char* name;
+    std::vector<float> under_y;
+    std::vector<float> theta;
+};
+
+struct CacheOptions {
+    size_t samples = 1000000;
+    float under_y_step = PREDICTION_CACHE_UNDER_Y_STEP;
+    float theta_step = PREDICTION_CACHE_THETA_STEP;
+    float sensor_theta_step = 0.1f;  // tracking の theta の分解能
+};
+
+inline void keep_value(float value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// 5回計測して最小の ns/予測
+template <typename Predict>
+double measure_ns(const Stream& stream, Predict predict) {
+    double best = 1e30;
+    for (int repeat = 0; repeat < 5; repeat++) {
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < stream.under_y.size(); i++) {
+            keep_value(predict(stream.under_y[i], stream.theta[i]));
+        }
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+        best = std::min(best, ns / (double)stream.under_y.size());
+    }
+    return best;
+}
+
+std::vector<Stream> make_streams(const CacheOptions& options) {
+    std::vector<Stream> streams;
+    const InputDomain& domain = MEASUREMENT_DOMAIN;
+    std::mt19937 rng(12345);
+
+    ValidationSet measurement;
+    if (load_validation_csv(std::string(DISTPREDICT_DATA_DIR) + "/All measurement data.csv", measurement)) {
+        Stream stream;
+        stream.name = "measurement";
+        std::vector<size_t> rows;
+        for (size_t i = 0; i < measurement.under_y.size(); i++) {
+            if (validate_input_range(measurement.under_y[i], measurement.theta[i])) {
+                rows.push_back(i);
+            }
+        }
+        std::uniform_int_distribution<size_t> pick(0, rows.size() - 1);
+        for (size_t i = 0; i < options.samples && !rows.empty(); i++) {
+            size_t row = rows[pick(rng)];
+            stream.under_y.push_back(measurement.under_y[row]);
+            stream.theta.push_back(measurement.theta[row]);
+        }
+        streams.push_back(stream);
+    } else {
+        std::fprintf(stderr, "warning: %s/All measurement data.csv not found, skipping\n", DISTPREDICT_DATA_DIR);
+    }
+
+    Stream tracking;
+    tracking.name = "tracking";
+    std::normal_distribution<float> step(0.0f, 1.0f);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    float row = 50.0f;
+    float angle = 0.0f;
+    for (size_t i = 0; i < options.samples; i++) {
+        if (uniform(rng) < 0.05f) {
+            row = std::min(std::max(row + (uniform(rng) < 0.5f ? -1.0f : 1.0f), domain.under_y_min), domain.under_y_max);
+        }
+        angle = std::min(std::max(angle + 0.05f * step(rng), domain.theta_min), domain.theta_max);
+        tracking.under_y.push_back(row);
+        tracking.theta.push_back(std::round(angle / options.sensor_theta_step) * options.sensor_theta_step);
+    }
+    streams.push_back(tracking);
+
+    Stream random;
+    random.name = "random";
+    random.under_y.resize(options.samples);
+    random.theta.resize(options.samples);
+    generate_domain_sweep(domain, random.under_y.data(), random.theta.data(), options.samples);
+    streams.push_back(random);
+    return streams;
+}
+
+bool parse_options(int argc, char** argv, CacheOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--samples") == 0 && has_value) {
+            options.samples = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--under-y-step") == 0 && has_value) {
+            options.under_y_step = std::strtof(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--theta-step") == 0 && has_value) {
+            options.theta_step = std::strtof(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--sensor-theta-step") == 0 && has_value) {
+            options.sensor_theta_step = std::strtof(argv[++i], nullptr);
+        } else {
+            return false;
+        }
+    }
+    return options.samples > 0 && options.sensor_theta_step > 0.0f;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    CacheOptions options;
+    if (!parse_options(argc, argv, options)) {
+        std::printf("usage: cache_bench [--samples N] [--under-y-step S] [--theta-step S] [--sensor-theta-step S]\n");
+        return 1;
+    }
+    static PredictionCache cache;
+    if (!cache.set_quantization(options.under_y_step, options.theta_step)) {
+        std::fprintf(stderr, "quantization step too small for the %d-bit key\n", 32);
+        return 1;
+    }
+
+    std::vector<Stream> streams = make_streams(options);
+    std::printf("=== cache_bench ===\n");
+    std::printf("cache: %d sets x %d ways (%zu bytes), quantization: under_y %.4g, theta %.4g\n",
+                PREDICTION_CACHE_SETS, PREDICTION_CACHE_WAYS, sizeof(PredictionCache),
+                cache.under_y_step(), cache.theta_step());
+    std::printf("%-12s %10s %10s %8s %8s %10s %12s\n", "stream", "horner ns", "cached ns", "speedup",
+                "hit %", "evictions", "max |diff|");
+    for (const Stream& stream : streams) {
+        const double horner_ns = measure_ns(stream, predict_distance_horner);
+        cache.clear();
+        const double cached_ns = measure_ns(stream, [](float u, float t) { return cache.predict(u, t); });
+
+        // 計測とは別に空の状態から1巡してヒット率と量子化による差を求める
+        cache.clear();
+        cache.reset_stats();
+        double max_difference = 0.0;
+        for (size_t i = 0; i < stream.under_y.size(); i++) {
+            float value = cache.predict(stream.under_y[i], stream.theta[i]);
+            float exact = predict_distance_horner(stream.under_y[i], stream.theta[i]);
+            max_difference = std::max(max_difference, (double)std::fabs(value - exact));
+        }
+        const PredictionCacheStats& stats = cache.stats();
+        std::printf("%-12s %10.2f %10.2f %7.2fx %8.2f %10u %12.3e\n", stream.name, horner_ns, cached_ns,
+                    horner_ns / cached_ns, 100.0 * cache.hit_rate(), (unsigned)stats.evictions, max_difference);
+    }
+
+    // ヒットのみの費用: 同じ入力を繰り返す
+    Stream repeated;
+    repeated.name = "repeated";
+    repeated.under_y.assign(options.samples, 40.0f);
+    repeated.theta.assign(options.samples, 12.34f);
+    cache.clear();
+    std::printf("hit cost (same input repeated): %.2f ns\n",
+                measure_ns(repeated, [](float u, float t) { return cache.predict(u, t); }));
+    return 0;
+}
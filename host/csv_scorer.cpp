@@ -0,0 +1,311 @@
+/*
+ * ホスト用 CSVストリーミング採点の実装
+ */
+
+#include "csv_scorer.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "teensy_polynomial_model.h"
+
+namespace {
+
+struct CsvColumns {
+    int under_y = -1;
+    int theta = -1;
+    int distance = -1;
+    int last = -1;  // 読む必要のある最後の列
+};
+
+struct ScoreBlock {
+    std::vector<float> under_y;
+    std::vector<float> theta;
+    std::vector<float> distance;
+    std::vector<float> prediction;
+    std::vector<const char*> line;        // 入力行 (マップ領域内を指す, 出力でそのまま複写)
+    std::vector<uint32_t> line_length;
+    size_t rows = 0;
+    size_t skipped_lines = 0;
+};
+
+// [begin, end) の前後の空白を除いた範囲
+inline void trim(const char*& begin, const char*& end) {
+    while (begin < end && (*begin == ' ' || *begin == '\t' || *begin == '"')) begin++;
+    while (end > begin && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r' || end[-1] == '"')) end--;
+}
+
+// 1フィールドをその場でfloatに変換 (確保・コピーなし)
+inline bool parse_float(const char* begin, const char* end, float& value) {
+    trim(begin, end);
+    if (begin < end && *begin == '+') begin++;
+    std::from_chars_result result = std::from_chars(begin, end, value);
+    return result.ec == std::errc() && result.ptr == end;
+}
+
+bool parse_header(const char* begin, const char* end, CsvColumns& columns) {
+    // UTF-8 BOMを除去
+    if (end - begin >= 3 && std::memcmp(begin, "\xEF\xBB\xBF", 3) == 0) {
+        begin += 3;
+    }
+    int column = 0;
+    for (const char* field = begin; field <= end; column++) {
+        const char* comma = (const char*)std::memchr(field, ',', (size_t)(end - field));
+        const char* field_end = comma != nullptr ? comma : end;
+        const char* name_begin = field;
+        const char* name_end = field_end;
+        trim(name_begin, name_end);
+        size_t length = (size_t)(name_end - name_begin);
+        if (length == 7 && std::memcmp(name_begin, "under_y", 7) == 0) columns.under_y = column;
+        if (length == 5 && std::memcmp(name_begin, "theta", 5) == 0) columns.theta = column;
+        if (length == 8 && std::memcmp(name_begin, "distance", 8) == 0) columns.distance = column;
+        if (comma == nullptr) {
+            break;
+        }
+        field = comma + 1;
+    }
+    columns.last = std::max(columns.under_y, std::max(columns.theta, columns.distance));
+    return columns.under_y >= 0 && columns.theta >= 0;
+}
+
+// 1行を解析してブロックの末尾に追加 (空行・不正な行はfalse)
+inline bool parse_row(const char* begin, const char* end, const CsvColumns& columns, ScoreBlock& block) {
+    float under_y = 0.0f, theta = 0.0f, distance = NAN;
+    int found = 0;
+    const int needed = columns.distance >= 0 ? 3 : 2;
+    int column = 0;
+    const char* field = begin;
+    while (column <= columns.last) {
+        const char* comma = (const char*)std::memchr(field, ',', (size_t)(end - field));
+        const char* field_end = comma != nullptr ? comma : end;
+        if (column == columns.under_y) {
+            if (!parse_float(field, field_end, under_y)) return false;
+            found++;
+        } else if (column == columns.theta) {
+            if (!parse_float(field, field_end, theta)) return false;
+            found++;
+        } else if (column == columns.distance) {
+            if (!parse_float(field, field_end, distance)) return false;
+            found++;
+        }
+        if (comma == nullptr) {
+            break;
+        }
+        field = comma + 1;
+        column++;
+    }
+    if (found != needed) {
+        return false;
+    }
+    size_t row = block.rows++;
+    block.line[row] = begin;
+    block.line_length[row] = (uint32_t)(end - begin);
+    block.under_y[row] = under_y;
+    block.theta[row] = theta;
+    block.distance[row] = distance;
+    return true;
+}
+
+// 生産者1・消費者1の固定長ブロック循環キュー
+class BlockRing {
+public:
+    BlockRing(size_t depth, size_t block_rows) : blocks_(depth) {
+        for (ScoreBlock& block : blocks_) {
+            block.under_y.resize(block_rows);
+            block.theta.resize(block_rows);
+            block.distance.resize(block_rows);
+            block.prediction.resize(block_rows);
+            block.line.resize(block_rows);
+            block.line_length.resize(block_rows);
+        }
+    }
+
+    // 生産者: 空きブロックを取得 (消費者が返すまで待つ)
+    ScoreBlock& acquire_free() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [this] { return filled_ < blocks_.size(); });
+        ScoreBlock& block = blocks_[tail_];
+        block.rows = 0;
+        block.skipped_lines = 0;
+        return block;
+    }
+
+    // 生産者: 埋めたブロックを公開
+    void publish() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tail_ = (tail_ + 1) % blocks_.size();
+            filled_++;
+        }
+        not_empty_.notify_one();
+    }
+
+    void finish() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            finished_ = true;
+        }
+        not_empty_.notify_one();
+    }
+
+    // 消費者: 次のブロック (生産者が終了して空ならnullptr)
+    ScoreBlock* acquire_filled() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [this] { return filled_ > 0 || finished_; });
+        return filled_ > 0 ? &blocks_[head_] : nullptr;
+    }
+
+    // 消費者: 処理済みのブロックを返却
+    void release() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            head_ = (head_ + 1) % blocks_.size();
+            filled_--;
+        }
+        not_full_.notify_one();
+    }
+
+private:
+    std::vector<ScoreBlock> blocks_;
+    size_t head_ = 0;
+    size_t tail_ = 0;
+    size_t filled_ = 0;
+    bool finished_ = false;
+    std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+};
+
+void produce_blocks(const char* position, const char* end, const CsvColumns& columns,
+                    size_t block_rows, BlockRing& ring) {
+    while (position < end) {
+        ScoreBlock& block = ring.acquire_free();
+        while (position < end && block.rows < block_rows) {
+            const char* newline = (const char*)std::memchr(position, '\n', (size_t)(end - position));
+            const char* line_end = newline != nullptr ? newline : end;
+            const char* content_end = line_end;
+            if (content_end > position && content_end[-1] == '\r') {
+                content_end--;
+            }
+            if (content_end > position && !parse_row(position, content_end, columns, block)) {
+                block.skipped_lines++;
+            }
+            position = newline != nullptr ? newline + 1 : end;
+        }
+        ring.publish();
+    }
+    ring.finish();
+}
+
+// float値を最短表現で書き込む
+inline char* append_float(char* cursor, char* limit, float value) {
+    std::to_chars_result result = std::to_chars(cursor, limit, value);
+    return result.ptr;
+}
+
+}  // namespace
+
+bool score_csv(const char* data, size_t size, PredictBatchFunction predict, std::FILE* out,
+               const ScoreOptions& options, ScoreSummary& summary, std::string& error) {
+    const char* end = data + size;
+    const char* header_end = (const char*)std::memchr(data, '\n', size);
+    if (header_end == nullptr) {
+        header_end = end;
+    }
+    CsvColumns columns;
+    if (!parse_header(data, header_end, columns)) {
+        error = "header must contain under_y and theta columns";
+        return false;
+    }
+    summary = ScoreSummary();
+    summary.has_distance = columns.distance >= 0;
+
+    const size_t block_rows = std::max<size_t>(1, options.block_rows);
+    BlockRing ring(std::max<size_t>(2, options.queue_depth), block_rows);
+    const char* body = header_end < end ? header_end + 1 : end;
+    std::thread producer(produce_blocks, body, end, columns, block_rows, std::ref(ring));
+
+    // 出力は入力行をそのまま複写し、末尾に予測値 (と絶対誤差) の列を追加する
+    std::vector<char> output(std::max<size_t>(1 << 20, block_rows * 64));
+    char* cursor = output.data();
+    char* const limit = output.data() + output.size();
+    auto flush = [&]() {
+        summary.output_bytes += std::fwrite(output.data(), 1, (size_t)(cursor - output.data()), out);
+        cursor = output.data();
+    };
+    if (out != nullptr) {
+        const char* header_begin = data;
+        const char* header_content_end = header_end;
+        if (header_content_end > header_begin && header_content_end[-1] == '\r') header_content_end--;
+        if (header_content_end - header_begin >= 3 && std::memcmp(header_begin, "\xEF\xBB\xBF", 3) == 0) header_begin += 3;
+        summary.output_bytes += std::fwrite(header_begin, 1, (size_t)(header_content_end - header_begin), out);
+        const char* suffix = summary.has_distance ? ",prediction,abs_error\n" : ",prediction\n";
+        summary.output_bytes += std::fwrite(suffix, 1, std::strlen(suffix), out);
+    }
+
+    // 追加する列の最大長 (float 2個 + 区切り)
+    const size_t max_suffix = 2 * 16 + 4;
+    while (ScoreBlock* block = ring.acquire_filled()) {
+        const size_t rows = block->rows;
+        predict(block->under_y.data(), block->theta.data(), block->prediction.data(), rows);
+
+        for (size_t i = 0; i < rows; i++) {
+            float prediction = block->prediction[i];
+            bool valid = validate_input_range(block->under_y[i], block->theta[i]);
+            float abs_error = 0.0f;
+            if (!valid) {
+                summary.invalid_rows++;
+            } else if (summary.has_distance) {
+                abs_error = std::fabs(prediction - block->distance[i]);
+                summary.sum_abs_error += abs_error;
+                summary.max_abs_error = std::max(summary.max_abs_error, (double)abs_error);
+            }
+            if (out == nullptr) {
+                continue;
+            }
+
+            size_t length = block->line_length[i];
+            if ((size_t)(limit - cursor) < length + max_suffix) {
+                flush();
+                if ((size_t)(limit - cursor) < length + max_suffix) {
+                    // バッファより長い行はそのまま書き出す
+                    summary.output_bytes += std::fwrite(block->line[i], 1, length, out);
+                    length = 0;
+                }
+            }
+            std::memcpy(cursor, block->line[i], length);
+            cursor += length;
+            *cursor++ = ',';
+            cursor = append_float(cursor, limit, prediction);
+            if (summary.has_distance) {
+                *cursor++ = ',';
+                // 範囲外の行は誤差を空欄にする
+                if (valid) {
+                    cursor = append_float(cursor, limit, abs_error);
+                }
+            }
+            *cursor++ = '\n';
+        }
+        summary.rows += rows;
+        summary.skipped_lines += block->skipped_lines;
+        ring.release();
+    }
+    if (out != nullptr) {
+        flush();
+    }
+
+    producer.join();
+    // 容量不足や I/O エラーで途中までしか書けていない出力を成功として扱わない
+    if (out != nullptr && (std::fflush(out) != 0 || std::ferror(out))) {
+        error = "output write failed";
+        return false;
+    }
+    return true;
+}
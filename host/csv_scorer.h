@@ -0,0 +1,42 @@
+/*
+ * ホスト用 CSVストリーミング採点
+ *
+ * 測定ログ (ヘッダに under_y, theta を含むCSV, distance列があれば誤差も計算) をメモリマップし、
+ * 行ごとのメモリ確保なしでその場で数値を解析してバッチ予測関数に流し、
+ * 入力行をそのまま複写した末尾に予測値と絶対誤差の列を追加して書き出す。
+ * - 解析スレッド (生産者) と 予測+書き出しスレッド (消費者) を固定個数のブロックで循環させる
+ * - ブロック・出力バッファは開始時に確保したものを再利用する
+ */
+
+#ifndef HOST_CSV_SCORER_H
+#define HOST_CSV_SCORER_H
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+#include "mapped_file.h"
+#include "predictor_engines.h"
+
+struct ScoreOptions {
+    size_t block_rows = 65536;   // 1ブロックの行数
+    size_t queue_depth = 4;      // 生産者と消費者の間で循環させるブロック数
+};
+
+struct ScoreSummary {
+    size_t rows = 0;             // 予測した行数
+    size_t invalid_rows = 0;     // 入力範囲外 (予測値 -1) の行数
+    size_t skipped_lines = 0;    // 列が足りない・数値でない行数
+    bool has_distance = false;   // distance列があるか
+    double sum_abs_error = 0.0;  // 有効な行の絶対誤差の合計
+    double max_abs_error = 0.0;
+    size_t output_bytes = 0;
+};
+
+// CSV全体 (data, size) を採点し、out に "<入力行>,prediction[,abs_error]" を書き出す
+// (abs_error は distance 列がある場合のみ, 入力範囲外の行は空欄)
+// out が nullptr なら書き出さずに集計のみ行う。ヘッダが不正か書き出しに失敗したらfalse (書き出し後に out をフラッシュする)
+bool score_csv(const char* data, size_t size, PredictBatchFunction predict, std::FILE* out,
+               const ScoreOptions& options, ScoreSummary& summary, std::string& error);
+
+#endif // HOST_CSV_SCORER_H
@@ -0,0 +1,95 @@
+/*
+ * ホスト用 推論エンジンの C ABI の実装
+ */
+
+#include "distpredict_capi.h"
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include "predictor_engines.h"
+#include "teensy_model_blob.h"
+
+struct DistpredictModel {
+    std::vector<double> storage;  // .dpm の内容 (係数を倍精度のまま参照できるよう8バイト境界)
+    RuntimeModel model;
+};
+
+int distpredict_abi_version(void) {
+    return DISTPREDICT_ABI_VERSION;
+}
+
+int distpredict_engine_count(void) {
+    return PREDICTOR_ENGINE_COUNT;
+}
+
+const char* distpredict_engine_name(int index) {
+    return index >= 0 && index < PREDICTOR_ENGINE_COUNT ? PREDICTOR_ENGINES[index].name : nullptr;
+}
+
+const char* distpredict_engine_description(int index) {
+    return index >= 0 && index < PREDICTOR_ENGINE_COUNT ? PREDICTOR_ENGINES[index].description : nullptr;
+}
+
+int distpredict_predict(const char* engine, const float* under_y, const float* theta, float* out, size_t n) {
+    const PredictorEngine* found = engine != nullptr ? find_predictor_engine(engine) : nullptr;
+    if (found == nullptr) {
+        return -1;
+    }
+    if (n > 0) {
+        run_engine_batch(*found, under_y, theta, out, n);
+    }
+    return 0;
+}
+
+DistpredictModel* distpredict_model_load(const void* data, size_t size, int* status) {
+    DistpredictModel* model = new (std::nothrow) DistpredictModel();
+    if (model == nullptr) {
+        if (status != nullptr) {
+            *status = -1;  // 確保できない (distpredict_status_name は "unknown")
+        }
+        return nullptr;
+    }
+    model->storage.resize((size + sizeof(double) - 1) / sizeof(double));
+    if (size > 0) {
+        std::memcpy(model->storage.data(), data, size);
+    }
+    const ModelBlobStatus result =
+        parse_model_blob(reinterpret_cast<const uint8_t*>(model->storage.data()), size, model->model);
+    if (status != nullptr) {
+        *status = result;
+    }
+    if (result != MODEL_BLOB_OK) {
+        delete model;
+        return nullptr;
+    }
+    return model;
+}
+
+void distpredict_model_free(DistpredictModel* model) {
+    delete model;
+}
+
+const char* distpredict_status_name(int status) {
+    return model_blob_status_name((ModelBlobStatus)status);
+}
+
+int distpredict_model_degree(const DistpredictModel* model) {
+    return model->model.degree;
+}
+
+void distpredict_model_evaluate(const DistpredictModel* model, const double* under_y, const double* theta,
+                                double* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = evaluate_runtime_model(model->model, under_y[i], theta[i]);
+    }
+}
+
+void distpredict_model_predict(const DistpredictModel* model, const float* under_y, const float* theta, float* out,
+                               size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = predict_distance_runtime(model->model, under_y[i], theta[i]);
+    }
+}
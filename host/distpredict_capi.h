@@ -0,0 +1,57 @@
+/*
+ * ホスト用 推論エンジンの C ABI (共有ライブラリ libdistpredict.so)
+ *
+ * Python (distpredict.py, ctypes) などから、Teensy と同じ推論コードを numpy の連続したバッファに対して呼ぶための入口。
+ * - 組み込みのエンジン (predictor_engines.h の一覧) を名前で選んでバッチ予測する
+ * - 任意の学習済みモデルをバイナリモデル (.dpm, export_teensy_model.py blob と同じ形式) のバイト列で渡し、
+ *   実機の predict_distance_runtime と同じ評価器で予測する
+ * 配列はすべて要素の連続したもの (numpy の C 連続配列) を渡すこと。関数はスレッドセーフ (モデルは読み取りのみ)
+ */
+
+#ifndef HOST_DISTPREDICT_CAPI_H
+#define HOST_DISTPREDICT_CAPI_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DISTPREDICT_API __attribute__((visibility("default")))
+
+// 関数の引数・戻り値を変えたら上げる (ラッパー側で一致を確認する)
+#define DISTPREDICT_ABI_VERSION 1
+
+DISTPREDICT_API int distpredict_abi_version(void);
+
+// 組み込みのエンジン (index が範囲外なら NULL)
+DISTPREDICT_API int distpredict_engine_count(void);
+DISTPREDICT_API const char* distpredict_engine_name(int index);
+DISTPREDICT_API const char* distpredict_engine_description(int index);
+
+// エンジン engine で n 件を予測する (範囲外の入力は -1)。成功なら 0、エンジン名が不明なら -1
+DISTPREDICT_API int distpredict_predict(const char* engine, const float* under_y, const float* theta, float* out,
+                                        size_t n);
+
+// バイナリモデル
+typedef struct DistpredictModel DistpredictModel;
+
+// data の内容を8バイト境界の領域に複製して検証する。失敗なら NULL を返し、status に ModelBlobStatus (確保の失敗は -1) を書く
+DISTPREDICT_API DistpredictModel* distpredict_model_load(const void* data, size_t size, int* status);
+DISTPREDICT_API void distpredict_model_free(DistpredictModel* model);
+DISTPREDICT_API const char* distpredict_status_name(int status);
+DISTPREDICT_API int distpredict_model_degree(const DistpredictModel* model);
+
+// 倍精度・入力検証なしの評価 (学習時の検証・格子出力用。scikit-learn の predict と同じく全入力を評価する)
+DISTPREDICT_API void distpredict_model_evaluate(const DistpredictModel* model, const double* under_y,
+                                                const double* theta, double* out, size_t n);
+
+// 実機と同じ単精度の入出力・入力検証付きの予測 (範囲外は -1)
+DISTPREDICT_API void distpredict_model_predict(const DistpredictModel* model, const float* under_y, const float* theta,
+                                               float* out, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_DISTPREDICT_CAPI_H
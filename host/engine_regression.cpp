@@ -0,0 +1,352 @@
+/*
+ * ホスト用 全エンジンの差分回帰テスト (精度と速度)
+ *
+ * data/ の alloutput_* (学習済みモデルで全画素格子を予測したもの) を参照として、エンジン一覧の全エンジンを
+ * 同じ入力 (入力検証範囲内の行) で実行し、エンジンごとに ns/予測・スループット・参照との最大/平均絶対偏差と、
+ * 実測データ (alloutput_* 以外のCSV) の平均絶対誤差を1行ずつ表示する (--csv で同じ表をCSVとして書き出す)。
+ * 実測データの点は画素格子上にあるため、同じ点での参照の平均絶対誤差と比べた悪化量も表示する。
+ * 実測データで誤差表を当てはめたエンジン (ensemble) は、当てはめに使わなかった行だけで比べる。
+ * 参照との最大偏差か平均絶対誤差の悪化がエンジンごとの許容値 (ENGINE_BUDGETS) を超えると終了コード 1 を返す
+ * (高速化の変更で精度が落ちていないかを確かめるためのもので、ctest には登録しない)
+ *
+ * 使い方: engine_regression [--engine NAME] [--data-dir DIR] [--csv PATH|-] [--repeats N]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "predictor_engines.h"
+#include "teensy_ensemble_errors.h"
+#include "teensy_polynomial_model.h"
+#include "validation_data.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct RegressionOptions {
+    const char* engine = nullptr;  // nullptrなら全エンジン
+    std::string data_dir = DISTPREDICT_DATA_DIR;
+    std::string csv_path;          // 空なら書き出さない, "-" なら標準出力
+    int repeats = 5;
+};
+
+// 参照 (alloutput_*, _cleaned でないもの) のファイル名の先頭
+const char* REFERENCE_DEGREE17 = "alloutput_polynomial_degree17";
+const char* REFERENCE_DEGREE6 = "alloutput_polynomial_degree6";
+
+// 参照との最大偏差を確認しない (参照と別のモデルを組み合わせるエンジン)
+const double NOT_CHECKED = -1.0;
+
+// 倍精度で同じモデルを評価するエンジンの許容値 (単精度の出力と参照CSVの丸め ~1e-5 cm に余裕を持たせた値)
+const double EXACT_MAX_DEVIATION = 1e-3;
+const double EXACT_MAE_INCREASE = 1e-3;
+
+// エンジンごとの参照と許容値 (ここにないエンジンは17次の参照と EXACT_*)。
+// 近似エンジンの許容値は README に記載した精度 (現在の値) に余裕を持たせたもので、
+// 精度と引き換えに速くする変更をしたときは、ここを見直してその変更に含めること
+struct EngineBudget {
+    const char* engine;
+    const char* reference;
+    double max_deviation;     // 参照との最大絶対偏差 (cm)
+    double max_mae_increase;  // 同じ実測点での参照の平均絶対誤差からの悪化 (cm)
+    bool held_out_only = false;  // 実測データは誤差表の当てはめに使わなかった行だけで比べる
+};
+
+const EngineBudget ENGINE_BUDGETS[] = {
+    {"float", REFERENCE_DEGREE17, 0.05, 0.005},
+    {"mixed", REFERENCE_DEGREE17, 0.02, 0.005},
+    {"chebyshev", REFERENCE_DEGREE17, 0.01, 0.005},
+    {"template-6", REFERENCE_DEGREE6, EXACT_MAX_DEVIATION, EXACT_MAE_INCREASE},
+    {"ensemble", REFERENCE_DEGREE17, NOT_CHECKED, EXACT_MAE_INCREASE, true},  // 17次より悪化しないこと
+    {"lut-bilinear", REFERENCE_DEGREE17, 0.5, 0.01},
+    {"lut-bicubic", REFERENCE_DEGREE17, 0.05, 0.005},
+    {"tiled", REFERENCE_DEGREE17, 0.5, 0.01},
+    {"sparse", REFERENCE_DEGREE17, 5.0, 0.02},
+};
+
+EngineBudget budget_for(const char* engine) {
+    for (const EngineBudget& budget : ENGINE_BUDGETS) {
+        if (std::strcmp(budget.engine, engine) == 0) {
+            return budget;
+        }
+    }
+    return EngineBudget{engine, REFERENCE_DEGREE17, EXACT_MAX_DEVIATION, EXACT_MAE_INCREASE};
+}
+
+inline bool valid_input(float under_y, float theta) {
+    return under_y >= UNDER_Y_MIN && under_y <= UNDER_Y_MAX && theta >= THETA_MIN && theta <= THETA_MAX;
+}
+
+inline uint64_t point_key(float under_y, float theta) {
+    uint32_t under_y_bits;
+    uint32_t theta_bits;
+    std::memcpy(&under_y_bits, &under_y, sizeof(under_y_bits));
+    std::memcpy(&theta_bits, &theta, sizeof(theta_bits));
+    return ((uint64_t)under_y_bits << 32) | theta_bits;
+}
+
+// 入力検証範囲内の行だけを集めた参照と、実測データの点での参照の予測
+struct Reference {
+    std::string name;
+    std::vector<float> under_y;
+    std::vector<float> theta;
+    std::vector<float> distance;
+    std::vector<float> measured_under_y;  // 参照に同じ点がある実測データの行
+    std::vector<float> measured_theta;
+    std::vector<float> measured_distance;
+    std::vector<float> measured_reference;
+    std::vector<bool> measured_held_out;  // 誤差表の当てはめに使わなかった行 (ENSEMBLE_ERROR_SOURCE)
+    double reference_mae = 0.0;
+};
+
+bool build_reference(const std::vector<ValidationSet>& sets, const char* prefix, Reference& reference) {
+    const ValidationSet* found = nullptr;
+    for (const ValidationSet& set : sets) {
+        if (set.name.compare(0, std::strlen(prefix), prefix) == 0 && set.name.find("_cleaned") == std::string::npos) {
+            found = &set;
+            break;
+        }
+    }
+    if (found == nullptr) {
+        return false;
+    }
+
+    reference.name = found->name;
+    std::unordered_map<uint64_t, float> by_point;
+    for (size_t i = 0; i < found->under_y.size(); i++) {
+        by_point[point_key(found->under_y[i], found->theta[i])] = found->distance[i];
+        if (valid_input(found->under_y[i], found->theta[i])) {
+            reference.under_y.push_back(found->under_y[i]);
+            reference.theta.push_back(found->theta[i]);
+            reference.distance.push_back(found->distance[i]);
+        }
+    }
+
+    double error_sum = 0.0;
+    for (const ValidationSet& set : sets) {
+        if (set.name.compare(0, 9, "alloutput") == 0) {
+            continue;
+        }
+        for (size_t i = 0; i < set.under_y.size(); i++) {
+            if (!valid_input(set.under_y[i], set.theta[i])) {
+                continue;
+            }
+            auto match = by_point.find(point_key(set.under_y[i], set.theta[i]));
+            if (match == by_point.end()) {
+                continue;
+            }
+            reference.measured_under_y.push_back(set.under_y[i]);
+            reference.measured_theta.push_back(set.theta[i]);
+            reference.measured_distance.push_back(set.distance[i]);
+            reference.measured_reference.push_back(match->second);
+            reference.measured_held_out.push_back(set.name == ENSEMBLE_ERROR_SOURCE && ensemble_error_held_out((int)i));
+            error_sum += std::fabs((double)match->second - set.distance[i]);
+        }
+    }
+    reference.reference_mae = error_sum / (double)std::max<size_t>(reference.measured_distance.size(), 1);
+    return true;
+}
+
+struct EngineResult {
+    const char* engine;
+    const char* reference;
+    double ns_per_prediction;
+    size_t reference_rows;
+    double max_deviation;
+    double mean_deviation;
+    double max_deviation_limit;
+    double max_mae_increase;
+    size_t measured_rows;
+    double mae;
+    double reference_mae;
+    bool passed;
+};
+
+// repeats 回計測して最小の ns/予測
+double measure_ns(const PredictorEngine& engine, const Reference& reference, std::vector<float>& out, int repeats) {
+    const size_t n = reference.under_y.size();
+    double best = 1e30;
+    for (int repeat = 0; repeat < repeats; repeat++) {
+        Clock::time_point start = Clock::now();
+        run_engine_batch(engine, reference.under_y.data(), reference.theta.data(), out.data(), n);
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+        best = std::min(best, ns / (double)n);
+    }
+    return best;
+}
+
+EngineResult evaluate_engine(const PredictorEngine& engine, const EngineBudget& budget, const Reference& reference,
+                             const RegressionOptions& options) {
+    EngineResult result = {};
+    result.engine = engine.name;
+    result.reference = budget.reference;
+    result.max_deviation_limit = budget.max_deviation;
+    result.max_mae_increase = budget.max_mae_increase;
+    result.reference_rows = reference.under_y.size();
+
+    // 入力検証範囲内のため、-1 (エラー指標) が返ればそのまま大きな偏差になる
+    std::vector<float> out(reference.under_y.size());
+    result.ns_per_prediction = measure_ns(engine, reference, out, options.repeats);
+    double deviation_sum = 0.0;
+    for (size_t i = 0; i < out.size(); i++) {
+        const double deviation = std::fabs((double)out[i] - reference.distance[i]);
+        result.max_deviation = std::max(result.max_deviation, deviation);
+        deviation_sum += deviation;
+    }
+    result.mean_deviation = deviation_sum / (double)std::max<size_t>(out.size(), 1);
+
+    // 実測データの行 (held_out_only なら誤差表の当てはめに使わなかった行だけ)
+    std::vector<float> measured_under_y;
+    std::vector<float> measured_theta;
+    std::vector<size_t> rows;
+    for (size_t i = 0; i < reference.measured_under_y.size(); i++) {
+        if (!budget.held_out_only || reference.measured_held_out[i]) {
+            measured_under_y.push_back(reference.measured_under_y[i]);
+            measured_theta.push_back(reference.measured_theta[i]);
+            rows.push_back(i);
+        }
+    }
+    result.measured_rows = rows.size();
+    std::vector<float> measured(result.measured_rows);
+    run_engine_batch(engine, measured_under_y.data(), measured_theta.data(), measured.data(), result.measured_rows);
+    double error_sum = 0.0;
+    double reference_error_sum = 0.0;
+    for (size_t i = 0; i < measured.size(); i++) {
+        error_sum += std::fabs((double)measured[i] - reference.measured_distance[rows[i]]);
+        reference_error_sum +=
+            std::fabs((double)reference.measured_reference[rows[i]] - reference.measured_distance[rows[i]]);
+    }
+    result.mae = error_sum / (double)std::max<size_t>(measured.size(), 1);
+    result.reference_mae = reference_error_sum / (double)std::max<size_t>(measured.size(), 1);
+
+    const bool deviation_ok = budget.max_deviation == NOT_CHECKED || result.max_deviation <= budget.max_deviation;
+    const bool mae_ok = result.mae <= result.reference_mae + budget.max_mae_increase;
+    result.passed = deviation_ok && mae_ok;
+    return result;
+}
+
+void write_csv(std::FILE* out, const std::vector<EngineResult>& results) {
+    std::fprintf(out, "engine,reference,ns_per_prediction,mpredictions_per_s,reference_rows,max_abs_deviation,"
+                      "mean_abs_deviation,max_deviation_limit,measured_rows,mae,reference_mae,mae_increase,"
+                      "max_mae_increase,status\n");
+    for (const EngineResult& result : results) {
+        std::fprintf(out, "%s,%s,%.3f,%.3f,%zu,%.6e,%.6e,", result.engine, result.reference, result.ns_per_prediction,
+                     1e3 / result.ns_per_prediction, result.reference_rows, result.max_deviation,
+                     result.mean_deviation);
+        if (result.max_deviation_limit == NOT_CHECKED) {
+            std::fprintf(out, ",");
+        } else {
+            std::fprintf(out, "%.6e,", result.max_deviation_limit);
+        }
+        std::fprintf(out, "%zu,%.6f,%.6f,%.6f,%.6f,%s\n", result.measured_rows, result.mae, result.reference_mae,
+                     result.mae - result.reference_mae, result.max_mae_increase, result.passed ? "pass" : "FAIL");
+    }
+}
+
+bool parse_options(int argc, char** argv, RegressionOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--engine") == 0 && has_value) {
+            options.engine = argv[++i];
+        } else if (std::strcmp(argv[i], "--data-dir") == 0 && has_value) {
+            options.data_dir = argv[++i];
+        } else if (std::strcmp(argv[i], "--csv") == 0 && has_value) {
+            options.csv_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--repeats") == 0 && has_value) {
+            options.repeats = std::atoi(argv[++i]);
+        } else {
+            return false;
+        }
+    }
+    return options.repeats > 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    RegressionOptions options;
+    if (!parse_options(argc, argv, options)) {
+        std::printf("usage: engine_regression [--engine NAME] [--data-dir DIR] [--csv PATH|-] [--repeats N]\n");
+        return 1;
+    }
+    if (options.engine != nullptr && find_predictor_engine(options.engine) == nullptr) {
+        std::printf("unknown engine: %s\n", options.engine);
+        return 1;
+    }
+
+    const std::vector<ValidationSet> sets = load_validation_sets(options.data_dir);
+    std::vector<Reference> references;
+    std::vector<EngineResult> results;
+    int failures = 0;
+    for (int e = 0; e < PREDICTOR_ENGINE_COUNT; e++) {
+        const PredictorEngine& engine = PREDICTOR_ENGINES[e];
+        if (options.engine != nullptr && std::strcmp(options.engine, engine.name) != 0) {
+            continue;
+        }
+        const EngineBudget budget = budget_for(engine.name);
+        auto cached = std::find_if(references.begin(), references.end(), [&budget](const Reference& reference) {
+            return reference.name.compare(0, std::strlen(budget.reference), budget.reference) == 0;
+        });
+        if (cached == references.end()) {
+            Reference reference;
+            if (!build_reference(sets, budget.reference, reference)) {
+                std::printf("%s: no %s*.csv in %s\n", engine.name, budget.reference, options.data_dir.c_str());
+                failures++;
+                continue;
+            }
+            references.push_back(std::move(reference));
+            cached = references.end() - 1;
+        }
+        results.push_back(evaluate_engine(engine, budget, *cached, options));
+        failures += results.back().passed ? 0 : 1;
+    }
+
+    // 人が読む表 (std::printf) と機械が読む表 (--csv)
+    if (options.csv_path != "-") {
+        std::printf("=== engine_regression ===\n");
+        for (const Reference& reference : references) {
+            std::printf("reference %s: %zu rows in the input range, %zu measured points (reference MAE %.4f)\n",
+                        reference.name.c_str(), reference.under_y.size(), reference.measured_under_y.size(),
+                        reference.reference_mae);
+        }
+        std::printf("\n%-18s %9s %9s %11s %11s %9s %8s %9s %9s  %s\n", "engine", "ns/pred", "Mpred/s", "max |dev|",
+                    "mean |dev|", "limit", "MAE", "dMAE", "limit", "status");
+        for (const EngineResult& result : results) {
+            char limit[16];
+            if (result.max_deviation_limit == NOT_CHECKED) {
+                std::snprintf(limit, sizeof(limit), "-");
+            } else {
+                std::snprintf(limit, sizeof(limit), "%.0e", result.max_deviation_limit);
+            }
+            std::printf("%-18s %9.1f %9.2f %11.3e %11.3e %9s %8.4f %+9.4f %9.3f  %s\n", result.engine,
+                        result.ns_per_prediction, 1e3 / result.ns_per_prediction, result.max_deviation,
+                        result.mean_deviation, limit, result.mae, result.mae - result.reference_mae,
+                        result.max_mae_increase, result.passed ? "pass" : "FAIL");
+        }
+        std::printf("(dev: vs the reference grid in the input range; dMAE: vs the reference at the same measured "
+                    "points)\n");
+        std::printf("(ensemble: MAE only on the every %dth row of %s held out from its error grids)\n",
+                    ENSEMBLE_ERROR_HOLDOUT_STRIDE, ENSEMBLE_ERROR_SOURCE);
+    }
+    if (!options.csv_path.empty()) {
+        std::FILE* out = options.csv_path == "-" ? stdout : std::fopen(options.csv_path.c_str(), "w");
+        if (out == nullptr) {
+            std::printf("%s: cannot open for writing\n", options.csv_path.c_str());
+            return 1;
+        }
+        write_csv(out, results);
+        if (out != stdout) {
+            std::fclose(out);
+        }
+    }
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,284 @@
+/*
+ * ホスト用 複数の次数のモデルのべき乗表共有評価 (predict_distance_ensemble) の速度・精度比較
+ *
+ * 組み込みの組み合わせ (全データ6次 + LNN蒸留17次) について、PolynomialModel<N>::evaluate (Horner法) を
+ * モデルごとに呼ぶ場合・モデルごとに theta のべき乗表を作る場合と、べき乗表を共有した評価 (と選択・加重平均) の
+ * ns/予測を実測範囲の低食い違い量列で比べる (参考: 従来の特徴量生成による17次の予測 predict_distance_teensy)。
+ * 各モデルの値は同じ係数の long double による評価を参照として、共有した評価と Horner法の最大相対誤差を表示する。
+ * 精度は誤差表 teensy_ensemble_errors.h の当てはめに使わなかった実測データの行 (ENSEMBLE_ERROR_SOURCE のうち
+ * ensemble_error_held_out の行) で、各モデル・各方針の平均絶対誤差を under_y の区間ごとに表示する
+ * (data/ の他の実測CSVは同じ測定点を含むため使わない。選択・加重平均は入力点のセルの誤差で決まるため、
+ * 選択で各モデルが使われた点数も表示する)
+ * 共有した評価の参照との差が 1e-6 (相対) を超えるか、当てはめに使わなかった行が読めなければ終了コード 1 を返す
+ *
+ * 使い方: ensemble_report [--samples N] [--data-dir DIR]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "predictor_engines.h"
+#include "teensy_ensemble_errors.h"
+#include "teensy_ensemble_model.h"
+#include "teensy_model_degree17.h"
+#include "teensy_model_degree6.h"
+#include "teensy_polynomial_model.h"
+#include "validation_data.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct ReportOptions {
+    size_t samples = 200000;
+    std::string data_dir = DISTPREDICT_DATA_DIR;
+};
+
+const double CONSISTENCY_TOLERANCE = 1e-6;
+const int REFERENCE_MAX_DEGREE = DefaultEnsemble::MAX_DEGREE;
+
+// 平均絶対誤差を集計する under_y の区間 (最後は入力検証範囲の外で、予測は -1 になるため値を直接評価する)
+const int BAND_COUNT = 4;
+const float BAND_EDGES[BAND_COUNT + 1] = {0.0f, 30.0f, 60.0f, 100.0f, 121.0f};
+
+inline void keep_value(float value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// 5回計測して最小の ns/予測
+template <typename Evaluate>
+double measure_ns(const std::vector<float>& under_y, const std::vector<float>& theta, Evaluate evaluate) {
+    double best = 1e30;
+    for (int repeat = 0; repeat < 5; repeat++) {
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < under_y.size(); i++) {
+            keep_value(evaluate(under_y[i], theta[i]));
+        }
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+        best = std::min(best, ns / (double)under_y.size());
+    }
+    return best;
+}
+
+// 参照: 係数 (sklearn順) と単項式の積和を long double で求める
+long double reference_value(const double* coefficients, int degree, double intercept, float under_y, float theta) {
+    long double under_y_powers[REFERENCE_MAX_DEGREE + 1];
+    long double theta_powers[REFERENCE_MAX_DEGREE + 1];
+    under_y_powers[0] = theta_powers[0] = 1.0L;
+    for (int i = 1; i <= degree; i++) {
+        under_y_powers[i] = under_y_powers[i - 1] * under_y;
+        theta_powers[i] = theta_powers[i - 1] * theta;
+    }
+    long double sum = intercept;
+    int k = 0;
+    for (int d = 0; d <= degree; d++) {
+        for (int j = 0; j <= d; j++, k++) {
+            sum += (long double)coefficients[k] * under_y_powers[d - j] * theta_powers[j];
+        }
+    }
+    return sum;
+}
+
+int band_of(float under_y) {
+    for (int b = 0; b < BAND_COUNT; b++) {
+        if (under_y < BAND_EDGES[b + 1] || b == BAND_COUNT - 1) {
+            return b;
+        }
+    }
+    return BAND_COUNT - 1;
+}
+
+bool parse_options(int argc, char** argv, ReportOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--samples") == 0 && has_value) {
+            options.samples = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--data-dir") == 0 && has_value) {
+            options.data_dir = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    return options.samples > 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    ReportOptions options;
+    if (!parse_options(argc, argv, options)) {
+        std::printf("usage: ensemble_report [--samples N] [--data-dir DIR]\n");
+        return 1;
+    }
+
+    const DefaultEnsemble& ensemble = ENSEMBLE_DEFAULT;
+    const int count = DefaultEnsemble::COUNT;
+    const EnsembleMember* members = ensemble.members();
+    std::vector<float> under_y(options.samples);
+    std::vector<float> theta(options.samples);
+    generate_domain_sweep(MEASUREMENT_DOMAIN, under_y.data(), theta.data(), options.samples);
+
+    std::printf("=== ensemble_report ===\n");
+    std::printf("members:");
+    for (int m = 0; m < count; m++) {
+        std::printf(" %s (MAE %.2f)", members[m].name, (double)members[m].validation_mae);
+    }
+    std::printf("\n");
+    for (int m = 0; m < count; m++) {
+        const EnsembleErrorGrid* grid = members[m].error_grid;
+        if (grid == nullptr) {
+            std::printf("  %-10s no error grid (validation MAE for every input)\n", members[m].name);
+            continue;
+        }
+        const int cells = grid->cells_under_y * grid->cells_theta;
+        const float lowest = *std::min_element(grid->mae, grid->mae + cells);
+        const float highest = *std::max_element(grid->mae, grid->mae + cells);
+        std::printf("  %-10s error grid %d x %d cells, cell MAE %.3f..%.3f\n", members[m].name, grid->cells_under_y,
+                    grid->cells_theta, (double)lowest, (double)highest);
+    }
+    std::printf("%zu points in the measurement domain\n\n", options.samples);
+
+    const double horner_ns = measure_ns(under_y, theta, [](float u, float t) {
+        return (float)(MODEL_DEGREE6.evaluate(u, t) + MODEL_DEGREE17.evaluate(u, t));
+    });
+    const double separate_ns = measure_ns(under_y, theta, [](float u, float t) {
+        double theta_powers6[7];
+        double theta_powers17[18];
+        theta_powers6[0] = theta_powers17[0] = 1.0;
+        for (int j = 1; j <= 6; j++) {
+            theta_powers6[j] = theta_powers6[j - 1] * t;
+        }
+        for (int j = 1; j <= 17; j++) {
+            theta_powers17[j] = theta_powers17[j - 1] * t;
+        }
+        return (float)(MODEL_DEGREE6.evaluate_with_theta_powers(u, theta_powers6) +
+                       MODEL_DEGREE17.evaluate_with_theta_powers(u, theta_powers17));
+    });
+    const double shared_ns = measure_ns(under_y, theta, [&ensemble](float u, float t) {
+        double values[count];
+        ensemble.evaluate_all(u, t, values);
+        return (float)(values[0] + values[1]);
+    });
+    const double select_ns = measure_ns(under_y, theta, [](float u, float t) {
+        return predict_distance_ensemble(u, t, ENSEMBLE_SELECT);
+    });
+    const double weighted_ns = measure_ns(under_y, theta, [](float u, float t) {
+        return predict_distance_ensemble(u, t, ENSEMBLE_WEIGHTED);
+    });
+    const double features_ns = measure_ns(under_y, theta, predict_distance_teensy);
+
+    std::printf("%-48s %10s %10s\n", "evaluation (both models unless noted)", "ns", "x Horner");
+    std::printf("%-48s %10.1f %10.2f\n", "PolynomialModel<N>::evaluate per model (Horner)", horner_ns, 1.0);
+    std::printf("%-48s %10.1f %10.2f\n", "theta power table per model", separate_ns, separate_ns / horner_ns);
+    std::printf("%-48s %10.1f %10.2f\n", "shared theta power table (evaluate_all)", shared_ns, shared_ns / horner_ns);
+    std::printf("%-48s %10.1f %10.2f\n", "  + select (predict_distance_ensemble)", select_ns, select_ns / horner_ns);
+    std::printf("%-48s %10.1f %10.2f\n", "  + weighted (predict_distance_ensemble)", weighted_ns,
+                weighted_ns / horner_ns);
+    std::printf("%-48s %10.1f %10.2f\n", "degree 17 only, features (predict_distance_teensy)", features_ns,
+                features_ns / horner_ns);
+
+    // long double の参照との差
+    const double* coefficients[count] = {MODEL_DEGREE6_COEFFICIENTS, MODEL_DEGREE17_COEFFICIENTS};
+    const int degrees[count] = {6, 17};
+    const double intercepts[count] = {MODEL_DEGREE6_INTERCEPT, MODEL_DEGREE17_INTERCEPT};
+    const size_t accuracy_points = std::min<size_t>(options.samples, 50000);
+    const size_t stride = options.samples / accuracy_points;
+    double shared_rel[count] = {};
+    double horner_rel[count] = {};
+    for (size_t n = 0; n < accuracy_points; n++) {
+        const float u = under_y[n * stride];
+        const float t = theta[n * stride];
+        double values[count];
+        ensemble.evaluate_all(u, t, values);
+        const double horner[count] = {MODEL_DEGREE6.evaluate(u, t), MODEL_DEGREE17.evaluate(u, t)};
+        for (int m = 0; m < count; m++) {
+            const long double reference = reference_value(coefficients[m], degrees[m], intercepts[m], u, t);
+            const double scale = std::max(1.0, (double)std::fabs(reference));
+            shared_rel[m] = std::max(shared_rel[m], (double)std::fabs(values[m] - reference) / scale);
+            horner_rel[m] = std::max(horner_rel[m], (double)std::fabs(horner[m] - reference) / scale);
+        }
+    }
+    bool consistent = true;
+    std::printf("\nvs long double evaluation (%zu points, max |err| / max(|ref|, 1)):\n", accuracy_points);
+    std::printf("  %-10s %14s %14s\n", "", "shared table", "Horner");
+    for (int m = 0; m < count; m++) {
+        std::printf("  %-10s %14.3e %14.3e\n", members[m].name, shared_rel[m], horner_rel[m]);
+        consistent = consistent && shared_rel[m] <= CONSISTENCY_TOLERANCE;
+    }
+
+    // 誤差表の当てはめに使わなかった実測データでの平均絶対誤差 (列: 各モデル, 選択, 加重平均)
+    const int COLUMNS = count + 2;
+    double error_sum[BAND_COUNT + 1][COLUMNS] = {};
+    size_t counts[BAND_COUNT + 1] = {};
+    size_t selected[count] = {};
+    for (const ValidationSet& set : load_validation_sets(options.data_dir)) {
+        if (set.name != ENSEMBLE_ERROR_SOURCE) {
+            continue;
+        }
+        for (size_t i = 0; i < set.under_y.size(); i++) {
+            if (!ensemble_error_held_out((int)i)) {
+                continue;
+            }
+            const float u = set.under_y[i];
+            const float t = set.theta[i];
+            double predictions[COLUMNS];
+            ensemble.evaluate_all(u, t, predictions);
+            predictions[count] = ensemble_combine(members, count, predictions, u, t, ENSEMBLE_SELECT);
+            predictions[count + 1] = ensemble_combine(members, count, predictions, u, t, ENSEMBLE_WEIGHTED);
+            for (int m = 0; m < count; m++) {
+                if (predictions[count] == predictions[m]) {
+                    selected[m]++;
+                    break;
+                }
+            }
+            const int band = band_of(u);
+            for (int c = 0; c < COLUMNS; c++) {
+                const double error = std::fabs(predictions[c] - set.distance[i]);
+                error_sum[band][c] += error;
+                error_sum[BAND_COUNT][c] += error;
+            }
+            counts[band]++;
+            counts[BAND_COUNT]++;
+        }
+    }
+    if (counts[BAND_COUNT] == 0) {
+        std::printf("\nno held-out rows: %s not found in %s\n", ENSEMBLE_ERROR_SOURCE, options.data_dir.c_str());
+        return 1;
+    }
+    std::printf("\nmean absolute error on held-out measured data (cm, every %dth row of %s, not used for the error "
+                "grids):\n",
+                ENSEMBLE_ERROR_HOLDOUT_STRIDE, ENSEMBLE_ERROR_SOURCE);
+    std::printf("%-16s %6s", "under_y", "n");
+    for (int m = 0; m < count; m++) {
+        std::printf(" %10s", members[m].name);
+    }
+    std::printf(" %10s %10s\n", "select", "weighted");
+    for (int b = 0; b <= BAND_COUNT; b++) {
+        if (counts[b] == 0) {
+            continue;
+        }
+        char label[32];
+        if (b < BAND_COUNT) {
+            std::snprintf(label, sizeof(label), "[%g, %g)", (double)BAND_EDGES[b], (double)BAND_EDGES[b + 1]);
+        } else {
+            std::snprintf(label, sizeof(label), "all");
+        }
+        std::printf("%-16s %6zu", label, counts[b]);
+        for (int c = 0; c < COLUMNS; c++) {
+            std::printf(" %10.3f", error_sum[b][c] / (double)counts[b]);
+        }
+        std::printf("\n");
+    }
+    std::printf("select used:");
+    for (int m = 0; m < count; m++) {
+        std::printf(" %s %zu", members[m].name, selected[m]);
+    }
+    std::printf("\n(under_y >= 100 is outside validate_input_range; values are evaluated without validation)\n");
+    return consistent ? 0 : 1;
+}
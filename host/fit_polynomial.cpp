@@ -0,0 +1,205 @@
+/*
+ * ホスト用 多項式回帰の学習ツール (train.py の次数ごとの学習を置き換える)
+ *
+ * 学習CSVを1回だけ先頭から読み、最大次数の正規方程式を蓄積して1回の Cholesky分解から
+ * 全次数のモデルを求め (polynomial_fitter.h)、そのまま実機で読み込めるバイナリモデル (.dpm) として書き出す。
+ * 検証CSVを指定すると、書き出したモデルを predict_polynomial と同じ evaluate_runtime_model で評価した
+ * 検証MAEをヘッダとファイル名 (train.py と同じ polynomial_degree<N>_mae<MAE>.dpm) に入れる。
+ * チェビシェフ基底から単項式への変換誤差は学習領域の低食い違い量列で確認する
+ *
+ * 使い方: fit_polynomial TRAIN.csv [--validation VAL.csv] [--min-degree N] [--max-degree N] [--out-dir DIR]
+ *         (出力先の既定は train.py と同じ models/<日時>)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "model_store.h"
+#include "polynomial_fitter.h"
+#include "predictor_engines.h"
+#include "validation_data.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct FitOptions {
+    std::string train_path;
+    std::string validation_path;
+    int min_degree = 1;
+    int max_degree = MODEL_BLOB_MAX_DEGREE;
+    std::string out_dir;
+};
+
+const size_t CONVERSION_CHECK_POINTS = 10000;
+
+double elapsed_ms(Clock::time_point start, Clock::time_point end) {
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() * 1e-6;
+}
+
+std::string default_out_dir() {
+    char stamp[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", std::localtime(&now));
+    return std::string("models/") + stamp;
+}
+
+bool parse_options(int argc, char** argv, FitOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--validation") == 0 && has_value) {
+            options.validation_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--min-degree") == 0 && has_value) {
+            options.min_degree = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--max-degree") == 0 && has_value) {
+            options.max_degree = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--out-dir") == 0 && has_value) {
+            options.out_dir = argv[++i];
+        } else if (argv[i][0] != '-' && options.train_path.empty()) {
+            options.train_path = argv[i];
+        } else {
+            return false;
+        }
+    }
+    if (options.out_dir.empty()) {
+        options.out_dir = default_out_dir();
+    }
+    return !options.train_path.empty() && options.min_degree >= 1 && options.min_degree <= options.max_degree &&
+           options.max_degree <= MODEL_BLOB_MAX_DEGREE;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    FitOptions options;
+    if (!parse_options(argc, argv, options)) {
+        std::printf("usage: fit_polynomial TRAIN.csv [--validation VAL.csv] [--min-degree N] [--max-degree N] "
+                    "[--out-dir DIR]\n");
+        std::printf("       (degrees 1..%d, default output directory models/<timestamp>)\n", MODEL_BLOB_MAX_DEGREE);
+        return 1;
+    }
+
+    ValidationSet validation;
+    const bool has_validation = !options.validation_path.empty();
+    if (has_validation && !load_validation_csv(options.validation_path, validation)) {
+        std::printf("%s: cannot read under_y, theta, distance columns\n", options.validation_path.c_str());
+        return 1;
+    }
+
+    std::printf("=== fit_polynomial ===\n");
+    PolynomialFitter fitter(options.max_degree);
+    Clock::time_point start = Clock::now();
+    if (!read_validation_rows(options.train_path, [&fitter](float under_y, float theta, float distance) {
+            fitter.add(under_y, theta, distance);
+        })) {
+        std::printf("%s: cannot read under_y, theta, distance columns\n", options.train_path.c_str());
+        return 1;
+    }
+    Clock::time_point accumulated = Clock::now();
+    const int solvable = fitter.factorize();
+    Clock::time_point factorized = Clock::now();
+
+    const double accumulate_ms = elapsed_ms(start, accumulated);
+    std::printf("train: %s (%zu rows), read + accumulate %.1f ms (%.2f us/row)\n", options.train_path.c_str(),
+                fitter.rows(), accumulate_ms, fitter.rows() > 0 ? accumulate_ms * 1e3 / (double)fitter.rows() : 0.0);
+    std::printf("Cholesky (degree %d, %d terms): %.1f ms\n", fitter.max_degree(),
+                (fitter.max_degree() + 1) * (fitter.max_degree() + 2) / 2, elapsed_ms(accumulated, factorized));
+    if (has_validation) {
+        std::printf("validation: %s (%zu rows)\n", options.validation_path.c_str(), validation.under_y.size());
+    }
+    if (solvable < options.min_degree) {
+        std::printf("no degree in %d..%d can be fitted (too few distinct points)\n", options.min_degree,
+                    options.max_degree);
+        return 1;
+    }
+    if (solvable < options.max_degree) {
+        std::printf("degrees above %d are rank deficient for this data and are skipped\n", solvable);
+    }
+
+    std::error_code directory_error;
+    std::filesystem::create_directories(options.out_dir, directory_error);
+    if (directory_error) {
+        std::printf("%s: %s\n", options.out_dir.c_str(), directory_error.message().c_str());
+        return 1;
+    }
+    std::printf("output: %s\n\n", options.out_dir.c_str());
+
+    std::vector<float> check_under_y(CONVERSION_CHECK_POINTS);
+    std::vector<float> check_theta(CONVERSION_CHECK_POINTS);
+    generate_domain_sweep(TRAINING_DOMAIN, check_under_y.data(), check_theta.data(), CONVERSION_CHECK_POINTS);
+
+    std::printf("%6s %6s %10s %10s %10s %12s  %s\n", "degree", "terms", "train RMSE", "val MAE", "val RMSE",
+                "convert err", "file");
+    int best_degree = -1;
+    double best_mae = std::numeric_limits<double>::infinity();
+    int failures = 0;
+    Clock::time_point solve_start = Clock::now();
+    for (int degree = options.min_degree; degree <= solvable; degree++) {
+        FittedPolynomial fitted;
+        fitter.solve(degree, fitted);
+
+        // 書き出すモデル (単項式, Horner評価) で検証する
+        RuntimeModel model = fitted.runtime_model(std::numeric_limits<float>::quiet_NaN());
+        double abs_sum = 0.0;
+        double square_sum = 0.0;
+        for (size_t i = 0; i < validation.under_y.size(); i++) {
+            const double error = evaluate_runtime_model(model, validation.under_y[i], validation.theta[i]) -
+                                 validation.distance[i];
+            abs_sum += std::fabs(error);
+            square_sum += error * error;
+        }
+        const double count = (double)std::max<size_t>(validation.under_y.size(), 1);
+        const double val_mae = abs_sum / count;
+        const double val_rmse = std::sqrt(square_sum / count);
+        model.validation_mae = has_validation ? (float)val_mae : std::numeric_limits<float>::quiet_NaN();
+
+        // 変換誤差: max |単項式 - チェビシェフ基底| / max(|値|, 1)
+        double conversion_error = 0.0;
+        for (size_t i = 0; i < CONVERSION_CHECK_POINTS; i++) {
+            const long double reference = fitted.evaluate_chebyshev(check_under_y[i], check_theta[i]);
+            const double value = evaluate_runtime_model(model, check_under_y[i], check_theta[i]);
+            conversion_error = std::max(conversion_error, (double)(std::fabs(value - reference) /
+                                                                   std::max(1.0L, std::fabs(reference))));
+        }
+
+        char name[64];
+        if (has_validation) {
+            std::snprintf(name, sizeof(name), "polynomial_degree%d_mae%.2f.dpm", degree, val_mae);
+        } else {
+            std::snprintf(name, sizeof(name), "polynomial_degree%d.dpm", degree);
+        }
+        std::string error;
+        const std::string path = (std::filesystem::path(options.out_dir) / name).string();
+        if (!write_model_blob(path, model, error)) {
+            std::printf("%s\n", error.c_str());
+            failures++;
+            continue;
+        }
+
+        if (has_validation) {
+            std::printf("%6d %6d %10.3f %10.3f %10.3f %12.3e  %s\n", degree, model.term_count, fitted.train_rmse,
+                        val_mae, val_rmse, conversion_error, name);
+            if (val_mae < best_mae) {
+                best_mae = val_mae;
+                best_degree = degree;
+            }
+        } else {
+            std::printf("%6d %6d %10.3f %10s %10s %12.3e  %s\n", degree, model.term_count, fitted.train_rmse, "-",
+                        "-", conversion_error, name);
+        }
+    }
+    std::printf("\nsolve + convert + validate + write: %.1f ms\n", elapsed_ms(solve_start, Clock::now()));
+    if (best_degree >= 0) {
+        std::printf("best degree: %d (validation MAE %.2f)\n", best_degree, best_mae);
+    }
+    return failures > 0 ? 1 : 0;
+}
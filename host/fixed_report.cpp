@@ -0,0 +1,230 @@
+/*
+ * ホスト用 固定小数点 (Q形式) 評価器の検証ツール
+ *
+ * 入力検証範囲全体 (under_y -100〜100, theta -180〜180) の Q16.16 格子と乱数点で
+ * predict_distance_fixed_q16 を long double のHorner評価 (同じ係数, 出力と同じ範囲に飽和) と比較し、
+ * 最悪誤差とその位置・平均誤差・実測範囲での最悪誤差・途中の段の飽和回数・出力の飽和点数を表示する。
+ * 参照に倍精度の Horner評価を使わないのは、範囲の隅では倍精度自体の丸め誤差が無視できないため (差も表示する)
+ * あわせて、丸めた正規化入力 (Q29) での正規化係数の long double 評価との差 (整数演算だけによる誤差) も表示する。
+ * 範囲の隅ではモデルの桁落ちが大きく、全体の誤差はほぼ正規化入力の丸めで決まる
+ * 途中の段で飽和した点がある、または最悪誤差が --tolerance を超えると終了コード 1 を返す
+ *
+ * 使い方: fixed_report [--step S] [--samples N] [--tolerance CM]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "predictor_engines.h"
+#include "teensy_fixed_model.h"
+#include "teensy_horner_model.h"
+#include "teensy_precision_model.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct ReportOptions {
+    double step = 0.25;         // 格子の間隔 (Q16 で正確に表せる値)
+    size_t samples = 1000000;   // Q16 の乱数点
+    double tolerance = 0.5;     // 入力検証範囲全体での最悪誤差の許容値 [cm]
+};
+
+struct ErrorSummary {
+    size_t points = 0;
+    double max_error = 0.0;
+    double sum_error = 0.0;
+    double worst_under_y = 0.0;
+    double worst_theta = 0.0;
+    double measured_max_error = 0.0;   // 実測範囲 (MEASUREMENT_DOMAIN) 内の最悪誤差
+    double arithmetic_max_error = 0.0; // 丸めた正規化入力での参照との差 (整数演算による誤差)
+    double double_max_error = 0.0;     // 倍精度 Horner評価と参照の差 (参照の精度の目安)
+    uint32_t saturations = 0;          // 途中の段の飽和回数
+    size_t saturated_outputs = 0;      // 出力が Q16.16 の範囲に飽和した点数
+};
+
+const double Q16_SCALE = (double)FIXED_ONE;
+const long double OUTPUT_MIN = (long double)INT32_MIN / Q16_SCALE;
+const long double OUTPUT_MAX = (long double)INT32_MAX / Q16_SCALE;
+
+inline void keep_value(float value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// 参照: 同じ係数の long double Horner評価
+long double evaluate_horner_long_double(long double under_y, long double theta) {
+    const double* coeff = HORNER_COEFFICIENTS;
+    long double acc = 0.0L;
+    for (int i = POLY_DEGREE; i >= 0; i--) {
+        long double q = *coeff++;
+        for (int j = POLY_DEGREE - i; j > 0; j--) {
+            q = q * theta + *coeff++;
+        }
+        acc = acc * under_y + q;
+    }
+    return acc + HORNER_INTERCEPT;
+}
+
+// 丸めた正規化入力 (Q29) での正規化係数 (precision と同じ写像) の long double Horner評価
+long double evaluate_normalized_long_double(int32_t x_q, int32_t y_q) {
+    const long double x = std::ldexp((long double)x_q, -FIXED_INPUT_FRAC_BITS);
+    const long double y = std::ldexp((long double)y_q, -FIXED_INPUT_FRAC_BITS);
+    const double* coeff = PRECISION_COEFFICIENTS;
+    long double acc = 0.0L;
+    for (int i = POLY_DEGREE; i >= 0; i--) {
+        long double q = *coeff++;
+        for (int j = POLY_DEGREE - i; j > 0; j--) {
+            q = q * y + *coeff++;
+        }
+        acc = acc * x + q;
+    }
+    return acc;
+}
+
+// teensy_fixed_model.cpp と同じ正規化 (ヘッダの定数の説明どおり)
+int32_t normalize_q16(int32_t value_q16, int32_t center, int64_t inv_half) {
+    const int shift = FIXED_IO_FRAC_BITS + FIXED_NORM_FRAC_BITS - FIXED_INPUT_FRAC_BITS;
+    return (int32_t)(((int64_t)(value_q16 - center) * inv_half + ((int64_t)1 << (shift - 1))) >> shift);
+}
+
+bool in_measurement_domain(double under_y, double theta) {
+    const InputDomain& domain = MEASUREMENT_DOMAIN;
+    return under_y >= domain.under_y_min && under_y <= domain.under_y_max && theta >= domain.theta_min &&
+           theta <= domain.theta_max;
+}
+
+void check_point(int32_t under_y_q16, int32_t theta_q16, ErrorSummary& summary) {
+    const double under_y = under_y_q16 / Q16_SCALE;
+    const double theta = theta_q16 / Q16_SCALE;
+    const int32_t fixed = predict_distance_fixed_q16(under_y_q16, theta_q16, &summary.saturations);
+
+    const long double exact = evaluate_horner_long_double(under_y, theta);
+    const long double reference = std::min(std::max(exact, OUTPUT_MIN), OUTPUT_MAX);
+    const double error = (double)std::fabs((long double)fixed / Q16_SCALE - reference);
+    if (exact < OUTPUT_MIN || exact > OUTPUT_MAX) {
+        summary.saturated_outputs++;
+    } else {
+        const double double_error = (double)std::fabs((long double)evaluate_horner_double(under_y, theta) - exact);
+        summary.double_max_error = std::max(summary.double_max_error, double_error);
+        const long double rounded = evaluate_normalized_long_double(
+            normalize_q16(under_y_q16, FIXED_UNDER_Y_CENTER, FIXED_UNDER_Y_INV_HALF),
+            normalize_q16(theta_q16, FIXED_THETA_CENTER, FIXED_THETA_INV_HALF));
+        if (rounded >= OUTPUT_MIN && rounded <= OUTPUT_MAX) {
+            const double arithmetic_error = (double)std::fabs((long double)fixed / Q16_SCALE - rounded);
+            summary.arithmetic_max_error = std::max(summary.arithmetic_max_error, arithmetic_error);
+        }
+    }
+
+    summary.points++;
+    summary.sum_error += error;
+    if (error > summary.max_error) {
+        summary.max_error = error;
+        summary.worst_under_y = under_y;
+        summary.worst_theta = theta;
+    }
+    if (in_measurement_domain(under_y, theta)) {
+        summary.measured_max_error = std::max(summary.measured_max_error, error);
+    }
+}
+
+void print_summary(const char* name, const ErrorSummary& summary) {
+    std::printf("%-8s %9zu %12.3e %12.3e %9.2f %8.2f %12.3e %12.3e %12.3e %11u %10zu\n", name, summary.points,
+                summary.max_error, summary.sum_error / (double)summary.points, summary.worst_under_y,
+                summary.worst_theta, summary.measured_max_error, summary.arithmetic_max_error, summary.double_max_error,
+                (unsigned)summary.saturations, summary.saturated_outputs);
+}
+
+// 5回計測して最小の ns/予測
+template <typename Predict>
+double measure_ns(const std::vector<float>& under_y, const std::vector<float>& theta, Predict predict) {
+    double best = 1e30;
+    for (int repeat = 0; repeat < 5; repeat++) {
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < under_y.size(); i++) {
+            keep_value(predict(under_y[i], theta[i]));
+        }
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+        best = std::min(best, ns / (double)under_y.size());
+    }
+    return best;
+}
+
+bool parse_options(int argc, char** argv, ReportOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--step") == 0 && has_value) {
+            options.step = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--samples") == 0 && has_value) {
+            options.samples = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--tolerance") == 0 && has_value) {
+            options.tolerance = std::strtod(argv[++i], nullptr);
+        } else {
+            return false;
+        }
+    }
+    // 格子の間隔は Q16 の整数倍
+    const double step_q16 = options.step * Q16_SCALE;
+    return options.step > 0.0 && step_q16 == std::floor(step_q16) && options.tolerance > 0.0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    ReportOptions options;
+    if (!parse_options(argc, argv, options)) {
+        std::printf("usage: fixed_report [--step S] [--samples N] [--tolerance CM]\n");
+        return 1;
+    }
+
+    std::printf("=== fixed_report ===\n");
+    std::printf("I/O Q%d.%d, normalized inputs Q%d.%d, final stage Q%d, outputs saturate to [%.0f, %.0f] cm\n",
+                32 - FIXED_IO_FRAC_BITS, FIXED_IO_FRAC_BITS, 32 - FIXED_INPUT_FRAC_BITS, FIXED_INPUT_FRAC_BITS,
+                FIXED_OUTPUT_FRAC_BITS, (double)OUTPUT_MIN, (double)OUTPUT_MAX);
+    std::printf("reference: long double Horner, clamped to the output range\n");
+    std::printf("generator estimate: max %.3e cm (full range), %.3e cm (measurement domain)\n\n",
+                (double)FIXED_ESTIMATED_MAX_ERROR, (double)FIXED_ESTIMATED_MAX_ERROR_MEASURED);
+    std::printf("%-8s %9s %12s %12s %9s %8s %12s %12s %12s %11s %10s\n", "inputs", "points", "max |err|",
+                "mean |err|", "at u", "at t", "meas. max", "arith. max", "double max", "saturations", "sat. out");
+
+    // 入力検証範囲全体の格子 (両端を含む)
+    ErrorSummary grid;
+    const int32_t step_q16 = (int32_t)(options.step * Q16_SCALE);
+    for (int32_t u = FIXED_UNDER_Y_MIN; u <= FIXED_UNDER_Y_MAX; u += step_q16) {
+        for (int32_t t = FIXED_THETA_MIN; t <= FIXED_THETA_MAX; t += step_q16) {
+            check_point(u, t, grid);
+        }
+    }
+    print_summary("grid", grid);
+
+    // Q16 の乱数点 (格子の間)
+    ErrorSummary random;
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int32_t> pick_under_y(FIXED_UNDER_Y_MIN, FIXED_UNDER_Y_MAX);
+    std::uniform_int_distribution<int32_t> pick_theta(FIXED_THETA_MIN, FIXED_THETA_MAX);
+    for (size_t i = 0; i < options.samples; i++) {
+        const int32_t under_y_q16 = pick_under_y(rng);
+        const int32_t theta_q16 = pick_theta(rng);
+        check_point(under_y_q16, theta_q16, random);
+    }
+    print_summary("random", random);
+
+    // 速度 (ホストの参考値, 実測範囲の低食い違い量列)
+    std::vector<float> under_y(1000000);
+    std::vector<float> theta(1000000);
+    generate_domain_sweep(MEASUREMENT_DOMAIN, under_y.data(), theta.data(), under_y.size());
+    std::printf("\nhost time: fixed %.2f ns/pred, horner (double) %.2f ns/pred\n",
+                measure_ns(under_y, theta, predict_distance_fixed), measure_ns(under_y, theta, predict_distance_horner));
+
+    const double max_error = std::max(grid.max_error, random.max_error);
+    const uint32_t saturations = grid.saturations + random.saturations;
+    const bool pass = saturations == 0 && max_error <= options.tolerance;
+    std::printf("%s: max |err| %.3e cm (tolerance %.3e), %u intermediate saturations\n", pass ? "PASS" : "FAIL",
+                max_error, options.tolerance, (unsigned)saturations);
+    return pass ? 0 : 1;
+}
@@ -0,0 +1,226 @@
+/*
+ * ホスト用 予測値 + 勾配 (+ Hessian) の同時評価 (predict_distance_gradient) の速度・精度比較
+ *
+ * 実測範囲の低食い違い量列で、通常の予測 (predict_distance_teensy)・予測値 + 勾配・予測値 + 勾配 + Hessian と、
+ * 従来の差分近似 (前進差分: 3回, 中心差分: 5回の予測) の ns/評価と通常の予測に対する倍率を表示する。
+ * 精度は、同じ係数の項ごとの微分を long double で求めたものを参照として、
+ * 解析的な勾配・Hessian と差分近似 (単精度の予測の中心差分) の最大誤差を表示する。
+ * 予測値が predict_distance_teensy と一致しない点があれば終了コード 1 を返す
+ *
+ * 使い方: gradient_report [--samples N] [--step H]
+ *   --step は差分近似の刻み (under_y, theta 共通, 既定 0.01)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "predictor_engines.h"
+#include "teensy_polynomial_model.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct ReportOptions {
+    size_t samples = 200000;
+    float step = 0.01f;
+};
+
+struct ErrorStats {
+    double max_abs = 0.0;
+    double max_rel = 0.0;  // |誤差| / max(|参照|, 1)
+
+    void add(double value, long double reference) {
+        const double error = (double)std::fabs((long double)value - reference);
+        max_abs = std::max(max_abs, error);
+        max_rel = std::max(max_rel, error / std::max(1.0, (double)std::fabs(reference)));
+    }
+};
+
+inline void keep_value(float value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// 参照: 同じモデル (係数・標準化) の勾配・Hessian を long double で項ごとに微分して求める
+void reference_derivatives(float under_y, float theta, long double* gradient, long double* hessian) {
+    long double under_y_powers[POLY_DEGREE + 1];
+    long double theta_powers[POLY_DEGREE + 1];
+    under_y_powers[0] = theta_powers[0] = 1.0L;
+    for (int i = 1; i <= POLY_DEGREE; i++) {
+        under_y_powers[i] = under_y_powers[i - 1] * under_y;
+        theta_powers[i] = theta_powers[i - 1] * theta;
+    }
+    for (int c = 0; c < 2; c++) gradient[c] = 0.0L;
+    for (int c = 0; c < 3; c++) hessian[c] = 0.0L;
+    int k = 0;
+    for (int d = 0; d <= POLY_DEGREE; d++) {
+        for (int i = d; i >= 0; i--, k++) {
+            const int j = d - i;
+            const long double w = (long double)MODEL_COEFFICIENTS[k] / SCALER_SCALE[k];
+            if (i > 0) gradient[0] += w * i * under_y_powers[i - 1] * theta_powers[j];
+            if (j > 0) gradient[1] += w * j * under_y_powers[i] * theta_powers[j - 1];
+            if (i > 1) hessian[0] += w * (i * (i - 1)) * under_y_powers[i - 2] * theta_powers[j];
+            if (i > 0 && j > 0) hessian[1] += w * (i * j) * under_y_powers[i - 1] * theta_powers[j - 1];
+            if (j > 1) hessian[2] += w * (j * (j - 1)) * under_y_powers[i] * theta_powers[j - 2];
+        }
+    }
+}
+
+// 差分近似 (従来の方法)
+float forward_difference(float under_y, float theta, float step, float* gradient) {
+    const float value = predict_distance_teensy(under_y, theta);
+    gradient[0] = (predict_distance_teensy(under_y + step, theta) - value) / step;
+    gradient[1] = (predict_distance_teensy(under_y, theta + step) - value) / step;
+    return value;
+}
+
+float central_difference(float under_y, float theta, float step, float* gradient) {
+    const float value = predict_distance_teensy(under_y, theta);
+    gradient[0] = (predict_distance_teensy(under_y + step, theta) - predict_distance_teensy(under_y - step, theta)) /
+                  (2.0f * step);
+    gradient[1] = (predict_distance_teensy(under_y, theta + step) - predict_distance_teensy(under_y, theta - step)) /
+                  (2.0f * step);
+    return value;
+}
+
+// 5回計測して最小の ns/評価
+template <typename Evaluate>
+double measure_ns(const std::vector<float>& under_y, const std::vector<float>& theta, Evaluate evaluate) {
+    double best = 1e30;
+    for (int repeat = 0; repeat < 5; repeat++) {
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < under_y.size(); i++) {
+            keep_value(evaluate(under_y[i], theta[i]));
+        }
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+        best = std::min(best, ns / (double)under_y.size());
+    }
+    return best;
+}
+
+bool parse_options(int argc, char** argv, ReportOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--samples") == 0 && has_value) {
+            options.samples = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--step") == 0 && has_value) {
+            options.step = std::strtof(argv[++i], nullptr);
+        } else {
+            return false;
+        }
+    }
+    return options.samples > 0 && options.step > 0.0f;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    ReportOptions options;
+    if (!parse_options(argc, argv, options)) {
+        std::printf("usage: gradient_report [--samples N] [--step H]\n");
+        return 1;
+    }
+
+    // 実測範囲の内側 (差分近似の刻みの分だけ縮める)
+    InputDomain domain = MEASUREMENT_DOMAIN;
+    domain.under_y_min += 2.0f * options.step;
+    domain.under_y_max -= 2.0f * options.step;
+    domain.theta_min += 2.0f * options.step;
+    domain.theta_max -= 2.0f * options.step;
+    std::vector<float> under_y(options.samples);
+    std::vector<float> theta(options.samples);
+    generate_domain_sweep(domain, under_y.data(), theta.data(), options.samples);
+
+    std::printf("=== gradient_report ===\n");
+    std::printf("%zu points in the measurement domain, finite-difference step %g\n\n", options.samples,
+                (double)options.step);
+
+    const float step = options.step;
+    const double plain_ns = measure_ns(under_y, theta, predict_distance_teensy);
+    const double gradient_ns = measure_ns(under_y, theta, [](float u, float t) {
+        float gradient[2];
+        const float value = predict_distance_gradient(u, t, gradient);
+        keep_value(gradient[0]);
+        keep_value(gradient[1]);
+        return value;
+    });
+    const double hessian_ns = measure_ns(under_y, theta, [](float u, float t) {
+        float gradient[2];
+        float hessian[3];
+        const float value = predict_distance_gradient(u, t, gradient, hessian);
+        keep_value(gradient[0]);
+        keep_value(hessian[1]);
+        return value;
+    });
+    const double forward_ns = measure_ns(under_y, theta, [step](float u, float t) {
+        float gradient[2];
+        const float value = forward_difference(u, t, step, gradient);
+        keep_value(gradient[0]);
+        keep_value(gradient[1]);
+        return value;
+    });
+    const double central_ns = measure_ns(under_y, theta, [step](float u, float t) {
+        float gradient[2];
+        const float value = central_difference(u, t, step, gradient);
+        keep_value(gradient[0]);
+        keep_value(gradient[1]);
+        return value;
+    });
+
+    std::printf("%-34s %10s %10s\n", "evaluation", "ns", "x plain");
+    std::printf("%-34s %10.1f %10.2f\n", "predict_distance_teensy", plain_ns, 1.0);
+    std::printf("%-34s %10.1f %10.2f\n", "value + gradient", gradient_ns, gradient_ns / plain_ns);
+    std::printf("%-34s %10.1f %10.2f\n", "value + gradient + Hessian", hessian_ns, hessian_ns / plain_ns);
+    std::printf("%-34s %10.1f %10.2f\n", "forward difference (3 predictions)", forward_ns, forward_ns / plain_ns);
+    std::printf("%-34s %10.1f %10.2f\n", "central difference (5 predictions)", central_ns, central_ns / plain_ns);
+
+    // 精度
+    const size_t accuracy_points = std::min<size_t>(options.samples, 50000);
+    const size_t stride = options.samples / accuracy_points;
+    const char* names[5] = {"d/du", "d/dt", "d2/du2", "d2/dudt", "d2/dt2"};
+    ErrorStats analytic[5];
+    ErrorStats difference[2];
+    size_t value_mismatches = 0;
+    for (size_t n = 0; n < accuracy_points; n++) {
+        const float u = under_y[n * stride];
+        const float t = theta[n * stride];
+        float gradient[2];
+        float hessian[3];
+        const float value = predict_distance_gradient(u, t, gradient, hessian);
+        if (value != predict_distance_teensy(u, t)) {
+            value_mismatches++;
+        }
+        long double reference_gradient[2];
+        long double reference_hessian[3];
+        reference_derivatives(u, t, reference_gradient, reference_hessian);
+        float central[2];
+        central_difference(u, t, step, central);
+        for (int c = 0; c < 2; c++) {
+            analytic[c].add(gradient[c], reference_gradient[c]);
+            difference[c].add(central[c], reference_gradient[c]);
+        }
+        for (int c = 0; c < 3; c++) {
+            analytic[2 + c].add(hessian[c], reference_hessian[c]);
+        }
+    }
+
+    std::printf("\naccuracy vs long double derivatives (%zu points, rel = |err| / max(|ref|, 1)):\n",
+                accuracy_points);
+    std::printf("%-9s %14s %14s %14s %14s\n", "", "analytic abs", "analytic rel", "central abs", "central rel");
+    for (int c = 0; c < 5; c++) {
+        if (c < 2) {
+            std::printf("%-9s %14.3e %14.3e %14.3e %14.3e\n", names[c], analytic[c].max_abs, analytic[c].max_rel,
+                        difference[c].max_abs, difference[c].max_rel);
+        } else {
+            std::printf("%-9s %14.3e %14.3e %14s %14s\n", names[c], analytic[c].max_abs, analytic[c].max_rel, "-",
+                        "-");
+        }
+    }
+    std::printf("value vs predict_distance_teensy: %zu mismatches\n", value_mismatches);
+    return value_mismatches == 0 ? 0 : 1;
+}
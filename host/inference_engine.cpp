@@ -0,0 +1,202 @@
+/*
+ * ホスト用 マルチスレッド推論エンジンの実装
+ */
+
+#include "inference_engine.h"
+
+#include <algorithm>
+
+#include "simd_predictor.h"
+
+namespace {
+
+inline uint64_t pack_range(uint32_t begin, uint32_t end) {
+    return ((uint64_t)begin << 32) | end;
+}
+
+inline uint32_t range_begin(uint64_t range) { return (uint32_t)(range >> 32); }
+inline uint32_t range_end(uint64_t range) { return (uint32_t)range; }
+
+// 格子のi番目の座標 (両端を含む等間隔)
+inline float grid_value(float min_value, float max_value, size_t steps, size_t index) {
+    if (steps <= 1) {
+        return min_value;
+    }
+    return (float)(min_value + (double)(max_value - min_value) * (double)index / (double)(steps - 1));
+}
+
+}  // namespace
+
+InferenceEngine::InferenceEngine(unsigned thread_count, PredictBatchFunction kernel, size_t chunk_size)
+    : kernel_(kernel != nullptr ? kernel : predict_distance_batch_simd),
+      chunk_size_(std::max<size_t>(16, (chunk_size + 15) / 16 * 16)) {
+    if (thread_count == 0) {
+        thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    queue_storage_.reset(new WorkQueue[thread_count]);
+    for (unsigned i = 0; i < thread_count; i++) {
+        queues_.push_back(&queue_storage_[i]);
+    }
+    scratch_.resize(thread_count);
+    for (WorkerScratch& scratch : scratch_) {
+        scratch.under_y.resize(chunk_size_);
+        scratch.theta.resize(chunk_size_);
+    }
+
+    // ワーカー0は呼び出しスレッド自身
+    for (unsigned i = 1; i < thread_count; i++) {
+        threads_.emplace_back(&InferenceEngine::worker_loop, this, i);
+    }
+}
+
+InferenceEngine::~InferenceEngine() {
+    {
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        shutting_down_ = true;
+    }
+    start_cv_.notify_all();
+    for (std::thread& thread : threads_) {
+        thread.join();
+    }
+}
+
+void InferenceEngine::predict(const float* under_y, const float* theta, float* out, size_t n) {
+    Job job = {JOB_ARRAYS, under_y, theta, nullptr, out, n};
+    run_job(job);
+}
+
+void InferenceEngine::predict_grid(const GridSpec& grid, float* out) {
+    Job job = {JOB_GRID, nullptr, nullptr, &grid, out, grid.size()};
+    run_job(job);
+}
+
+void InferenceEngine::run_job(const Job& job) {
+    if (job.n == 0) {
+        return;
+    }
+
+    // チャンクをワーカー数で等分して各キューに配る
+    const unsigned workers = thread_count();
+    const uint64_t chunk_count = (job.n + chunk_size_ - 1) / chunk_size_;
+    for (unsigned w = 0; w < workers; w++) {
+        uint32_t begin = (uint32_t)(chunk_count * w / workers);
+        uint32_t end = (uint32_t)(chunk_count * (w + 1) / workers);
+        queues_[w]->range.store(pack_range(begin, end), std::memory_order_relaxed);
+    }
+    steal_count_.store(0, std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        job_ = job;
+        active_workers_ = workers - 1;
+        generation_++;
+    }
+    start_cv_.notify_all();
+
+    drain_queues(0);
+
+    std::unique_lock<std::mutex> lock(control_mutex_);
+    done_cv_.wait(lock, [this] { return active_workers_ == 0; });
+}
+
+void InferenceEngine::worker_loop(unsigned worker_index) {
+    uint64_t seen_generation = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(control_mutex_);
+            start_cv_.wait(lock, [&] { return shutting_down_ || generation_ != seen_generation; });
+            if (shutting_down_) {
+                return;
+            }
+            seen_generation = generation_;
+        }
+
+        drain_queues(worker_index);
+
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        if (--active_workers_ == 0) {
+            done_cv_.notify_one();
+        }
+    }
+}
+
+void InferenceEngine::drain_queues(unsigned worker_index) {
+    uint32_t chunk;
+    for (;;) {
+        while (take_chunk(worker_index, chunk)) {
+            process_chunk(worker_index, chunk);
+        }
+        if (!steal_chunks(worker_index)) {
+            return;
+        }
+    }
+}
+
+// 自分のキューの先頭から1チャンク取り出す
+bool InferenceEngine::take_chunk(unsigned worker_index, uint32_t& chunk) {
+    std::atomic<uint64_t>& range = queues_[worker_index]->range;
+    uint64_t current = range.load(std::memory_order_acquire);
+    for (;;) {
+        uint32_t begin = range_begin(current);
+        uint32_t end = range_end(current);
+        if (begin >= end) {
+            return false;
+        }
+        if (range.compare_exchange_weak(current, pack_range(begin + 1, end), std::memory_order_acq_rel)) {
+            chunk = begin;
+            return true;
+        }
+    }
+}
+
+// 他ワーカーのキューの後半を盗んで自分のキューに移す (自分のキューが空のときのみ呼ぶ)
+bool InferenceEngine::steal_chunks(unsigned worker_index) {
+    const unsigned workers = thread_count();
+    for (unsigned offset = 1; offset < workers; offset++) {
+        std::atomic<uint64_t>& victim = queues_[(worker_index + offset) % workers]->range;
+        uint64_t current = victim.load(std::memory_order_acquire);
+        for (;;) {
+            uint32_t begin = range_begin(current);
+            uint32_t end = range_end(current);
+            if (begin >= end) {
+                break;
+            }
+            uint32_t stolen = (end - begin + 1) / 2;
+            if (victim.compare_exchange_weak(current, pack_range(begin, end - stolen), std::memory_order_acq_rel)) {
+                queues_[worker_index]->range.store(pack_range(end - stolen, end), std::memory_order_release);
+                steal_count_.fetch_add(stolen, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void InferenceEngine::process_chunk(unsigned worker_index, uint32_t chunk) {
+    const Job& job = job_;
+    size_t begin = (size_t)chunk * chunk_size_;
+    size_t count = std::min(chunk_size_, job.n - begin);
+
+    if (job.kind == JOB_ARRAYS) {
+        kernel_(job.under_y + begin, job.theta + begin, job.out + begin, count);
+        return;
+    }
+
+    // 格子座標をワーカー専用バッファに展開してからバッチ評価
+    const GridSpec& grid = *job.grid;
+    WorkerScratch& scratch = scratch_[worker_index];
+    size_t row = begin / grid.theta_steps;
+    size_t column = begin % grid.theta_steps;
+    float under_y = grid_value(grid.under_y_min, grid.under_y_max, grid.under_y_steps, row);
+    for (size_t k = 0; k < count; k++) {
+        scratch.under_y[k] = under_y;
+        scratch.theta[k] = grid_value(grid.theta_min, grid.theta_max, grid.theta_steps, column);
+        if (++column == grid.theta_steps) {
+            column = 0;
+            row++;
+            under_y = grid_value(grid.under_y_min, grid.under_y_max, grid.under_y_steps, row);
+        }
+    }
+    kernel_(scratch.under_y.data(), scratch.theta.data(), job.out + begin, count);
+}
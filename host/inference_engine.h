@@ -0,0 +1,110 @@
+/*
+ * ホスト用 マルチスレッド推論エンジン
+ *
+ * 大量の入力配列または規則格子 (under_y × theta) をチャンクに分割し、
+ * ワークスティーリング付きスレッドプールで並列に予測する。
+ * - 各ワーカーは自分のチャンク範囲を先頭から消化し、空になると他ワーカーの範囲の後半を盗む
+ * - 格子入力は各ワーカー専用のバッファで生成し、結果は出力配列の重ならない区間へ直接書き込む
+ *   (結果書き込みにグローバルロックは不要)
+ */
+
+#ifndef HOST_INFERENCE_ENGINE_H
+#define HOST_INFERENCE_ENGINE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "predictor_engines.h"
+
+// 規則格子の指定 (両端を含む等間隔, 出力は under_y 行 × theta 列の行優先)
+struct GridSpec {
+    float under_y_min;
+    float under_y_max;
+    size_t under_y_steps;
+    float theta_min;
+    float theta_max;
+    size_t theta_steps;
+
+    size_t size() const { return under_y_steps * theta_steps; }
+};
+
+class InferenceEngine {
+public:
+    // thread_count: 呼び出しスレッドを含む並列数 (0ならハードウェアスレッド数)
+    // chunk_size: 1タスクあたりのサンプル数 (16の倍数に切り上げ、キャッシュライン境界を揃える)
+    explicit InferenceEngine(unsigned thread_count = 0,
+                             PredictBatchFunction kernel = nullptr,
+                             size_t chunk_size = 4096);
+    ~InferenceEngine();
+
+    InferenceEngine(const InferenceEngine&) = delete;
+    InferenceEngine& operator=(const InferenceEngine&) = delete;
+
+    // n個の入力を並列に予測
+    void predict(const float* under_y, const float* theta, float* out, size_t n);
+
+    // 格子全体を並列に予測 (out は grid.size() 要素)
+    void predict_grid(const GridSpec& grid, float* out);
+
+    unsigned thread_count() const { return (unsigned)queues_.size(); }
+    size_t chunk_size() const { return chunk_size_; }
+
+    // 直近のジョブで他ワーカーから盗んだチャンク数
+    uint64_t last_steal_count() const { return steal_count_.load(std::memory_order_relaxed); }
+
+private:
+    // チャンク範囲 [begin, end) を1語にまとめ、所有者と盗む側の両方がCASで更新する
+    struct alignas(64) WorkQueue {
+        std::atomic<uint64_t> range{0};
+    };
+
+    // ワーカーごとの格子入力生成用バッファ
+    struct WorkerScratch {
+        std::vector<float> under_y;
+        std::vector<float> theta;
+    };
+
+    enum JobKind { JOB_ARRAYS, JOB_GRID };
+
+    struct Job {
+        JobKind kind;
+        const float* under_y;
+        const float* theta;
+        const GridSpec* grid;
+        float* out;
+        size_t n;
+    };
+
+    void run_job(const Job& job);
+    void worker_loop(unsigned worker_index);
+    void drain_queues(unsigned worker_index);
+    bool take_chunk(unsigned worker_index, uint32_t& chunk);
+    bool steal_chunks(unsigned worker_index);
+    void process_chunk(unsigned worker_index, uint32_t chunk);
+
+    PredictBatchFunction kernel_;
+    size_t chunk_size_;
+    std::unique_ptr<WorkQueue[]> queue_storage_;
+    std::vector<WorkQueue*> queues_;
+    std::vector<WorkerScratch> scratch_;
+    std::vector<std::thread> threads_;
+
+    // ジョブの開始・終了通知 (結果の書き込みには使わない)
+    std::mutex control_mutex_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    uint64_t generation_ = 0;
+    unsigned active_workers_ = 0;
+    bool shutting_down_ = false;
+
+    Job job_{};
+    std::atomic<uint64_t> steal_count_{0};
+};
+
+#endif // HOST_INFERENCE_ENGINE_H
@@ -0,0 +1,52 @@
+/*
+ * ホスト用 読み取り専用メモリマップファイルの実装
+ */
+
+#include "mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+MappedFile::~MappedFile() {
+    if (size_ > 0) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+}
+
+bool MappedFile::open(const std::string& path, std::string& error, bool sequential) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error = path + ": " + std::strerror(errno);
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        error = path + ": " + std::strerror(errno);
+        ::close(fd);
+        return false;
+    }
+    size_ = (size_t)info.st_size;
+    if (size_ == 0) {
+        ::close(fd);
+        data_ = "";
+        error.clear();
+        return true;
+    }
+    void* mapped = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        error = path + ": " + std::strerror(errno);
+        size_ = 0;
+        return false;
+    }
+    if (sequential) {
+        madvise(mapped, size_, MADV_SEQUENTIAL);
+    }
+    data_ = (const char*)mapped;
+    return true;
+}
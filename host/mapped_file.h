@@ -0,0 +1,32 @@
+/*
+ * ホスト用 読み取り専用メモリマップファイル
+ * CSVストリーミング採点とバイナリモデルの読み込みで共用する
+ */
+
+#ifndef HOST_MAPPED_FILE_H
+#define HOST_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // 失敗時はfalseを返し、errorに理由を格納
+    // sequential: 先頭から1回だけ読む場合はtrue (先読みを強める)
+    bool open(const std::string& path, std::string& error, bool sequential = true);
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+#endif // HOST_MAPPED_FILE_H
@@ -0,0 +1,221 @@
+/*
+ * ホスト用 バイナリモデル (.dpm) の検査・切り替え試験ツール
+ *
+ * info: 各ファイルを読み込んでヘッダ・CRC32・読み込み時間を表示し、
+ *       組み込みの17次モデル (Horner) との予測の最大差を学習領域の格子で比較する
+ * swap: 予測スレッドを動かしたまま2つのモデルを交互に切り替え、
+ *       切り替え時間・予測スループット・バッチ内でモデルが混ざっていないかを確認する
+ *
+ * 使い方: model_blob info FILE.dpm...
+ *         model_blob swap A.dpm B.dpm [--threads N] [--seconds S] [--interval-ms M]
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "model_store.h"
+#include "predictor_engines.h"
+#include "teensy_horner_model.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+double elapsed_us(Clock::time_point start, Clock::time_point end) {
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() * 1e-3;
+}
+
+// 組み込みモデルとの最大差 (両方が有効な入力のみ)
+double max_difference_from_builtin(const RuntimeModel& model, size_t grid_size) {
+    const InputDomain& domain = TRAINING_DOMAIN;
+    double max_difference = 0.0;
+    for (size_t i = 0; i < grid_size; i++) {
+        float under_y = domain.under_y_min + (domain.under_y_max - domain.under_y_min) * (float)i / (float)(grid_size - 1);
+        for (size_t j = 0; j < grid_size; j++) {
+            float theta = domain.theta_min + (domain.theta_max - domain.theta_min) * (float)j / (float)(grid_size - 1);
+            float value = predict_distance_runtime(model, under_y, theta);
+            float builtin = predict_distance_horner(under_y, theta);
+            if (value == -1.0f || builtin == -1.0f) {
+                continue;
+            }
+            max_difference = std::max(max_difference, (double)std::fabs(value - builtin));
+        }
+    }
+    return max_difference;
+}
+
+int run_info(int argc, char** argv) {
+    if (argc < 3) {
+        return -1;
+    }
+    int failures = 0;
+    for (int i = 2; i < argc; i++) {
+        std::string error;
+        Clock::time_point start = Clock::now();
+        std::shared_ptr<LoadedModel> loaded = load_model_blob(argv[i], error);
+        Clock::time_point end = Clock::now();
+        if (!loaded) {
+            std::printf("%s: FAILED (%s)\n", argv[i], error.c_str());
+            failures++;
+            continue;
+        }
+        const RuntimeModel& model = loaded->model;
+        std::printf("%s\n", argv[i]);
+        std::printf("  degree %d, %d terms, %zu bytes, CRC32 %08x, validation MAE %.4f\n",
+                    model.degree, model.term_count, loaded->file.size(), loaded->crc32, model.validation_mae);
+        std::printf("  input range: under_y %.1f..%.1f, theta %.1f..%.1f\n",
+                    model.under_y_min, model.under_y_max, model.theta_min, model.theta_max);
+        std::printf("  load (mmap + verify): %.1f us\n", elapsed_us(start, end));
+        std::printf("  max |diff| vs built-in degree-%d model (training domain): %.3e\n",
+                    POLY_DEGREE, max_difference_from_builtin(model, 201));
+    }
+    return failures > 0 ? 1 : 0;
+}
+
+struct SwapOptions {
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    double seconds = 2.0;
+    double interval_ms = 1.0;
+};
+
+struct WorkerResult {
+    uint64_t batches = 0;
+    uint64_t mixed_batches = 0;  // 2つのモデルの出力が混ざったバッチ
+    double max_batch_us = 0.0;
+};
+
+int run_swap(int argc, char** argv) {
+    if (argc < 4) {
+        return -1;
+    }
+    const std::string paths[2] = {argv[2], argv[3]};
+    SwapOptions options;
+    for (int i = 4; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--threads") == 0 && has_value) {
+            options.threads = (unsigned)std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--seconds") == 0 && has_value) {
+            options.seconds = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--interval-ms") == 0 && has_value) {
+            options.interval_ms = std::strtod(argv[++i], nullptr);
+        } else {
+            return -1;
+        }
+    }
+    if (options.threads == 0) {
+        return -1;
+    }
+
+    // 各モデルの期待出力 (バッチ内の全出力がどちらか一方と一致するはず)
+    const size_t BATCH = 1024;
+    std::vector<float> under_y(BATCH);
+    std::vector<float> theta(BATCH);
+    generate_domain_sweep(TRAINING_DOMAIN, under_y.data(), theta.data(), BATCH);
+    std::vector<float> expected[2];
+    for (int k = 0; k < 2; k++) {
+        std::string error;
+        std::shared_ptr<LoadedModel> loaded = load_model_blob(paths[k], error);
+        if (!loaded) {
+            std::fprintf(stderr, "%s\n", error.c_str());
+            return 1;
+        }
+        expected[k].resize(BATCH);
+        for (size_t i = 0; i < BATCH; i++) {
+            expected[k][i] = predict_distance_runtime(loaded->model, under_y[i], theta[i]);
+        }
+    }
+
+    ModelStore store;
+    std::string error;
+    if (!store.load(paths[0], error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    std::atomic<bool> running(true);
+    std::vector<WorkerResult> results(options.threads);
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < options.threads; t++) {
+        workers.emplace_back([&, t]() {
+            std::vector<float> out(BATCH);
+            WorkerResult& result = results[t];
+            while (running.load(std::memory_order_relaxed)) {
+                Clock::time_point start = Clock::now();
+                uint64_t generation = store.predict_batch(under_y.data(), theta.data(), out.data(), BATCH);
+                result.max_batch_us = std::max(result.max_batch_us, elapsed_us(start, Clock::now()));
+                // 世代の奇数は paths[0]、偶数は paths[1]
+                const std::vector<float>& reference = expected[(generation + 1) % 2];
+                if (std::memcmp(out.data(), reference.data(), BATCH * sizeof(float)) != 0) {
+                    result.mixed_batches++;
+                }
+                result.batches++;
+            }
+        });
+    }
+
+    // 切り替え側: 交互に読み込み直す
+    size_t swaps = 0;
+    double total_swap_us = 0.0;
+    double max_swap_us = 0.0;
+    Clock::time_point begin = Clock::now();
+    Clock::time_point deadline = begin + std::chrono::microseconds((long long)(options.seconds * 1e6));
+    while (Clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::microseconds((long long)(options.interval_ms * 1e3)));
+        Clock::time_point start = Clock::now();
+        if (!store.load(paths[(swaps + 1) % 2], error)) {
+            std::fprintf(stderr, "%s\n", error.c_str());
+            break;
+        }
+        double swap_us = elapsed_us(start, Clock::now());
+        total_swap_us += swap_us;
+        max_swap_us = std::max(max_swap_us, swap_us);
+        swaps++;
+    }
+    running = false;
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    double seconds = elapsed_us(begin, Clock::now()) * 1e-6;
+
+    WorkerResult total;
+    for (const WorkerResult& result : results) {
+        total.batches += result.batches;
+        total.mixed_batches += result.mixed_batches;
+        total.max_batch_us = std::max(total.max_batch_us, result.max_batch_us);
+    }
+    std::printf("=== model_blob swap ===\n");
+    std::printf("models: %s <-> %s\n", paths[0].c_str(), paths[1].c_str());
+    std::printf("threads: %u, duration: %.2f s, swaps: %zu\n", options.threads, seconds, swaps);
+    std::printf("swap (load + verify + publish): mean %.1f us, max %.1f us\n",
+                swaps > 0 ? total_swap_us / (double)swaps : 0.0, max_swap_us);
+    std::printf("predictions: %.2f M/s, max batch latency: %.1f us (batch %zu)\n",
+                (double)(total.batches * BATCH) / seconds * 1e-6, total.max_batch_us, BATCH);
+    std::printf("batches: %llu, mixed-model batches: %llu\n",
+                (unsigned long long)total.batches, (unsigned long long)total.mixed_batches);
+    return total.mixed_batches == 0 ? 0 : 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int status = -1;
+    if (argc >= 2 && std::strcmp(argv[1], "info") == 0) {
+        status = run_info(argc, argv);
+    } else if (argc >= 2 && std::strcmp(argv[1], "swap") == 0) {
+        status = run_swap(argc, argv);
+    }
+    if (status < 0) {
+        std::printf("usage: model_blob info FILE.dpm...\n"
+                    "       model_blob swap A.dpm B.dpm [--threads N] [--seconds S] [--interval-ms M]\n");
+        return 1;
+    }
+    return status;
+}
@@ -0,0 +1,101 @@
+/*
+ * ホスト用 バイナリモデル (.dpm) の読み込みと無停止の切り替えの実装
+ */
+
+#include "model_store.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+std::shared_ptr<LoadedModel> load_model_blob(const std::string& path, std::string& error) {
+    std::shared_ptr<LoadedModel> loaded = std::make_shared<LoadedModel>();
+    // 係数は評価のたびに全体を読むため、順次読み出しの先読み指定はしない
+    if (!loaded->file.open(path, error, false)) {
+        return nullptr;
+    }
+    // mmapの先頭はページ境界なので係数の8バイト境界も満たす
+    const uint8_t* data = (const uint8_t*)loaded->file.data();
+    ModelBlobStatus status = parse_model_blob(data, loaded->file.size(), loaded->model);
+    if (status != MODEL_BLOB_OK) {
+        error = path + ": " + model_blob_status_name(status);
+        return nullptr;
+    }
+    std::memcpy(&loaded->crc32, data + offsetof(ModelBlobHeader, crc32), sizeof(loaded->crc32));
+    loaded->path = path;
+    loaded->generation = 0;
+    return loaded;
+}
+
+bool write_model_blob(const std::string& path, const RuntimeModel& model, std::string& error) {
+    const size_t coefficient_bytes = sizeof(double) * (size_t)model.term_count;
+    std::vector<uint8_t> blob(MODEL_BLOB_HEADER_SIZE + coefficient_bytes);
+
+    ModelBlobHeader header = {};
+    header.magic = MODEL_BLOB_MAGIC;
+    header.version = MODEL_BLOB_VERSION;
+    header.header_size = MODEL_BLOB_HEADER_SIZE;
+    header.degree = (uint16_t)model.degree;
+    header.basis = MODEL_BASIS_MONOMIAL_HORNER;
+    header.term_count = (uint32_t)model.term_count;
+    header.coefficient_offset = MODEL_BLOB_HEADER_SIZE;
+    header.intercept = model.intercept;
+    header.under_y_min = model.under_y_min;
+    header.under_y_max = model.under_y_max;
+    header.theta_min = model.theta_min;
+    header.theta_max = model.theta_max;
+    header.validation_mae = model.validation_mae;
+    std::memcpy(blob.data(), &header, sizeof(header));
+    std::memcpy(blob.data() + MODEL_BLOB_HEADER_SIZE, model.coefficients, coefficient_bytes);
+    header.crc32 = model_blob_crc32(blob.data(), offsetof(ModelBlobHeader, crc32));
+    header.crc32 = model_blob_crc32(blob.data() + MODEL_BLOB_HEADER_SIZE, coefficient_bytes, header.crc32);
+    std::memcpy(blob.data() + offsetof(ModelBlobHeader, crc32), &header.crc32, sizeof(header.crc32));
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        error = path + ": cannot open for writing";
+        return false;
+    }
+    const bool written = std::fwrite(blob.data(), 1, blob.size(), file) == blob.size();
+    if (std::fclose(file) != 0 || !written) {
+        error = path + ": write failed";
+        return false;
+    }
+    return true;
+}
+
+bool ModelStore::load(const std::string& path, std::string& error) {
+    std::shared_ptr<LoadedModel> loaded = load_model_blob(path, error);
+    if (!loaded) {
+        return false;
+    }
+    loaded->generation = ++generation_;
+    std::atomic_store(&active_, std::shared_ptr<const LoadedModel>(std::move(loaded)));
+    return true;
+}
+
+std::shared_ptr<const LoadedModel> ModelStore::active() const {
+    return std::atomic_load(&active_);
+}
+
+float ModelStore::predict(float under_y, float theta) const {
+    std::shared_ptr<const LoadedModel> loaded = active();
+    return loaded ? predict_distance_runtime(loaded->model, under_y, theta) : -1.0f;
+}
+
+uint64_t ModelStore::predict_batch(const float* under_y, const float* theta, float* out, size_t n) const {
+    std::shared_ptr<const LoadedModel> loaded = active();
+    if (!loaded) {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = -1.0f;
+        }
+        return 0;
+    }
+    const RuntimeModel& model = loaded->model;
+    for (size_t i = 0; i < n; i++) {
+        out[i] = predict_distance_runtime(model, under_y[i], theta[i]);
+    }
+    return loaded->generation;
+}
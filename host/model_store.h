@@ -0,0 +1,54 @@
+/*
+ * ホスト用 バイナリモデル (.dpm) の読み込みと無停止の切り替え
+ *
+ * ファイルをメモリマップし、ヘッダとCRC32を検証するだけで係数はマップ領域を直接評価する (解析・コピーなし)。
+ * アクティブなモデルは shared_ptr をアトミックに差し替えるため、切り替え中も予測スレッドは止まらず、
+ * 古いモデルは最後の参照が外れた時点でアンマップされる
+ */
+
+#ifndef HOST_MODEL_STORE_H
+#define HOST_MODEL_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "mapped_file.h"
+#include "teensy_model_blob.h"
+
+struct LoadedModel {
+    std::string path;
+    MappedFile file;
+    RuntimeModel model;
+    uint32_t crc32;
+    uint64_t generation;  // ModelStoreで何回目に読み込んだか (1から)
+};
+
+// path を読み込んで検証する (失敗時はnullptrを返し、errorに理由を格納)
+std::shared_ptr<LoadedModel> load_model_blob(const std::string& path, std::string& error);
+
+// model (係数はHorner評価順) を export_teensy_model.py blob と同じ形式の .dpm として path に書き出す
+// (失敗時はfalseを返し、errorに理由を格納)
+bool write_model_blob(const std::string& path, const RuntimeModel& model, std::string& error);
+
+class ModelStore {
+public:
+    // 読み込みと検証に成功した場合のみアクティブなモデルを差し替える
+    bool load(const std::string& path, std::string& error);
+
+    // 現在のモデル (未読み込みならnullptr)。予測の間は戻り値を保持しておくこと
+    std::shared_ptr<const LoadedModel> active() const;
+
+    // 1回だけ予測する場合の簡易版 (未読み込みなら -1.0f)
+    float predict(float under_y, float theta) const;
+
+    // バッチ全体を同じモデルで予測し、使用したモデルの世代を返す (未読み込みなら0)
+    uint64_t predict_batch(const float* under_y, const float* theta, float* out, size_t n) const;
+
+private:
+    std::shared_ptr<const LoadedModel> active_;
+    uint64_t generation_ = 0;  // load() の呼び出し側で直列化すること
+};
+
+#endif // HOST_MODEL_STORE_H
@@ -0,0 +1,244 @@
+/*
+ * ホスト用 取得→推論→出力パイプライン (SamplePipeline) のシミュレーション
+ *
+ * 取得段・推論段・出力段をそれぞれ別スレッドで動かし、取得段は指定したサンプルレートで
+ * 実測範囲の低食い違い量列を入れる (予定時刻を過ぎた分はまとめて入れる = 割り込みの遅れを模す)。
+ * サンプルレートごとに、受け付け・取りこぼし数、推論のスループットと平均バッチ長、
+ * サンプルキューの平均・最大件数、取得から推論完了までの遅延 (p50/p99/最大) を表示し、
+ * 取りこぼしなく処理できたか (sustained) を判定する
+ *
+ * 使い方: pipeline_sim [--rate HZ ...] [--seconds S] [--batch N] [--output-delay-ns NS] [--verify]
+ *   --rate 0 は取得段を待たずに回す (上限のスループットの測定)
+ *   --output-delay-ns は出力段の1件あたりの処理時間 (シリアル送信など) を模す
+ *   --verify は出力段で結果を predict_distance_selected と比較する
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "predictor_engines.h"
+#include "teensy_precision_model.h"
+#include "teensy_sample_pipeline.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct SimOptions {
+    std::vector<double> rates;
+    double seconds = 1.0;
+    uint32_t batch = PIPELINE_BATCH_SIZE;
+    uint32_t output_delay_ns = 0;
+    bool verify = false;
+};
+
+struct SimResult {
+    PipelineStats stats;
+    double elapsed_s = 0.0;
+    double mean_depth = 0.0;
+    uint32_t mismatches = 0;
+    std::vector<uint32_t> latency_cycles;
+};
+
+const size_t INPUT_COUNT = 1 << 16;
+
+// 指定時間だけ待つ (1コアの環境でも他のスレッドが動けるよう yield する)
+void spin_for(uint32_t ns) {
+    if (ns == 0) {
+        return;
+    }
+    Clock::time_point until = Clock::now() + std::chrono::nanoseconds(ns);
+    while (Clock::now() < until) {
+        std::this_thread::yield();
+    }
+}
+
+SimResult run_simulation(double rate, const SimOptions& options, const std::vector<float>& under_y,
+                         const std::vector<float>& theta) {
+    static SamplePipeline pipeline;
+    pipeline.reset_stats();
+    SimResult result;
+    result.latency_cycles.reserve(rate > 0.0 ? (size_t)(rate * options.seconds * 1.1) : 1 << 22);
+
+    std::atomic<bool> acquiring(true);
+    std::atomic<bool> inferring(true);
+    std::atomic<bool> emitting(true);
+    const Clock::time_point start = Clock::now();
+    const Clock::time_point stop = start + std::chrono::duration_cast<Clock::duration>(
+                                               std::chrono::duration<double>(options.seconds));
+
+    // 取得段: 予定時刻 start + i / rate を過ぎたサンプルをすべて入れる
+    std::thread acquisition([&]() {
+        uint64_t index = 0;
+        while (true) {
+            Clock::time_point now = Clock::now();
+            if (now >= stop) {
+                break;
+            }
+            uint64_t due = rate > 0.0 ? (uint64_t)(std::chrono::duration<double>(now - start).count() * rate)
+                                      : index + 1;
+            for (; index < due; index++) {
+                pipeline.push_sample(under_y[index % INPUT_COUNT], theta[index % INPUT_COUNT]);
+            }
+            if (rate > 0.0) {
+                std::this_thread::yield();
+            }
+        }
+        acquiring.store(false);
+    });
+
+    // 推論段: 空なら他のスレッドに譲る (取得段の終了後はキューを空にしてから終わる)
+    std::thread inference([&]() {
+        while (true) {
+            if (pipeline.run_inference(options.batch) == 0) {
+                if (!acquiring.load() && pipeline.sample_depth() == 0) {
+                    break;
+                }
+                std::this_thread::yield();
+            }
+        }
+        inferring.store(false);
+    });
+
+    // 出力段: 遅延を記録し、必要なら結果を検証する
+    std::thread output([&]() {
+        PipelineResult item;
+        while (true) {
+            if (!pipeline.pop_result(item)) {
+                if (!inferring.load() && pipeline.result_depth() == 0) {
+                    break;
+                }
+                std::this_thread::yield();
+                continue;
+            }
+            const uint32_t now = profiler_cycles();
+            result.latency_cycles.push_back(now - item.acquired_cycles);
+            if (options.verify && item.distance != predict_distance_selected(item.under_y, item.theta)) {
+                result.mismatches++;
+            }
+            spin_for(options.output_delay_ns);
+        }
+        emitting.store(false);
+    });
+
+    // 監視: サンプルキューの件数を定期的に標本化
+    uint64_t depth_sum = 0;
+    uint64_t depth_samples = 0;
+    while (emitting.load()) {
+        depth_sum += pipeline.sample_depth();
+        depth_samples++;
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    acquisition.join();
+    inference.join();
+    output.join();
+
+    result.elapsed_s = std::chrono::duration<double>(Clock::now() - start).count();
+    result.stats = pipeline.stats();
+    result.mean_depth = depth_samples > 0 ? (double)depth_sum / (double)depth_samples : 0.0;
+    return result;
+}
+
+float latency_percentile_us(std::vector<uint32_t>& latency_cycles, double p) {
+    if (latency_cycles.empty()) {
+        return 0.0f;
+    }
+    size_t rank = std::min(latency_cycles.size() - 1, (size_t)(p * (double)latency_cycles.size()));
+    std::nth_element(latency_cycles.begin(), latency_cycles.begin() + rank, latency_cycles.end());
+    return profiler_cycles_to_us(latency_cycles[rank]);
+}
+
+bool parse_options(int argc, char** argv, SimOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--rate") == 0 && has_value) {
+            while (i + 1 < argc && argv[i + 1][0] != '-') {
+                options.rates.push_back(std::strtod(argv[++i], nullptr));
+            }
+        } else if (std::strcmp(argv[i], "--seconds") == 0 && has_value) {
+            options.seconds = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--batch") == 0 && has_value) {
+            options.batch = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--output-delay-ns") == 0 && has_value) {
+            options.output_delay_ns = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--verify") == 0) {
+            options.verify = true;
+        } else {
+            return false;
+        }
+    }
+    if (options.rates.empty()) {
+        options.rates = {1000.0, 10000.0, 100000.0, 1000000.0, 0.0};
+    }
+    for (double rate : options.rates) {
+        if (rate < 0.0) {
+            return false;
+        }
+    }
+    return options.seconds > 0.0 && options.batch >= 1 && options.batch <= PIPELINE_BATCH_SIZE;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    SimOptions options;
+    if (!parse_options(argc, argv, options)) {
+        std::printf("usage: pipeline_sim [--rate HZ ...] [--seconds S] [--batch N] [--output-delay-ns NS] "
+                    "[--verify]\n");
+        return 1;
+    }
+    profiler_calibrate();
+
+    std::vector<float> under_y(INPUT_COUNT);
+    std::vector<float> theta(INPUT_COUNT);
+    generate_domain_sweep(MEASUREMENT_DOMAIN, under_y.data(), theta.data(), INPUT_COUNT);
+
+    std::printf("=== pipeline_sim ===\n");
+    std::printf("queues: %d samples / %d results, batch <= %u, %.2f s per rate, output delay %u ns, %u hw threads\n",
+                PIPELINE_SAMPLE_QUEUE_SIZE, PIPELINE_RESULT_QUEUE_SIZE, (unsigned)options.batch, options.seconds,
+                (unsigned)options.output_delay_ns, std::thread::hardware_concurrency());
+    std::printf("%-10s %10s %9s %7s %12s %7s %7s %6s %9s %9s %9s %s\n", "rate Hz", "acquired", "dropped", "drop %",
+                "infer /s", "batch", "depth", "max", "p50 us", "p99 us", "max us", "status");
+
+    bool consistent = true;
+    for (double rate : options.rates) {
+        SimResult result = run_simulation(rate, options, under_y, theta);
+        const PipelineStats& stats = result.stats;
+        const uint32_t offered = stats.acquired + stats.dropped;
+        const double drop_percent = offered > 0 ? 100.0 * stats.dropped / offered : 0.0;
+        const double mean_batch = stats.batches > 0 ? (double)stats.inferred / stats.batches : 0.0;
+        const float p50 = latency_percentile_us(result.latency_cycles, 0.50);
+        const float p99 = latency_percentile_us(result.latency_cycles, 0.99);
+        const float max_latency = latency_percentile_us(result.latency_cycles, 1.0);
+        const bool lossless = stats.inferred == stats.acquired && stats.emitted == stats.acquired;
+        const bool sustained = rate == 0.0 || (stats.dropped == 0 && lossless);
+
+        char rate_text[32];
+        if (rate > 0.0) {
+            std::snprintf(rate_text, sizeof(rate_text), "%.0f", rate);
+        } else {
+            std::snprintf(rate_text, sizeof(rate_text), "max");
+        }
+        std::printf("%-10s %10u %9u %7.2f %12.0f %7.1f %7.1f %6u %9.2f %9.2f %9.2f %s\n", rate_text,
+                    (unsigned)stats.acquired, (unsigned)stats.dropped, drop_percent,
+                    (double)stats.inferred / result.elapsed_s, mean_batch, result.mean_depth,
+                    (unsigned)stats.max_sample_depth, p50, p99, max_latency,
+                    rate == 0.0 ? "-" : (sustained ? "sustained" : "DROPS"));
+        if (!lossless) {
+            std::printf("  error: %u acquired but %u inferred / %u emitted\n", (unsigned)stats.acquired,
+                        (unsigned)stats.inferred, (unsigned)stats.emitted);
+        }
+        if (options.verify) {
+            std::printf("  verify: %u mismatches vs predict_distance_selected\n", (unsigned)result.mismatches);
+        }
+        consistent = consistent && lossless && result.mismatches == 0;
+    }
+    return consistent ? 0 : 1;
+}
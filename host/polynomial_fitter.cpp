@@ -0,0 +1,263 @@
+/*
+ * ホスト用 多項式回帰の学習の実装
+ */
+
+#include "polynomial_fitter.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "teensy_chebyshev_model.h"
+
+namespace {
+
+// ピボットの2乗が元の対角成分のこの割合を下回る項は、それまでの項の一次結合とみなす
+const long double RANK_TOLERANCE = 1e-12L;
+
+int term_count_of(int degree) {
+    return (degree + 1) * (degree + 2) / 2;
+}
+
+// T_0(x)..T_degree(x)
+template <typename Real>
+void chebyshev_values(Real x, int degree, Real* values) {
+    values[0] = 1;
+    if (degree >= 1) {
+        values[1] = x;
+    }
+    for (int i = 2; i <= degree; i++) {
+        values[i] = 2 * x * values[i - 1] - values[i - 2];
+    }
+}
+
+// T_0..T_degree を (value - center) * inv_half_width の多項式として展開した、value の単項式の係数
+// (i 行目が T_i, 列が value の指数。行優先 (degree+1) x (degree+1))
+std::vector<long double> chebyshev_in_raw_powers(int degree, long double center, long double inv_half_width) {
+    const int size = degree + 1;
+    std::vector<long double> in_x(size * size, 0.0L);  // 正規化変数 x の単項式の係数
+    in_x[0] = 1.0L;
+    if (degree >= 1) {
+        in_x[size + 1] = 1.0L;
+    }
+    for (int i = 2; i <= degree; i++) {
+        for (int k = 0; k <= i; k++) {
+            long double value = -in_x[(i - 2) * size + k];
+            if (k > 0) {
+                value += 2.0L * in_x[(i - 1) * size + k - 1];
+            }
+            in_x[i * size + k] = value;
+        }
+    }
+
+    // x^k = s^k (v - c)^k = s^k Σ_m C(k, m) v^m (-c)^(k-m)
+    std::vector<long double> binomial(size * size, 0.0L);
+    for (int k = 0; k <= degree; k++) {
+        binomial[k * size] = 1.0L;
+        for (int m = 1; m <= k; m++) {
+            binomial[k * size + m] = binomial[(k - 1) * size + m - 1] + (m < k ? binomial[(k - 1) * size + m] : 0.0L);
+        }
+    }
+    std::vector<long double> raw(size * size, 0.0L);
+    for (int i = 0; i <= degree; i++) {
+        long double scale = 1.0L;
+        for (int k = 0; k <= i; k++, scale *= inv_half_width) {
+            const long double coefficient = in_x[i * size + k] * scale;
+            if (coefficient == 0.0L) {
+                continue;
+            }
+            long double shift = 1.0L;  // (-c)^(k-m)
+            for (int m = k; m >= 0; m--, shift *= -center) {
+                raw[i * size + m] += coefficient * binomial[k * size + m] * shift;
+            }
+        }
+    }
+    return raw;
+}
+
+}  // namespace
+
+RuntimeModel FittedPolynomial::runtime_model(float validation_mae) const {
+    return RuntimeModel{degree, (int)horner.size(), intercept, horner.data(),
+                        UNDER_Y_MIN, UNDER_Y_MAX, THETA_MIN, THETA_MAX, validation_mae};
+}
+
+long double FittedPolynomial::evaluate_chebyshev(double under_y, double theta) const {
+    long double tx[MODEL_BLOB_MAX_DEGREE + 1];
+    long double ty[MODEL_BLOB_MAX_DEGREE + 1];
+    chebyshev_values<long double>(((long double)under_y - CHEBYSHEV_UNDER_Y_CENTER) * CHEBYSHEV_UNDER_Y_INV_HALF_WIDTH,
+                                  degree, tx);
+    chebyshev_values<long double>(((long double)theta - CHEBYSHEV_THETA_CENTER) * CHEBYSHEV_THETA_INV_HALF_WIDTH,
+                                  degree, ty);
+    long double sum = 0.0L;
+    int k = 0;
+    for (int d = 0; d <= degree; d++) {
+        for (int j = 0; j <= d; j++, k++) {
+            sum += chebyshev[k] * tx[d - j] * ty[j];
+        }
+    }
+    return sum;
+}
+
+PolynomialFitter::PolynomialFitter(int max_degree)
+    : max_degree_(std::max(0, std::min(max_degree, MODEL_BLOB_MAX_DEGREE))),
+      term_count_(term_count_of(max_degree_)),
+      block_basis_((size_t)term_count_ * BLOCK_ROWS, 0.0),
+      block_distance_(BLOCK_ROWS, 0.0),
+      gram_((size_t)term_count_ * term_count_, 0.0),
+      moment_(term_count_, 0.0) {}
+
+void PolynomialFitter::add(float under_y, float theta, float distance) {
+    double tx[MODEL_BLOB_MAX_DEGREE + 1];
+    double ty[MODEL_BLOB_MAX_DEGREE + 1];
+    chebyshev_values<double>(((double)under_y - CHEBYSHEV_UNDER_Y_CENTER) * CHEBYSHEV_UNDER_Y_INV_HALF_WIDTH,
+                             max_degree_, tx);
+    chebyshev_values<double>(((double)theta - CHEBYSHEV_THETA_CENTER) * CHEBYSHEV_THETA_INV_HALF_WIDTH,
+                             max_degree_, ty);
+    double* column = block_basis_.data() + block_fill_;
+    for (int d = 0; d <= max_degree_; d++) {
+        for (int j = 0; j <= d; j++, column += BLOCK_ROWS) {
+            *column = tx[d - j] * ty[j];
+        }
+    }
+    block_distance_[block_fill_] = distance;
+    rows_++;
+    if (++block_fill_ == BLOCK_ROWS) {
+        flush_block();
+    }
+}
+
+// G += ΦᵀΦ, Φᵀy += Φᵀy (ブロック内の行について)。
+// 項の組ごとに行方向の内積を8本の部分和で取り、ベクトル化させる (未使用の行は0のため端数処理は不要)
+void PolynomialFitter::flush_block() {
+    if (block_fill_ == 0) {
+        return;
+    }
+    const int rows = (block_fill_ + 7) / 8 * 8;
+    for (int r = block_fill_; r < rows; r++) {
+        block_distance_[r] = 0.0;
+        for (int a = 0; a < term_count_; a++) {
+            block_basis_[(size_t)a * BLOCK_ROWS + r] = 0.0;
+        }
+    }
+
+    for (int a = 0; a < term_count_; a++) {
+        const double* basis_a = block_basis_.data() + (size_t)a * BLOCK_ROWS;
+        double* gram_row = gram_.data() + (size_t)a * term_count_;
+        for (int b = 0; b <= a; b++) {
+            const double* basis_b = block_basis_.data() + (size_t)b * BLOCK_ROWS;
+            double partial[8] = {};
+            for (int r = 0; r < rows; r += 8) {
+                for (int k = 0; k < 8; k++) {
+                    partial[k] += basis_a[r + k] * basis_b[r + k];
+                }
+            }
+            gram_row[b] += ((partial[0] + partial[1]) + (partial[2] + partial[3])) +
+                           ((partial[4] + partial[5]) + (partial[6] + partial[7]));
+        }
+        double moment = 0.0;
+        for (int r = 0; r < rows; r++) {
+            moment += basis_a[r] * block_distance_[r];
+        }
+        moment_[a] += moment;
+    }
+    for (int r = 0; r < block_fill_; r++) {
+        distance_squares_ += block_distance_[r] * block_distance_[r];
+    }
+    block_fill_ = 0;
+}
+
+int PolynomialFitter::factorize() {
+    flush_block();
+    const int n = term_count_;
+    cholesky_.assign((size_t)n * n, 0.0L);
+    forward_.assign(n, 0.0L);
+    factorized_terms_ = 0;
+
+    for (int a = 0; a < n; a++) {
+        long double* row_a = cholesky_.data() + (size_t)a * n;
+        for (int b = 0; b < a; b++) {
+            const long double* row_b = cholesky_.data() + (size_t)b * n;
+            long double sum = gram_[(size_t)a * n + b];
+            for (int k = 0; k < b; k++) {
+                sum -= row_a[k] * row_b[k];
+            }
+            row_a[b] = sum / row_b[b];
+        }
+        long double pivot = gram_[(size_t)a * n + a];
+        for (int k = 0; k < a; k++) {
+            pivot -= row_a[k] * row_a[k];
+        }
+        if (!(pivot > RANK_TOLERANCE * gram_[(size_t)a * n + a])) {
+            break;  // この項以降は分解できない
+        }
+        row_a[a] = std::sqrt(pivot);
+
+        long double z = moment_[a];
+        for (int k = 0; k < a; k++) {
+            z -= row_a[k] * forward_[k];
+        }
+        forward_[a] = z / row_a[a];
+        factorized_terms_ = a + 1;
+    }
+
+    int degree = -1;
+    while (degree < max_degree_ && term_count_of(degree + 1) <= factorized_terms_) {
+        degree++;
+    }
+    return rows_ > 0 ? degree : -1;
+}
+
+bool PolynomialFitter::solve(int degree, FittedPolynomial& fitted) const {
+    const int terms = term_count_of(degree);
+    if (degree < 0 || degree > max_degree_ || terms > factorized_terms_ || rows_ == 0) {
+        return false;
+    }
+    const int n = term_count_;
+
+    // Lᵀ c = z (左上 terms x terms のみ使う)
+    std::vector<long double> chebyshev(terms);
+    long double explained = 0.0L;
+    for (int a = terms - 1; a >= 0; a--) {
+        long double sum = forward_[a];
+        for (int k = a + 1; k < terms; k++) {
+            sum -= cholesky_[(size_t)k * n + a] * chebyshev[k];
+        }
+        chebyshev[a] = sum / cholesky_[(size_t)a * n + a];
+        explained += forward_[a] * forward_[a];
+    }
+
+    fitted.degree = degree;
+    fitted.chebyshev.assign(chebyshev.begin(), chebyshev.end());
+    // 残差平方和 = yᵀy - zᵀz
+    fitted.train_rmse = std::sqrt(std::max(0.0, (double)((long double)distance_squares_ - explained)) / (double)rows_);
+
+    // 生の単項式の係数 A[m][l] = Σ c_ij P_i[m] Q_j[l] (P_i, Q_j は T_i(x), T_j(y) を under_y, theta で展開したもの)
+    const int size = degree + 1;
+    const std::vector<long double> under_y_powers =
+        chebyshev_in_raw_powers(degree, CHEBYSHEV_UNDER_Y_CENTER, CHEBYSHEV_UNDER_Y_INV_HALF_WIDTH);
+    const std::vector<long double> theta_powers =
+        chebyshev_in_raw_powers(degree, CHEBYSHEV_THETA_CENTER, CHEBYSHEV_THETA_INV_HALF_WIDTH);
+    std::vector<long double> monomial(size * size, 0.0L);
+    int k = 0;
+    for (int d = 0; d <= degree; d++) {
+        for (int j = 0; j <= d; j++, k++) {
+            const int i = d - j;
+            for (int m = 0; m <= i; m++) {
+                const long double scaled = chebyshev[k] * under_y_powers[i * size + m];
+                for (int l = 0; l <= j; l++) {
+                    monomial[m * size + l] += scaled * theta_powers[j * size + l];
+                }
+            }
+        }
+    }
+
+    fitted.intercept = (double)monomial[0];
+    monomial[0] = 0.0L;
+    fitted.horner.clear();
+    for (int i = degree; i >= 0; i--) {
+        for (int j = degree - i; j >= 0; j--) {
+            fitted.horner.push_back((double)monomial[i * size + j]);
+        }
+    }
+    return true;
+}
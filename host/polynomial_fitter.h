@@ -0,0 +1,71 @@
+/*
+ * ホスト用 多項式回帰の学習 (正規方程式の逐次蓄積と1回のCholesky分解で全次数を解く)
+ *
+ * 学習データを1行ずつ受け取り、最大次数の全項について正規方程式 G c = Φᵀy の Gram行列 G = ΦᵀΦ を蓄積する
+ * (行そのものは保持しない)。項は PolynomialFeatures と同じ順序 (次数昇順, 各次数内で theta の指数昇順) のため、
+ * d次の項は先頭の (d+1)(d+2)/2 個で、d次の正規方程式は G の左上の小行列になる。
+ * G = LLᵀ の L の左上の小行列はその小行列の Cholesky因子なので、最大次数で1回分解すれば全次数を解ける。
+ * 単項式のままでは高次で条件数が悪化するため、基底は teensy_chebyshev_model.h と同じ正規化変数上の
+ * T_i(x) T_j(y) とし、解いた後に生の単項式 (Horner評価順, .dpm と同じ並び) の係数へ変換する
+ */
+
+#ifndef HOST_POLYNOMIAL_FITTER_H
+#define HOST_POLYNOMIAL_FITTER_H
+
+#include <cstddef>
+#include <vector>
+
+#include "teensy_model_blob.h"
+
+struct FittedPolynomial {
+    int degree = 0;
+    double train_rmse = 0.0;         // 学習データのRMSE (正規方程式の残差から求める)
+    std::vector<double> chebyshev;   // c_ij (PolynomialFeatures と同じ順序, 切片は c_00 に含む)
+    std::vector<double> horner;      // 生の単項式の係数 (Horner評価順, 定数項は0で intercept に含む)
+    double intercept = 0.0;
+
+    // horner を参照するモデル (入力検証範囲は validate_input_range と同じ)
+    RuntimeModel runtime_model(float validation_mae) const;
+
+    // チェビシェフ基底のまま long double で評価する (単項式への変換誤差の確認用)
+    long double evaluate_chebyshev(double under_y, double theta) const;
+};
+
+class PolynomialFitter {
+public:
+    explicit PolynomialFitter(int max_degree);
+
+    // 1行を加える (BLOCK_ROWS 行ごとに Gram行列へ反映する)
+    void add(float under_y, float theta, float distance);
+
+    // 残りの行を反映して Cholesky分解する。解ける最大の次数を返す (解けなければ -1)
+    // 途中の項がそれまでの項とほぼ一次従属 (データ点の不足など) なら、その項を含む次数は解けない
+    int factorize();
+
+    // factorize() の後に degree次のモデルを求める (解けない次数ならfalse)
+    bool solve(int degree, FittedPolynomial& fitted) const;
+
+    int max_degree() const { return max_degree_; }
+    size_t rows() const { return rows_; }
+
+private:
+    static const int BLOCK_ROWS = 256;
+
+    void flush_block();
+
+    int max_degree_;
+    int term_count_;
+    size_t rows_ = 0;
+    int block_fill_ = 0;
+    std::vector<double> block_basis_;     // 項ごとに BLOCK_ROWS 行分の基底の値 (項 k は k * BLOCK_ROWS から)
+    std::vector<double> block_distance_;
+    std::vector<double> gram_;            // G の下三角 (行優先, term_count_ x term_count_)
+    std::vector<double> moment_;          // Φᵀy
+    double distance_squares_ = 0.0;       // yᵀy
+
+    int factorized_terms_ = 0;            // Cholesky分解できた先頭の項の数
+    std::vector<long double> cholesky_;   // L (行優先, term_count_ x term_count_)
+    std::vector<long double> forward_;    // L z = Φᵀy の z
+};
+
+#endif // HOST_POLYNOMIAL_FITTER_H
@@ -0,0 +1,223 @@
+/*
+ * ホスト用 精度モード解析ツール
+ * 単精度・混合精度 (倍精度で評価する行数ごと) のHorner評価と単精度チェビシェフ (Clenshaw) 評価を
+ * 倍精度参照と比較し、
+ * 学習領域全体での最悪誤差・平均誤差・評価時間・倍精度演算数を表示する。
+ * --tolerance を指定すると、許容誤差を満たす中で倍精度演算が最も少ないモードを推奨する
+ * (Cortex-M7では倍精度の乗加算が単精度より大幅に遅いため、ホストの時間ではなく演算数で選ぶ)
+ *
+ * 使い方: precision_report [--tolerance CM] [--grid-size S] [--samples N]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "predictor_engines.h"
+#include "teensy_chebyshev_model.h"
+#include "teensy_precision_model.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct ReportOptions {
+    double tolerance = -1.0;     // 負なら推奨なし
+    size_t grid_size = 1200;     // 格子 (S × S)
+    size_t samples = 1000000;    // 低食い違い量列の点数 (格子の間を埋める)
+};
+
+enum ModeKind { MODE_FLOAT, MODE_CHEBYSHEV_FLOAT, MODE_MIXED };
+
+struct PrecisionMode {
+    ModeKind kind;
+    int double_rows;  // MODE_MIXED のみ
+    double max_error;
+    double mean_error;
+    float worst_under_y;
+    float worst_theta;
+    double ns_per_eval;
+};
+
+inline void keep_value(double value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline double evaluate_mode(const PrecisionMode& mode, float under_y, float theta) {
+    switch (mode.kind) {
+        case MODE_FLOAT:
+            return (double)evaluate_horner_float(under_y, theta);
+        case MODE_CHEBYSHEV_FLOAT:
+            return (double)evaluate_chebyshev_float(under_y, theta);
+        default:
+            return evaluate_horner_mixed(under_y, theta, mode.double_rows);
+    }
+}
+
+// 1回の評価に含まれる倍精度の乗加算数 (正規化2 + 外側の行数 + 倍精度行の内側)
+// 倍精度Horner (参照) は項数と同じ HORNER_TERM_COUNT 回
+int double_operation_count(const PrecisionMode& mode) {
+    if (mode.kind != MODE_MIXED) {
+        return 0;
+    }
+    int count = 2 + (POLY_DEGREE + 1);
+    for (int i = 0; i < mode.double_rows; i++) {
+        count += POLY_DEGREE - i;
+    }
+    return count;
+}
+
+void describe_mode(const PrecisionMode& mode, char* buffer, size_t size) {
+    switch (mode.kind) {
+        case MODE_FLOAT:
+            std::snprintf(buffer, size, "float");
+            break;
+        case MODE_CHEBYSHEV_FLOAT:
+            std::snprintf(buffer, size, "chebyshev float");
+            break;
+        default:
+            std::snprintf(buffer, size, "mixed rows=%d", mode.double_rows);
+            break;
+    }
+}
+
+void measure_mode(PrecisionMode& mode, const std::vector<float>& under_y, const std::vector<float>& theta,
+                  const std::vector<double>& reference) {
+    const size_t n = under_y.size();
+    mode.max_error = 0.0;
+    mode.worst_under_y = 0.0f;
+    mode.worst_theta = 0.0f;
+    double sum_error = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        // 出力はfloatで返すため、最終的な丸めも含めて比較する
+        double value = (double)(float)evaluate_mode(mode, under_y[i], theta[i]);
+        double error = std::fabs(value - reference[i]);
+        sum_error += error;
+        if (error > mode.max_error) {
+            mode.max_error = error;
+            mode.worst_under_y = under_y[i];
+            mode.worst_theta = theta[i];
+        }
+    }
+    mode.mean_error = sum_error / (double)n;
+
+    const size_t timing_count = std::min<size_t>(n, 200000);
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < timing_count; i++) {
+        keep_value(evaluate_mode(mode, under_y[i], theta[i]));
+    }
+    Clock::time_point end = Clock::now();
+    mode.ns_per_eval = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() /
+                       (double)timing_count;
+}
+
+bool parse_options(int argc, char** argv, ReportOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--tolerance") == 0 && has_value) {
+            options.tolerance = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--grid-size") == 0 && has_value) {
+            options.grid_size = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--samples") == 0 && has_value) {
+            options.samples = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            return false;
+        }
+    }
+    return options.grid_size > 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    ReportOptions options;
+    if (!parse_options(argc, argv, options)) {
+        std::printf("usage: precision_report [--tolerance CM] [--grid-size S] [--samples N]\n");
+        return 1;
+    }
+
+    // 学習領域の格子 (両端を含む) + 低食い違い量列
+    const InputDomain& domain = TRAINING_DOMAIN;
+    const size_t grid_count = options.grid_size * options.grid_size;
+    std::vector<float> under_y(grid_count + options.samples);
+    std::vector<float> theta(grid_count + options.samples);
+    for (size_t i = 0; i < options.grid_size; i++) {
+        for (size_t j = 0; j < options.grid_size; j++) {
+            size_t k = i * options.grid_size + j;
+            under_y[k] = domain.under_y_min + (domain.under_y_max - domain.under_y_min) * (float)i / (float)(options.grid_size - 1);
+            theta[k] = domain.theta_min + (domain.theta_max - domain.theta_min) * (float)j / (float)(options.grid_size - 1);
+        }
+    }
+    generate_domain_sweep(domain, under_y.data() + grid_count, theta.data() + grid_count, options.samples);
+
+    std::vector<double> reference(under_y.size());
+    for (size_t i = 0; i < under_y.size(); i++) {
+        reference[i] = evaluate_horner_double((double)under_y[i], (double)theta[i]);
+    }
+
+    // 参照 (倍精度Horner) の評価時間
+    const size_t timing_count = std::min<size_t>(under_y.size(), 200000);
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < timing_count; i++) {
+        keep_value(evaluate_horner_double((double)under_y[i], (double)theta[i]));
+    }
+    Clock::time_point end = Clock::now();
+    double double_ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() /
+                       (double)timing_count;
+
+    std::printf("=== precision_report (reference: double Horner) ===\n");
+    std::printf("domain: under_y %.1f..%.1f, theta %.1f..%.1f, points: %zu (grid %zux%zu + %zu sweep)\n",
+                domain.under_y_min, domain.under_y_max, domain.theta_min, domain.theta_max,
+                under_y.size(), options.grid_size, options.grid_size, options.samples);
+    std::printf("compiled mode: %s (MIXED_DOUBLE_ROWS=%d)\n\n", selected_precision_name(), MIXED_DOUBLE_ROWS);
+    std::printf("%-16s %10s %12s %12s %10s   %s\n", "mode", "double ops", "max |err|", "mean |err|", "ns/eval", "worst (under_y, theta)");
+    std::printf("%-16s %10d %12s %12s %10.2f\n", "double", HORNER_TERM_COUNT, "-", "-", double_ns);
+
+    // 倍精度演算数の昇順に並べる
+    std::vector<PrecisionMode> modes;
+    modes.push_back({MODE_FLOAT, 0, 0.0, 0.0, 0.0f, 0.0f, 0.0});
+    modes.push_back({MODE_CHEBYSHEV_FLOAT, 0, 0.0, 0.0, 0.0f, 0.0f, 0.0});
+    for (int double_rows = 0; double_rows <= POLY_DEGREE + 1; double_rows++) {
+        modes.push_back({MODE_MIXED, double_rows, 0.0, 0.0, 0.0f, 0.0f, 0.0});
+    }
+    for (PrecisionMode& mode : modes) {
+        measure_mode(mode, under_y, theta, reference);
+
+        char name[32];
+        describe_mode(mode, name, sizeof(name));
+        std::printf("%-16s %10d %12.3e %12.3e %10.2f   (%.3f, %.3f)\n", name, double_operation_count(mode),
+                    mode.max_error, mode.mean_error, mode.ns_per_eval, mode.worst_under_y, mode.worst_theta);
+    }
+
+    if (options.tolerance < 0.0) {
+        return 0;
+    }
+
+    // 許容誤差を満たすモードのうち倍精度演算が最少のもの (同数なら誤差の小さい方)
+    std::printf("\ntolerance: %.3e\n", options.tolerance);
+    const PrecisionMode* best = nullptr;
+    for (const PrecisionMode& mode : modes) {
+        if (mode.max_error > options.tolerance) {
+            continue;
+        }
+        if (best == nullptr || double_operation_count(mode) < double_operation_count(*best) ||
+            (double_operation_count(mode) == double_operation_count(*best) && mode.max_error < best->max_error)) {
+            best = &mode;
+        }
+    }
+    if (best == nullptr) {
+        std::printf("recommended: double  (no reduced-precision mode meets the tolerance)\n");
+    } else if (best->kind == MODE_FLOAT) {
+        std::printf("recommended: float  (-DUSE_DOUBLE_PRECISION=0 -DUSE_MIXED_PRECISION=0)\n");
+    } else if (best->kind == MODE_CHEBYSHEV_FLOAT) {
+        std::printf("recommended: chebyshev float  (predict_distance_chebyshev)\n");
+    } else {
+        std::printf("recommended: mixed rows=%d  (-DUSE_DOUBLE_PRECISION=0 -DUSE_MIXED_PRECISION=1 -DMIXED_DOUBLE_ROWS=%d)\n",
+                    best->double_rows, best->double_rows);
+    }
+    return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * ホスト用 推論エンジン一覧の実装
+ */
+
+#include "predictor_engines.h"
+
+#include <cstring>
+
+#include "simd_predictor.h"
+#include "teensy_batch_model.h"
+#include "teensy_chebyshev_model.h"
+#include "teensy_ensemble_model.h"
+#include "teensy_fixed_model.h"
+#include "teensy_horner_model.h"
+#include "teensy_lut_model.h"
+#include "teensy_model_degree17.h"
+#include "teensy_model_degree6.h"
+#include "teensy_polynomial_model.h"
+#include "teensy_precision_model.h"
+#include "teensy_sparse_model.h"
+#include "teensy_tiled_model.h"
+
+namespace {
+
+// PolynomialModel<Degree> は関数ポインタとして登録できないため薄いラッパーを用意する
+float predict_template_degree17(float under_y, float theta) {
+    return MODEL_DEGREE17.predict(under_y, theta);
+}
+
+float predict_template_degree6(float under_y, float theta) {
+    return MODEL_DEGREE6.predict(under_y, theta);
+}
+
+float predict_ensemble_weighted(float under_y, float theta) {
+    return predict_distance_ensemble(under_y, theta, ENSEMBLE_WEIGHTED);
+}
+
+}  // namespace
+
+const PredictorEngine PREDICTOR_ENGINES[] = {
+    {"standard", "features + StandardScaler + Kahan dot product", predict_distance_teensy, nullptr},
+    {"horner", "scaler-folded nested Horner (double)", predict_distance_horner, predict_distance_batch},
+    {"simd", "Horner, AVX-512/AVX2/NEON batch kernel (runtime dispatch)", predict_distance_horner, predict_distance_batch_simd},
+    {"float", "normalized Horner, single precision", predict_distance_horner_float, nullptr},
+    {"mixed", "normalized Horner, float inner / double outer (MIXED_DOUBLE_ROWS)", predict_distance_horner_mixed, nullptr},
+    {"chebyshev", "Chebyshev tensor basis, Clenshaw recurrence (float)", predict_distance_chebyshev, nullptr},
+    {"chebyshev-double", "Chebyshev tensor basis, Clenshaw recurrence (double)", predict_distance_chebyshev_double, nullptr},
+    {"template-17", "PolynomialModel<17>, compile-time unrolled Horner (double)", predict_template_degree17, nullptr},
+    {"template-6", "PolynomialModel<6>, all-data degree-6 model (MAE 0.70, different model)", predict_template_degree6, nullptr},
+    {"ensemble", "degree-6 + degree-17 over a shared power table, per-region 1/MAE^2 blend (different model)", predict_ensemble_weighted, nullptr},
+    {"lut-bilinear", "lookup table, bilinear interpolation (float)", predict_distance_lut_bilinear, nullptr},
+    {"lut-bicubic", "lookup table, Catmull-Rom bicubic interpolation (float)", predict_distance_lut_bicubic, nullptr},
+    {"tiled", "piecewise degree-4 tiles fitted to the LNN-distilled grid, O(1) dispatch (float)", predict_distance_tiled, nullptr},
+    {"sparse", "pruned + refitted normalized polynomial, generated evaluator (double)", predict_distance_sparse, nullptr},
+    {"fixed", "integer-only Q-format Horner (int64 stages, Q16.16 I/O)", predict_distance_fixed, nullptr},
+};
+
+const int PREDICTOR_ENGINE_COUNT = sizeof(PREDICTOR_ENGINES) / sizeof(PredictorEngine);
+
+const PredictorEngine* find_predictor_engine(const char* name) {
+    for (int i = 0; i < PREDICTOR_ENGINE_COUNT; i++) {
+        if (std::strcmp(PREDICTOR_ENGINES[i].name, name) == 0) {
+            return &PREDICTOR_ENGINES[i];
+        }
+    }
+    return nullptr;
+}
+
+void run_engine_batch(const PredictorEngine& engine, const float* under_y, const float* theta,
+                      float* out, size_t n) {
+    if (engine.predict_batch != nullptr) {
+        engine.predict_batch(under_y, theta, out, n);
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        out[i] = engine.predict(under_y[i], theta[i]);
+    }
+}
+
+void generate_domain_sweep(const InputDomain& domain, float* under_y, float* theta, size_t count) {
+    // 黄金比の一般化 (plastic number) による2次元R2列: 格子より偏りなく領域を埋める
+    const double alpha_under_y = 0.7548776662466927;
+    const double alpha_theta = 0.5698402909980532;
+    const double under_y_span = domain.under_y_max - domain.under_y_min;
+    const double theta_span = domain.theta_max - domain.theta_min;
+
+    double frac_under_y = 0.5;
+    double frac_theta = 0.5;
+    for (size_t i = 0; i < count; i++) {
+        under_y[i] = (float)(domain.under_y_min + frac_under_y * under_y_span);
+        theta[i] = (float)(domain.theta_min + frac_theta * theta_span);
+        frac_under_y += alpha_under_y;
+        frac_theta += alpha_theta;
+        if (frac_under_y >= 1.0) frac_under_y -= 1.0;
+        if (frac_theta >= 1.0) frac_theta -= 1.0;
+    }
+}
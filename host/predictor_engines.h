@@ -0,0 +1,52 @@
+/*
+ * ホスト用 推論エンジン一覧
+ * ベンチマーク・検証ツールが同じエンジン群を名前で選択できるようにする
+ */
+
+#ifndef HOST_PREDICTOR_ENGINES_H
+#define HOST_PREDICTOR_ENGINES_H
+
+#include <cstddef>
+
+// 単一サンプル予測関数
+typedef float (*PredictFunction)(float under_y, float theta);
+
+// バッチ予測関数 (配列構造の入力)
+typedef void (*PredictBatchFunction)(const float* under_y, const float* theta, float* out, size_t n);
+
+struct PredictorEngine {
+    const char* name;
+    const char* description;
+    PredictFunction predict;
+    PredictBatchFunction predict_batch;  // 未対応ならnullptr
+};
+
+// predict_batch があればそれを、なければ predict を繰り返して n 個を予測
+void run_engine_batch(const PredictorEngine& engine, const float* under_y, const float* theta,
+                      float* out, size_t n);
+
+// 入力範囲 (矩形)
+struct InputDomain {
+    float under_y_min;
+    float under_y_max;
+    float theta_min;
+    float theta_max;
+};
+
+// data/ のCSVに現れる実測範囲 (under_y 0〜121, theta -48.1〜55.2) のうち
+// validate_input_range() が受け付ける部分 (ベンチマークの掃引範囲)
+const InputDomain MEASUREMENT_DOMAIN = {0.0f, 100.0f, -48.1f, 55.2f};
+
+// 学習データ全体の範囲 (検証なしの評価関数を直接調べる精度解析用)
+const InputDomain TRAINING_DOMAIN = {0.0f, 121.0f, -48.1f, 55.2f};
+
+extern const PredictorEngine PREDICTOR_ENGINES[];
+extern const int PREDICTOR_ENGINE_COUNT;
+
+// 名前からエンジンを検索 (見つからなければnullptr)
+const PredictorEngine* find_predictor_engine(const char* name);
+
+// 実測範囲を2次元加法的再帰列 (低食い違い量列) で掃引した入力を生成
+void generate_domain_sweep(const InputDomain& domain, float* under_y, float* theta, size_t count);
+
+#endif // HOST_PREDICTOR_ENGINES_H
@@ -0,0 +1,59 @@
+/*
+ * ホスト用 段階別プロファイルレポート
+ * teensy_profiler.h のスコープタイマーを有効にして従来パス (特徴量生成 → 標準化 → 線形結合) と
+ * Horner法を実測範囲の掃引入力で実行し、段階ごとのサイクル数の分布 (最小・平均・p50・p99・最大) を表示する
+ * (実機のメニュー「r」と同じ表。ホストのサイクルは rdtsc)
+ *
+ * 使い方: profile_report [--samples N]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "predictor_engines.h"
+#include "teensy_horner_model.h"
+#include "teensy_profiler.h"
+
+int main(int argc, char** argv) {
+    size_t samples = 200000;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--samples") == 0 && i + 1 < argc) {
+            samples = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            std::printf("usage: profile_report [--samples N]\n");
+            return 1;
+        }
+    }
+    if (samples == 0) {
+        std::printf("usage: profile_report [--samples N]\n");
+        return 1;
+    }
+
+    std::vector<float> under_y(samples);
+    std::vector<float> theta(samples);
+    generate_domain_sweep(MEASUREMENT_DOMAIN, under_y.data(), theta.data(), samples);
+
+    // 1巡目はキャッシュ・分岐予測を温めるだけで記録しない
+    volatile float sink = 0.0f;
+    for (size_t i = 0; i < samples; i++) {
+        sink = predict_distance_teensy(under_y[i], theta[i]);
+        sink = predict_distance_horner(under_y[i], theta[i]);
+    }
+
+    profiler_set_active(true);
+    profiler_reset();
+    for (size_t i = 0; i < samples; i++) {
+        sink = predict_distance_teensy(under_y[i], theta[i]);
+    }
+    for (size_t i = 0; i < samples; i++) {
+        sink = predict_distance_horner(under_y[i], theta[i]);
+    }
+    profiler_set_active(false);
+    (void)sink;
+
+    std::printf("samples: %zu per path (measurement domain sweep)\n", samples);
+    print_profile_report();
+    return 0;
+}
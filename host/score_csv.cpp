@@ -0,0 +1,123 @@
+/*
+ * ホスト用 測定ログ採点ツール
+ * CSVをメモリマップして解析・バッチ予測・書き出しをパイプラインで行い、
+ * 予測値と (distance列があれば) 絶対誤差を出力する。集計は標準エラーへ表示
+ *
+ * 使い方: score_csv INPUT.csv [--output PATH|-|none] [--engine NAME] [--block-rows N]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "csv_scorer.h"
+#include "predictor_engines.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct ToolOptions {
+    const char* input = nullptr;
+    const char* output = "-";        // "-" は標準出力, "none" は書き出しなし
+    const char* engine = "simd";
+    ScoreOptions score;
+};
+
+// バッチAPIを持たないエンジンも PredictBatchFunction として渡せるようにする
+const PredictorEngine* selected_engine = nullptr;
+
+void predict_with_selected_engine(const float* under_y, const float* theta, float* out, size_t n) {
+    run_engine_batch(*selected_engine, under_y, theta, out, n);
+}
+
+bool parse_options(int argc, char** argv, ToolOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--output") == 0 && has_value) {
+            options.output = argv[++i];
+        } else if (std::strcmp(argv[i], "--engine") == 0 && has_value) {
+            options.engine = argv[++i];
+        } else if (std::strcmp(argv[i], "--block-rows") == 0 && has_value) {
+            options.score.block_rows = std::strtoull(argv[++i], nullptr, 10);
+        } else if (argv[i][0] != '-' && options.input == nullptr) {
+            options.input = argv[i];
+        } else {
+            return false;
+        }
+    }
+    return options.input != nullptr && options.score.block_rows > 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    ToolOptions options;
+    if (!parse_options(argc, argv, options)) {
+        std::fprintf(stderr, "usage: score_csv INPUT.csv [--output PATH|-|none] [--engine NAME] [--block-rows N]\n");
+        return 1;
+    }
+    selected_engine = find_predictor_engine(options.engine);
+    if (selected_engine == nullptr) {
+        std::fprintf(stderr, "unknown engine: %s\n", options.engine);
+        return 1;
+    }
+
+    std::string error;
+    MappedFile input;
+    if (!input.open(options.input, error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    std::FILE* out = nullptr;
+    if (std::strcmp(options.output, "-") == 0) {
+        out = stdout;
+    } else if (std::strcmp(options.output, "none") != 0) {
+        out = std::fopen(options.output, "wb");
+        if (out == nullptr) {
+            std::fprintf(stderr, "%s: %s\n", options.output, std::strerror(errno));
+            return 1;
+        }
+    }
+    // 書き出しはブロック単位なので大きめのバッファにする
+    std::vector<char> out_buffer(1 << 20);
+    if (out != nullptr) {
+        std::setvbuf(out, out_buffer.data(), _IOFBF, out_buffer.size());
+    }
+
+    PredictBatchFunction predict = selected_engine->predict_batch != nullptr ? selected_engine->predict_batch
+                                                                            : predict_with_selected_engine;
+    ScoreSummary summary;
+    Clock::time_point start = Clock::now();
+    bool ok = score_csv(input.data(), input.size(), predict, out, options.score, summary, error);
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    if (!ok) {
+        if (out != nullptr && out != stdout) {
+            std::fclose(out);
+        }
+        std::fprintf(stderr, "%s: %s\n", options.input, error.c_str());
+        return 1;
+    }
+    if (out != nullptr && out != stdout && std::fclose(out) != 0) {
+        std::fprintf(stderr, "%s: write failed\n", options.output);
+        return 1;
+    }
+
+    size_t valid_rows = summary.rows - summary.invalid_rows;
+    std::fprintf(stderr, "=== score_csv (%s) ===\n", selected_engine->name);
+    std::fprintf(stderr, "input: %s (%.1f MB)\n", options.input, (double)input.size() / 1e6);
+    std::fprintf(stderr, "rows: %zu scored, %zu out of range, %zu skipped\n",
+                 summary.rows, summary.invalid_rows, summary.skipped_lines);
+    if (summary.has_distance && valid_rows > 0) {
+        std::fprintf(stderr, "MAE vs distance: %.6f, max |err|: %.6f (in-range rows)\n",
+                     summary.sum_abs_error / (double)valid_rows, summary.max_abs_error);
+    }
+    std::fprintf(stderr, "time: %.3f s, %.1f MB/s in, %.1f MB/s out, %.2f Mrows/s\n", seconds,
+                 (double)input.size() / 1e6 / seconds, (double)summary.output_bytes / 1e6 / seconds,
+                 (double)summary.rows / 1e6 / seconds);
+    return 0;
+}
@@ -0,0 +1,414 @@
+/*
+ * ホスト用 バイナリフレーム・プロトコル (teensy_serial_protocol) のクライアントとスループット測定
+ *
+ * --device を指定すると実機 (例: /dev/ttyACM0) のシリアルポートを raw モードで開く。
+ * 指定しなければ擬似端末 (pty) の対を作り、マスタ側で実機と同じ FrameParser / protocol_handle_frame を
+ * 動かすスレッドを実機の代わりにする (スレーブ側は実機のポートと同じ扱い)。
+ * PING で相手の情報を確認した後、1フレームあたりの組数ごとに、最大 --window 個の要求を送ったまま
+ * 応答を待つ形でフレームを送り続け、フレーム/s・予測/s・送受信の MB/s・往復遅延 (p50/p99) を表示する。
+ * 結果はすべて predict_distance_selected と比較し、不一致・順序の誤り・タイムアウトがあれば終了コード 1 を返す
+ *
+ * 使い方: serial_client [--device PATH] [--pairs N ...] [--frames N] [--window N] [--cycles] [--noise N]
+ *                      [--timeout-ms MS]
+ *   --cycles は相手に1件ごとの推論サイクル数を要求し、その p50/p99 も表示する
+ *   --noise は各フレームの前に N バイトの ASCII 文字を送る (メニューの文字が混ざった回線を模す)
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "predictor_engines.h"
+#include "teensy_precision_model.h"
+#include "teensy_profiler.h"
+#include "teensy_serial_protocol.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct ClientOptions {
+    std::string device;  // 空なら pty の疑似デバイス
+    std::vector<int> pairs;
+    size_t frames = 20000;
+    int window = 4;
+    bool cycles = false;
+    size_t noise = 0;
+    int timeout_ms = 1000;
+};
+
+struct RunResult {
+    bool ok = true;
+    size_t frames = 0;
+    size_t mismatches = 0;
+    double elapsed_s = 0.0;
+    uint64_t tx_bytes = 0;
+    uint64_t rx_bytes = 0;
+    std::vector<float> latency_us;
+    std::vector<uint32_t> device_cycles;
+};
+
+const size_t INPUT_COUNT = 1 << 16;
+
+// raw モード (行編集・改行変換・エコーなし, 1バイトから読める)
+bool set_raw_mode(int fd) {
+    termios tio;
+    if (tcgetattr(fd, &tio) != 0) {
+        return false;
+    }
+    cfmakeraw(&tio);
+    cfsetispeed(&tio, B115200);  // USB シリアルでは無視される
+    cfsetospeed(&tio, B115200);
+    tio.c_cc[VMIN] = 1;
+    tio.c_cc[VTIME] = 0;
+    return tcsetattr(fd, TCSANOW, &tio) == 0;
+}
+
+int open_serial(const char* path) {
+    int fd = open(path, O_RDWR | O_NOCTTY);
+    if (fd < 0) {
+        return -1;
+    }
+    if (!set_raw_mode(fd)) {
+        close(fd);
+        return -1;
+    }
+    tcflush(fd, TCIOFLUSH);  // 起動時のメニューなど、接続前に届いた文字を捨てる
+    return fd;
+}
+
+bool write_all(int fd, const uint8_t* data, size_t length) {
+    while (length > 0) {
+        ssize_t written = write(fd, data, length);
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        length -= (size_t)written;
+    }
+    return true;
+}
+
+// 受信側: 読み込みバッファと状態機械
+class FrameReader {
+public:
+    explicit FrameReader(int fd) : fd_(fd) {}
+
+    // 次の正しいフレームを待つ (timeout_ms 以内に届かなければ false)
+    bool next_frame(int timeout_ms, uint64_t& rx_bytes) {
+        const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (true) {
+            while (position_ < end_) {
+                if (parser_.feed(buffer_[position_++]) == PROTOCOL_FRAME) {
+                    return true;
+                }
+            }
+            const int remaining = (int)std::chrono::duration_cast<std::chrono::milliseconds>(
+                                      deadline - Clock::now()).count();
+            pollfd entry = {fd_, POLLIN, 0};
+            if (remaining <= 0 || poll(&entry, 1, remaining) <= 0) {
+                return false;
+            }
+            const ssize_t count = read(fd_, buffer_, sizeof(buffer_));
+            if (count <= 0) {
+                return false;
+            }
+            rx_bytes += (uint64_t)count;
+            position_ = 0;
+            end_ = (size_t)count;
+        }
+    }
+
+    const ProtocolFrame& frame() const { return parser_.frame(); }
+    const ProtocolStats& stats() const { return parser_.stats(); }
+
+private:
+    int fd_;
+    uint8_t buffer_[4096];
+    size_t position_ = 0;
+    size_t end_ = 0;
+    FrameParser parser_;
+};
+
+// pty のマスタ側で実機の代わりに要求を処理する
+class LoopbackDevice {
+public:
+    bool start(std::string& slave_path) {
+        master_ = posix_openpt(O_RDWR | O_NOCTTY);
+        if (master_ < 0 || grantpt(master_) != 0 || unlockpt(master_) != 0) {
+            return false;
+        }
+        slave_path = ptsname(master_);
+        running_.store(true);
+        thread_ = std::thread([this]() { serve(); });
+        return true;
+    }
+
+    void stop() {
+        running_.store(false);
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        if (master_ >= 0) {
+            close(master_);
+        }
+    }
+
+    const ProtocolStats& stats() const { return parser_.stats(); }
+
+private:
+    void serve() {
+        uint8_t input[4096];
+        uint8_t response[PROTOCOL_MAX_FRAME_SIZE];
+        while (running_.load()) {
+            pollfd entry = {master_, POLLIN, 0};
+            if (poll(&entry, 1, 50) <= 0) {
+                continue;
+            }
+            const ssize_t count = read(master_, input, sizeof(input));
+            if (count <= 0) {
+                continue;
+            }
+            for (ssize_t i = 0; i < count; i++) {
+                if (parser_.feed(input[i]) == PROTOCOL_FRAME) {
+                    write_all(master_, response, protocol_handle_frame(parser_.frame(), response));
+                }
+            }
+        }
+    }
+
+    int master_ = -1;
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+    FrameParser parser_;
+};
+
+// PING を送り、相手のサイクル数/μs を返す (応答がなければ負)
+float ping(int fd, FrameReader& reader, int timeout_ms) {
+    uint8_t frame[PROTOCOL_MAX_FRAME_SIZE];
+    uint64_t rx_bytes = 0;
+    for (int attempt = 0; attempt < 3; attempt++) {
+        const uint16_t sequence = (uint16_t)(0xF000 + attempt);
+        if (!write_all(fd, frame, protocol_encode_frame(PROTOCOL_TYPE_PING, 0, sequence, nullptr, 0, frame))) {
+            return -1.0f;
+        }
+        while (reader.next_frame(timeout_ms, rx_bytes)) {
+            const ProtocolFrame& response = reader.frame();
+            if (response.type != (PROTOCOL_TYPE_PING | PROTOCOL_TYPE_RESPONSE) || response.sequence != sequence ||
+                response.length != 8) {
+                continue;
+            }
+            const uint16_t max_pairs = (uint16_t)(response.payload[2] | (response.payload[3] << 8));
+            float cycles_per_us;
+            std::memcpy(&cycles_per_us, response.payload + 4, sizeof(cycles_per_us));
+            std::printf("device: protocol v%u, degree %u, <= %u pairs/frame, %.1f cycles/us\n",
+                        (unsigned)response.payload[0], (unsigned)response.payload[1], (unsigned)max_pairs,
+                        cycles_per_us);
+            if (response.payload[0] != PROTOCOL_VERSION || max_pairs != PROTOCOL_MAX_PAIRS) {
+                std::printf("error: protocol mismatch (expected v%u, %d pairs)\n", (unsigned)PROTOCOL_VERSION,
+                            PROTOCOL_MAX_PAIRS);
+                return -1.0f;
+            }
+            return cycles_per_us;
+        }
+    }
+    return -1.0f;
+}
+
+RunResult run_frames(int fd, FrameReader& reader, int pairs, const ClientOptions& options,
+                     const std::vector<float>& under_y, const std::vector<float>& theta) {
+    RunResult result;
+    result.latency_us.reserve(options.frames);
+    std::vector<Clock::time_point> sent_at(options.frames);
+    std::vector<uint8_t> frame(PROTOCOL_MAX_FRAME_SIZE + options.noise);
+    float distance[PROTOCOL_MAX_PAIRS];
+    uint32_t cycles[PROTOCOL_MAX_PAIRS];
+    const uint8_t flags = options.cycles ? PROTOCOL_FLAG_CYCLES : 0;
+
+    // ASCII の雑音 (同期バイトを含まない)
+    for (size_t i = 0; i < options.noise; i++) {
+        frame[i] = (uint8_t)('a' + i % 26);
+    }
+
+    size_t sent = 0;
+    const Clock::time_point start = Clock::now();
+    while (result.frames < options.frames) {
+        while (sent < options.frames && sent - result.frames < (size_t)options.window) {
+            const size_t offset = (sent * (size_t)pairs) % (INPUT_COUNT - PROTOCOL_MAX_PAIRS);
+            const size_t length = options.noise + protocol_encode_predict((uint16_t)sent, flags, &under_y[offset],
+                                                                          &theta[offset], (size_t)pairs,
+                                                                          frame.data() + options.noise);
+            sent_at[sent] = Clock::now();
+            if (!write_all(fd, frame.data(), length)) {
+                std::printf("  error: write failed\n");
+                result.ok = false;
+                return result;
+            }
+            result.tx_bytes += length;
+            sent++;
+        }
+
+        if (!reader.next_frame(options.timeout_ms, result.rx_bytes)) {
+            std::printf("  error: no response to frame %zu within %d ms\n", result.frames, options.timeout_ms);
+            result.ok = false;
+            break;
+        }
+        const ProtocolFrame& response = reader.frame();
+        if (response.sequence != (uint16_t)result.frames ||
+            !protocol_decode_predict_response(response, (size_t)pairs, distance, cycles)) {
+            std::printf("  error: unexpected response (type 0x%02X, sequence %u) to frame %zu\n",
+                        (unsigned)response.type, (unsigned)response.sequence, result.frames);
+            result.ok = false;
+            break;
+        }
+        result.latency_us.push_back(
+            std::chrono::duration<float, std::micro>(Clock::now() - sent_at[result.frames]).count());
+
+        const size_t offset = (result.frames * (size_t)pairs) % (INPUT_COUNT - PROTOCOL_MAX_PAIRS);
+        for (int i = 0; i < pairs; i++) {
+            if (distance[i] != predict_distance_selected(under_y[offset + i], theta[offset + i])) {
+                result.mismatches++;
+            }
+            if (options.cycles) {
+                result.device_cycles.push_back(cycles[i]);
+            }
+        }
+        result.frames++;
+    }
+    result.elapsed_s = std::chrono::duration<double>(Clock::now() - start).count();
+    return result;
+}
+
+template <typename T>
+T percentile(std::vector<T>& values, double p) {
+    if (values.empty()) {
+        return T();
+    }
+    size_t rank = std::min(values.size() - 1, (size_t)(p * (double)values.size()));
+    std::nth_element(values.begin(), values.begin() + rank, values.end());
+    return values[rank];
+}
+
+bool parse_options(int argc, char** argv, ClientOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--device") == 0 && has_value) {
+            options.device = argv[++i];
+        } else if (std::strcmp(argv[i], "--pairs") == 0 && has_value) {
+            while (i + 1 < argc && argv[i + 1][0] != '-') {
+                options.pairs.push_back(std::atoi(argv[++i]));
+            }
+        } else if (std::strcmp(argv[i], "--frames") == 0 && has_value) {
+            options.frames = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--window") == 0 && has_value) {
+            options.window = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--cycles") == 0) {
+            options.cycles = true;
+        } else if (std::strcmp(argv[i], "--noise") == 0 && has_value) {
+            options.noise = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--timeout-ms") == 0 && has_value) {
+            options.timeout_ms = std::atoi(argv[++i]);
+        } else {
+            return false;
+        }
+    }
+    if (options.pairs.empty()) {
+        options.pairs = {1, 8, 32, PROTOCOL_MAX_PAIRS};
+    }
+    for (int pairs : options.pairs) {
+        if (pairs < 1 || pairs > PROTOCOL_MAX_PAIRS) {
+            return false;
+        }
+    }
+    // 送ったままにする要求は sequence (16ビット) が一巡しない数まで
+    return options.frames > 0 && options.window >= 1 && options.window <= 1024 && options.timeout_ms > 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    ClientOptions options;
+    if (!parse_options(argc, argv, options)) {
+        std::printf("usage: serial_client [--device PATH] [--pairs N ...] [--frames N] [--window N] [--cycles] "
+                    "[--noise N] [--timeout-ms MS]\n");
+        return 1;
+    }
+
+    LoopbackDevice loopback;
+    std::string path = options.device;
+    if (path.empty()) {
+        profiler_calibrate();  // PING の cycles/μs とサイクル数の計測用
+        if (!loopback.start(path)) {
+            std::printf("error: cannot create pty\n");
+            return 1;
+        }
+    }
+    const int fd = open_serial(path.c_str());
+    if (fd < 0) {
+        std::printf("error: cannot open %s\n", path.c_str());
+        loopback.stop();
+        return 1;
+    }
+
+    std::printf("=== serial_client ===\n");
+    std::printf("link: %s (%s), window %d frames, %zu frames per size, noise %zu bytes/frame\n", path.c_str(),
+                options.device.empty() ? "pty loopback" : "device", options.window, options.frames, options.noise);
+    FrameReader reader(fd);
+    const float cycles_per_us = ping(fd, reader, options.timeout_ms);
+    bool ok = cycles_per_us >= 0.0f;
+    if (!ok) {
+        std::printf("error: no PING response\n");
+    }
+
+    std::vector<float> under_y(INPUT_COUNT);
+    std::vector<float> theta(INPUT_COUNT);
+    generate_domain_sweep(MEASUREMENT_DOMAIN, under_y.data(), theta.data(), INPUT_COUNT);
+
+    if (ok) {
+        std::printf("%6s %8s %10s %12s %9s %9s %9s %9s %10s %10s %s\n", "pairs", "frames", "frames/s", "pred/s",
+                    "tx MB/s", "rx MB/s", "p50 us", "p99 us", "dev p50us", "dev p99us", "status");
+    }
+    for (size_t k = 0; ok && k < options.pairs.size(); k++) {
+        const int pairs = options.pairs[k];
+        RunResult result = run_frames(fd, reader, pairs, options, under_y, theta);
+        const double seconds = result.elapsed_s > 0.0 ? result.elapsed_s : 1.0;
+        const float p50 = percentile(result.latency_us, 0.50);
+        const float p99 = percentile(result.latency_us, 0.99);
+        const bool has_cycles = !result.device_cycles.empty() && cycles_per_us > 0.0f;
+        const float device_p50 = has_cycles ? percentile(result.device_cycles, 0.50) / cycles_per_us : 0.0f;
+        const float device_p99 = has_cycles ? percentile(result.device_cycles, 0.99) / cycles_per_us : 0.0f;
+        std::printf("%6d %8zu %10.0f %12.0f %9.3f %9.3f %9.1f %9.1f %10.3f %10.3f %s\n", pairs, result.frames,
+                    result.frames / seconds, result.frames * pairs / seconds, result.tx_bytes / seconds * 1e-6,
+                    result.rx_bytes / seconds * 1e-6, p50, p99, device_p50, device_p99,
+                    result.ok && result.mismatches == 0 ? "ok" : "FAIL");
+        if (result.mismatches > 0) {
+            std::printf("  error: %zu results differ from predict_distance_selected\n", result.mismatches);
+        }
+        ok = ok && result.ok && result.mismatches == 0;
+    }
+
+    const ProtocolStats& client_stats = reader.stats();
+    std::printf("client parser: %u frames, %u crc errors, %u length errors, %u skipped bytes\n",
+                (unsigned)client_stats.frames, (unsigned)client_stats.crc_errors, (unsigned)client_stats.length_errors,
+                (unsigned)client_stats.skipped_bytes);
+    close(fd);
+    if (options.device.empty()) {
+        loopback.stop();
+        const ProtocolStats& device_stats = loopback.stats();
+        std::printf("device parser: %u frames, %u crc errors, %u length errors, %u skipped bytes\n",
+                    (unsigned)device_stats.frames, (unsigned)device_stats.crc_errors,
+                    (unsigned)device_stats.length_errors, (unsigned)device_stats.skipped_bytes);
+    }
+    return ok ? 0 : 1;
+}
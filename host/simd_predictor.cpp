@@ -0,0 +1,229 @@
+/*
+ * ホスト用 SIMD バッチ予測カーネルの実装
+ *
+ * 畳み込みHorner形式ではべき乗生成・単項式の組み立て・内積がすべて
+ * 「係数をブロードキャストしてFMA」の1種類の演算に置き換わるため、
+ * サンプル方向にベクトル化し、FMAのレイテンシを隠すために独立した
+ * ベクトルを複数本 (SIMD_CHAINS) 交互に進める。
+ */
+
+#include "simd_predictor.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#include "teensy_batch_model.h"
+#include "teensy_horner_model.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SIMD_HAVE_X86 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define SIMD_HAVE_NEON 1
+#endif
+
+namespace {
+
+typedef void (*BatchKernel)(const float* under_y, const float* theta, float* out, size_t n);
+
+// 1ブロックで交互に進める独立ベクトル数
+const int SIMD_CHAINS = 4;
+
+#if SIMD_HAVE_X86
+
+__attribute__((target("avx2,fma")))
+void predict_batch_avx2(const float* under_y, const float* theta, float* out, size_t n) {
+    const int lanes = 4;
+    const size_t block = (size_t)(lanes * SIMD_CHAINS);
+    const __m256d under_y_min = _mm256_set1_pd(UNDER_Y_MIN);
+    const __m256d under_y_max = _mm256_set1_pd(UNDER_Y_MAX);
+    const __m256d theta_min = _mm256_set1_pd(THETA_MIN);
+    const __m256d theta_max = _mm256_set1_pd(THETA_MAX);
+    const __m256d intercept = _mm256_set1_pd(HORNER_INTERCEPT);
+    const __m256d error_value = _mm256_set1_pd(-1.0);
+
+    size_t offset = 0;
+    for (; offset + block <= n; offset += block) {
+        __m256d u[SIMD_CHAINS], t[SIMD_CHAINS], acc[SIMD_CHAINS], q[SIMD_CHAINS];
+#pragma GCC unroll 4
+        for (int k = 0; k < SIMD_CHAINS; k++) {
+            u[k] = _mm256_cvtps_pd(_mm_loadu_ps(under_y + offset + k * lanes));
+            t[k] = _mm256_cvtps_pd(_mm_loadu_ps(theta + offset + k * lanes));
+            acc[k] = _mm256_setzero_pd();
+        }
+
+        const double* coeff = HORNER_COEFFICIENTS;
+        for (int i = POLY_DEGREE; i >= 0; i--) {
+            __m256d c = _mm256_broadcast_sd(coeff++);
+#pragma GCC unroll 4
+            for (int k = 0; k < SIMD_CHAINS; k++) q[k] = c;
+            for (int j = POLY_DEGREE - i; j > 0; j--) {
+                c = _mm256_broadcast_sd(coeff++);
+#pragma GCC unroll 4
+                for (int k = 0; k < SIMD_CHAINS; k++) q[k] = _mm256_fmadd_pd(q[k], t[k], c);
+            }
+#pragma GCC unroll 4
+            for (int k = 0; k < SIMD_CHAINS; k++) acc[k] = _mm256_fmadd_pd(acc[k], u[k], q[k]);
+        }
+
+#pragma GCC unroll 4
+        for (int k = 0; k < SIMD_CHAINS; k++) {
+            // validate_input_range() と同じ判定 (NaNは不正扱い)
+            __m256d valid = _mm256_and_pd(
+                _mm256_and_pd(_mm256_cmp_pd(u[k], under_y_min, _CMP_GE_OQ), _mm256_cmp_pd(u[k], under_y_max, _CMP_LE_OQ)),
+                _mm256_and_pd(_mm256_cmp_pd(t[k], theta_min, _CMP_GE_OQ), _mm256_cmp_pd(t[k], theta_max, _CMP_LE_OQ)));
+            __m256d result = _mm256_blendv_pd(error_value, _mm256_add_pd(acc[k], intercept), valid);
+            _mm_storeu_ps(out + offset + k * lanes, _mm256_cvtpd_ps(result));
+        }
+    }
+
+    // 端数はスカラー版で処理
+    predict_distance_batch(under_y + offset, theta + offset, out + offset, n - offset);
+}
+
+__attribute__((target("avx512f")))
+void predict_batch_avx512(const float* under_y, const float* theta, float* out, size_t n) {
+    const int lanes = 8;
+    const size_t block = (size_t)(lanes * SIMD_CHAINS);
+    const __m512d under_y_min = _mm512_set1_pd(UNDER_Y_MIN);
+    const __m512d under_y_max = _mm512_set1_pd(UNDER_Y_MAX);
+    const __m512d theta_min = _mm512_set1_pd(THETA_MIN);
+    const __m512d theta_max = _mm512_set1_pd(THETA_MAX);
+    const __m512d intercept = _mm512_set1_pd(HORNER_INTERCEPT);
+    const __m512d error_value = _mm512_set1_pd(-1.0);
+
+    size_t offset = 0;
+    for (; offset + block <= n; offset += block) {
+        __m512d u[SIMD_CHAINS], t[SIMD_CHAINS], acc[SIMD_CHAINS], q[SIMD_CHAINS];
+#pragma GCC unroll 4
+        for (int k = 0; k < SIMD_CHAINS; k++) {
+            u[k] = _mm512_cvtps_pd(_mm256_loadu_ps(under_y + offset + k * lanes));
+            t[k] = _mm512_cvtps_pd(_mm256_loadu_ps(theta + offset + k * lanes));
+            acc[k] = _mm512_setzero_pd();
+        }
+
+        const double* coeff = HORNER_COEFFICIENTS;
+        for (int i = POLY_DEGREE; i >= 0; i--) {
+            __m512d c = _mm512_set1_pd(*coeff++);
+#pragma GCC unroll 4
+            for (int k = 0; k < SIMD_CHAINS; k++) q[k] = c;
+            for (int j = POLY_DEGREE - i; j > 0; j--) {
+                c = _mm512_set1_pd(*coeff++);
+#pragma GCC unroll 4
+                for (int k = 0; k < SIMD_CHAINS; k++) q[k] = _mm512_fmadd_pd(q[k], t[k], c);
+            }
+#pragma GCC unroll 4
+            for (int k = 0; k < SIMD_CHAINS; k++) acc[k] = _mm512_fmadd_pd(acc[k], u[k], q[k]);
+        }
+
+#pragma GCC unroll 4
+        for (int k = 0; k < SIMD_CHAINS; k++) {
+            __mmask8 valid = _mm512_cmp_pd_mask(u[k], under_y_min, _CMP_GE_OQ)
+                           & _mm512_cmp_pd_mask(u[k], under_y_max, _CMP_LE_OQ)
+                           & _mm512_cmp_pd_mask(t[k], theta_min, _CMP_GE_OQ)
+                           & _mm512_cmp_pd_mask(t[k], theta_max, _CMP_LE_OQ);
+            __m512d result = _mm512_mask_blend_pd(valid, error_value, _mm512_add_pd(acc[k], intercept));
+            _mm256_storeu_ps(out + offset + k * lanes, _mm512_cvtpd_ps(result));
+        }
+    }
+
+    predict_distance_batch(under_y + offset, theta + offset, out + offset, n - offset);
+}
+
+#endif  // SIMD_HAVE_X86
+
+#if SIMD_HAVE_NEON
+
+void predict_batch_neon(const float* under_y, const float* theta, float* out, size_t n) {
+    const int lanes = 2;
+    const size_t block = (size_t)(lanes * SIMD_CHAINS);
+    const float64x2_t under_y_min = vdupq_n_f64(UNDER_Y_MIN);
+    const float64x2_t under_y_max = vdupq_n_f64(UNDER_Y_MAX);
+    const float64x2_t theta_min = vdupq_n_f64(THETA_MIN);
+    const float64x2_t theta_max = vdupq_n_f64(THETA_MAX);
+    const float64x2_t intercept = vdupq_n_f64(HORNER_INTERCEPT);
+    const float64x2_t error_value = vdupq_n_f64(-1.0);
+
+    size_t offset = 0;
+    for (; offset + block <= n; offset += block) {
+        float64x2_t u[SIMD_CHAINS], t[SIMD_CHAINS], acc[SIMD_CHAINS], q[SIMD_CHAINS];
+#pragma GCC unroll 4
+        for (int k = 0; k < SIMD_CHAINS; k++) {
+            u[k] = vcvt_f64_f32(vld1_f32(under_y + offset + k * lanes));
+            t[k] = vcvt_f64_f32(vld1_f32(theta + offset + k * lanes));
+            acc[k] = vdupq_n_f64(0.0);
+        }
+
+        const double* coeff = HORNER_COEFFICIENTS;
+        for (int i = POLY_DEGREE; i >= 0; i--) {
+            float64x2_t c = vdupq_n_f64(*coeff++);
+#pragma GCC unroll 4
+            for (int k = 0; k < SIMD_CHAINS; k++) q[k] = c;
+            for (int j = POLY_DEGREE - i; j > 0; j--) {
+                c = vdupq_n_f64(*coeff++);
+#pragma GCC unroll 4
+                for (int k = 0; k < SIMD_CHAINS; k++) q[k] = vfmaq_f64(c, q[k], t[k]);
+            }
+#pragma GCC unroll 4
+            for (int k = 0; k < SIMD_CHAINS; k++) acc[k] = vfmaq_f64(q[k], acc[k], u[k]);
+        }
+
+#pragma GCC unroll 4
+        for (int k = 0; k < SIMD_CHAINS; k++) {
+            uint64x2_t valid = vandq_u64(
+                vandq_u64(vcgeq_f64(u[k], under_y_min), vcleq_f64(u[k], under_y_max)),
+                vandq_u64(vcgeq_f64(t[k], theta_min), vcleq_f64(t[k], theta_max)));
+            float64x2_t result = vbslq_f64(valid, vaddq_f64(acc[k], intercept), error_value);
+            vst1_f32(out + offset + k * lanes, vcvt_f32_f64(result));
+        }
+    }
+
+    predict_distance_batch(under_y + offset, theta + offset, out + offset, n - offset);
+}
+
+#endif  // SIMD_HAVE_NEON
+
+struct KernelChoice {
+    const char* name;
+    BatchKernel kernel;
+};
+
+// CPU機能と環境変数 DISTPREDICT_SIMD からカーネルを決定
+KernelChoice select_kernel() {
+    const char* requested = std::getenv("DISTPREDICT_SIMD");
+    bool forced = requested != nullptr && requested[0] != '\0';
+
+#if SIMD_HAVE_X86
+    __builtin_cpu_init();
+    bool has_avx512 = __builtin_cpu_supports("avx512f");
+    bool has_avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    if (has_avx512 && (!forced || std::strcmp(requested, "avx512") == 0)) {
+        return {"avx512", predict_batch_avx512};
+    }
+    if (has_avx2 && (!forced || std::strcmp(requested, "avx2") == 0 || std::strcmp(requested, "avx512") == 0)) {
+        return {"avx2", predict_batch_avx2};
+    }
+#elif SIMD_HAVE_NEON
+    if (!forced || std::strcmp(requested, "scalar") != 0) {
+        return {"neon", predict_batch_neon};
+    }
+#endif
+    (void)forced;
+    return {"scalar", predict_distance_batch};
+}
+
+const KernelChoice& active_kernel() {
+    static const KernelChoice choice = select_kernel();
+    return choice;
+}
+
+}  // namespace
+
+void predict_distance_batch_simd(const float* under_y, const float* theta, float* out, size_t n) {
+    active_kernel().kernel(under_y, theta, out, n);
+}
+
+const char* simd_kernel_name() {
+    return active_kernel().name;
+}
@@ -0,0 +1,23 @@
+/*
+ * ホスト用 SIMD バッチ予測カーネル
+ *
+ * 畳み込み済みHorner係数 (teensy_horner_model.h) を倍精度ベクトルで評価する。
+ * 実行時にCPU機能を判定して AVX-512 (8サンプル/命令) → AVX2+FMA (4サンプル/命令)
+ * → スカラー (predict_distance_batch) の順に選択。aarch64 では NEON (2サンプル/命令) を使用。
+ *
+ * 環境変数 DISTPREDICT_SIMD=scalar|avx2|avx512|neon で下位のカーネルを強制できる。
+ */
+
+#ifndef HOST_SIMD_PREDICTOR_H
+#define HOST_SIMD_PREDICTOR_H
+
+#include <cstddef>
+
+// n個のサンプルをSIMDカーネルで予測 (範囲外の入力は -1.0f)
+// FMAを使うためスカラー版とは最終ビットが異なり得る
+void predict_distance_batch_simd(const float* under_y, const float* theta, float* out, size_t n);
+
+// 選択されたカーネル名 ("avx512", "avx2", "neon", "scalar")
+const char* simd_kernel_name();
+
+#endif // HOST_SIMD_PREDICTOR_H
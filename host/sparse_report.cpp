@@ -0,0 +1,142 @@
+/*
+ * ホスト用 スパース (枝刈り) モデルの速度・精度レポート
+ *
+ * teensy_sparse_model.h の各モデルについて、生成済みの評価関数と項の一覧をたどる汎用ループの ns/予測 (実測範囲の掃引)、
+ * 17次モデル (Horner法, 171項) との最大差・平均差 (alloutput の格子点)、実測検証データでのMAEを並べ、
+ * 項数に対する速度と精度の関係 (トレードオフ曲線) を表示する
+ * 17次モデルは実測範囲の四隅 (データのない領域) で発散するため、差は学習データの存在する格子点で比べる
+ *
+ * 使い方: sparse_report [--samples N]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "predictor_engines.h"
+#include "teensy_horner_model.h"
+#include "teensy_sparse_model.h"
+#include "validation_data.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+inline void keep_value(float value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// 5回計測して最小の ns/予測
+template <typename Predict>
+double measure_ns(const std::vector<float>& under_y, const std::vector<float>& theta, Predict predict) {
+    double best = 1e30;
+    for (int repeat = 0; repeat < 5; repeat++) {
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < under_y.size(); i++) {
+            keep_value(predict(under_y[i], theta[i]));
+        }
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+        best = std::min(best, ns / (double)under_y.size());
+    }
+    return best;
+}
+
+struct Accuracy {
+    double max_difference = 0.0;
+    double mean_difference = 0.0;
+    double validation_mae = 0.0;
+};
+
+template <typename Predict>
+Accuracy measure_accuracy(const ValidationSet& grid, const std::vector<float>& reference,
+                          const ValidationSet& validation, Predict predict) {
+    Accuracy accuracy;
+    for (size_t i = 0; i < grid.under_y.size(); i++) {
+        double difference = std::fabs((double)predict(grid.under_y[i], grid.theta[i]) - (double)reference[i]);
+        accuracy.max_difference = std::max(accuracy.max_difference, difference);
+        accuracy.mean_difference += difference;
+    }
+    accuracy.mean_difference /= (double)std::max<size_t>(grid.under_y.size(), 1);
+
+    size_t rows = 0;
+    for (size_t i = 0; i < validation.under_y.size(); i++) {
+        float value = predict(validation.under_y[i], validation.theta[i]);
+        if (value == -1.0f) {
+            continue;
+        }
+        accuracy.validation_mae += std::fabs((double)value - (double)validation.distance[i]);
+        rows++;
+    }
+    accuracy.validation_mae = rows > 0 ? accuracy.validation_mae / (double)rows : 0.0;
+    return accuracy;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t samples = 1000000;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--samples") == 0 && i + 1 < argc) {
+            samples = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            samples = 0;
+            break;
+        }
+    }
+    if (samples == 0) {
+        std::printf("usage: sparse_report [--samples N]\n");
+        return 1;
+    }
+
+    ValidationSet validation;
+    ValidationSet grid;
+    const std::string validation_path = std::string(DISTPREDICT_DATA_DIR) + "/All measurement data.csv";
+    const std::string grid_path =
+        std::string(DISTPREDICT_DATA_DIR) + "/alloutput_polynomial_degree17_mae0.90(LNN蒸留多項式).csv";
+    if (!load_validation_csv(validation_path, validation)) {
+        std::fprintf(stderr, "cannot read %s\n", validation_path.c_str());
+        return 1;
+    }
+    if (!load_validation_csv(grid_path, grid)) {
+        std::fprintf(stderr, "cannot read %s\n", grid_path.c_str());
+        return 1;
+    }
+
+    std::vector<float> under_y(samples);
+    std::vector<float> theta(samples);
+    generate_domain_sweep(MEASUREMENT_DOMAIN, under_y.data(), theta.data(), samples);
+    std::vector<float> reference(grid.under_y.size());
+    for (size_t i = 0; i < grid.under_y.size(); i++) {
+        reference[i] = predict_distance_horner(grid.under_y[i], grid.theta[i]);
+    }
+
+    std::printf("=== sparse_report ===\n");
+    std::printf("timing: %zu inputs (measurement domain sweep), diff vs horner: %zu grid points (%s)\n", samples,
+                grid.under_y.size(), grid.name.c_str());
+    std::printf("validation: %s (valid rows)\n", validation.name.c_str());
+    std::printf("%-7s %10s %10s %8s %12s %12s %10s\n", "terms", "gen ns", "loop ns", "speedup",
+                "max |diff|", "mean |diff|", "val MAE");
+
+    const double horner_ns = measure_ns(under_y, theta, predict_distance_horner);
+    Accuracy horner = measure_accuracy(grid, reference, validation, predict_distance_horner);
+    std::printf("%-7d %10.2f %10s %7.2fx %12.3e %12.3e %10.4f   (horner)\n", HORNER_TERM_COUNT, horner_ns, "-",
+                1.0, horner.max_difference, horner.mean_difference, horner.validation_mae);
+
+    for (int m = 0; m < SPARSE_MODEL_COUNT; m++) {
+        const SparseModel& model = SPARSE_MODELS[m];
+        auto generated = [&](float u, float t) { return predict_distance_sparse_model(model, u, t); };
+        auto loop = [&](float u, float t) { return predict_distance_sparse_terms(model, u, t); };
+        const double generated_ns = measure_ns(under_y, theta, generated);
+        const double loop_ns = measure_ns(under_y, theta, loop);
+        Accuracy accuracy = measure_accuracy(grid, reference, validation, generated);
+        std::printf("%-7d %10.2f %10.2f %7.2fx %12.3e %12.3e %10.4f%s\n", model.term_count, generated_ns, loop_ns,
+                    horner_ns / generated_ns, accuracy.max_difference, accuracy.mean_difference,
+                    accuracy.validation_mae, m == SPARSE_DEFAULT_MODEL ? "   (default)" : "");
+    }
+    return 0;
+}
@@ -0,0 +1,193 @@
+/*
+ * ホスト用 連続入力 (StreamingPredictor) のベンチマーク
+ *
+ * 追跡ループを模した入力列ごとに、毎回全項を評価する Horner法と
+ * StreamingPredictor (部分多項式の再利用のみ / テイラー近似あり) の ns/予測、
+ * Horner法との最大差、評価経路の内訳を表示する
+ *   row-held:   under_y (カメラの行) を整数で固定し theta を 0.1 度刻みで掃引
+ *   angle-held: theta を固定し under_y を 0.1 刻みで掃引
+ *   tracking:   under_y は時々 ±1 行だけ動き、theta は小さな酔歩
+ *   drift:      両方が毎回わずかに動く (テイラー近似の対象)
+ *   random:     実測範囲の低食い違い量列 (毎回両方が大きく変わる最悪の場合)
+ *
+ * 使い方: stream_bench [--samples N] [--max-delta DU DT]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "predictor_engines.h"
+#include "teensy_horner_model.h"
+#include "teensy_streaming_model.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct Stream {
+    const char* name;
+    std::vector<float> under_y;
+    std::vector<float> theta;
+};
+
+inline void keep_value(float value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+float clamp_value(float value, float low, float high) {
+    return std::min(std::max(value, low), high);
+}
+
+std::vector<Stream> make_streams(size_t samples) {
+    const InputDomain& domain = MEASUREMENT_DOMAIN;
+    std::vector<Stream> streams(5);
+    std::mt19937 rng(12345);
+    std::normal_distribution<float> step(0.0f, 1.0f);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+
+    streams[0].name = "row-held";
+    streams[1].name = "angle-held";
+    for (size_t i = 0; i < samples; i++) {
+        // 往復掃引 (折り返し点も連続)
+        const int sweep_t = (int)((domain.theta_max - domain.theta_min) / 0.1f);
+        const int sweep_u = (int)((domain.under_y_max - domain.under_y_min) / 0.1f);
+        int k = (int)(i % (size_t)(2 * sweep_t));
+        int row = (int)(i / (size_t)(2 * sweep_t)) % 101;
+        streams[0].under_y.push_back((float)row);
+        streams[0].theta.push_back(domain.theta_min + 0.1f * (float)(k < sweep_t ? k : 2 * sweep_t - k));
+        k = (int)(i % (size_t)(2 * sweep_u));
+        int column = (int)(i / (size_t)(2 * sweep_u)) % 103;
+        streams[1].under_y.push_back(domain.under_y_min + 0.1f * (float)(k < sweep_u ? k : 2 * sweep_u - k));
+        streams[1].theta.push_back(domain.theta_min + (float)column);
+    }
+
+    streams[2].name = "tracking";
+    float row = 50.0f;
+    float angle = 0.0f;
+    for (size_t i = 0; i < samples; i++) {
+        if (uniform(rng) < 0.05f) {
+            row = clamp_value(row + (uniform(rng) < 0.5f ? -1.0f : 1.0f), domain.under_y_min, domain.under_y_max);
+        }
+        angle = clamp_value(angle + 0.05f * step(rng), domain.theta_min, domain.theta_max);
+        streams[2].under_y.push_back(row);
+        streams[2].theta.push_back(angle);
+    }
+
+    streams[3].name = "drift";
+    float under_y = 50.0f;
+    angle = 0.0f;
+    for (size_t i = 0; i < samples; i++) {
+        under_y = clamp_value(under_y + 0.01f * step(rng), domain.under_y_min, domain.under_y_max);
+        angle = clamp_value(angle + 0.02f * step(rng), domain.theta_min, domain.theta_max);
+        streams[3].under_y.push_back(under_y);
+        streams[3].theta.push_back(angle);
+    }
+
+    streams[4].name = "random";
+    streams[4].under_y.resize(samples);
+    streams[4].theta.resize(samples);
+    generate_domain_sweep(domain, streams[4].under_y.data(), streams[4].theta.data(), samples);
+    return streams;
+}
+
+// 5回計測して最小の ns/予測
+template <typename Predict>
+double measure_ns(const Stream& stream, Predict predict) {
+    double best = 1e30;
+    for (int repeat = 0; repeat < 5; repeat++) {
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < stream.under_y.size(); i++) {
+            keep_value(predict(stream.under_y[i], stream.theta[i]));
+        }
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+        best = std::min(best, ns / (double)stream.under_y.size());
+    }
+    return best;
+}
+
+struct StreamingResult {
+    double ns;
+    double max_difference;
+    StreamingStats stats;
+};
+
+StreamingResult run_streaming(const Stream& stream, const std::vector<float>& reference, bool taylor,
+                              float max_delta_under_y, float max_delta_theta) {
+    StreamingPredictor predictor;
+    predictor.set_taylor(taylor, max_delta_under_y, max_delta_theta);
+    StreamingResult result;
+    result.ns = measure_ns(stream, [&](float u, float t) { return predictor.predict(u, t); });
+
+    // 計測とは別に1巡して差と経路の内訳を求める
+    predictor.reset();
+    predictor.reset_stats();
+    result.max_difference = 0.0;
+    for (size_t i = 0; i < stream.under_y.size(); i++) {
+        float value = predictor.predict(stream.under_y[i], stream.theta[i]);
+        result.max_difference = std::max(result.max_difference, (double)std::fabs(value - reference[i]));
+    }
+    result.stats = predictor.stats();
+    return result;
+}
+
+void print_result(const char* stream, const char* mode, double ns, double horner_ns, const StreamingResult* result,
+                  size_t samples) {
+    std::printf("%-11s %-14s %8.2f %8.2fx", stream, mode, ns, horner_ns / ns);
+    if (result == nullptr) {
+        std::printf(" %10s\n", "-");
+        return;
+    }
+    const double scale = 100.0 / (double)samples;
+    std::printf(" %10.2e %7.1f %7.1f %7.1f %7.1f\n", result->max_difference,
+                scale * result->stats.full, scale * result->stats.theta_held,
+                scale * result->stats.under_y_held, scale * result->stats.taylor);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t samples = 1000000;
+    float max_delta_under_y = STREAMING_TAYLOR_MAX_DELTA_UNDER_Y;
+    float max_delta_theta = STREAMING_TAYLOR_MAX_DELTA_THETA;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--samples") == 0 && i + 1 < argc) {
+            samples = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--max-delta") == 0 && i + 2 < argc) {
+            max_delta_under_y = std::strtof(argv[++i], nullptr);
+            max_delta_theta = std::strtof(argv[++i], nullptr);
+        } else {
+            samples = 0;
+            break;
+        }
+    }
+    if (samples == 0) {
+        std::printf("usage: stream_bench [--samples N] [--max-delta DU DT]\n");
+        return 1;
+    }
+
+    std::vector<Stream> streams = make_streams(samples);
+    std::printf("=== stream_bench ===\n");
+    std::printf("samples per stream: %zu, taylor max delta: under_y %.3f, theta %.3f\n",
+                samples, max_delta_under_y, max_delta_theta);
+    std::printf("%-11s %-14s %8s %9s %10s %7s %7s %7s %7s\n", "stream", "mode", "ns/pred", "speedup",
+                "max |diff|", "full%", "theta%", "u_y%", "taylor%");
+    for (const Stream& stream : streams) {
+        std::vector<float> reference(samples);
+        for (size_t i = 0; i < samples; i++) {
+            reference[i] = predict_distance_horner(stream.under_y[i], stream.theta[i]);
+        }
+        const double horner_ns = measure_ns(stream, predict_distance_horner);
+        print_result(stream.name, "horner", horner_ns, horner_ns, nullptr, samples);
+        StreamingResult exact = run_streaming(stream, reference, false, max_delta_under_y, max_delta_theta);
+        print_result(stream.name, "stream", exact.ns, horner_ns, &exact, samples);
+        StreamingResult taylor = run_streaming(stream, reference, true, max_delta_under_y, max_delta_theta);
+        print_result(stream.name, "stream+taylor", taylor.ns, horner_ns, &taylor, samples);
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*
+ * ホスト用 検証データ読み込みの実装
+ */
+
+#include "validation_data.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+std::vector<std::string> split_csv_line(const std::string& line) {
+    std::vector<std::string> fields;
+    std::stringstream stream(line);
+    std::string field;
+    while (std::getline(stream, field, ',')) {
+        // 末尾の空白・改行 (CRLF) を除去
+        while (!field.empty() && (field.back() == '\r' || field.back() == ' ')) {
+            field.pop_back();
+        }
+        fields.push_back(field);
+    }
+    return fields;
+}
+
+int find_column(const std::vector<std::string>& header, const char* name) {
+    for (size_t i = 0; i < header.size(); i++) {
+        if (header[i] == name) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+}  // namespace
+
+bool read_validation_rows(const std::string& path, const std::function<void(float, float, float)>& row) {
+    std::ifstream file(path);
+    std::string line;
+    if (!file || !std::getline(file, line)) {
+        return false;
+    }
+
+    // UTF-8 BOMを除去してからヘッダを解析
+    if (line.compare(0, 3, "\xEF\xBB\xBF") == 0) {
+        line.erase(0, 3);
+    }
+    std::vector<std::string> header = split_csv_line(line);
+    int under_y_column = find_column(header, "under_y");
+    int theta_column = find_column(header, "theta");
+    int distance_column = find_column(header, "distance");
+    if (under_y_column < 0 || theta_column < 0 || distance_column < 0) {
+        return false;
+    }
+    int needed = std::max(under_y_column, std::max(theta_column, distance_column));
+
+    while (std::getline(file, line)) {
+        std::vector<std::string> fields = split_csv_line(line);
+        if ((int)fields.size() <= needed) {
+            continue;
+        }
+        row(std::strtof(fields[under_y_column].c_str(), nullptr), std::strtof(fields[theta_column].c_str(), nullptr),
+            std::strtof(fields[distance_column].c_str(), nullptr));
+    }
+    return true;
+}
+
+bool load_validation_csv(const std::string& path, ValidationSet& set) {
+    set.name = std::filesystem::path(path).filename().string();
+    set.under_y.clear();
+    set.theta.clear();
+    set.distance.clear();
+    return read_validation_rows(path, [&set](float under_y, float theta, float distance) {
+        set.under_y.push_back(under_y);
+        set.theta.push_back(theta);
+        set.distance.push_back(distance);
+    });
+}
+
+std::vector<ValidationSet> load_validation_sets(const std::string& data_dir) {
+    std::vector<std::string> paths;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(data_dir, error)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".csv") {
+            paths.push_back(entry.path().string());
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+
+    std::vector<ValidationSet> sets;
+    for (const std::string& path : paths) {
+        ValidationSet set;
+        if (load_validation_csv(path, set)) {
+            sets.push_back(std::move(set));
+        }
+    }
+    return sets;
+}
@@ -0,0 +1,34 @@
+/*
+ * ホスト用 検証データ読み込み
+ * data/ のCSV (ヘッダに under_y, theta, distance を含むもの) を列ごとの配列として読み込む
+ */
+
+#ifndef HOST_VALIDATION_DATA_H
+#define HOST_VALIDATION_DATA_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+// CMakeから data/ の絶対パスが渡される (未定義ならカレントディレクトリ基準)
+#ifndef DISTPREDICT_DATA_DIR
+#define DISTPREDICT_DATA_DIR "data"
+#endif
+
+struct ValidationSet {
+    std::string name;               // ファイル名
+    std::vector<float> under_y;
+    std::vector<float> theta;
+    std::vector<float> distance;    // 実測値、またはalloutput_*では参照モデルの予測値
+};
+
+// 1ファイルを先頭から1行ずつ読み、(under_y, theta, distance) を row に渡す (配列に溜めない。必要な列がなければfalse)
+bool read_validation_rows(const std::string& path, const std::function<void(float, float, float)>& row);
+
+// 1ファイルを読み込む (必要な列がなければfalse)
+bool load_validation_csv(const std::string& path, ValidationSet& set);
+
+// ディレクトリ内の全CSVをファイル名順に読み込む (必要な列がないファイルは読み飛ばす)
+std::vector<ValidationSet> load_validation_sets(const std::string& data_dir);
+
+#endif // HOST_VALIDATION_DATA_H
@@ -0,0 +1,87 @@
+/*
+ * ホスト用 最悪実行時間 (WCET) とジッタの測定
+ *
+ * 実機のメニュー (w) と同じ run_wcet_suite を、指定した測定対象 (既定: すべて) について実行する。
+ * 表示は実機と同じ表 (領域 × 条件ごとの最小・p50・p99・最大・ジッタ・期限超過数と最悪の入力, 条件ごとのヒストグラム)。
+ * ホストでは割り込みを無効にできず、OS のスケジューリングによる外れ値も含むため、期限は実機より緩めに与えること
+ * いずれかの測定が期限を超えると終了コード 1 を返す
+ *
+ * 使い方: wcet_report [--target NAME ...] [--samples N] [--cold-samples N] [--deadline-us US]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "teensy_wcet_suite.h"
+
+namespace {
+
+struct ReportOptions {
+    std::vector<const WcetTarget*> targets;
+    WcetOptions suite = WCET_DEFAULT_OPTIONS;
+};
+
+const WcetTarget* find_target(const char* name) {
+    for (int i = 0; i < WCET_TARGET_COUNT; i++) {
+        if (std::strcmp(WCET_TARGETS[i].name, name) == 0) {
+            return &WCET_TARGETS[i];
+        }
+    }
+    return nullptr;
+}
+
+bool parse_options(int argc, char** argv, ReportOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--target") == 0 && has_value) {
+            while (i + 1 < argc && argv[i + 1][0] != '-') {
+                const WcetTarget* target = find_target(argv[++i]);
+                if (target == nullptr) {
+                    return false;
+                }
+                options.targets.push_back(target);
+            }
+        } else if (std::strcmp(argv[i], "--samples") == 0 && has_value) {
+            options.suite.warm_samples = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--cold-samples") == 0 && has_value) {
+            options.suite.cold_samples = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--deadline-us") == 0 && has_value) {
+            options.suite.deadline_us = std::strtof(argv[++i], nullptr);
+        } else {
+            return false;
+        }
+    }
+    if (options.targets.empty()) {
+        for (int i = 0; i < WCET_TARGET_COUNT; i++) {
+            options.targets.push_back(&WCET_TARGETS[i]);
+        }
+    }
+    return options.suite.warm_samples > 0 && options.suite.cold_samples > 0 && options.suite.deadline_us > 0.0f;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    ReportOptions options;
+    if (!parse_options(argc, argv, options)) {
+        std::printf("usage: wcet_report [--target NAME ...] [--samples N] [--cold-samples N] [--deadline-us US]\n");
+        std::printf("targets:");
+        for (int i = 0; i < WCET_TARGET_COUNT; i++) {
+            std::printf(" %s", WCET_TARGETS[i].name);
+        }
+        std::printf("\n");
+        return 1;
+    }
+    profiler_calibrate();
+
+    bool pass = true;
+    for (size_t i = 0; i < options.targets.size(); i++) {
+        if (i > 0) {
+            std::printf("\n");
+        }
+        pass = run_wcet_suite(*options.targets[i], options.suite) && pass;
+    }
+    return pass ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+/*
+ * Teensy 4.1 多項式回帰モデル実装 (17次) - バッチ予測
+ *
+ * 1サンプルずつのpredict_distance_horner()と同じ演算順序で評価するため結果は一致する。
+ * 内側ループはブロック内サンプル方向で依存関係がなく、コンパイラがSIMD化できる。
+ */
+
+#include "teensy_batch_model.h"
+#include <pgmspace.h>
+
+// 1ブロック (最大BATCH_BLOCK_SIZE個) を評価
+static TEENSY_FAST void predict_block(const float* under_y, const float* theta, float* out, int count) {
+    double u[BATCH_BLOCK_SIZE];
+    double t[BATCH_BLOCK_SIZE];
+    double acc[BATCH_BLOCK_SIZE];
+    double q[BATCH_BLOCK_SIZE];
+    bool valid[BATCH_BLOCK_SIZE];
+
+    // 端数ブロックは0で埋めて常に固定長で計算する
+    for (int k = 0; k < BATCH_BLOCK_SIZE; k++) {
+        float uy = k < count ? under_y[k] : 0.0f;
+        float th = k < count ? theta[k] : 0.0f;
+        valid[k] = validate_input_range(uy, th);
+        u[k] = (double)uy;
+        t[k] = (double)th;
+        acc[k] = 0.0;
+    }
+
+    // 係数は評価順に並んでいるため、各係数を1回だけ読み出して全サンプルに適用
+    const double* coeff = HORNER_COEFFICIENTS;
+    for (int i = POLY_DEGREE; i >= 0; i--) {
+        double c = *coeff++;
+        for (int k = 0; k < BATCH_BLOCK_SIZE; k++) {
+            q[k] = c;
+        }
+        for (int j = POLY_DEGREE - i; j > 0; j--) {
+            c = *coeff++;
+            for (int k = 0; k < BATCH_BLOCK_SIZE; k++) {
+                q[k] = q[k] * t[k] + c;
+            }
+        }
+        for (int k = 0; k < BATCH_BLOCK_SIZE; k++) {
+            acc[k] = acc[k] * u[k] + q[k];
+        }
+    }
+
+    for (int k = 0; k < count; k++) {
+        out[k] = valid[k] ? (float)(acc[k] + HORNER_INTERCEPT) : -1.0f;  // エラー指標
+    }
+}
+
+void predict_distance_batch(const float* under_y, const float* theta, float* out, size_t n) {
+    size_t offset = 0;
+    while (offset < n) {
+        size_t remaining = n - offset;
+        int count = remaining < (size_t)BATCH_BLOCK_SIZE ? (int)remaining : BATCH_BLOCK_SIZE;
+        predict_block(under_y + offset, theta + offset, out + offset, count);
+        offset += (size_t)count;
+    }
+}
@@ -0,0 +1,21 @@
+/*
+ * Teensy 4.1 多項式回帰モデル (17次) - バッチ予測API
+ *
+ * 構造体配列ではなく配列構造 (under_y[], theta[]) で入力を受け取り、
+ * Horner係数を1回読み出すごとにブロック内の全サンプルへ適用する
+ */
+
+#ifndef TEENSY_BATCH_MODEL_H
+#define TEENSY_BATCH_MODEL_H
+
+#include <stddef.h>
+#include "teensy_horner_model.h"
+
+// 1ブロックで同時に評価するサンプル数 (スタック使用量: 5 * 8 * BATCH_BLOCK_SIZE バイト)
+const int BATCH_BLOCK_SIZE = 16;
+
+// n個のサンプルをまとめて予測 (範囲外の入力は -1.0f)
+// out は under_y または theta と同じ配列でもよい (ずらして一部だけ重なる配列は不可)
+void predict_distance_batch(const float* under_y, const float* theta, float* out, size_t n);
+
+#endif // TEENSY_BATCH_MODEL_H
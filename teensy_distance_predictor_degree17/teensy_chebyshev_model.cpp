@@ -0,0 +1,71 @@
+/*
+ * Teensy 4.1 多項式回帰モデル実装 (17次) - チェビシェフ基底 Clenshaw評価
+ * 係数表: teensy_chebyshev_model.h (export_teensy_model.py chebyshev で生成)
+ *
+ * 単項式基底では係数と中間値が大きく打ち消し合うため倍精度+Kahan総和が必要だったが、
+ * [-1, 1]^2 上のチェビシェフ基底では |T_k| <= 1 で係数も小さく揃うため単精度で評価できる
+ * - 特徴量生成・標準化のループなし
+ * - 内側 (y方向) と外側 (x方向) をそれぞれClenshaw漸化式で評価 (乗加算 約2x171回)
+ */
+
+#include "teensy_chebyshev_model.h"
+#include <pgmspace.h>
+
+// 入れ子Clenshaw評価: Σ_i T_i(x) r_i(y), r_i(y) = Σ_j c_ij T_j(y)
+// b_k = c_k + 2t b_(k+1) - b_(k+2),  Σ c_k T_k(t) = c_0 + t b_1 - b_2
+template <typename Real>
+static TEENSY_INLINE Real clenshaw_2d(const Real* coeff, Real x, Real y) {
+    const Real two_x = x + x;
+    const Real two_y = y + y;
+    Real outer1 = 0, outer2 = 0;
+
+    // 係数は評価順に並んでいるため先頭から順に読み出すだけでよい
+    for (int i = POLY_DEGREE; ; i--) {
+        Real inner1 = 0, inner2 = 0;
+        for (int j = POLY_DEGREE - i; j > 0; j--) {
+            Real inner0 = *coeff++ + two_y * inner1 - inner2;
+            inner2 = inner1;
+            inner1 = inner0;
+        }
+        Real row = *coeff++ + y * inner1 - inner2;
+
+        if (i == 0) {
+            return row + x * outer1 - outer2;
+        }
+        Real outer0 = row + two_x * outer1 - outer2;
+        outer2 = outer1;
+        outer1 = outer0;
+    }
+}
+
+TEENSY_FAST float evaluate_chebyshev_float(float under_y, float theta) {
+    const float x = (under_y - (float)CHEBYSHEV_UNDER_Y_CENTER) * (float)CHEBYSHEV_UNDER_Y_INV_HALF_WIDTH;
+    const float y = (theta - (float)CHEBYSHEV_THETA_CENTER) * (float)CHEBYSHEV_THETA_INV_HALF_WIDTH;
+    return clenshaw_2d<float>(CHEBYSHEV_COEFFICIENTS_F, x, y);
+}
+
+TEENSY_FAST double evaluate_chebyshev_double(double under_y, double theta) {
+    const double x = (under_y - CHEBYSHEV_UNDER_Y_CENTER) * CHEBYSHEV_UNDER_Y_INV_HALF_WIDTH;
+    const double y = (theta - CHEBYSHEV_THETA_CENTER) * CHEBYSHEV_THETA_INV_HALF_WIDTH;
+    return clenshaw_2d<double>(CHEBYSHEV_COEFFICIENTS, x, y);
+}
+
+// 単精度Clenshaw評価による予測関数
+TEENSY_FAST float predict_distance_chebyshev(float under_y, float theta) {
+    // 入力値検証
+    if (!validate_input_range(under_y, theta)) {
+        return -1.0f;  // エラー指標
+    }
+
+    return evaluate_chebyshev_float(under_y, theta);
+}
+
+// 倍精度Clenshaw評価による予測関数
+TEENSY_FAST float predict_distance_chebyshev_double(float under_y, float theta) {
+    // 入力値検証
+    if (!validate_input_range(under_y, theta)) {
+        return -1.0f;  // エラー指標
+    }
+
+    return (float)evaluate_chebyshev_double((double)under_y, (double)theta);
+}
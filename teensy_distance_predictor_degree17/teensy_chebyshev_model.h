@@ -0,0 +1,178 @@
+/*
+ * Teensy 4.1 多項式回帰モデル (17次) - チェビシェフ基底 (Clenshaw評価) 用係数
+ * 自動生成元: models/20250721_233056-LNN蒸留多項式/polynomial_degree17_mae0.90.joblib
+ * 生成日時: 2026-10-16 23:45:27
+ * 生成スクリプト: export_teensy_model.py chebyshev
+ *
+ * 正規化変数 x = (under_y - 60.5) / 60.5, y = (theta - 3.5) / 52.5
+ * (under_y 0..121, theta -49..56 が [-1, 1]^2 に写る) 上のテンソル基底:
+ *   distance = Σ c_ij * T_i(x) * T_j(y)  (i + j <= 17, 切片は c_00 に含む)
+ * 係数の大きさ: 最大 1.184e+03, 絶対値の総和 2.002e+04
+ *   (単項式基底では最大 1.140e+05, 総和 2.925e+06)
+ * 係数は評価順 (外側T_17(x)→T_0(x), 内側T_j(y)降順) に格納
+ */
+
+#ifndef TEENSY_CHEBYSHEV_MODEL_H
+#define TEENSY_CHEBYSHEV_MODEL_H
+
+#include "teensy_horner_model.h"
+
+// 正規化の中心と半幅の逆数
+const double CHEBYSHEV_UNDER_Y_CENTER = 60.5;
+const double CHEBYSHEV_UNDER_Y_INV_HALF_WIDTH = 0.01652892561983471;
+const double CHEBYSHEV_THETA_CENTER = 3.5;
+const double CHEBYSHEV_THETA_INV_HALF_WIDTH = 0.01904761904761905;
+
+// チェビシェフ係数 c_ij (単精度)
+const float CHEBYSHEV_COEFFICIENTS_F[HORNER_TERM_COUNT] PROGMEM = {
+    // T_17(x) : T_0..0(y)
+    0.00134911478f,
+    // T_16(x) : T_1..0(y)
+    0.000246436269f, 0.017984277f,
+    // T_15(x) : T_2..0(y)
+    -0.0880270423f, 0.0129450627f, -0.0132511306f,
+    // T_14(x) : T_3..0(y)
+    -0.0478478339f, -0.470118913f, -0.0648952614f, -0.437805821f,
+    // T_13(x) : T_4..0(y)
+    0.427410335f, 0.0487386231f, 2.36761755f, 0.16693026f,
+    1.66631524f,
+    // T_12(x) : T_5..0(y)
+    0.0494174525f, -1.56546537f, -0.169274912f, -5.2682849f,
+    -0.564499154f, -3.39122867f,
+    // T_11(x) : T_6..0(y)
+    0.308045818f, 0.363747938f, 3.36371761f, 1.87335644f,
+    8.04783467f, 3.3828675f, 4.95140717f,
+    // T_10(x) : T_7..0(y)
+    -0.607480114f, -0.461525026f, -3.00362043f, -3.62153671f,
+    -7.752958f, -7.32335294f, -11.58491f, -4.37922926f,
+    // T_9(x) : T_8..0(y)
+    -0.61850714f, 1.02823185f, -1.74183262f, 4.82481449f,
+    -1.76197748f, 10.9589817f, -2.23852827f, 15.568238f,
+    -1.29121069f,
+    // T_8(x) : T_9..0(y)
+    0.486536284f, 1.93938938f, 1.27496649f, 6.70411442f,
+    1.97504674f, 12.9425914f, 2.7409148f, 20.4506535f,
+    3.41284781f, 11.7683573f,
+    // T_7(x) : T_10..0(y)
+    -0.394251772f, -1.56660168f, -5.16850718f, -8.3501058f,
+    -17.1386016f, -23.1144029f, -35.5660373f, -43.077617f,
+    -55.4021404f, -57.9803888f, -31.4379559f,
+    // T_6(x) : T_11..0(y)
+    0.404547933f, 2.2802025f, 7.06390507f, 14.9361693f,
+    31.5335953f, 44.9727673f, 80.8343608f, 92.4145836f,
+    143.791368f, 139.006596f, 188.944473f, 78.5330153f,
+    // T_5(x) : T_12..0(y)
+    -0.559175765f, -3.28789592f, -6.84480238f, -24.0161395f,
+    -31.8777004f, -84.1768646f, -88.2573068f, -193.639134f,
+    -174.410039f, -325.409763f, -255.118459f, -416.629805f,
+    -143.96516f,
+    // T_4(x) : T_13..0(y)
+    0.037066171f, 0.342093834f, 5.28197288f, 5.04634437f,
+    33.8438911f, 26.1845859f, 112.018431f, 77.3051665f,
+    249.330319f, 157.737931f, 411.092063f, 233.066102f,
+    521.265497f, 133.074692f,
+    // T_3(x) : T_14..0(y)
+    0.433762662f, 0.806795509f, 2.97753598f, 0.063169319f,
+    8.48913545f, -14.3967383f, 11.5383104f, -60.7697128f,
+    2.97524992f, -147.206586f, -22.2369003f, -252.062931f,
+    -49.235891f, -323.34383f, -36.0533446f,
+    // T_2(x) : T_15..0(y)
+    0.610835312f, 0.35121641f, 4.03635536f, 2.34870116f,
+    16.4649072f, 11.7118616f, 50.3018381f, 39.2510461f,
+    116.331028f, 92.233651f, 213.617216f, 164.362898f,
+    316.828264f, 231.380662f, 382.899632f, 146.142493f,
+    // T_1(x) : T_16..0(y)
+    -0.0592934184f, -3.56345289f, -4.08409512f, -23.2080347f,
+    -25.4241071f, -84.5073181f, -94.6522431f, -219.665607f,
+    -246.829095f, -443.892091f, -491.605528f, -732.603329f,
+    -785.567214f, -1012.41925f, -1046.29971f, -1184.47487f,
+    -615.706397f,
+    // T_0(x) : T_17..0(y)
+    0.0490665617f, 0.0263896525f, 2.97971296f, 3.24045243f,
+    18.425657f, 20.2429672f, 65.729235f, 74.219128f,
+    168.125659f, 190.339859f, 335.603914f, 375.013697f,
+    548.440349f, 594.552308f, 752.365968f, 788.330244f,
+    877.5374f, 464.9347f
+};
+
+// チェビシェフ係数 c_ij (倍精度)
+const double CHEBYSHEV_COEFFICIENTS[HORNER_TERM_COUNT] PROGMEM = {
+    // T_17(x) : T_0..0(y)
+      1.3491147759718805e-03,
+    // T_16(x) : T_1..0(y)
+      2.4643626917944468e-04,   1.7984277024628140e-02,
+    // T_15(x) : T_2..0(y)
+     -8.8027042345229345e-02,   1.2945062738616306e-02,  -1.3251130619068444e-02,
+    // T_14(x) : T_3..0(y)
+     -4.7847833938890388e-02,  -4.7011891316055426e-01,  -6.4895261440686469e-02,  -4.3780582121561579e-01,
+    // T_13(x) : T_4..0(y)
+      4.2741033507414888e-01,   4.8738623135041896e-02,   2.3676175513919526e+00,   1.6693025989698329e-01,
+      1.6663152405909689e+00,
+    // T_12(x) : T_5..0(y)
+      4.9417452460240138e-02,  -1.5654653685416562e+00,  -1.6927491225134061e-01,  -5.2682848960152588e+00,
+     -5.6449915428829511e-01,  -3.3912286714611231e+00,
+    // T_11(x) : T_6..0(y)
+      3.0804581762517325e-01,   3.6374793797841543e-01,   3.3637176063090677e+00,   1.8733564449239115e+00,
+      8.0478346694033540e+00,   3.3828674970301638e+00,   4.9514071744242250e+00,
+    // T_10(x) : T_7..0(y)
+     -6.0748011437683613e-01,  -4.6152502556887082e-01,  -3.0036204294437674e+00,  -3.6215367102881779e+00,
+     -7.7529580043329895e+00,  -7.3233529407332894e+00,  -1.1584909970917908e+01,  -4.3792292647267423e+00,
+    // T_9(x) : T_8..0(y)
+     -6.1850713991913764e-01,   1.0282318538149142e+00,  -1.7418326209405632e+00,   4.8248144850811565e+00,
+     -1.7619774806390707e+00,   1.0958981705901959e+01,  -2.2385282677152256e+00,   1.5568238014288253e+01,
+     -1.2912106922643718e+00,
+    // T_8(x) : T_9..0(y)
+      4.8653628352958611e-01,   1.9393893845341843e+00,   1.2749664890532055e+00,   6.7041144205344931e+00,
+      1.9750467408666890e+00,   1.2942591398521509e+01,   2.7409148030964818e+00,   2.0450653508034812e+01,
+      3.4128478084968794e+00,   1.1768357268243159e+01,
+    // T_7(x) : T_10..0(y)
+     -3.9425177177143139e-01,  -1.5666016822836901e+00,  -5.1685071824440625e+00,  -8.3501057956492115e+00,
+     -1.7138601630135330e+01,  -2.3114402880655415e+01,  -3.5566037314709320e+01,  -4.3077616983367989e+01,
+     -5.5402140377965665e+01,  -5.7980388800147949e+01,  -3.1437955891081582e+01,
+    // T_6(x) : T_11..0(y)
+      4.0454793321686144e-01,   2.2802024963537200e+00,   7.0639050701658874e+00,   1.4936169262238058e+01,
+      3.1533595340517181e+01,   4.4972767293536847e+01,   8.0834360788927057e+01,   9.2414583586783351e+01,
+      1.4379136780368844e+02,   1.3900659643404529e+02,   1.8894447329696402e+02,   7.8533015322233368e+01,
+    // T_5(x) : T_12..0(y)
+     -5.5917576470538854e-01,  -3.2878959162196173e+00,  -6.8448023809278302e+00,  -2.4016139490244893e+01,
+     -3.1877700392583218e+01,  -8.4176864587882619e+01,  -8.8257306772412718e+01,  -1.9363913359483115e+02,
+     -1.7441003938737038e+02,  -3.2540976282313147e+02,  -2.5511845888280314e+02,  -4.1662980471724006e+02,
+     -1.4396515975633824e+02,
+    // T_4(x) : T_13..0(y)
+      3.7066170990230345e-02,   3.4209383433743051e-01,   5.2819728801146439e+00,   5.0463443682780236e+00,
+      3.3843891119123157e+01,   2.6184585865688899e+01,   1.1201843095826023e+02,   7.7305166456732550e+01,
+      2.4933031909137750e+02,   1.5773793142187782e+02,   4.1109206342312649e+02,   2.3306610223393108e+02,
+      5.2126549715262615e+02,   1.3307469211254505e+02,
+    // T_3(x) : T_14..0(y)
+      4.3376266200652086e-01,   8.0679550932501232e-01,   2.9775359833784281e+00,   6.3169319003921823e-02,
+      8.4891354532131942e+00,  -1.4396738337472938e+01,   1.1538310404416794e+01,  -6.0769712790279094e+01,
+      2.9752499171953772e+00,  -1.4720658634635512e+02,  -2.2236900346673814e+01,  -2.5206293114920226e+02,
+     -4.9235891045604703e+01,  -3.2334382998504151e+02,  -3.6053344587707073e+01,
+    // T_2(x) : T_15..0(y)
+      6.1083531235145960e-01,   3.5121640972678364e-01,   4.0363553555514873e+00,   2.3487011574618517e+00,
+      1.6464907171340727e+01,   1.1711861590937350e+01,   5.0301838141071208e+01,   3.9251046121068363e+01,
+      1.1633102814910949e+02,   9.2233651009804504e+01,   2.1361721577307210e+02,   1.6436289845567148e+02,
+      3.1682826400054154e+02,   2.3138066232117993e+02,   3.8289963171813923e+02,   1.4614249283523685e+02,
+    // T_1(x) : T_16..0(y)
+     -5.9293418436418964e-02,  -3.5634528917980046e+00,  -4.0840951154649581e+00,  -2.3208034652336991e+01,
+     -2.5424107130148403e+01,  -8.4507318065020598e+01,  -9.4652243137056360e+01,  -2.1966560654444785e+02,
+     -2.4682909509638696e+02,  -4.4389209060661511e+02,  -4.9160552847798868e+02,  -7.3260332860797462e+02,
+     -7.8556721441275204e+02,  -1.0124192495786648e+03,  -1.0462997146773696e+03,  -1.1844748664715819e+03,
+     -6.1570639714103424e+02,
+    // T_0(x) : T_17..0(y)
+      4.9066561656959697e-02,   2.6389652519221499e-02,   2.9797129575539811e+00,   3.2404524256093943e+00,
+      1.8425656997964776e+01,   2.0242967166431022e+01,   6.5729235000334455e+01,   7.4219127998159479e+01,
+      1.6812565930516396e+02,   1.9033985938283490e+02,   3.3560391412567253e+02,   3.7501369695451825e+02,
+      5.4844034947805687e+02,   5.9455230816366975e+02,   7.5236596849764646e+02,   7.8833024376676678e+02,
+      8.7753740043644689e+02,   4.6493470049538860e+02
+};
+
+// Clenshaw漸化式による予測関数 (入力検証付き)
+float predict_distance_chebyshev(float under_y, float theta);
+float predict_distance_chebyshev_double(float under_y, float theta);
+
+// 入力検証なしの評価関数
+float evaluate_chebyshev_float(float under_y, float theta);
+double evaluate_chebyshev_double(double under_y, double theta);
+
+#endif // TEENSY_CHEBYSHEV_MODEL_H
@@ -14,6 +14,24 @@
  */
 
 #include "teensy_polynomial_model.h"
+#include "teensy_horner_model.h"
+#include "teensy_lut_model.h"
+#include "teensy_tiled_model.h"
+#include "teensy_sparse_model.h"
+#include "teensy_streaming_model.h"
+#include "teensy_prediction_cache.h"
+#include "teensy_sample_pipeline.h"
+#include "teensy_serial_protocol.h"
+#include "teensy_precision_model.h"
+#include "teensy_chebyshev_model.h"
+#include "teensy_ensemble_model.h"
+#include "teensy_model_blob.h"
+#include "teensy_wcet_suite.h"
+#include "teensy_profiler.h"
+#include <SD.h>
+
+// SDカードから読み込むバイナリモデル (export_teensy_model.py blob で生成したファイルをこの名前でコピー)
+const char* MODEL_BLOB_PATH = "model.dpm";
 
 // 検証用テストデータ構造体
 struct TestCase {
@@ -39,20 +57,42 @@ const TestCase TEST_CASES[] = {
 
 const int NUM_TEST_CASES = sizeof(TEST_CASES) / sizeof(TestCase);
 
-// ベンチマーク統計情報
-struct BenchmarkStats {
-    uint32_t min_time_us;
-    uint32_t max_time_us;
-    uint32_t total_time_us;
-    uint32_t num_samples;
-    float mean_error;
-    float max_error;
-    float total_error;
+// PC版scikit-learnとの比較用テストケース (倍精度の期待値)
+struct PCTestCase {
+    float under_y;
+    float theta;
+    double expected_pc_result;
+    const char* description;
 };
 
+const PCTestCase PC_TEST_CASES[] = {
+    {10.0f, 45.0f, -1.469114474846, "Standard test case"},
+    {0.0f, 0.0f, 90.490019373702, "Origin point"},
+    {-5.0f, -30.0f, -12.680106587601, "Negative values"},
+    {15.0f, 90.0f, 100166717.672446146607, "High angle"},
+    {5.0f, 30.0f, 84.307658247756, "Low values"}
+};
+
+const int NUM_PC_TEST_CASES = sizeof(PC_TEST_CASES) / sizeof(PCTestCase);
+
 // グローバル変数
-BenchmarkStats benchmark_stats;
+// 実行時間の統計は teensy_profiler の段階別ヒストグラム (DWTサイクルカウンタ) に集計する
 bool continuous_mode = false;
+bool profiler_active_before_continuous = false;    // 連続モード終了時に戻すプロファイラの状態
+// 連続モード用の差分評価 (前回の部分Horner多項式を保持)
+StreamingPredictor streaming_predictor;
+// 量子化入力の予測結果キャッシュ (グローバル変数のため DTCM に置かれる)
+PredictionCache prediction_cache;
+// 取得→推論→出力パイプライン (取得段は IntervalTimer の割り込み, 推論段・出力段は loop())
+SamplePipeline sample_pipeline;
+IntervalTimer acquisition_timer;
+bool pipeline_mode = false;
+const uint32_t PIPELINE_SAMPLE_RATE_HZ = 1000;     // 取得段のサンプルレート
+const uint32_t PIPELINE_OUTPUT_DECIMATION = 100;   // 出力段が送信する結果の間引き (1/N)
+uint32_t pipeline_acquire_index = 0;               // 割り込みハンドラだけが書き込む
+// バイナリフレームの要求 (host/serial_client) の受信状態と応答の送信バッファ
+FrameParser protocol_parser;
+uint8_t protocol_response[PROTOCOL_MAX_FRAME_SIZE];
 
 void setup() {
     // Initialize serial communication
@@ -74,6 +114,8 @@ void setup() {
     print_memory_info();
     
     // Initialize benchmark statistics
+    // サイクルカウンタの較正のみ行い、段階別の記録はベンチマーク (3, 4) とレポート (r) で有効化する
+    profiler_calibrate();
     reset_benchmark_stats();
     
     // Display menu
@@ -81,9 +123,18 @@ void setup() {
 }
 
 void loop() {
-    if (Serial.available()) {
-        char command = Serial.read();
-        handle_command(command);
+    // 同期バイトで始まるバイナリフレームは受信できるだけ処理し、それ以外の文字はメニューのコマンドとして扱う
+    while (Serial.available()) {
+        uint8_t byte = Serial.read();
+        if (protocol_parser.idle() && byte != PROTOCOL_SYNC0) {
+            handle_command((char)byte);
+            break;
+        }
+        handle_protocol_byte(byte);
+    }
+    
+    if (pipeline_mode) {
+        run_pipeline_stages();
     }
     
     if (continuous_mode) {
@@ -118,6 +169,53 @@ void handle_command(char command) {
         case '8':
             run_pc_comparison_test();
             break;
+        case '9':
+            run_horner_comparison_test();
+            break;
+        case 'l':
+        case 'L':
+            run_lut_comparison_test();
+            break;
+        case 't':
+        case 'T':
+            run_tiled_comparison_test();
+            break;
+        case 's':
+        case 'S':
+            run_sparse_comparison_test();
+            break;
+        case 'p':
+        case 'P':
+            run_precision_comparison_test();
+            break;
+        case 'm':
+        case 'M':
+            load_model_blob_from_sd();
+            break;
+        case 'c':
+        case 'C':
+            run_cache_test();
+            break;
+        case 'q':
+        case 'Q':
+            toggle_pipeline_mode();
+            break;
+        case 'g':
+        case 'G':
+            run_gradient_test();
+            break;
+        case 'e':
+        case 'E':
+            run_ensemble_test();
+            break;
+        case 'w':
+        case 'W':
+            run_wcet_test();
+            break;
+        case 'r':
+        case 'R':
+            run_profile_report();
+            break;
         case 'h':
         case 'H':
             print_menu();
@@ -143,7 +241,20 @@ void print_menu() {
     Serial.println("6 - ベンチマーク統計のリセット");
     Serial.println("7 - ストレステスト (高負荷)");
     Serial.println("8 - PC版との精度比較テスト (詳細デバッグ付き)");
+    Serial.println("9 - Horner評価エンジンの精度・速度比較");
+    Serial.println("l - 補間表 (双1次/双3次) の補間誤差・速度比較");
+    Serial.println("t - 区分多項式モデル (4次タイル) の誤差・速度比較");
+    Serial.println("s - スパース (枝刈り) 多項式モデルの項数ごとの誤差・速度比較");
+    Serial.println("p - 精度モード (倍精度/単精度/混合精度/チェビシェフ) の誤差・速度比較");
+    Serial.println("m - SDカードのバイナリモデル (model.dpm) を読み込んで切り替え");
+    Serial.println("c - 予測結果キャッシュ (量子化入力) のヒット率・速度測定");
+    Serial.println("q - 取得→推論→出力パイプライン (割り込みで取得) の切り替え");
+    Serial.println("g - 予測値 + 勾配 (+ Hessian) の同時評価と差分近似の速度・差の比較");
+    Serial.println("e - 複数次数モデル (6次 + 17次) のべき乗表共有評価と選択・加重平均の比較");
+    Serial.println("w - 最悪実行時間 (WCET)・ジッタ測定 (入力領域 × キャッシュ cold/warm × 割り込み有効/無効)");
+    Serial.println("r - 段階別プロファイル (サイクル数の最小/平均/p50/p99/最大) の表示");
     Serial.println("h - このメニューを表示");
+    Serial.println("(0xA5 0x5A で始まるバイナリ要求フレームはいつでも受け付けます: host/serial_client)");
     Serial.println("----------------------------------------");
     Serial.print("コマンドを入力してください: ");
 }
@@ -161,27 +272,23 @@ void run_single_prediction() {
         return;
     }
     
-    // Measure prediction time
-    uint32_t start_time = micros();
-    float prediction = predict_distance_teensy(under_y, theta);
-    uint32_t end_time = micros();
-    uint32_t execution_time = end_time - start_time;
+    // Measure prediction time (サイクル単位)
+    uint32_t start_cycles = profiler_cycles();
+    float prediction = predict_distance_selected(under_y, theta);
+    float execution_time = profiler_cycles_to_us(profiler_cycles() - start_cycles);
     
     // Display results
     Serial.println("\n結果:");
     Serial.print("  入力: under_y="); Serial.print(under_y, 3);
     Serial.print(", theta="); Serial.println(theta, 3);
     Serial.print("  予測距離: "); Serial.print(prediction, 3); Serial.println(" cm");
-    Serial.print("  実行時間: "); Serial.print(execution_time); Serial.println(" μs");
+    Serial.print("  実行時間: "); Serial.print(execution_time, 3); Serial.println(" μs");
     
     // Performance analysis for degree 17
-    Serial.println("\n17次多項式モデル分析 (Double precision):");
+    Serial.print("\n17次多項式モデル分析 (精度モード: "); Serial.print(selected_precision_name()); Serial.println("):");
     Serial.print("  特徴量数: "); Serial.println(FEATURE_COUNT);
     Serial.print("  予想実行時間: <120μs");
-    Serial.print(" ["); Serial.print(execution_time < 120 ? "合格" : "要最適化"); Serial.println("]");
-    
-    // Update benchmark statistics
-    update_benchmark_stats(execution_time, 0.0f);  // No error calculation for manual input
+    Serial.print(" ["); Serial.print(execution_time < 120.0f ? "合格" : "要最適化"); Serial.println("]");
 }
 
 float get_float_input(const char* prompt) {
@@ -210,16 +317,15 @@ void run_test_suite() {
     float total_error = 0.0f;
     float max_error = 0.0f;
     int passed_tests = 0;
-    uint32_t total_time = 0;
+    float total_time = 0.0f;
     
     for (int i = 0; i < NUM_TEST_CASES; i++) {
         const TestCase& test = TEST_CASES[i];
         
         // Run prediction
-        uint32_t start_time = micros();
-        float prediction = predict_distance_teensy(test.under_y, test.theta);
-        uint32_t end_time = micros();
-        uint32_t execution_time = end_time - start_time;
+        uint32_t start_cycles = profiler_cycles();
+        float prediction = predict_distance_selected(test.under_y, test.theta);
+        float execution_time = profiler_cycles_to_us(profiler_cycles() - start_cycles);
         total_time += execution_time;
         
         // Calculate error
@@ -245,17 +351,14 @@ void run_test_suite() {
         Serial.print("  期待値: "); Serial.print(test.expected_distance, 2);
         Serial.print(" cm, 予測値: "); Serial.print(prediction, 2); Serial.println(" cm");
         Serial.print("  誤差: "); Serial.print(error, 3); Serial.print(" cm");
-        Serial.print(", 時間: "); Serial.print(execution_time); Serial.print(" μs");
+        Serial.print(", 時間: "); Serial.print(execution_time, 3); Serial.print(" μs");
         Serial.print(" ["); Serial.print(passed ? "合格" : "不合格"); Serial.println("]");
         Serial.println();
-        
-        // Update benchmark statistics
-        update_benchmark_stats(execution_time, error);
     }
     
     // Display summary
     float mean_error = total_error / NUM_TEST_CASES;
-    float mean_time = (float)total_time / NUM_TEST_CASES;
+    float mean_time = total_time / NUM_TEST_CASES;
     float pass_rate = (float)passed_tests / NUM_TEST_CASES * 100.0f;
     
     Serial.println("=== テストスイート概要 ===");
@@ -276,9 +379,10 @@ void run_benchmark_suite() {
     Serial.print(BENCHMARK_ITERATIONS);
     Serial.println(" 回のイテレーションでパフォーマンス分析を実行中...");
     
-    uint32_t min_time = UINT32_MAX;
-    uint32_t max_time = 0;
-    uint32_t total_time = 0;
+    // 段階別ヒストグラムをこのベンチマークの分だけにする (記録はベンチマーク中だけ有効化)
+    const bool profiler_was_active = profiler_active();
+    profiler_set_active(true);
+    profiler_reset();
     
     // Use a representative test case for benchmarking
     float test_under_y = 10.0f;
@@ -294,16 +398,8 @@ void run_benchmark_suite() {
             Serial.print(".");
         }
         
-        // Measure execution time
-        uint32_t start_time = micros();
+        // 実行時間は predict_distance_teensy 内のスコープタイマーが段階ごとに記録する
         float prediction = predict_distance_teensy(test_under_y, test_theta);
-        uint32_t end_time = micros();
-        uint32_t execution_time = end_time - start_time;
-        
-        // Update statistics
-        total_time += execution_time;
-        if (execution_time < min_time) min_time = execution_time;
-        if (execution_time > max_time) max_time = execution_time;
         
         // Prevent compiler optimization
         (void)prediction;
@@ -312,21 +408,28 @@ void run_benchmark_suite() {
     Serial.println(" 完了！");
     
     // Calculate statistics
-    float mean_time = (float)total_time / BENCHMARK_ITERATIONS;
+    const StageHistogram& predict_stats = profiler_histogram(PROFILE_STAGE_PREDICT);
+    float mean_cycles = predict_stats.count > 0 ? (float)predict_stats.total_cycles / predict_stats.count : 0.0f;
+    float mean_time = mean_cycles / profiler_cycles_per_us();
     
     // Display results
     Serial.println("\n=== ベンチマーク結果 ===");
     Serial.print("イテレーション数: "); Serial.println(BENCHMARK_ITERATIONS);
-    Serial.print("最小時間: "); Serial.print(min_time); Serial.println(" μs");
-    Serial.print("最大時間: "); Serial.print(max_time); Serial.println(" μs");
-    Serial.print("平均時間: "); Serial.print(mean_time, 2); Serial.println(" μs");
+    Serial.print("最小時間: "); Serial.print(profiler_cycles_to_us(predict_stats.min_cycles), 3); Serial.println(" μs");
+    Serial.print("最大時間: "); Serial.print(profiler_cycles_to_us(predict_stats.max_cycles), 3); Serial.println(" μs");
+    Serial.print("平均時間: "); Serial.print(mean_time, 3); Serial.println(" μs");
+    Serial.print("p99時間: "); Serial.print(profiler_cycles_to_us(histogram_percentile(predict_stats, 0.99f)), 3); Serial.println(" μs");
     Serial.print("目標時間: <120 μs (Double precision)");
     Serial.print(" ["); Serial.print(mean_time < 120.0f ? "合格" : "要最適化"); Serial.println("]");
-    Serial.print("合計時間: "); Serial.print(total_time / 1000.0f, 2); Serial.println(" ms");
+    Serial.print("合計時間: "); Serial.print(profiler_cycles_to_us((uint32_t)predict_stats.total_cycles) / 1000.0f, 3); Serial.println(" ms");
+    
+    // 段階別の内訳 (特徴量生成・標準化・線形結合)
+    Serial.println();
+    print_profile_report();
     
     // Performance analysis for degree 17
     Serial.println("\n=== パフォーマンス分析 (17次多項式) ===");
-    Serial.print("予測あたりのCPUサイクル: ~"); Serial.print((int)(mean_time * 0.6f)); Serial.println(" サイクル");
+    Serial.print("予測あたりのCPUサイクル: "); Serial.print((int)mean_cycles); Serial.println(" サイクル (DWT実測)");
     Serial.print("理論上の最大予測数/秒: "); Serial.print((int)(1000000.0f / mean_time)); Serial.println();
     Serial.print("特徴量処理効率: "); Serial.print(171.0f / mean_time, 2); Serial.println(" 特徴量/μs");
     
@@ -335,11 +438,19 @@ void run_benchmark_suite() {
     Serial.print("スタック使用量: ~"); Serial.print(171 * 8 + 18 * 8 * 2); Serial.println(" bytes (double)");
     Serial.print("フラッシュ使用量: ~"); Serial.print(171 * 8 * 3); Serial.println(" bytes (double)");
     
-    // Update global benchmark statistics
-    benchmark_stats.min_time_us = min_time;
-    benchmark_stats.max_time_us = max_time;
-    benchmark_stats.total_time_us += total_time;
-    benchmark_stats.num_samples += BENCHMARK_ITERATIONS;
+    // メニュー・プロトコル・パイプラインが使う評価器 (コンパイル時に選択) も同じ入力で計測する
+    for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+        float prediction = predict_distance_selected(test_under_y, test_theta);
+        (void)prediction;
+    }
+    profiler_set_active(profiler_was_active);
+    
+    const StageHistogram& selected_stats = profiler_histogram(PROFILE_STAGE_SELECTED);
+    Serial.print("\n=== 選択した評価器 ("); Serial.print(selected_precision_name()); Serial.println(") ===");
+    Serial.print("平均時間: ");
+    Serial.print(selected_stats.count > 0 ? profiler_cycles_to_us((uint32_t)(selected_stats.total_cycles / selected_stats.count)) : 0.0f, 3);
+    Serial.print(" μs, p99: "); Serial.print(profiler_cycles_to_us(histogram_percentile(selected_stats, 0.99f)), 3);
+    Serial.println(" μs");
 }
 
 void run_stress_test() {
@@ -357,7 +468,7 @@ void run_stress_test() {
         float theta = -90.0f + (i % 180);
         
         // Run prediction
-        float prediction = predict_distance_teensy(under_y, theta);
+        float prediction = predict_distance_selected(under_y, theta);
         
         // Check for failed predictions
         if (prediction < 0) {
@@ -385,23 +496,8 @@ void run_pc_comparison_test() {
     Serial.println("\n=== PC版との精度比較テスト (詳細デバッグ付き) ===");
     Serial.println("PC版scikit-learnの結果と比較し、内部計算も表示します...\n");
     
-    // Test cases with expected PC results
-    struct PCTestCase {
-        float under_y;
-        float theta;
-        double expected_pc_result;
-        const char* description;
-    };
-    
-    const PCTestCase pc_test_cases[] = {
-        {10.0f, 45.0f, -1.469114474846, "Standard test case"},
-        {0.0f, 0.0f, 90.490019373702, "Origin point"},
-        {-5.0f, -30.0f, -12.680106587601, "Negative values"},
-        {15.0f, 90.0f, 100166717.672446146607, "High angle"},
-        {5.0f, 30.0f, 84.307658247756, "Low values"}
-    };
-    
-    const int num_pc_tests = sizeof(pc_test_cases) / sizeof(PCTestCase);
+    const PCTestCase* pc_test_cases = PC_TEST_CASES;
+    const int num_pc_tests = NUM_PC_TEST_CASES;
     
     float total_error = 0.0f;
     float max_error = 0.0f;
@@ -422,10 +518,11 @@ void run_pc_comparison_test() {
         
         Serial.println("\\n内部計算詳細:");
         Serial.println("ステップ1: 多項式特徴量生成");
-        uint32_t step1_start = micros();
+        uint32_t step1_start = profiler_cycles();
         generate_polynomial_features_double(test.under_y, test.theta, features);
-        uint32_t step1_time = micros() - step1_start;
-        Serial.print("  時間: "); Serial.print(step1_time); Serial.println(" μs");
+        uint32_t step1_cycles = profiler_cycles() - step1_start;
+        Serial.print("  時間: "); Serial.print(profiler_cycles_to_us(step1_cycles), 3);
+        Serial.print(" μs ("); Serial.print(step1_cycles); Serial.println(" サイクル)");
         Serial.print("  特徴量[0] (bias): "); Serial.println((float)features[0], 8);
         Serial.print("  特徴量[170] (最高次): "); 
         if (abs(features[170]) > 1e30) {
@@ -435,26 +532,27 @@ void run_pc_comparison_test() {
         }
         
         Serial.println("ステップ2: 標準化");
-        uint32_t step2_start = micros();
+        uint32_t step2_start = profiler_cycles();
         apply_standard_scaling_double(features);
-        uint32_t step2_time = micros() - step2_start;
-        Serial.print("  時間: "); Serial.print(step2_time); Serial.println(" μs");
+        uint32_t step2_cycles = profiler_cycles() - step2_start;
+        Serial.print("  時間: "); Serial.print(profiler_cycles_to_us(step2_cycles), 3);
+        Serial.print(" μs ("); Serial.print(step2_cycles); Serial.println(" サイクル)");
         Serial.print("  標準化後[0]: "); Serial.println((float)features[0], 8);
         Serial.print("  標準化後[170]: "); Serial.println((float)features[170], 8);
         
         Serial.println("ステップ3: 線形結合");
-        uint32_t step3_start = micros();
+        uint32_t step3_start = profiler_cycles();
         double detailed_result = compute_linear_combination_double(features);
-        uint32_t step3_time = micros() - step3_start;
-        Serial.print("  時間: "); Serial.print(step3_time); Serial.println(" μs");
+        uint32_t step3_cycles = profiler_cycles() - step3_start;
+        Serial.print("  時間: "); Serial.print(profiler_cycles_to_us(step3_cycles), 3);
+        Serial.print(" μs ("); Serial.print(step3_cycles); Serial.println(" サイクル)");
         Serial.print("  結果: "); Serial.println((float)detailed_result, 12);
 #endif
         
         // Run main prediction function
-        uint32_t start_time = micros();
+        uint32_t start_cycles = profiler_cycles();
         float teensy_result = predict_distance_teensy(test.under_y, test.theta);
-        uint32_t end_time = micros();
-        uint32_t execution_time = end_time - start_time;
+        float execution_time = profiler_cycles_to_us(profiler_cycles() - start_cycles);
         
         // Calculate error vs PC result
         double error = abs((double)teensy_result - test.expected_pc_result);
@@ -477,7 +575,7 @@ void run_pc_comparison_test() {
         Serial.print("  Teensy結果: "); Serial.println(teensy_result, 12);
         Serial.print("  絶対誤差: "); Serial.print(error, 12);
         Serial.print("  相対誤差: "); Serial.print(relative_error, 8); Serial.println("%");
-        Serial.print("  総実行時間: "); Serial.print(execution_time); Serial.print(" μs");
+        Serial.print("  総実行時間: "); Serial.print(execution_time, 3); Serial.print(" μs");
         Serial.print(" ["); Serial.print(passed ? "合格" : "不合格"); Serial.println("]");
         Serial.println("----------------------------------------\\n");
     }
@@ -497,7 +595,451 @@ void run_pc_comparison_test() {
     Serial.println("注意: 17次多項式の数値特性により、PC版との微小差は正常です");
 }
 
+void run_horner_comparison_test() {
+    Serial.println("\n=== Horner評価エンジン比較テスト ===");
+    Serial.println("スケーラー畳み込み済みHorner法と従来パス (特徴量生成+標準化+Kahan) を比較します...\n");
+    
+    double max_diff_from_standard = 0.0;
+    double max_error_from_pc = 0.0;
+    int passed_tests = 0;
+    const int total_tests = NUM_TEST_CASES + NUM_PC_TEST_CASES;
+    
+    for (int i = 0; i < total_tests; i++) {
+        // 前半: TEST_CASES, 後半: PC_TEST_CASES
+        bool is_pc_case = i >= NUM_TEST_CASES;
+        float under_y = is_pc_case ? PC_TEST_CASES[i - NUM_TEST_CASES].under_y : TEST_CASES[i].under_y;
+        float theta = is_pc_case ? PC_TEST_CASES[i - NUM_TEST_CASES].theta : TEST_CASES[i].theta;
+        double expected = is_pc_case ? PC_TEST_CASES[i - NUM_TEST_CASES].expected_pc_result
+                                     : (double)TEST_CASES[i].expected_distance;
+        
+        float standard_result = predict_distance_teensy(under_y, theta);
+        float horner_result = predict_distance_horner(under_y, theta);
+        
+        double diff = abs((double)horner_result - (double)standard_result);
+        double error = abs((double)horner_result - expected);
+        if (diff > max_diff_from_standard) max_diff_from_standard = diff;
+        if (error > max_error_from_pc) max_error_from_pc = error;
+        
+        // 各スイートと同じ許容誤差 (PC比較: 1e-5, テストスイート: 1e-4)
+        double tolerance_ratio = is_pc_case ? 1e-5 : 1e-4;
+        double tolerance = max(tolerance_ratio, abs(expected) * tolerance_ratio);
+        bool passed = error <= tolerance;
+        if (passed) passed_tests++;
+        
+        Serial.print(is_pc_case ? "PC " : "T  "); Serial.print(i + 1);
+        Serial.print(": ("); Serial.print(under_y, 1);
+        Serial.print(", "); Serial.print(theta, 1); Serial.print(")");
+        Serial.print("  従来: "); Serial.print(standard_result, 6);
+        Serial.print("  Horner: "); Serial.print(horner_result, 6);
+        Serial.print("  差: "); Serial.print(diff, 9);
+        Serial.print(" ["); Serial.print(passed ? "合格" : "不合格"); Serial.println("]");
+    }
+    
+    // 速度比較 (多数回の合計サイクル数から平均を求める)
+    const int TIMING_ITERATIONS = 1000;
+    volatile float sink = 0.0f;
+    
+    uint32_t start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_teensy(10.0f + (i % 10), 45.0f - (i % 30));
+    }
+    uint32_t standard_cycles = profiler_cycles() - start_cycles;
+    
+    start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_horner(10.0f + (i % 10), 45.0f - (i % 30));
+    }
+    uint32_t horner_cycles = profiler_cycles() - start_cycles;
+    (void)sink;
+    
+    float standard_mean = profiler_cycles_to_us(standard_cycles) / TIMING_ITERATIONS;
+    float horner_mean = profiler_cycles_to_us(horner_cycles) / TIMING_ITERATIONS;
+    
+    Serial.println("\n=== Horner比較概要 ===");
+    Serial.print("合格したテスト: "); Serial.print(passed_tests);
+    Serial.print("/"); Serial.println(total_tests);
+    Serial.print("従来パスとの最大差: "); Serial.println(max_diff_from_standard, 9);
+    Serial.print("期待値との最大誤差: "); Serial.println(max_error_from_pc, 9);
+    Serial.print("平均時間 (従来): "); Serial.print(standard_mean, 3); Serial.println(" μs");
+    Serial.print("平均時間 (Horner): "); Serial.print(horner_mean, 3); Serial.println(" μs");
+    Serial.print("速度向上: "); Serial.print(horner_mean > 0.0f ? standard_mean / horner_mean : 0.0f, 2); Serial.println(" 倍");
+    Serial.print("スタック使用量: 従来 ~"); Serial.print(171 * 8 + 18 * 8 * 2);
+    Serial.println(" bytes, Horner ~32 bytes (double)");
+}
+
+void run_lut_comparison_test() {
+    Serial.println("\n=== 補間表 比較テスト ===");
+    Serial.println("補間表の範囲を格子点の中間で掃引し、Horner法 (厳密値) との差を計測します...\n");
+    
+    // 格子点の中間 (補間誤差が最大になりやすい位置) を含むよう 1/3 刻みで掃引
+    const int SWEEP_STEPS_U = 3 * (int)((LUT_UNDER_Y_MAX - LUT_UNDER_Y_MIN) * LUT_UNDER_Y_INV_STEP);
+    const int SWEEP_STEPS_T = 3 * (int)((LUT_THETA_MAX - LUT_THETA_MIN) * LUT_THETA_INV_STEP);
+    double max_error_bilinear = 0.0;
+    double max_error_bicubic = 0.0;
+    double sum_error_bilinear = 0.0;
+    double sum_error_bicubic = 0.0;
+    int sample_count = 0;
+    
+    for (int i = 0; i <= SWEEP_STEPS_U; i++) {
+        float under_y = LUT_UNDER_Y_MIN + (LUT_UNDER_Y_MAX - LUT_UNDER_Y_MIN) * i / SWEEP_STEPS_U;
+        for (int j = 0; j <= SWEEP_STEPS_T; j++) {
+            float theta = LUT_THETA_MIN + (LUT_THETA_MAX - LUT_THETA_MIN) * j / SWEEP_STEPS_T;
+            if (!validate_input_range(under_y, theta)) continue;
+            
+            double exact = evaluate_horner_double((double)under_y, (double)theta);
+            double error_bilinear = abs((double)predict_distance_lut_bilinear(under_y, theta) - exact);
+            double error_bicubic = abs((double)predict_distance_lut_bicubic(under_y, theta) - exact);
+            if (error_bilinear > max_error_bilinear) max_error_bilinear = error_bilinear;
+            if (error_bicubic > max_error_bicubic) max_error_bicubic = error_bicubic;
+            sum_error_bilinear += error_bilinear;
+            sum_error_bicubic += error_bicubic;
+            sample_count++;
+        }
+    }
+    
+    // 速度比較 (Horner比較テストと同じ入力列, サイクル数)
+    const int TIMING_ITERATIONS = 1000;
+    volatile float sink = 0.0f;
+    
+    uint32_t start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_horner(10.0f + (i % 10), 45.0f - (i % 30));
+    }
+    uint32_t horner_cycles = profiler_cycles() - start_cycles;
+    
+    start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_lut_bilinear(10.0f + (i % 10), 45.0f - (i % 30));
+    }
+    uint32_t bilinear_cycles = profiler_cycles() - start_cycles;
+    
+    start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_lut_bicubic(10.0f + (i % 10), 45.0f - (i % 30));
+    }
+    uint32_t bicubic_cycles = profiler_cycles() - start_cycles;
+    (void)sink;
+    
+    Serial.println("=== 補間表比較概要 ===");
+    Serial.print("評価点数: "); Serial.println(sample_count);
+    Serial.print("双1次 最大誤差: "); Serial.print(max_error_bilinear, 6);
+    Serial.print("  平均誤差: "); Serial.println(sample_count > 0 ? sum_error_bilinear / sample_count : 0.0, 6);
+    Serial.print("双3次 最大誤差: "); Serial.print(max_error_bicubic, 6);
+    Serial.print("  平均誤差: "); Serial.println(sample_count > 0 ? sum_error_bicubic / sample_count : 0.0, 6);
+    Serial.print("平均時間 (Horner): "); Serial.print(profiler_cycles_to_us(horner_cycles) / TIMING_ITERATIONS, 3); Serial.println(" μs");
+    Serial.print("平均時間 (双1次): "); Serial.print(profiler_cycles_to_us(bilinear_cycles) / TIMING_ITERATIONS, 3); Serial.println(" μs");
+    Serial.print("平均時間 (双3次): "); Serial.print(profiler_cycles_to_us(bicubic_cycles) / TIMING_ITERATIONS, 3); Serial.println(" μs");
+    Serial.print("補間表サイズ: "); Serial.print((int)sizeof(LUT_VALUES)); Serial.println(" bytes (Flash)");
+}
+
+void run_tiled_comparison_test() {
+    Serial.println("\n=== 区分多項式モデル 比較テスト ===");
+    Serial.println("学習領域を掃引し、Horner法 (17次) との差を計測します...\n");
+    
+    // 学習領域 (under_y 0〜100, theta -48〜55) を 1/2 刻みで掃引
+    // 学習データ (LNN蒸留出力) のない隅では17次モデル自体が発散するため、平均ではなく差が小さい点の割合で比較する
+    int sample_count = 0;
+    int within_quarter = 0;  // 差が0.25cm以内の点
+    int within_one = 0;      // 差が1cm以内の点
+    
+    for (float under_y = 0.0f; under_y <= 100.0f; under_y += 0.5f) {
+        for (float theta = -48.0f; theta <= 55.0f; theta += 0.5f) {
+            double exact = evaluate_horner_double((double)under_y, (double)theta);
+            double error = abs((double)predict_distance_tiled(under_y, theta) - exact);
+            if (error <= 0.25) within_quarter++;
+            if (error <= 1.0) within_one++;
+            sample_count++;
+        }
+    }
+    
+    // 速度比較 (Horner比較テストと同じ入力列, サイクル数)
+    const int TIMING_ITERATIONS = 1000;
+    volatile float sink = 0.0f;
+    
+    uint32_t start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_horner(10.0f + (i % 10), 45.0f - (i % 30));
+    }
+    uint32_t horner_cycles = profiler_cycles() - start_cycles;
+    
+    start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_tiled(10.0f + (i % 10), 45.0f - (i % 30));
+    }
+    uint32_t tiled_cycles = profiler_cycles() - start_cycles;
+    (void)sink;
+    
+    float horner_mean = (float)horner_cycles / TIMING_ITERATIONS;
+    float tiled_mean = (float)tiled_cycles / TIMING_ITERATIONS;
+    
+    Serial.println("=== 区分多項式モデル比較概要 ===");
+    Serial.print("タイル数: "); Serial.print(TILED_TILE_COUNT);
+    Serial.print(" ("); Serial.print(TILED_CELLS_U); Serial.print(" x "); Serial.print(TILED_CELLS_T);
+    Serial.print(" セル, "); Serial.print(TILED_TERM_COUNT); Serial.println(" 項/タイル)");
+    Serial.print("評価点数: "); Serial.println(sample_count);
+    Serial.print("Horner法との差 0.25cm以内: "); Serial.print(100.0 * within_quarter / sample_count, 1);
+    Serial.print(" %  1cm以内: "); Serial.print(100.0 * within_one / sample_count, 1); Serial.println(" %");
+    Serial.print("平均時間 (Horner): "); Serial.print(horner_mean, 1); Serial.print(" cycles, ");
+    Serial.print(profiler_cycles_to_us((uint32_t)horner_mean), 3); Serial.println(" μs");
+    Serial.print("平均時間 (区分): "); Serial.print(tiled_mean, 1); Serial.print(" cycles, ");
+    Serial.print(profiler_cycles_to_us((uint32_t)tiled_mean), 3);
+    Serial.print(" μs ("); Serial.print(tiled_mean > 0.0f ? horner_mean / tiled_mean : 0.0f, 2); Serial.println(" 倍)");
+    Serial.print("係数表サイズ: "); Serial.print((int)sizeof(TILED_COEFFICIENTS)); Serial.println(" bytes (Flash)");
+}
+
+void run_sparse_comparison_test() {
+    Serial.println("\n=== スパース多項式モデル 比較テスト ===");
+    Serial.println("項数ごとに学習領域を掃引し、Horner法 (17次, 171項) との差と速度を計測します...\n");
+    
+    // 速度比較 (区分多項式モデルと同じ入力列, サイクル数)
+    const int TIMING_ITERATIONS = 1000;
+    volatile float sink = 0.0f;
+    
+    uint32_t start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_horner(10.0f + (i % 10), 45.0f - (i % 30));
+    }
+    float horner_mean = (float)(profiler_cycles() - start_cycles) / TIMING_ITERATIONS;
+    Serial.print("Horner法: "); Serial.print(horner_mean, 1); Serial.print(" cycles, ");
+    Serial.print(profiler_cycles_to_us((uint32_t)horner_mean), 3); Serial.println(" μs\n");
+    
+    Serial.println("項数\tcycles\tμs\t倍率\t1cm以内(%)\t検証MAE(cm)");
+    for (int m = 0; m < SPARSE_MODEL_COUNT; m++) {
+        const SparseModel& model = SPARSE_MODELS[m];
+        
+        // 学習領域 (under_y 0〜100, theta -48〜55) を 1 刻みで掃引
+        // 17次モデルはデータのない隅で発散するため、差が1cm以内の点の割合で比較する
+        int sample_count = 0;
+        int within_one = 0;
+        for (float under_y = 0.0f; under_y <= 100.0f; under_y += 1.0f) {
+            for (float theta = -48.0f; theta <= 55.0f; theta += 1.0f) {
+                double exact = evaluate_horner_double((double)under_y, (double)theta);
+                if (abs((double)predict_distance_sparse_model(model, under_y, theta) - exact) <= 1.0) within_one++;
+                sample_count++;
+            }
+        }
+        
+        start_cycles = profiler_cycles();
+        for (int i = 0; i < TIMING_ITERATIONS; i++) {
+            sink = predict_distance_sparse_model(model, 10.0f + (i % 10), 45.0f - (i % 30));
+        }
+        float sparse_mean = (float)(profiler_cycles() - start_cycles) / TIMING_ITERATIONS;
+        
+        Serial.print(model.term_count); Serial.print(m == SPARSE_DEFAULT_MODEL ? "*" : ""); Serial.print("\t");
+        Serial.print(sparse_mean, 1); Serial.print("\t");
+        Serial.print(profiler_cycles_to_us((uint32_t)sparse_mean), 3); Serial.print("\t");
+        Serial.print(sparse_mean > 0.0f ? horner_mean / sparse_mean : 0.0f, 2); Serial.print("\t");
+        Serial.print(100.0 * within_one / sample_count, 1); Serial.print("\t\t");
+        Serial.println(model.validation_mae, 3);
+    }
+    (void)sink;
+    Serial.println("(* は predict_distance_sparse の既定モデル, 検証MAEは生成時に実測データで計算した値)");
+}
+
+void run_precision_comparison_test() {
+    Serial.println("\n=== 精度モード比較テスト ===");
+    Serial.print("コンパイル時の選択: "); Serial.print(selected_precision_name());
+    Serial.print(" (MIXED_DOUBLE_ROWS="); Serial.print(MIXED_DOUBLE_ROWS); Serial.println(")");
+    Serial.println("学習領域を掃引し、倍精度Horner法との差を計測します...\n");
+    
+    // 学習領域 (under_y 0〜100, theta -48〜55) を 1/2 刻みで掃引 (under_y > 100 は入力検証で除外される)
+    double max_error_float = 0.0;
+    double max_error_mixed = 0.0;
+    double sum_error_float = 0.0;
+    double sum_error_mixed = 0.0;
+    double max_error_chebyshev = 0.0;
+    double sum_error_chebyshev = 0.0;
+    int sample_count = 0;
+    
+    for (float under_y = 0.0f; under_y <= 100.0f; under_y += 0.5f) {
+        for (float theta = -48.0f; theta <= 55.0f; theta += 0.5f) {
+            double exact = evaluate_horner_double((double)under_y, (double)theta);
+            double error_float = abs((double)predict_distance_horner_float(under_y, theta) - exact);
+            double error_mixed = abs((double)predict_distance_horner_mixed(under_y, theta) - exact);
+            double error_chebyshev = abs((double)predict_distance_chebyshev(under_y, theta) - exact);
+            if (error_float > max_error_float) max_error_float = error_float;
+            if (error_mixed > max_error_mixed) max_error_mixed = error_mixed;
+            sum_error_float += error_float;
+            sum_error_mixed += error_mixed;
+            if (error_chebyshev > max_error_chebyshev) max_error_chebyshev = error_chebyshev;
+            sum_error_chebyshev += error_chebyshev;
+            sample_count++;
+        }
+    }
+    
+    // 速度比較 (Horner比較テストと同じ入力列, サイクル数)
+    const int TIMING_ITERATIONS = 1000;
+    volatile float sink = 0.0f;
+    
+    uint32_t start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_horner(10.0f + (i % 10), 45.0f - (i % 30));
+    }
+    uint32_t double_cycles = profiler_cycles() - start_cycles;
+    
+    start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_horner_float(10.0f + (i % 10), 45.0f - (i % 30));
+    }
+    uint32_t float_cycles = profiler_cycles() - start_cycles;
+    
+    start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_horner_mixed(10.0f + (i % 10), 45.0f - (i % 30));
+    }
+    uint32_t mixed_cycles = profiler_cycles() - start_cycles;
+    
+    start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_chebyshev(10.0f + (i % 10), 45.0f - (i % 30));
+    }
+    uint32_t chebyshev_cycles = profiler_cycles() - start_cycles;
+    (void)sink;
+    
+    float double_mean = profiler_cycles_to_us(double_cycles) / TIMING_ITERATIONS;
+    float float_mean = profiler_cycles_to_us(float_cycles) / TIMING_ITERATIONS;
+    float mixed_mean = profiler_cycles_to_us(mixed_cycles) / TIMING_ITERATIONS;
+    float chebyshev_mean = profiler_cycles_to_us(chebyshev_cycles) / TIMING_ITERATIONS;
+    
+    Serial.println("=== 精度モード比較概要 ===");
+    Serial.print("評価点数: "); Serial.println(sample_count);
+    Serial.print("単精度 最大誤差: "); Serial.print(max_error_float, 6);
+    Serial.print("  平均誤差: "); Serial.println(sum_error_float / sample_count, 6);
+    Serial.print("混合精度 最大誤差: "); Serial.print(max_error_mixed, 6);
+    Serial.print("  平均誤差: "); Serial.println(sum_error_mixed / sample_count, 6);
+    Serial.print("チェビシェフ(単精度) 最大誤差: "); Serial.print(max_error_chebyshev, 6);
+    Serial.print("  平均誤差: "); Serial.println(sum_error_chebyshev / sample_count, 6);
+    Serial.print("平均時間 (倍精度): "); Serial.print(double_mean, 3); Serial.println(" μs");
+    Serial.print("平均時間 (単精度): "); Serial.print(float_mean, 3);
+    Serial.print(" μs ("); Serial.print(float_mean > 0.0f ? double_mean / float_mean : 0.0f, 2); Serial.println(" 倍)");
+    Serial.print("平均時間 (混合精度): "); Serial.print(mixed_mean, 3);
+    Serial.print(" μs ("); Serial.print(mixed_mean > 0.0f ? double_mean / mixed_mean : 0.0f, 2); Serial.println(" 倍)");
+    Serial.print("平均時間 (チェビシェフ): "); Serial.print(chebyshev_mean, 3);
+    Serial.print(" μs ("); Serial.print(chebyshev_mean > 0.0f ? double_mean / chebyshev_mean : 0.0f, 2); Serial.println(" 倍)");
+}
+
+
+void load_model_blob_from_sd() {
+    Serial.println("\n=== バイナリモデル読み込み ===");
+    if (!SD.begin(BUILTIN_SDCARD)) {
+        Serial.println("SDカードを初期化できません。");
+        return;
+    }
+    File file = SD.open(MODEL_BLOB_PATH, FILE_READ);
+    if (!file) {
+        Serial.print(MODEL_BLOB_PATH); Serial.println(" が見つかりません。");
+        return;
+    }
+    
+    // 非アクティブ面に読み込み、検証に成功したときだけ切り替える (失敗しても現在のモデルのまま)
+    uint32_t start_cycles = profiler_cycles();
+    size_t size = file.size();
+    ModelBlobStatus status = MODEL_BLOB_BAD_LAYOUT;
+    if (size <= MODEL_BLOB_MAX_BYTES && (size_t)file.read(model_blob_staging_buffer(), size) == size) {
+        status = commit_model_blob(size);
+    }
+    uint32_t load_cycles = profiler_cycles() - start_cycles;
+    file.close();
+    
+    if (status != MODEL_BLOB_OK) {
+        Serial.print("読み込み失敗: "); Serial.println(model_blob_status_name(status));
+        return;
+    }
+    
+    const RuntimeModel* model = active_runtime_model();
+    Serial.print("次数: "); Serial.print(model->degree);
+    Serial.print("  項数: "); Serial.print(model->term_count);
+    Serial.print("  検証MAE: "); Serial.println(model->validation_mae, 4);
+    Serial.print("読み込み + 検証時間: "); Serial.print(profiler_cycles_to_us(load_cycles), 1); Serial.println(" μs");
+    
+    // 組み込みモデルとの比較 (同じ .joblib から生成したファイルなら差は0)
+    double max_difference = 0.0;
+    for (float under_y = 0.0f; under_y <= 100.0f; under_y += 2.0f) {
+        for (float theta = -48.0f; theta <= 55.0f; theta += 2.0f) {
+            double difference = abs((double)predict_distance_runtime(*model, under_y, theta) -
+                                    (double)predict_distance_horner(under_y, theta));
+            if (difference > max_difference) max_difference = difference;
+        }
+    }
+    Serial.print("組み込みモデルとの最大差: "); Serial.println(max_difference, 6);
+    
+    const int TIMING_ITERATIONS = 1000;
+    volatile float sink = 0.0f;
+    start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_runtime(*active_runtime_model(), 10.0f + (i % 10), 45.0f - (i % 30));
+    }
+    uint32_t runtime_cycles = profiler_cycles() - start_cycles;
+    (void)sink;
+    Serial.print("平均時間 (読み込みモデル): "); Serial.print(profiler_cycles_to_us(runtime_cycles) / TIMING_ITERATIONS, 3); Serial.println(" μs");
+}
+
+
+void run_cache_test() {
+    Serial.println("\n=== 予測結果キャッシュ テスト ===");
+    Serial.print("量子化: under_y "); Serial.print(prediction_cache.under_y_step(), 3);
+    Serial.print(", theta "); Serial.print(prediction_cache.theta_step(), 3);
+    Serial.print(" / "); Serial.print(PREDICTION_CACHE_SETS); Serial.print(" セット x ");
+    Serial.print(PREDICTION_CACHE_WAYS); Serial.print(" ウェイ ("); Serial.print((int)sizeof(PredictionCache));
+    Serial.println(" bytes)");
+    Serial.println("追跡を模した入力 (整数の行, theta は0.1度刻みの往復) で Horner法と比較します...\n");
+    
+    // 行は 64 サンプルごとに1行動き、theta は 0.1度刻みで ±5度を往復する
+    const int ITERATIONS = 10000;
+    prediction_cache.clear();
+    prediction_cache.reset_stats();
+    volatile float sink = 0.0f;
+    double max_difference = 0.0;
+    uint32_t hit_cycles = 0, miss_cycles = 0;
+    uint32_t hit_count = 0, miss_count = 0;
+    
+    for (int i = 0; i < ITERATIONS; i++) {
+        float under_y = (float)(20 + (i / 64) % 40);
+        int k = i % 200;
+        float theta = 10.0f + 0.1f * (float)(k < 100 ? k : 200 - k) - 5.0f;
+        
+        uint32_t misses_before = prediction_cache.stats().misses;
+        uint32_t start_cycles = profiler_cycles();
+        float cached = prediction_cache.predict(under_y, theta);
+        uint32_t elapsed = profiler_cycles() - start_cycles;
+        if (prediction_cache.stats().misses != misses_before) {
+            miss_cycles += elapsed;
+            miss_count++;
+        } else {
+            hit_cycles += elapsed;
+            hit_count++;
+        }
+        sink = cached;
+        double difference = abs((double)cached - (double)predict_distance_horner(under_y, theta));
+        if (difference > max_difference) max_difference = difference;
+    }
+    
+    uint32_t start_cycles = profiler_cycles();
+    for (int i = 0; i < ITERATIONS; i++) {
+        sink = predict_distance_horner((float)(20 + (i / 64) % 40), 10.0f + 0.1f * (float)(i % 100) - 5.0f);
+    }
+    uint32_t horner_cycles = profiler_cycles() - start_cycles;
+    (void)sink;
+    
+    Serial.println("=== キャッシュ概要 ===");
+    Serial.print("ヒット率: "); Serial.print(100.0f * prediction_cache.hit_rate(), 2); Serial.println(" %");
+    Serial.print("平均時間 (ヒット): ");
+    Serial.print(hit_count > 0 ? (float)hit_cycles / hit_count : 0.0f, 1); Serial.println(" cycles");
+    Serial.print("平均時間 (ミス): ");
+    Serial.print(miss_count > 0 ? (float)miss_cycles / miss_count : 0.0f, 1); Serial.println(" cycles");
+    Serial.print("平均時間 (Horner): "); Serial.print((float)horner_cycles / ITERATIONS, 1); Serial.println(" cycles");
+    Serial.print("量子化による最大差: "); Serial.print(max_difference, 6); Serial.println(" cm");
+    print_cache_stats();
+}
 
+void print_cache_stats() {
+    const PredictionCacheStats& stats = prediction_cache.stats();
+    Serial.print("キャッシュ: ヒット "); Serial.print(stats.hits);
+    Serial.print(", ミス "); Serial.print(stats.misses);
+    Serial.print(", 追い出し "); Serial.print(stats.evictions);
+    Serial.print(", 範囲外 "); Serial.print(stats.rejected);
+    Serial.print(" (ヒット率 "); Serial.print(100.0f * prediction_cache.hit_rate(), 2); Serial.println(" %)");
+}
 
 void toggle_continuous_mode() {
     continuous_mode = !continuous_mode;
@@ -506,76 +1048,297 @@ void toggle_continuous_mode() {
     
     if (continuous_mode) {
         Serial.println("連続ベンチマークを実行中... 停止するには任意のキーを押してください。");
+        profiler_active_before_continuous = profiler_active();
+        profiler_set_active(true);
         reset_benchmark_stats();
+        streaming_predictor.reset();
+        streaming_predictor.reset_stats();
+    } else {
+        profiler_set_active(profiler_active_before_continuous);
     }
 }
 
+// 取得段 (割り込み): センサの代わりに行 (整数) と角度を掃引したサンプルを入れる
+void pipeline_acquire_isr() {
+    const uint32_t i = pipeline_acquire_index++;
+    sample_pipeline.push_sample((float)((i / 64) % 101), -45.0f + (float)(i % 64) * 1.5f);
+}
+
+void toggle_pipeline_mode() {
+    pipeline_mode = !pipeline_mode;
+    Serial.print("パイプラインモード: ");
+    Serial.println(pipeline_mode ? "有効" : "無効");
+    
+    if (pipeline_mode) {
+        Serial.print("取得 "); Serial.print(PIPELINE_SAMPLE_RATE_HZ); Serial.print(" Hz, 結果は 1/");
+        Serial.print(PIPELINE_OUTPUT_DECIMATION); Serial.println(" に間引いて表示します。停止するには「q」を押してください。");
+        sample_pipeline.reset_stats();
+        acquisition_timer.begin(pipeline_acquire_isr, 1000000 / PIPELINE_SAMPLE_RATE_HZ);
+    } else {
+        acquisition_timer.end();
+        run_pipeline_stages();  // 残りを処理
+        print_pipeline_stats();
+    }
+}
+
+void run_pipeline_stages() {
+    static uint32_t output_count = 0;
+    static uint32_t last_report_time = 0;
+    
+    // 推論段: 溜まった分をバッチで処理 (取得が速すぎても1回の loop() でキュー長以上は処理しない)
+    uint32_t processed = 0;
+    uint32_t count;
+    while (processed < PIPELINE_SAMPLE_QUEUE_SIZE && (count = sample_pipeline.run_inference()) > 0) {
+        processed += count;
+    }
+    
+    // 出力段: 取得時刻 (サイクル) と取得から推論完了までの遅延を付けて送信
+    PipelineResult result;
+    while (sample_pipeline.pop_result(result)) {
+        if (output_count++ % PIPELINE_OUTPUT_DECIMATION != 0) {
+            continue;
+        }
+        Serial.print("[pipeline] t="); Serial.print(result.acquired_cycles);
+        Serial.print(" under_y="); Serial.print(result.under_y, 1);
+        Serial.print(" theta="); Serial.print(result.theta, 2);
+        Serial.print(" distance="); Serial.print(result.distance, 3);
+        Serial.print(" latency="); Serial.print(profiler_cycles_to_us(result.completed_cycles - result.acquired_cycles), 2);
+        Serial.println(" μs");
+    }
+    
+    if (millis() - last_report_time > 5000) {
+        print_pipeline_stats();
+        last_report_time = millis();
+    }
+}
+
+void run_gradient_test() {
+    Serial.println("\n=== 予測値 + 勾配の同時評価 ===");
+    Serial.println("predict_distance_gradient (べき乗表と線形結合を共有) と、予測の差分近似を比較します...\n");
+    
+    const int TIMING_ITERATIONS = 1000;
+    const float STEP = 0.01f;  // 差分近似の刻み
+    volatile float sink = 0.0f;
+    float gradient[2];
+    float hessian[3];
+    
+    uint32_t start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_teensy(10.0f + (i % 10), 45.0f - (i % 30));
+    }
+    float plain_mean = (float)(profiler_cycles() - start_cycles) / TIMING_ITERATIONS;
+    
+    start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_gradient(10.0f + (i % 10), 45.0f - (i % 30), gradient);
+    }
+    float gradient_mean = (float)(profiler_cycles() - start_cycles) / TIMING_ITERATIONS;
+    
+    start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_gradient(10.0f + (i % 10), 45.0f - (i % 30), gradient, hessian);
+    }
+    float hessian_mean = (float)(profiler_cycles() - start_cycles) / TIMING_ITERATIONS;
+    
+    // 中心差分 (5回の予測)
+    start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        float under_y = 10.0f + (i % 10);
+        float theta = 45.0f - (i % 30);
+        sink = predict_distance_teensy(under_y, theta);
+        gradient[0] = (predict_distance_teensy(under_y + STEP, theta) - predict_distance_teensy(under_y - STEP, theta)) / (2.0f * STEP);
+        gradient[1] = (predict_distance_teensy(under_y, theta + STEP) - predict_distance_teensy(under_y, theta - STEP)) / (2.0f * STEP);
+    }
+    float central_mean = (float)(profiler_cycles() - start_cycles) / TIMING_ITERATIONS;
+    (void)sink;
+    
+    Serial.println("評価\t\t\tcycles\tμs\t倍率");
+    const char* names[4] = {"予測のみ\t\t", "予測値 + 勾配\t\t", "予測値 + 勾配 + Hessian", "中心差分 (5回)\t\t"};
+    const float means[4] = {plain_mean, gradient_mean, hessian_mean, central_mean};
+    for (int i = 0; i < 4; i++) {
+        Serial.print(names[i]); Serial.print("\t");
+        Serial.print(means[i], 1); Serial.print("\t");
+        Serial.print(profiler_cycles_to_us((uint32_t)means[i]), 3); Serial.print("\t");
+        Serial.println(plain_mean > 0.0f ? means[i] / plain_mean : 0.0f, 2);
+    }
+    
+    // 実測範囲の数点で解析的な勾配と差分近似を並べる
+    Serial.println("\nunder_y\ttheta\t距離\t∂d/∂under_y\t(差分)\t∂d/∂theta\t(差分)");
+    const float POINTS[][2] = {{10.0f, 0.0f}, {30.0f, -20.0f}, {50.0f, 10.0f}, {80.0f, 40.0f}};
+    for (int i = 0; i < 4; i++) {
+        float under_y = POINTS[i][0];
+        float theta = POINTS[i][1];
+        float distance = predict_distance_gradient(under_y, theta, gradient);
+        float central_u = (predict_distance_teensy(under_y + STEP, theta) - predict_distance_teensy(under_y - STEP, theta)) / (2.0f * STEP);
+        float central_t = (predict_distance_teensy(under_y, theta + STEP) - predict_distance_teensy(under_y, theta - STEP)) / (2.0f * STEP);
+        Serial.print(under_y, 1); Serial.print("\t"); Serial.print(theta, 1); Serial.print("\t");
+        Serial.print(distance, 3); Serial.print("\t");
+        Serial.print(gradient[0], 5); Serial.print("\t"); Serial.print(central_u, 5); Serial.print("\t");
+        Serial.print(gradient[1], 5); Serial.print("\t"); Serial.println(central_t, 5);
+    }
+}
+
+void run_ensemble_test() {
+    Serial.println("\n=== 複数次数モデルの選択・加重平均 ===");
+    Serial.println("6次 + 17次を theta のべき乗表を共有して評価し、従来の17次の予測と比較します...\n");
+    
+    const int TIMING_ITERATIONS = 1000;
+    volatile float sink = 0.0f;
+    
+    uint32_t start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_teensy(10.0f + (i % 10), 45.0f - (i % 30));
+    }
+    float plain_mean = (float)(profiler_cycles() - start_cycles) / TIMING_ITERATIONS;
+    
+    start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_ensemble(10.0f + (i % 10), 45.0f - (i % 30), ENSEMBLE_SELECT);
+    }
+    float select_mean = (float)(profiler_cycles() - start_cycles) / TIMING_ITERATIONS;
+    
+    start_cycles = profiler_cycles();
+    for (int i = 0; i < TIMING_ITERATIONS; i++) {
+        sink = predict_distance_ensemble(10.0f + (i % 10), 45.0f - (i % 30), ENSEMBLE_WEIGHTED);
+    }
+    float weighted_mean = (float)(profiler_cycles() - start_cycles) / TIMING_ITERATIONS;
+    (void)sink;
+    
+    Serial.println("評価\t\t\tcycles\tμs\t倍率");
+    const char* names[3] = {"17次 (従来)\t\t", "6次 + 17次 選択\t", "6次 + 17次 加重平均\t"};
+    const float means[3] = {plain_mean, select_mean, weighted_mean};
+    for (int i = 0; i < 3; i++) {
+        Serial.print(names[i]); Serial.print("\t");
+        Serial.print(means[i], 1); Serial.print("\t");
+        Serial.print(profiler_cycles_to_us((uint32_t)means[i]), 3); Serial.print("\t");
+        Serial.println(plain_mean > 0.0f ? means[i] / plain_mean : 0.0f, 2);
+    }
+    
+    // 実測範囲の数点で各モデルの値と選択・加重平均を並べる
+    Serial.println("\nunder_y\ttheta\t6次\t17次\t選択\t加重平均");
+    const float POINTS[][2] = {{10.0f, 0.0f}, {30.0f, -20.0f}, {50.0f, 10.0f}, {80.0f, 40.0f}};
+    for (int i = 0; i < 4; i++) {
+        float under_y = POINTS[i][0];
+        float theta = POINTS[i][1];
+        double values[DefaultEnsemble::COUNT];
+        ENSEMBLE_DEFAULT.evaluate_all(under_y, theta, values);
+        Serial.print(under_y, 1); Serial.print("\t"); Serial.print(theta, 1); Serial.print("\t");
+        Serial.print(values[0], 3); Serial.print("\t"); Serial.print(values[1], 3); Serial.print("\t");
+        Serial.print(predict_distance_ensemble(under_y, theta, ENSEMBLE_SELECT), 3); Serial.print("\t");
+        Serial.println(predict_distance_ensemble(under_y, theta, ENSEMBLE_WEIGHTED), 3);
+    }
+}
+
+void run_wcet_test() {
+    Serial.println("\n=== 最悪実行時間 (WCET)・ジッタ測定 ===");
+    Serial.print("期限: "); Serial.print(WCET_DEFAULT_OPTIONS.deadline_us, 3); Serial.println(" μs / 予測");
+    // 段階別プロファイラのスコープタイマーで実行時間が膨らまないよう、測定中は記録を止める
+    const bool profiler_was_active = profiler_active();
+    profiler_set_active(false);
+    int passed = 0;
+    for (int i = 0; i < WCET_TARGET_COUNT; i++) {
+        Serial.println();
+        if (run_wcet_suite(WCET_TARGETS[i])) {
+            passed++;
+        }
+    }
+    profiler_set_active(profiler_was_active);
+    Serial.print("\n期限内: "); Serial.print(passed); Serial.print(" / "); Serial.println(WCET_TARGET_COUNT);
+}
+
+void print_pipeline_stats() {
+    PipelineStats stats = sample_pipeline.stats();
+    Serial.print("パイプライン: 取得 "); Serial.print(stats.acquired);
+    Serial.print(", 取りこぼし "); Serial.print(stats.dropped);
+    Serial.print(", 推論 "); Serial.print(stats.inferred);
+    Serial.print(" (平均バッチ "); Serial.print(stats.batches > 0 ? (float)stats.inferred / stats.batches : 0.0f, 1);
+    Serial.print("), 出力 "); Serial.print(stats.emitted);
+    Serial.print(", キュー最大 "); Serial.print(stats.max_sample_depth);
+    Serial.print("/"); Serial.println(PIPELINE_SAMPLE_QUEUE_SIZE);
+}
+
+// バイナリフレームを1バイト受信し、要求がそろえば処理して応答を返す (応答はバイナリのみ)
+void handle_protocol_byte(uint8_t byte) {
+    if (protocol_parser.feed(byte) == PROTOCOL_FRAME) {
+        size_t length = protocol_handle_frame(protocol_parser.frame(), protocol_response);
+        Serial.write(protocol_response, length);
+    }
+}
+
+void print_protocol_stats() {
+    const ProtocolStats& stats = protocol_parser.stats();
+    Serial.print("バイナリ要求: フレーム "); Serial.print(stats.frames);
+    Serial.print(", CRC誤り "); Serial.print(stats.crc_errors);
+    Serial.print(", 長さ誤り "); Serial.println(stats.length_errors);
+}
+
 void run_continuous_benchmark() {
     static uint32_t last_report_time = 0;
     static int iteration_count = 0;
+    static uint64_t streaming_total_cycles = 0;
     
     // Use varying test inputs for more realistic testing
-    float test_under_y = 10.0f + sin(millis() * 0.001f) * 15.0f;
+    // under_y はカメラの行 (整数) なので追跡中は同じ値が続き、theta だけが連続的に動く
+    float test_under_y = roundf(10.0f + sin(millis() * 0.001f) * 15.0f);
     float test_theta = 45.0f + cos(millis() * 0.0015f) * 30.0f;
     
-    // Measure execution time
-    uint32_t start_time = micros();
-    float prediction = predict_distance_teensy(test_under_y, test_theta);
-    uint32_t end_time = micros();
-    uint32_t execution_time = end_time - start_time;
-    
-    // Update statistics
-    update_benchmark_stats(execution_time, 0.0f);
+    // Measure execution time (統計は predict_distance_selected のスコープタイマーが記録する)
+    uint32_t start_cycles = profiler_cycles();
+    float prediction = predict_distance_selected(test_under_y, test_theta);
+    float execution_time = profiler_cycles_to_us(profiler_cycles() - start_cycles);
     iteration_count++;
     
+    // 同じ入力を差分評価 (前回と同じ行なら theta 方向の18項のみ)
+    start_cycles = profiler_cycles();
+    float streaming_prediction = streaming_predictor.predict(test_under_y, test_theta);
+    streaming_total_cycles += profiler_cycles() - start_cycles;
+    
     // Report every 5 seconds
     if (millis() - last_report_time > 5000) {
         Serial.print("連続: "); Serial.print(iteration_count);
-        Serial.print(" イテレーション, 最新: "); Serial.print(execution_time);
+        const StageHistogram& predict_stats = profiler_histogram(PROFILE_STAGE_SELECTED);
+        Serial.print(" イテレーション, 最新: "); Serial.print(execution_time, 3);
         Serial.print(" μs, 予測: "); Serial.print(prediction, 2);
-        Serial.print(" cm, 平均: "); Serial.print((float)benchmark_stats.total_time_us / benchmark_stats.num_samples, 2);
+        Serial.print(" cm, 平均: ");
+        Serial.print(predict_stats.count > 0 ? profiler_cycles_to_us((uint32_t)(predict_stats.total_cycles / predict_stats.count)) : 0.0f, 3);
+        Serial.print(" μs, p99: "); Serial.print(profiler_cycles_to_us(histogram_percentile(predict_stats, 0.99f)), 3);
         Serial.println(" μs");
         
+        const StreamingStats& streaming_stats = streaming_predictor.stats();
+        Serial.print("  差分評価: 平均 ");
+        Serial.print(profiler_cycles_to_us((uint32_t)(streaming_total_cycles / iteration_count)), 3);
+        Serial.print(" μs, 予測: "); Serial.print(streaming_prediction, 2);
+        Serial.print(" cm, 全評価/行再利用(theta)/行再利用(under_y)/テイラー: ");
+        Serial.print(streaming_stats.full); Serial.print("/");
+        Serial.print(streaming_stats.theta_held); Serial.print("/");
+        Serial.print(streaming_stats.under_y_held); Serial.print("/");
+        Serial.println(streaming_stats.taylor);
+        
         last_report_time = millis();
         iteration_count = 0;
+        streaming_total_cycles = 0;
+        streaming_predictor.reset_stats();
     }
     
     // Prevent compiler optimization
     (void)prediction;
+    (void)streaming_prediction;
 }
 
-void update_benchmark_stats(uint32_t execution_time, float error) {
-    if (benchmark_stats.num_samples == 0) {
-        benchmark_stats.min_time_us = execution_time;
-        benchmark_stats.max_time_us = execution_time;
-    } else {
-        if (execution_time < benchmark_stats.min_time_us) {
-            benchmark_stats.min_time_us = execution_time;
-        }
-        if (execution_time > benchmark_stats.max_time_us) {
-            benchmark_stats.max_time_us = execution_time;
-        }
-    }
-    
-    benchmark_stats.total_time_us += execution_time;
-    benchmark_stats.total_error += error;
-    benchmark_stats.num_samples++;
-    
-    if (error > benchmark_stats.max_error) {
-        benchmark_stats.max_error = error;
+// 段階別プロファイル・キャッシュ・プロトコルの統計を表示し、記録が無効なら以降の予測の記録を開始する
+void run_profile_report() {
+    print_profile_report();
+    print_cache_stats();
+    print_protocol_stats();
+    if (!profiler_active()) {
+        profiler_set_active(true);
+        Serial.println("段階別プロファイルの記録を開始しました (以降の予測を集計します)。");
     }
-    
-    benchmark_stats.mean_error = benchmark_stats.total_error / benchmark_stats.num_samples;
 }
 
 void reset_benchmark_stats() {
-    benchmark_stats.min_time_us = 0;
-    benchmark_stats.max_time_us = 0;
-    benchmark_stats.total_time_us = 0;
-    benchmark_stats.num_samples = 0;
-    benchmark_stats.mean_error = 0.0f;
-    benchmark_stats.max_error = 0.0f;
-    benchmark_stats.total_error = 0.0f;
+    profiler_reset();
+    prediction_cache.reset_stats();
     
     Serial.println("ベンチマーク統計をリセットしました。");
 }
@@ -0,0 +1,70 @@
+/*
+ * Teensy 4.1 多項式回帰モデル - 入力領域ごとの誤差表 (複数モデルの選択・加重平均用)
+ * 検証データ: data/All measurement data.csv (296 点のうち誤差表の当てはめに 222 点)
+ * 生成日時: 2026-10-17 01:31:30
+ * 生成スクリプト: export_teensy_model.py ensemble
+ *
+ * under_y 0..121 を 6 セル, theta -49..56 を 4 セルに分け、
+ * 各モデルのセル内の平均絶対誤差を格納する (行: under_y, 列: theta 昇順)。
+ * 点の少ないセルは全体のMAEへ寄せる: (Σ誤差 + 3 * 全体MAE) / (点数 + 3)
+ * 行番号 % 4 == 3 の 74 点は当てはめに使わず、選択・加重平均の誤差の確認用に残す
+ */
+
+#ifndef TEENSY_ENSEMBLE_ERRORS_H
+#define TEENSY_ENSEMBLE_ERRORS_H
+
+#include "teensy_ensemble_model.h"
+
+const int ENSEMBLE_ERROR_CELLS_U = 6;
+const int ENSEMBLE_ERROR_CELLS_T = 4;
+
+// 誤差表を当てはめた検証データのファイル名と、当てはめに使わず残した行の間隔
+const char* const ENSEMBLE_ERROR_SOURCE = "All measurement data.csv";
+const int ENSEMBLE_ERROR_HOLDOUT_STRIDE = 4;
+
+// ENSEMBLE_ERROR_SOURCE の行 (ヘッダを除き0から) が誤差表の当てはめに使われていないか
+inline bool ensemble_error_held_out(int row) {
+    return row % ENSEMBLE_ERROR_HOLDOUT_STRIDE == ENSEMBLE_ERROR_HOLDOUT_STRIDE - 1;
+}
+
+// degree6: models/20250719_191645-全データそのまま多項式/polynomial_degree6_mae0.70.joblib (全体のMAE 0.7542)
+const float ENSEMBLE_ERROR_MAE_DEGREE6[ENSEMBLE_ERROR_CELLS_U * ENSEMBLE_ERROR_CELLS_T] PROGMEM = {
+    // under_y 0..20.17 (点数 10 32 37 4)
+        1.0997f,     0.8509f,     1.3524f,     1.0537f,
+    // under_y 20.17..40.33 (点数 9 19 28 9)
+        0.5774f,     0.6844f,     0.5487f,     0.8714f,
+    // under_y 40.33..60.5 (点数 7 9 11 7)
+        0.4401f,     0.5849f,     0.6111f,     0.5656f,
+    // under_y 60.5..80.67 (点数 4 5 3 2)
+        0.4474f,     0.4023f,     0.4942f,     0.5436f,
+    // under_y 80.67..100.83 (点数 2 3 3 2)
+        0.6348f,     0.5062f,     0.4194f,     0.6464f,
+    // under_y 100.83..121 (点数 6 3 3 4)
+        0.6087f,     0.7172f,     0.4145f,     0.6904f
+};
+const EnsembleErrorGrid ENSEMBLE_ERROR_GRID_DEGREE6 = {
+    ENSEMBLE_ERROR_CELLS_U, ENSEMBLE_ERROR_CELLS_T, 0.0f, 121.0f, -49.0f, 56.0f,
+    ENSEMBLE_ERROR_MAE_DEGREE6
+};
+
+// degree17: models/20250721_233056-LNN蒸留多項式/polynomial_degree17_mae0.90.joblib (全体のMAE 0.8948)
+const float ENSEMBLE_ERROR_MAE_DEGREE17[ENSEMBLE_ERROR_CELLS_U * ENSEMBLE_ERROR_CELLS_T] PROGMEM = {
+    // under_y 0..20.17 (点数 10 32 37 4)
+        1.1837f,     0.9955f,     1.3975f,     1.6511f,
+    // under_y 20.17..40.33 (点数 9 19 28 9)
+        0.8252f,     0.7446f,     0.5533f,     1.0200f,
+    // under_y 40.33..60.5 (点数 7 9 11 7)
+        0.6661f,     0.5185f,     0.6132f,     0.7478f,
+    // under_y 60.5..80.67 (点数 4 5 3 2)
+        0.5100f,     0.7059f,     0.5242f,     0.9113f,
+    // under_y 80.67..100.83 (点数 2 3 3 2)
+        0.8069f,     0.5859f,     0.6770f,     0.9616f,
+    // under_y 100.83..121 (点数 6 3 3 4)
+        0.8929f,     0.7843f,     1.1920f,     1.0757f
+};
+const EnsembleErrorGrid ENSEMBLE_ERROR_GRID_DEGREE17 = {
+    ENSEMBLE_ERROR_CELLS_U, ENSEMBLE_ERROR_CELLS_T, 0.0f, 121.0f, -49.0f, 56.0f,
+    ENSEMBLE_ERROR_MAE_DEGREE17
+};
+
+#endif // TEENSY_ENSEMBLE_ERRORS_H
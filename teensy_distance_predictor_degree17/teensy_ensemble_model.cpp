@@ -0,0 +1,73 @@
+/*
+ * Teensy 4.1 多項式回帰モデル実装 - 複数の次数のモデルの選択・加重平均と組み込みの組み合わせ
+ * 係数表: teensy_model_degree6.h, teensy_model_degree17.h (export_teensy_model.py template で生成)
+ * 誤差表: teensy_ensemble_errors.h (export_teensy_model.py ensemble で生成)
+ */
+
+#include "teensy_ensemble_model.h"
+#include <math.h>
+#include "teensy_model_degree6.h"
+#include "teensy_model_degree17.h"
+#include "teensy_ensemble_errors.h"
+
+static const EnsembleMember DEFAULT_MEMBERS[DefaultEnsemble::COUNT] = {
+    // 学習データの範囲全体で使う (範囲外は低次で外挿が穏やかなためこのモデルにフォールバックする)
+    {"degree6", 0.70f, 0.0f, 121.0f, -48.1f, 55.2f, &ENSEMBLE_ERROR_GRID_DEGREE6},
+    // 実測範囲の隅 (under_y 100 以上など) で発散するため、実測範囲のうち入力検証範囲内だけで使う
+    {"degree17", 0.90f, 0.0f, 100.0f, -48.1f, 55.2f, &ENSEMBLE_ERROR_GRID_DEGREE17},
+};
+
+const DefaultEnsemble ENSEMBLE_DEFAULT(DEFAULT_MEMBERS, MODEL_DEGREE6, MODEL_DEGREE17);
+
+static TEENSY_INLINE bool member_covers(const EnsembleMember& member, float under_y, float theta) {
+    return under_y >= member.under_y_min && under_y <= member.under_y_max &&
+           theta >= member.theta_min && theta <= member.theta_max;
+}
+
+static TEENSY_INLINE int grid_cell(float value, float lower, float upper, int cells) {
+    const int cell = (int)floorf((value - lower) * (float)cells / (upper - lower));
+    return cell < 0 ? 0 : (cell >= cells ? cells - 1 : cell);
+}
+
+float ensemble_member_error(const EnsembleMember& member, float under_y, float theta) {
+    const EnsembleErrorGrid* grid = member.error_grid;
+    if (grid == nullptr) {
+        return member.validation_mae;
+    }
+    const int u = grid_cell(under_y, grid->under_y_min, grid->under_y_max, grid->cells_under_y);
+    const int t = grid_cell(theta, grid->theta_min, grid->theta_max, grid->cells_theta);
+    return grid->mae[u * grid->cells_theta + t];
+}
+
+double ensemble_combine(const EnsembleMember* members, int count, const double* values, float under_y, float theta,
+                        EnsemblePolicy policy) {
+    int best = -1;
+    float best_error = 0.0f;
+    double weighted_sum = 0.0;
+    double weight_sum = 0.0;
+    for (int m = 0; m < count; m++) {
+        if (!member_covers(members[m], under_y, theta)) {
+            continue;
+        }
+        const float error = ensemble_member_error(members[m], under_y, theta);
+        if (best < 0 || error < best_error) {
+            best = m;
+            best_error = error;
+        }
+        const double weight = 1.0 / ((double)error * error);
+        weighted_sum += weight * values[m];
+        weight_sum += weight;
+    }
+
+    if (best < 0) {
+        return values[0];  // どのモデルの範囲にも含まれない
+    }
+    if (policy == ENSEMBLE_SELECT) {
+        return values[best];
+    }
+    return weighted_sum / weight_sum;
+}
+
+TEENSY_FAST float predict_distance_ensemble(float under_y, float theta, EnsemblePolicy policy) {
+    return ENSEMBLE_DEFAULT.predict(under_y, theta, policy);
+}
@@ -0,0 +1,110 @@
+/*
+ * Teensy 4.1 多項式回帰モデル - 複数の次数のモデルのべき乗表を共有した評価 (入力ごとの選択・加重平均)
+ *
+ * models/ の次数ごとのモデルは入力領域によって誤差が異なるため、登録した複数のモデルを入力ごとに選択・加重平均する。
+ * 選択・重みは入力を含むセルの誤差 (teensy_ensemble_errors.h, export_teensy_model.py ensemble で生成) で決める。
+ * PolynomialEnsemble<Degrees...> は theta のべき乗表を最大次数まで1回だけ作り、
+ * 登録した PolynomialModel<N> すべてをその表の上で評価する (各行は表との内積、外側は under_y のHorner法)。
+ * 評価は PolynomialModel<N> と同じく index_sequence で完全に展開され、モデルどうしの演算はコンパイラが交互に並べる。
+ * under_y のべき乗は外側のHorner法に畳み込まれるため表を作らない
+ *
+ * 使用例:
+ *   float distance = predict_distance_ensemble(under_y, theta);                    // 加重平均
+ *   float distance = predict_distance_ensemble(under_y, theta, ENSEMBLE_SELECT);   // 選択
+ */
+
+#ifndef TEENSY_ENSEMBLE_MODEL_H
+#define TEENSY_ENSEMBLE_MODEL_H
+
+#include <algorithm>
+#include <tuple>
+#include "teensy_polynomial_template.h"
+
+// 入力領域をセルに分けたモデルの誤差表 (範囲外の入力は端のセルを使う)
+struct EnsembleErrorGrid {
+    int cells_under_y;
+    int cells_theta;
+    float under_y_min;
+    float under_y_max;
+    float theta_min;
+    float theta_max;
+    const float* mae;  // セルごとの平均絶対誤差 [cells_under_y * cells_theta] (under_y が外側)
+};
+
+// 登録するモデルの情報 (選択・加重平均に使う)
+struct EnsembleMember {
+    const char* name;
+    float validation_mae;  // 検証MAE (誤差表がないときの誤差)
+    // 信頼できる入力範囲 (外では選択・加重平均の対象から外す)
+    float under_y_min;
+    float under_y_max;
+    float theta_min;
+    float theta_max;
+    const EnsembleErrorGrid* error_grid;  // 入力領域ごとの誤差 (nullptr なら validation_mae を使う)
+};
+
+enum EnsemblePolicy {
+    ENSEMBLE_SELECT,    // 入力を範囲に含むモデルのうち入力点の誤差が最小のもの
+    ENSEMBLE_WEIGHTED,  // 入力を範囲に含むモデルの 1 / 誤差^2 加重平均 (誤差は入力点のセルの値)
+};
+
+// 入力点でのモデルの誤差 (誤差表のセルの値, 誤差表がなければ検証MAE)
+float ensemble_member_error(const EnsembleMember& member, float under_y, float theta);
+
+// 各モデルの値を方針に従って1つにまとめる
+// 入力を範囲に含むモデルがなければ先頭のモデルの値を使う (外挿が最も穏やかなモデルを先頭に登録する)
+double ensemble_combine(const EnsembleMember* members, int count, const double* values, float under_y, float theta,
+                        EnsemblePolicy policy);
+
+template <int... Degrees>
+class PolynomialEnsemble {
+    static_assert(sizeof...(Degrees) > 0, "at least one model is required");
+
+public:
+    static constexpr int COUNT = sizeof...(Degrees);
+    static constexpr int MAX_DEGREE = std::max({Degrees...});
+
+    constexpr PolynomialEnsemble(const EnsembleMember (&members)[COUNT], const PolynomialModel<Degrees>&... models)
+        : members_(members), models_(models...) {}
+
+    // 全モデルの値 (倍精度, 入力検証なし) を values[0..COUNT) に書く
+    TEENSY_INLINE void evaluate_all(double under_y, double theta, double* values) const {
+        double theta_powers[MAX_DEGREE + 1];
+        theta_powers[0] = 1.0;
+        for (int j = 1; j <= MAX_DEGREE; j++) {
+            theta_powers[j] = theta_powers[j - 1] * theta;
+        }
+        evaluate_members(under_y, theta_powers, values, std::make_index_sequence<COUNT>());
+    }
+
+    // 入力検証付き予測 (範囲外は -1.0f)
+    TEENSY_INLINE float predict(float under_y, float theta, EnsemblePolicy policy = ENSEMBLE_WEIGHTED) const {
+        if (!validate_input_range(under_y, theta)) {
+            return -1.0f;  // エラー指標
+        }
+        double values[COUNT];
+        evaluate_all((double)under_y, (double)theta, values);
+        return (float)ensemble_combine(members_, COUNT, values, under_y, theta, policy);
+    }
+
+    const EnsembleMember* members() const { return members_; }
+
+private:
+    template <size_t... M>
+    TEENSY_INLINE void evaluate_members(double under_y, const double* theta_powers, double* values,
+                                        std::index_sequence<M...>) const {
+        ((values[M] = std::get<M>(models_).evaluate_with_theta_powers(under_y, theta_powers)), ...);
+    }
+
+    const EnsembleMember* members_;
+    std::tuple<PolynomialModel<Degrees>...> models_;
+};
+
+// 組み込みの組み合わせ: 全データ6次 (MAE 0.70) + LNN蒸留17次 (MAE 0.90)
+typedef PolynomialEnsemble<6, 17> DefaultEnsemble;
+extern const DefaultEnsemble ENSEMBLE_DEFAULT;
+
+// ENSEMBLE_DEFAULT による入力検証付き予測 (範囲外は -1.0f)
+float predict_distance_ensemble(float under_y, float theta, EnsemblePolicy policy = ENSEMBLE_WEIGHTED);
+
+#endif // TEENSY_ENSEMBLE_MODEL_H
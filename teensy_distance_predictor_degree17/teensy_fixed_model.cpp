@@ -0,0 +1,107 @@
+/*
+ * Teensy 4.1 多項式回帰モデル実装 (17次) - 固定小数点 (Q形式) 整数Horner評価
+ * 係数表: teensy_fixed_model.h (export_teensy_model.py fixed で生成)
+ *
+ * FPUのない Cortex-M0+ や倍精度演算がソフトウェア実装になる Cortex-M4 向けに、浮動小数点演算を使わずに評価する
+ * - 正規化変数 x, y (int32 Q3.29) のネストHorner法。各段の値は int64 で、段ごとに生成時に決めた Q形式を持つ
+ * - 乗算は int64 × int32 を 32×32→64 ビットの積2回に分けて行う (128ビット演算不要)
+ * - 加算とシフトは飽和付き (生成時の上限により入力検証範囲では途中の段は飽和しない)
+ * - 結果は入力だけで決まり、コンパイラや浮動小数点ユニットの違いに依存しない
+ */
+
+#include "teensy_fixed_model.h"
+#include <pgmspace.h>
+
+static const int64_t FIXED_VALUE_MAX = INT64_MAX;
+static const int64_t FIXED_VALUE_MIN = INT64_MIN;
+
+static TEENSY_INLINE int64_t saturating_add(int64_t a, int64_t b, uint32_t& saturations) {
+    int64_t sum;
+    if (__builtin_add_overflow(a, b, &sum)) {
+        saturations++;
+        return a > 0 ? FIXED_VALUE_MAX : FIXED_VALUE_MIN;
+    }
+    return sum;
+}
+
+// 飽和付き左シフト (shift < 63)
+static TEENSY_INLINE int64_t saturating_shift_left(int64_t value, int shift, uint32_t& saturations) {
+    if (value > (FIXED_VALUE_MAX >> shift) || value < (FIXED_VALUE_MIN >> shift)) {
+        saturations++;
+        return value > 0 ? FIXED_VALUE_MAX : FIXED_VALUE_MIN;
+    }
+    return (int64_t)((uint64_t)value << shift);
+}
+
+// (value * factor) >> shift (切り捨て, 1 ≤ shift ≤ 62)
+// value = high * 2^31 + low (0 ≤ low < 2^31) に分け、|high|, |factor| < 2^31 の積を2回で求める
+static TEENSY_INLINE int64_t multiply_shift(int64_t value, int32_t factor, int shift, uint32_t& saturations) {
+    const int64_t high = (int64_t)(int32_t)(value >> 31) * factor;
+    const int64_t low = (int64_t)(value & 0x7FFFFFFF) * factor;
+    if (shift >= 31) {
+        return saturating_add(high >> (shift - 31), low >> shift, saturations);
+    }
+    return saturating_add(saturating_shift_left(high, 31 - shift, saturations), low >> shift, saturations);
+}
+
+// Q16 の入力を正規化入力 (Q29) に変換 (丸めあり)
+static TEENSY_INLINE int32_t normalize_fixed(int32_t value_q16, int32_t center, int64_t inv_half) {
+    const int shift = FIXED_IO_FRAC_BITS + FIXED_NORM_FRAC_BITS - FIXED_INPUT_FRAC_BITS;
+    return (int32_t)(((int64_t)(value_q16 - center) * inv_half + ((int64_t)1 << (shift - 1))) >> shift);
+}
+
+// 正規化入力 (Q29) での評価
+static TEENSY_FAST int32_t evaluate_fixed_q16(int32_t x, int32_t y, uint32_t* saturations) {
+    uint32_t saturated = 0;
+    const int64_t* coeff = FIXED_COEFFICIENTS;
+    const uint8_t* term_shift = FIXED_TERM_SHIFTS;
+    int64_t acc = 0;
+
+    // 係数・シフト量は評価順に並んでいるため先頭から順に読み出すだけでよい
+    // row 番目 (評価順) の行は x^(POLY_DEGREE - row) の係数 q_i(y) で、y の次数は row
+    for (int row = 0; row <= POLY_DEGREE; row++) {
+        int64_t q = *coeff++;
+        term_shift++;
+        for (int j = row; j > 0; j--) {
+            q = saturating_add(multiply_shift(q, y, *term_shift++, saturated), *coeff++, saturated);
+        }
+        const int64_t aligned = q >> FIXED_ROW_SHIFTS[row];
+        acc = row == 0 ? aligned
+                       : saturating_add(multiply_shift(acc, x, FIXED_OUTER_SHIFTS[row], saturated), aligned, saturated);
+    }
+
+    // 最終段の Q形式から Q16 へ (丸めあり) 変換し、int32 の範囲に飽和
+    const int output_shift = FIXED_OUTPUT_FRAC_BITS - FIXED_IO_FRAC_BITS;
+    if (output_shift > 0) {
+        const int shift = output_shift > 0 ? output_shift : 1;  // 生成する形式によっては負のシフトの警告になるため
+        acc = saturating_add(acc, (int64_t)1 << (shift - 1), saturated) >> shift;
+    } else if (output_shift < 0) {
+        acc = saturating_shift_left(acc, -output_shift, saturated);
+    }
+    if (saturations != nullptr) {
+        *saturations += saturated;
+    }
+    if (acc > INT32_MAX) return INT32_MAX;
+    if (acc < INT32_MIN) return INT32_MIN;
+    return (int32_t)acc;
+}
+
+TEENSY_FAST int32_t predict_distance_fixed_q16(int32_t under_y_q16, int32_t theta_q16, uint32_t* saturations) {
+    // 入力値検証 (validate_input_range と同じ範囲)
+    if (under_y_q16 < FIXED_UNDER_Y_MIN || under_y_q16 > FIXED_UNDER_Y_MAX ||
+        theta_q16 < FIXED_THETA_MIN || theta_q16 > FIXED_THETA_MAX) {
+        return FIXED_ERROR;  // エラー指標
+    }
+    return evaluate_fixed_q16(normalize_fixed(under_y_q16, FIXED_UNDER_Y_CENTER, FIXED_UNDER_Y_INV_HALF),
+                              normalize_fixed(theta_q16, FIXED_THETA_CENTER, FIXED_THETA_INV_HALF), saturations);
+}
+
+float predict_distance_fixed(float under_y, float theta) {
+    // 入力値検証
+    if (!validate_input_range(under_y, theta)) {
+        return -1.0f;  // エラー指標
+    }
+    const int32_t under_y_q16 = (int32_t)lroundf(under_y * (float)FIXED_ONE);
+    const int32_t theta_q16 = (int32_t)lroundf(theta * (float)FIXED_ONE);
+    return (float)predict_distance_fixed_q16(under_y_q16, theta_q16) / (float)FIXED_ONE;
+}
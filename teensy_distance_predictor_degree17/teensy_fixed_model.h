@@ -0,0 +1,211 @@
+/*
+ * Teensy 4.1 多項式回帰モデル (17次) - 固定小数点 (Q形式) 整数Horner評価用係数
+ * 自動生成元: models/20250721_233056-LNN蒸留多項式/polynomial_degree17_mae0.90.joblib
+ * 生成日時: 2026-10-17 00:23:31
+ * 生成スクリプト: export_teensy_model.py fixed
+ *
+ * 正規化変数 x = (under_y - 60.5) / 60.5, y = (theta - 3.5) / 52.5 (precision と同じ) の係数 b_ij を
+ * 段ごとに小数ビット数を変えた int64 の Q形式で格納 (評価順: 外側x^17→^0, 内側y降順)
+ * - 入出力: int32 Q16.16 (under_y, theta, distance), 正規化入力: int32 Q3.29
+ * - 各段の小数ビット数 (15〜58) は入力検証範囲全体 (|x| <= 2.6529, |y| <= 3.4952) での
+ *   値の上限 (区間演算) が 2^62 未満になるように選択 (通常の入力では途中の段はあふれない)
+ * - 出力は Q16.16 の範囲 (約 ±32768 cm) に飽和
+ * 倍精度参照 (同じ範囲に飽和) との差 (生成時の見積もり, 0.25 刻みの格子):
+ *   入力検証範囲全体 最大 3.634e-01 cm, 実測範囲 最大 2.841e-04 cm
+ */
+
+#ifndef TEENSY_FIXED_MODEL_H
+#define TEENSY_FIXED_MODEL_H
+
+#include "teensy_horner_model.h"
+
+const int FIXED_IO_FRAC_BITS = 16;
+const int FIXED_INPUT_FRAC_BITS = 29;
+const int FIXED_NORM_FRAC_BITS = 38;
+const int FIXED_OUTPUT_FRAC_BITS = 15;  // 最終段の小数ビット数
+
+// 入出力 (Q16.16) の 1.0 と、入力範囲外を表す -1.0
+const int32_t FIXED_ONE = 1 << FIXED_IO_FRAC_BITS;
+const int32_t FIXED_ERROR = -FIXED_ONE;
+
+// 正規化: x (Q29) = ((under_y (Q16) - 中心 (Q16)) * 半幅の逆数 (Q38)) >> (16 + 38 - 29), 丸めあり
+// 入力検証範囲の隅ではモデルの桁落ちが大きく、正規化入力の1ulpの丸めが 0.1 cm 程度の差になる
+const int32_t FIXED_UNDER_Y_CENTER = 3964928;
+const int64_t FIXED_UNDER_Y_INV_HALF = INT64_C(4543436478);
+const int32_t FIXED_THETA_CENTER = 229376;
+const int64_t FIXED_THETA_INV_HALF = INT64_C(5235769656);
+
+// 入力検証範囲 (Q16, validate_input_range と同じ)
+const int32_t FIXED_UNDER_Y_MIN = -6553600;
+const int32_t FIXED_UNDER_Y_MAX = 6553600;
+const int32_t FIXED_THETA_MIN = -11796480;
+const int32_t FIXED_THETA_MAX = 11796480;
+
+// 係数 b_ij (int64, その項を加える段の Q形式)
+const int64_t FIXED_COEFFICIENTS[HORNER_TERM_COUNT] PROGMEM = {
+    // x^17 : y^0..0
+    INT64_C(3185507199796899184),
+    // x^16 : y^1..0
+    INT64_C(2327524755472902603), INT64_C(2654010844992079633),
+    // x^15 : y^2..0
+    INT64_C(-3247624643416078240), INT64_C(59698564839342168), INT64_C(59768558219860090),
+    // x^14 : y^3..0
+    INT64_C(-3530546988608259975), INT64_C(-2168040818820807534), INT64_C(43064650420464114), INT64_C(-36812112130044007),
+    // x^13 : y^4..0
+    INT64_C(3942164532785634594), INT64_C(56191806717318584), INT64_C(285114871861607297), INT64_C(-3124805498353857),
+    INT64_C(-5561882459137261),
+    // x^12 : y^5..0
+    INT64_C(3646364393235032992), INT64_C(-3609717376217916752), INT64_C(73068562252890577), INT64_C(272926833415538161),
+    INT64_C(-3985834957805027), INT64_C(1947325380781736),
+    // x^11 : y^6..0
+    INT64_C(2841221180354088818), INT64_C(419372819951712778), INT64_C(-582353860912978849), INT64_C(-10430072749017119),
+    INT64_C(-43033578678862710), INT64_C(268699628163099), INT64_C(1358590105379359),
+    // x^10 : y^7..0
+    INT64_C(-2801507549944325600), INT64_C(-266051063446288034), INT64_C(47250393993051819), INT64_C(323055772900759061),
+    INT64_C(163222661884871), INT64_C(-12698182476700722), INT64_C(161582029812178), INT64_C(-68586090263717),
+    // x^9 : y^8..0
+    INT64_C(-2852360729462598921), INT64_C(592735307992489231), INT64_C(-13134621885609762), INT64_C(-57412210591992288),
+    INT64_C(16732398255773279), INT64_C(1068867850227273), INT64_C(3342013972561333), INT64_C(8828502668861),
+    INT64_C(-39964997504074),
+    // x^8 : y^9..0
+    INT64_C(4487505152422031497), INT64_C(1117981863617849334), INT64_C(214078866329284964), INT64_C(-37791959876412036),
+    INT64_C(-8178762793000793), INT64_C(-18156704310683605), INT64_C(-137944351473710), INT64_C(528972879523756),
+    INT64_C(-8045136281950), INT64_C(3238643105398),
+    // x^7 : y^10..0
+    INT64_C(-3636330767237071578), INT64_C(-903084384329064841), INT64_C(312771376436405184), INT64_C(-63136455679498146),
+    INT64_C(-11014365096687683), INT64_C(8556354581648200), INT64_C(589042857544512), INT64_C(-60167555970635),
+    INT64_C(-268265986485637), INT64_C(-1696877548811), INT64_C(2441391828106),
+    // x^6 : y^11..0
+    INT64_C(3731296094799793355), INT64_C(1314447246452209581), INT64_C(-92119326304759810), INT64_C(-210597062562872960),
+    INT64_C(-24032028912663548), INT64_C(16782982055324288), INT64_C(293842634498787), INT64_C(267156219348090),
+    INT64_C(6404646798259), INT64_C(-9342090718380), INT64_C(505010366719), INT64_C(-177725748175),
+    // x^5 : y^12..0
+    INT64_C(-2578743055935283382), INT64_C(-1895342953359314461), INT64_C(189156170586402845), INT64_C(208218770926334130),
+    INT64_C(-1962369680962123), INT64_C(-3544042262810382), INT64_C(-355398653775654), INT64_C(-189159666141141),
+    INT64_C(-12336759383936), INT64_C(1628794093919), INT64_C(2566272718407), INT64_C(22783158026),
+    INT64_C(-38443805234),
+    // x^4 : y^13..0
+    INT64_C(2735000680196546090), INT64_C(1577629352804143454), INT64_C(1367840517984783750), INT64_C(-918013504624972386),
+    INT64_C(-250409602298152144), INT64_C(90271424476490389), INT64_C(12355815119830548), INT64_C(-3144616313578128),
+    INT64_C(-159515188280618), INT64_C(36181166316587), INT64_C(412416256323), INT64_C(392824283806),
+    INT64_C(-36150480523), INT64_C(10014970467),
+    // x^3 : y^14..0
+    INT64_C(4000754407382633757), INT64_C(930171892521040659), INT64_C(-43128265877852503), INT64_C(108344128080165741),
+    INT64_C(2955194171758986), INT64_C(-12760919773451357), INT64_C(-1201161353503675), INT64_C(517727528260503),
+    INT64_C(131079383805531), INT64_C(3231218262918), INT64_C(-1482390186859), INT64_C(-57356870268),
+    INT64_C(-75023294175), INT64_C(-810007158), INT64_C(516936814),
+    // x^2 : y^15..0
+    INT64_C(2816980669532952573), INT64_C(202462475772409122), INT64_C(-380063385225658144), INT64_C(-35458676578897169),
+    INT64_C(7674013137897512), INT64_C(7692165134414171), INT64_C(2346994790426033), INT64_C(-454726878734748),
+    INT64_C(-108090204799401), INT64_C(24856086332820), INT64_C(3175046113973), INT64_C(-214885644164),
+    INT64_C(-15948838750), INT64_C(277145980), INT64_C(198940597), INT64_C(-5772287),
+    // x^1 : y^16..0
+    INT64_C(-4375082060607968872), INT64_C(-2054190734803687756), INT64_C(-319697092068489326), INT64_C(501221314628239108),
+    INT64_C(72229302779986382), INT64_C(-24960522726625869), INT64_C(-3502814914130270), INT64_C(620175808287634),
+    INT64_C(105100212073749), INT64_C(-13739922918076), INT64_C(-4242734697337), INT64_C(9797263312),
+    INT64_C(44459093067), INT64_C(621807130), INT64_C(-191674896), INT64_C(-1664623),
+    INT64_C(-7172927),
+    // x^0 : y^17..0
+    INT64_C(3620473221851302589), INT64_C(243401583108101764), INT64_C(884720889691081745), INT64_C(355532396047433498),
+    INT64_C(-275041603151960860), INT64_C(-43838985693041301), INT64_C(16356662616593492), INT64_C(2097660798399584),
+    INT64_C(-520373109234339), INT64_C(-102272640505212), INT64_C(19034343722515), INT64_C(1406406970622),
+    INT64_C(-192012897251), INT64_C(-11784495919), INT64_C(1903021892), INT64_C(161279202),
+    INT64_C(-5057365), INT64_C(3977029)
+};
+
+// 各項を加える前の乗算 (前段の値 * y) の右シフト量 (行の先頭は0)
+const uint8_t FIXED_TERM_SHIFTS[HORNER_TERM_COUNT] PROGMEM = {
+    // x^17 : y^0..0
+     0,
+    // x^16 : y^1..0
+     0, 35,
+    // x^15 : y^2..0
+     0, 31, 31,
+    // x^14 : y^3..0
+     0, 32, 31, 31,
+    // x^13 : y^4..0
+     0, 31, 31, 31,
+    31,
+    // x^12 : y^5..0
+     0, 33, 31, 31,
+    31, 31,
+    // x^11 : y^6..0
+     0, 31, 31, 31,
+    31, 30, 31,
+    // x^10 : y^7..0
+     0, 31, 31, 30,
+    31, 31, 31, 31,
+    // x^9 : y^8..0
+     0, 31, 31, 31,
+    30, 31, 31, 31,
+    31,
+    // x^8 : y^9..0
+     0, 32, 31, 31,
+    30, 31, 31, 31,
+    31, 31,
+    // x^7 : y^10..0
+     0, 32, 31, 30,
+    31, 31, 31, 31,
+    30, 31, 31,
+    // x^6 : y^11..0
+     0, 32, 31, 31,
+    30, 31, 31, 31,
+    31, 31, 30, 31,
+    // x^5 : y^12..0
+     0, 31, 31, 31,
+    31, 31, 31, 30,
+    31, 31, 31, 31,
+    30,
+    // x^4 : y^13..0
+     0, 32, 31, 31,
+    31, 31, 31, 31,
+    31, 30, 31, 31,
+    31, 31,
+    // x^3 : y^14..0
+     0, 31, 31, 31,
+    31, 31, 31, 30,
+    31, 31, 31, 31,
+    30, 31, 31,
+    // x^2 : y^15..0
+     0, 31, 31, 31,
+    30, 31, 31, 31,
+    31, 30, 31, 31,
+    31, 31, 30, 31,
+    // x^1 : y^16..0
+     0, 35, 31, 30,
+    31, 31, 31, 31,
+    31, 30, 31, 31,
+    31, 31, 30, 31,
+    31,
+    // x^0 : y^17..0
+     0, 31, 32, 30,
+    31, 31, 31, 31,
+    31, 30, 31, 31,
+    31, 31, 30, 31,
+    31, 31
+};
+
+// 行の値 q_i(y) を外側の段の Q形式に揃える右シフト量 (評価順)
+const uint8_t FIXED_ROW_SHIFTS[POLY_DEGREE + 1] PROGMEM = {
+     0,  0,  0,  1,  0,  1,  1,  1,  1,
+     1,  2,  2,  2,  3,  2,  2,  2,  3
+};
+
+// 外側の乗算 (前段の値 * x) の右シフト量 (評価順, 先頭は0)
+const uint8_t FIXED_OUTER_SHIFTS[POLY_DEGREE + 1] PROGMEM = {
+     0, 32, 35, 32, 32, 31, 31, 32, 31,
+    31, 31, 31, 31, 30, 31, 31, 31, 30
+};
+
+// 生成時に見積もった倍精度参照との差の最大値 [cm] (入力検証範囲全体 / 実測範囲)
+const float FIXED_ESTIMATED_MAX_ERROR = 3.633817e-01f;
+const float FIXED_ESTIMATED_MAX_ERROR_MEASURED = 2.841078e-04f;
+
+// 整数演算のみの予測 (Q16.16 の入出力, 範囲外は FIXED_ERROR, 出力は int32 の範囲に飽和)
+// saturations が非NULLなら途中の段で飽和した回数を加える (入力検証範囲では 0 のはず)
+int32_t predict_distance_fixed_q16(int32_t under_y_q16, int32_t theta_q16, uint32_t* saturations = nullptr);
+
+// 浮動小数点の入出力 (Q16.16 に丸めて評価, ホストでの比較用)
+float predict_distance_fixed(float under_y, float theta);
+
+#endif // TEENSY_FIXED_MODEL_H
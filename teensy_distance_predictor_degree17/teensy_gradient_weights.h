@@ -0,0 +1,88 @@
+/*
+ * Teensy 4.1 多項式回帰モデル (17次) - 勾配の重み
+ * 自動生成元: models/20250721_233056-LNN蒸留多項式/polynomial_degree17_mae0.90.joblib
+ * 生成日時: 2026-10-17 01:12:18
+ * 生成スクリプト: export_teensy_model.py gradient
+ *
+ * GRADIENT_WEIGHTS[k] = MODEL_COEFFICIENTS[k] / SCALER_SCALE[k] (特徴量 f_k の偏微分に掛ける値)
+ * PolynomialFeaturesの順序のまま格納
+ */
+
+#ifndef TEENSY_GRADIENT_WEIGHTS_H
+#define TEENSY_GRADIENT_WEIGHTS_H
+
+#include "teensy_polynomial_model.h"
+
+// 勾配の重み (倍精度でFlashメモリに格納)
+const double GRADIENT_WEIGHTS[FEATURE_COUNT] PROGMEM = {
+    // 次数 0: under_y^0..^0 * theta^0..^0
+      1.9887655672980000e+03,
+    // 次数 1: under_y^1..^0 * theta^0..^1
+     -2.5295427419757983e+00,  -1.6940732493714972e-01,
+    // 次数 2: under_y^2..^0 * theta^0..^2
+      2.2945548446365266e-01,  -6.3118323352186631e-02,   1.0558202925152332e-02,
+    // 次数 3: under_y^3..^0 * theta^0..^3
+     -6.0738452623411321e-02,   1.1956503714072806e-02,  -2.0133634184498531e-03,   4.6288590418497126e-04,
+    // 次数 4: under_y^4..^0 * theta^0..^4
+      6.0454655275606521e-03,  -1.4858399663154824e-03,   1.7824776381653031e-03,   7.1454280945659288e-04,
+      4.2817559199131492e-05,
+    // 次数 5: under_y^5..^0 * theta^0..^5
+     -3.0353148137523639e-04,   1.3840975588531287e-04,  -1.9126981825644151e-04,  -9.0183333927463616e-05,
+     -1.0092471363774489e-05,  -8.5293656199556479e-06,
+    // 次数 6: under_y^6..^0 * theta^0..^6
+      8.6276187181756100e-06,  -8.5326612014256991e-06,   6.2061505616525793e-06,   3.3738849312171476e-06,
+     -1.3719639270601267e-06,  -1.1408901923348892e-06,  -2.3469802817428499e-07,
+    // 次数 7: under_y^7..^0 * theta^0..^7
+     -1.3658141898641535e-07,   3.3871490840811679e-07,   1.3867735017011560e-07,   5.0292530799558903e-08,
+      4.0693223220776607e-07,   2.3458724071789336e-07,   2.8899373902100560e-08,   2.5613705934180656e-08,
+    // 次数 8: under_y^8..^0 * theta^0..^8
+      8.8119383771592973e-10,  -8.7677858986040607e-09,  -1.7265981339753810e-08,  -8.1009627446863007e-09,
+     -3.7314587690780360e-08,  -1.6323462018879145e-08,  -2.7818875458906129e-09,  -3.2751454347240567e-10,
+      5.2376717461488112e-10,
+    // 次数 9: under_y^9..^0 * theta^0..^9
+      6.2472140334931136e-12,   1.4792220768317781e-10,   6.1241101246471854e-10,   2.9608465599470504e-10,
+      1.8410251657901459e-09,   5.9638201091097320e-10,   2.0329682572117306e-10,  -1.0868126489643649e-10,
+     -2.9575407580962873e-11,  -3.4799852208850332e-11,
+    // 次数 10: under_y^10..^0 * theta^0..^10
+     -1.3855539709111950e-13,  -1.5477832351853927e-12,  -1.1761763941897605e-11,  -5.7126913412476261e-12,
+     -5.6670222199889373e-11,  -1.3219439272420501e-11,  -8.6769051191348278e-12,   9.3567831940311276e-12,
+      9.0298437723381079e-13,   1.3262593739324094e-12,  -5.3532649957849554e-13,
+    // 次数 11: under_y^11..^0 * theta^0..^11
+      3.1997787233523345e-16,   7.8904682887413718e-15,   1.2791104821198212e-13,   6.1036135530638906e-14,
+      1.1633628369788718e-12,   1.9150199839769560e-13,   2.2429999646107745e-13,  -3.5561116459652647e-13,
+     -4.2733790271671797e-14,  -2.9257144840593819e-14,   2.2004409980286438e-14,   2.5472868069027663e-14,
+    // 次数 12: under_y^12..^0 * theta^0..^12
+      8.7558219782356505e-18,   2.0225705447020990e-17,  -5.8791679857942114e-16,  -2.4259555524330437e-16,
+     -1.6409353655659986e-14,  -1.9092299783234154e-15,  -3.8514055337132937e-15,   7.8563059017991582e-15,
+      2.0025110008790858e-15,  -1.9983546664278049e-16,  -3.2154381013065578e-16,  -7.1110887675157111e-16,
+      2.5334610192293960e-16,
+    // 次数 13: under_y^13..^0 * theta^0..^13
+     -5.1756292544714194e-20,  -6.1812737271162057e-19,  -3.3371494919075669e-18,  -2.4076977244961422e-18,
+      1.5991379823618644e-16,   1.3861233746522539e-17,   4.6645591617359048e-17,  -1.1018680631487593e-16,
+     -5.0004991809141725e-17,   2.1461795298107644e-17,  -5.8458759424637951e-18,   1.9598558660035881e-17,
+     -8.1498104556568988e-18,  -9.9311576608410348e-18,
+    // 次数 14: under_y^14..^0 * theta^0..^14
+     -4.5141329507429351e-22,   4.2681041484309630e-21,   6.8874923497292706e-20,   4.1811531795458654e-20,
+     -1.0587018044358805e-18,  -7.8392729947256820e-20,  -4.0066869859025697e-19,   1.0019688806037180e-18,
+      6.7241558231435013e-19,  -4.0300467552754497e-19,   2.4571623398371465e-19,  -3.7260979634793846e-19,
+      1.5950371414315640e-19,   1.3962324404411146e-19,  -4.5181176936480710e-20,
+    // 次数 15: under_y^15..^0 * theta^0..^15
+      6.4347582148518237e-24,  -1.3770270377915426e-23,  -4.5637714476736454e-22,  -2.7449886552171063e-22,
+      4.5445528739422301e-21,   3.5213867169963477e-22,   2.3133744157260619e-21,  -5.7508583371596044e-21,
+     -5.0163843487034459e-21,   3.5915757403823482e-21,  -2.9587657989975318e-21,   3.6668814704292370e-21,
+     -2.1587916457646562e-21,  -3.7753742062529203e-22,   1.2606183276754154e-21,   1.6155004098648301e-21,
+    // 次数 16: under_y^16..^0 * theta^0..^16
+     -2.8379198276412480e-26,   1.6721573777939028e-26,   1.4788931051038756e-24,   9.0318549951275975e-25,
+     -1.1399889701928522e-23,  -1.1045189944231671e-24,  -7.9457925080328275e-24,   1.8991813384316617e-23,
+      1.9752353824734925e-23,  -1.6085647760958498e-23,   1.5136046009690931e-23,  -1.7542695435194955e-23,
+      1.6371767228243408e-23,  -9.6243124191608140e-25,  -1.2864339722879669e-23,  -2.5100051285621290e-23,
+     -2.5120478519706730e-25,
+    // 次数 17: under_y^17..^0 * theta^0..^17
+      4.5361505551609017e-29,   4.7742951345845947e-30,  -1.9652455358738619e-27,  -1.2310028594750317e-27,
+      1.2671787177787184e-26,   1.6883764087788943e-27,   1.2128310587498890e-26,  -2.7562152456727321e-26,
+     -3.2338647559418465e-26,   2.9314901582432949e-26,  -2.7374294302118201e-26,   3.2369451201073306e-26,
+     -5.1559626324670996e-26,   3.9385396044643078e-27,   5.3113598809127485e-26,   8.6193351952308152e-26,
+     -9.6416684938521210e-27,   1.8388969757099073e-26
+};
+
+#endif // TEENSY_GRADIENT_WEIGHTS_H
@@ -0,0 +1,42 @@
+/*
+ * Teensy 4.1 多項式回帰モデル実装 (17次) - Horner評価エンジン
+ * 係数表: teensy_horner_model.h (export_teensy_model.py horner で生成)
+ *
+ * StandardScalerを係数に畳み込み、under_y外側・theta内側のネストHorner法で評価
+ * - 特徴量バッファ不要 (スタック: 数十バイト)
+ * - 除算なし、乗算+加算 171回
+ */
+
+#include "teensy_horner_model.h"
+#include "teensy_profiler.h"
+#include <pgmspace.h>
+
+// Horner法による予測関数 (入力検証付き)
+TEENSY_FAST float predict_distance_horner(float under_y, float theta) {
+    PROFILE_SCOPE(PROFILE_STAGE_HORNER);
+
+    // 入力値検証
+    if (!validate_input_range(under_y, theta)) {
+        return -1.0f;  // エラー指標
+    }
+
+    return (float)evaluate_horner_double((double)under_y, (double)theta);
+}
+
+// 倍精度ネストHorner評価
+// distance = Σ_i under_y^i * q_i(theta), q_i(theta) = Σ_j a_ij * theta^j
+TEENSY_FAST double evaluate_horner_double(double under_y, double theta) {
+    const double* coeff = HORNER_COEFFICIENTS;
+    double acc = 0.0;
+
+    // 係数は評価順に並んでいるため先頭から順に読み出すだけでよい
+    for (int i = POLY_DEGREE; i >= 0; i--) {
+        double q = *coeff++;
+        for (int j = POLY_DEGREE - i; j > 0; j--) {
+            q = q * theta + *coeff++;
+        }
+        acc = acc * under_y + q;
+    }
+
+    return acc + HORNER_INTERCEPT;
+}
@@ -0,0 +1,98 @@
+/*
+ * Teensy 4.1 多項式回帰モデル (17次) - Horner評価用係数
+ * 自動生成元: models/20250721_233056-LNN蒸留多項式/polynomial_degree17_mae0.90.joblib
+ * 生成日時: 2026-10-16 23:30:47
+ * 生成スクリプト: export_teensy_model.py horner
+ *
+ * StandardScalerを係数に畳み込み済み:
+ *   distance = HORNER_INTERCEPT + Σ (coef_k / scale_k) * under_y^i * theta^j
+ * 係数は評価順 (外側under_y^17→^0, 内側theta降順) に格納
+ */
+
+#ifndef TEENSY_HORNER_MODEL_H
+#define TEENSY_HORNER_MODEL_H
+
+#include "teensy_polynomial_model.h"
+
+const int HORNER_TERM_COUNT = 171;
+
+// 畳み込み済み切片: intercept - Σ coef_k * mean_k / scale_k
+const double HORNER_INTERCEPT = -1898.2755480035073;
+
+// 畳み込み済み係数 coef_k / scale_k (倍精度でFlashメモリに格納)
+const double HORNER_COEFFICIENTS[HORNER_TERM_COUNT] PROGMEM = {
+    // under_y^17 : theta^0..0
+      4.5361505551598424e-29,
+    // under_y^16 : theta^1..0
+      4.7742951345824570e-30,  -2.8379198276403554e-26,
+    // under_y^15 : theta^2..0
+     -1.9652455358738282e-27,   1.6721573777944323e-26,   6.4347582148529397e-24,
+    // under_y^14 : theta^3..0
+     -1.2310028594755499e-27,   1.4788931051039145e-24,  -1.3770270377912079e-23,  -4.5141329507420295e-22,
+    // under_y^13 : theta^4..0
+      1.2671787177786492e-26,   9.0318549951336182e-25,  -4.5637714476726749e-22,   4.2681041484304619e-21,
+     -5.1756292544711745e-20,
+    // under_y^12 : theta^5..0
+      1.6883764087790052e-27,  -1.1399889701929368e-23,  -2.7449886552171665e-22,   6.8874923497312952e-20,
+     -6.1812737271165928e-19,   8.7558219782335351e-18,
+    // under_y^11 : theta^6..0
+      1.2128310587496605e-26,  -1.1045189944230848e-24,   4.5445528739406781e-21,   4.1811531795456999e-20,
+     -3.3371494919071205e-18,   2.0225705447019400e-17,   3.1997787233521851e-16,
+    // under_y^10 : theta^7..0
+     -2.7562152456736045e-26,  -7.9457925080330318e-24,   3.5213867169970398e-22,  -1.0587018044359050e-18,
+     -2.4076977244959169e-18,  -5.8791679857944608e-16,   7.8904682887427033e-15,  -1.3855539709106028e-13,
+    // under_y^9 : theta^8..0
+     -3.2338647559419177e-26,   1.8991813384316478e-23,   2.3133744157264757e-21,  -7.8392729947245095e-20,
+      1.5991379823620382e-16,  -2.4259555524322835e-16,   1.2791104821194599e-13,  -1.5477832351853020e-12,
+      6.2472140334932994e-12,
+    // under_y^8 : theta^9..0
+      2.9314901582431652e-26,   1.9752353824732677e-23,  -5.7508583371598963e-21,  -4.0066869859032313e-19,
+      1.3861233746515561e-17,  -1.6409353655661031e-14,   6.1036135530634602e-14,  -1.1761763941898881e-11,
+      1.4792220768319386e-10,   8.8119383771563349e-10,
+    // under_y^7 : theta^10..0
+     -2.7374294302115790e-26,  -1.6085647760959271e-23,  -5.0163843487040418e-21,   1.0019688806037804e-18,
+      4.6645591617365679e-17,  -1.9092299783237318e-15,   1.1633628369785356e-12,  -5.7126913412477045e-12,
+      6.1241101246448456e-10,  -8.7677858986047737e-09,  -1.3658141898646167e-07,
+    // under_y^6 : theta^11..0
+      3.2369451201084246e-26,   1.5136046009690814e-23,   3.5915757403816259e-21,   6.7241558231464028e-19,
+     -1.1018680631486796e-16,  -3.8514055337145188e-15,   1.9150199839774526e-13,  -5.6670222199866548e-11,
+      2.9608465599475529e-10,  -1.7265981339750707e-08,   3.3871490840814834e-07,   8.6276187181755524e-06,
+    // under_y^5 : theta^12..0
+     -5.1559626324678883e-26,  -1.7542695435188605e-23,  -2.9587657989972050e-21,  -4.0300467552752498e-19,
+     -5.0004991809143513e-17,   7.8563059018017078e-15,   2.2429999646108717e-13,  -1.3219439272424865e-11,
+      1.8410251657903594e-09,  -8.1009627446857862e-09,   1.3867735017010821e-07,  -8.5326612014236357e-06,
+     -3.0353148137517866e-04,
+    // under_y^4 : theta^13..0
+      3.9385396044655289e-27,   1.6371767228245368e-23,   3.6668814704303896e-21,   2.4571623398365514e-19,
+      2.1461795298104914e-17,   2.0025110008785880e-15,  -3.5561116459644630e-13,  -8.6769051191350556e-12,
+      5.9638201091090992e-10,  -3.7314587690787633e-08,   5.0292530799558856e-08,   6.2061505616522150e-06,
+      1.3840975588530875e-04,   6.0454655275601421e-03,
+    // under_y^3 : theta^14..0
+      5.3113598809125143e-26,  -9.6243124191609058e-25,  -2.1587916457645903e-21,  -3.7260979634791472e-19,
+     -5.8458759424659814e-18,  -1.9983546664278640e-16,  -4.2733790271668187e-14,   9.3567831940353265e-12,
+      2.0329682572121953e-10,  -1.6323462018882934e-08,   4.0693223220767522e-07,   3.3738849312182123e-06,
+     -1.9126981825647691e-04,  -1.4858399663151716e-03,  -6.0738452623407484e-02,
+    // under_y^2 : theta^15..0
+      8.6193351952313122e-26,  -1.2864339722884386e-23,  -3.7753742062536162e-22,   1.5950371414314735e-19,
+      1.9598558660041243e-17,  -3.2154381013056456e-16,  -2.9257144840595637e-14,   9.0298437723379837e-13,
+     -1.0868126489645403e-10,  -2.7818875458907258e-09,   2.3458724071784097e-07,  -1.3719639270602538e-06,
+     -9.0183333927489921e-05,   1.7824776381655538e-03,   1.1956503714070891e-02,   2.2945548446366845e-01,
+    // under_y^1 : theta^16..0
+     -9.6416684938517178e-27,  -2.5100051285634138e-23,   1.2606183276752469e-21,   1.3962324404411591e-19,
+     -8.1498104556567910e-18,  -7.1110887675153167e-16,   2.2004409980291111e-14,   1.3262593739324084e-12,
+     -2.9575407580956436e-11,  -3.2751454347241033e-10,   2.8899373902096838e-08,  -1.1408901923349183e-06,
+     -1.0092471363777631e-05,   7.1454280945680213e-04,  -2.0133634184499108e-03,  -6.3118323352180303e-02,
+     -2.5295427419758436e+00,
+    // under_y^0 : theta^17..0
+      1.8388969757099779e-26,  -2.5120478519703841e-25,   1.6155004098648378e-21,  -4.5181176936475553e-20,
+     -9.9311576608398037e-18,   2.5334610192299393e-16,   2.5472868069023596e-14,  -5.3532649957843839e-13,
+     -3.4799852208844646e-11,   5.2376717461478496e-10,   2.5613705934182436e-08,  -2.3469802817426609e-07,
+     -8.5293656199549330e-06,   4.2817559199135937e-05,   4.6288590418507372e-04,   1.0558202925152768e-02,
+     -1.6940732493711386e-01,   1.9887655672982307e+03
+};
+
+// Horner法による予測関数 (特徴量バッファ・除算なし)
+float predict_distance_horner(float under_y, float theta);
+double evaluate_horner_double(double under_y, double theta);
+
+#endif // TEENSY_HORNER_MODEL_H
@@ -0,0 +1,84 @@
+/*
+ * Teensy 4.1 多項式回帰モデル実装 (17次) - ルックアップテーブル補間
+ * 補間表: teensy_lut_model.h (export_teensy_model.py lut で生成)
+ *
+ * 17次多項式を格子上で事前に標本化し、実行時は近傍の標本から補間する
+ * - 双1次補間: 4標本, 約10 FLOP
+ * - 双3次補間 (Catmull-Rom): 16標本, 約60 FLOP
+ * 表の範囲外 (validate_input_rangeの範囲内) はHorner法で厳密に評価する
+ */
+
+#include "teensy_lut_model.h"
+#include <pgmspace.h>
+
+// 1軸について表上のセル番号と端数 [0, 1] を求める (範囲外・NaNはfalse)
+static TEENSY_INLINE bool locate_cell(float value, float min_value, float max_value, float inv_step,
+                                      int cell_count, int& cell, float& frac) {
+    if (!(value >= min_value && value <= max_value)) {
+        return false;
+    }
+    float position = (value - min_value) * inv_step;
+    cell = (int)position;
+    if (cell >= cell_count) {
+        cell = cell_count - 1;  // 上端ちょうどは最後のセルの右端
+    }
+    frac = position - (float)cell;
+    return true;
+}
+
+// 余白を除いたセル数
+static const int LUT_UNDER_Y_CELLS = LUT_UNDER_Y_COUNT - 3;
+static const int LUT_THETA_CELLS = LUT_THETA_COUNT - 3;
+
+// 余白込みの標本 [row][column]
+static TEENSY_INLINE float lut_sample(int row, int column) {
+    return LUT_VALUES[row * LUT_THETA_COUNT + column];
+}
+
+// Catmull-Rom 3次補間 (p1とp2の間, x ∈ [0, 1])
+static TEENSY_INLINE float catmull_rom(float p0, float p1, float p2, float p3, float x) {
+    return p1 + 0.5f * x * (p2 - p0 + x * (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3 + x * (3.0f * (p1 - p2) + p3 - p0)));
+}
+
+TEENSY_FAST float predict_distance_lut_bilinear(float under_y, float theta) {
+    // 入力値検証
+    if (!validate_input_range(under_y, theta)) {
+        return -1.0f;  // エラー指標
+    }
+
+    int cell_u, cell_t;
+    float x_u, x_t;
+    if (!locate_cell(under_y, LUT_UNDER_Y_MIN, LUT_UNDER_Y_MAX, LUT_UNDER_Y_INV_STEP, LUT_UNDER_Y_CELLS, cell_u, x_u) ||
+        !locate_cell(theta, LUT_THETA_MIN, LUT_THETA_MAX, LUT_THETA_INV_STEP, LUT_THETA_CELLS, cell_t, x_t)) {
+        return (float)evaluate_horner_double((double)under_y, (double)theta);
+    }
+
+    // 先頭の余白1標本分ずらす
+    int row = cell_u + 1;
+    int column = cell_t + 1;
+    float v0 = lut_sample(row, column) + x_t * (lut_sample(row, column + 1) - lut_sample(row, column));
+    float v1 = lut_sample(row + 1, column) + x_t * (lut_sample(row + 1, column + 1) - lut_sample(row + 1, column));
+    return v0 + x_u * (v1 - v0);
+}
+
+TEENSY_FAST float predict_distance_lut_bicubic(float under_y, float theta) {
+    // 入力値検証
+    if (!validate_input_range(under_y, theta)) {
+        return -1.0f;  // エラー指標
+    }
+
+    int cell_u, cell_t;
+    float x_u, x_t;
+    if (!locate_cell(under_y, LUT_UNDER_Y_MIN, LUT_UNDER_Y_MAX, LUT_UNDER_Y_INV_STEP, LUT_UNDER_Y_CELLS, cell_u, x_u) ||
+        !locate_cell(theta, LUT_THETA_MIN, LUT_THETA_MAX, LUT_THETA_INV_STEP, LUT_THETA_CELLS, cell_t, x_t)) {
+        return (float)evaluate_horner_double((double)under_y, (double)theta);
+    }
+
+    // 4x4ステンシル: 行 cell_u..cell_u+3, 列 cell_t..cell_t+3 (余白込みの添字)
+    float rows[4];
+    for (int k = 0; k < 4; k++) {
+        const float* row = &LUT_VALUES[(cell_u + k) * LUT_THETA_COUNT + cell_t];
+        rows[k] = catmull_rom(row[0], row[1], row[2], row[3], x_t);
+    }
+    return catmull_rom(rows[0], rows[1], rows[2], rows[3], x_u);
+}
@@ -0,0 +1,1897 @@
+/*
+ * Teensy 4.1 多項式回帰モデル (17次) - 補間用ルックアップテーブル
+ * 自動生成元: models/20250721_233056-LNN蒸留多項式/polynomial_degree17_mae0.90.joblib
+ * 生成日時: 2026-10-16 23:39:53
+ * 生成スクリプト: export_teensy_model.py lut
+ *
+ * 有効範囲: under_y 0..121 (間隔 1), theta -49..56 (間隔 1)
+ * 双3次補間の4点ステンシル用に各軸の前後へ1標本ずつ余白を含む
+ * 表サイズ: 124 x 108 (float, 53568 バイト)
+ */
+
+#ifndef TEENSY_LUT_MODEL_H
+#define TEENSY_LUT_MODEL_H
+
+#include "teensy_horner_model.h"
+
+// 表の有効範囲 (この外側はHorner法で厳密に評価)
+const float LUT_UNDER_Y_MIN = 0.0f;
+const float LUT_UNDER_Y_MAX = 121.0f;
+const float LUT_UNDER_Y_INV_STEP = 1.0f;
+const float LUT_THETA_MIN = -49.0f;
+const float LUT_THETA_MAX = 56.0f;
+const float LUT_THETA_INV_STEP = 1.0f;
+
+// 余白込みの標本数
+const int LUT_UNDER_Y_COUNT = 124;
+const int LUT_THETA_COUNT = 108;
+
+// 標本値 [under_y][theta] (単精度でFlashメモリに格納)
+const float LUT_VALUES[LUT_UNDER_Y_COUNT * LUT_THETA_COUNT] PROGMEM = {
+    // under_y = -1
+    -5126.49045f, -3311.05781f, -2097.20934f, -1297.24013f, -777.897243f, -445.863173f, -236.754271f, -106.870826f,
+    -27.0819539f, 21.6492438f, 51.4937391f, 70.0481573f, 81.9322766f, 89.8797739f, 95.4652782f, 99.575521f,
+    102.704565f, 105.131407f, 107.021569f, 108.481643f, 109.586336f, 110.390694f, 110.935281f, 111.248758f,
+    111.350044f, 111.250907f, 110.95901f, 110.481096f, 109.825882f, 109.006279f, 108.040696f, 106.953334f,
+    105.773539f, 104.534367f, 103.270642f, 102.016757f, 100.804525f, 99.6613005f, 98.6085748f, 97.6611506f,
+    96.8269376f, 96.1073426f, 95.4981635f, 94.9908561f, 94.5740107f, 94.2348721f, 93.9607408f, 93.7401195f,
+    93.5635048f, 93.4237676f, 93.3161137f, 93.2376643f, 93.1867347f, 93.1619279f, 93.1611769f, 93.1808797f,
+    93.2152647f, 93.2561028f, 93.2928497f, 93.3132563f, 93.3044371f, 93.2543277f, 93.1534136f, 92.9965649f,
+    92.7847736f, 92.526573f, 92.2389149f, 91.9472987f, 91.684989f, 91.4912183f, 91.4083545f, 91.4781074f,
+    91.7369517f, 92.2110559f, 92.9111019f, 93.8274718f, 94.9263452f, 96.1472926f, 97.4029722f, 98.5815353f,
+    99.5523514f, 100.175689f, 100.317092f, 99.8674381f, 98.7701396f, 97.0577961f, 94.9019775f, 92.6819398f,
+    91.0812225f, 91.22559f, 94.8820859f, 104.747591f, 124.866834f, 161.235065f, 222.660447f, 321.986738f,
+    477.809252f, 716.857858f, 1077.27165f, 1613.05283f, 2400.06446f, 3544.03095f, 5191.11411f, 7541.77479f,
+    10868.7945f, 15540.5278f, 22050.687f, 31056.2377f,
+    // under_y = 0
+    -4488.24275f, -2831.60999f, -1737.63186f, -1027.69306f, -575.638957f, -293.669557f, -121.668332f, -19.217289f,
+    40.3062866f, 74.0358354f, 92.7094499f, 102.855224f, 108.304878f, 111.218483f, 112.759727f, 113.526576f,
+    113.814984f, 113.772072f, 113.478908f, 112.990671f, 112.352816f, 111.605165f, 110.781134f, 109.90604f,
+    108.996341f, 108.060318f, 107.100013f, 106.113898f, 105.099694f, 104.056833f, 102.988198f, 101.900998f,
+    100.806737f, 99.7204216f, 98.6592067f, 97.6407316f, 96.6814126f, 95.7949186f, 94.9910114f, 94.2748672f,
+    93.6469265f, 93.1032528f, 92.6363229f, 92.2361312f, 91.8914603f, 91.5911634f, 91.3253123f, 91.086085f,
+    90.8683035f, 90.669573f, 90.4900193f, 90.3316671f, 90.1975411f, 90.0906023f, 90.0126562f, 89.9633718f,
+    89.9395477f, 89.9347405f, 89.9393373f, 89.9411112f, 89.9262523f, 89.8808107f, 89.7924405f, 89.6522883f,
+    89.4568353f, 89.2094855f, 88.9216868f, 88.6133956f, 88.3127291f, 88.0547123f, 87.8790993f, 87.8273386f,
+    87.9388449f, 88.2468351f, 88.7740724f, 89.5289266f, 90.5022094f, 91.6652532f, 92.9696945f, 94.3493848f,
+    95.724813f, 97.0104024f, 98.1250925f, 99.0067979f, 99.6317396f, 100.040404f, 100.373159f, 100.920559f,
+    102.196396f, 105.045877f, 110.807469f, 121.555297f, 140.460321f, 172.323414f, 224.352952f, 307.28457f,
+    436.972607f, 636.622881f, 939.886516f, 1395.09651f, 2071.00477f, 3064.47023f, 4510.66099f, 6596.46885f,
+    9577.99705f, 13803.175f, 19740.7833f, 28017.4439f,
+    // under_y = 1
+    -3903.83264f, -2398.24316f, -1417.99518f, -793.178351f, -404.433388f, -169.241895f, -31.5732462f, 45.8458127f,
+    87.2313352f, 107.886685f, 117.168443f, 120.570577f, 121.158351f, 120.530413f, 119.444999f, 118.212293f,
+    116.928318f, 115.605022f, 114.235231f, 112.819166f, 111.370224f, 109.911262f, 108.468042f, 107.063351f,
+    105.713281f, 104.425926f, 103.202077f, 102.037215f, 100.924075f, 99.8551574f, 98.8247289f, 97.8300864f,
+    96.8719911f, 95.9543561f, 95.0833566f, 94.2661889f, 93.5097182f, 92.8192336f, 92.1974881f, 91.6441381f,
+    91.155634f, 90.7255512f, 90.3452958f, 90.0050748f, 89.6950011f, 89.406187f, 89.1316929f, 88.8672151f,
+    88.6114314f, 88.3659614f, 88.134944f, 87.9242744f, 87.7405844f, 87.5900777f, 87.4773508f, 87.4043403f,
+    87.369525f, 87.3674988f, 87.388991f, 87.421377f, 87.449668f, 87.457926f, 87.4309938f, 87.3563957f,
+    87.2262268f, 87.0388349f, 86.8000964f, 86.5241071f, 86.2331454f, 85.9568219f, 85.7303997f, 85.5923512f,
+    85.5813036f, 85.7326073f, 86.0748321f, 86.6265496f, 87.3937802f, 88.3684804f, 89.5284015f, 90.8385852f,
+    92.2546862f, 93.728244f, 95.2140313f, 96.6797237f, 98.1184819f, 99.5657139f, 101.122476f, 102.98987f,
+    105.521682f, 109.306715f, 115.298212f, 125.015953f, 140.857633f, 166.570788f, 207.955624f, 273.893699f,
+    377.828796f, 539.865757f, 789.702426f, 1170.67086f, 1745.23897f, 2602.41535f, 3867.61082f, 5715.6439f,
+    8387.73776f, 12213.5466f, 17639.4762f, 25264.831f,
+    // under_y = 2
+    -3362.89754f, -2000.60577f, -1128.07568f, -583.702374f, -254.604106f, -63.2937743f, 42.3683764f, 96.6608724f,
+    121.506746f, 130.463807f, 131.568584f, 129.324344f, 126.059426f, 122.830102f, 120.000476f, 117.598755f,
+    115.523104f, 113.650002f, 111.882446f, 110.163604f, 108.472788f, 106.814336f, 105.205528f, 103.666646f,
+    102.214353f, 100.858386f, 99.6009323f, 98.4378515f, 97.3608536f, 96.3599212f, 95.4254358f, 94.5496882f,
+    93.7276462f, 92.9570051f, 92.2376576f, 91.5707846f, 90.9577852f, 90.3992571f, 89.8941947f, 89.4395223f,
+    89.0300159f, 88.6586103f, 88.3170323f, 87.996664f, 87.6895131f, 87.3891572f, 87.0915374f, 86.7954943f,
+    86.5029706f, 86.2188448f, 85.9503975f, 85.7064573f, 85.4963077f, 85.3284627f, 85.2094433f, 85.1426847f,
+    85.1277062f, 85.15965f, 85.2292665f, 85.3233863f, 85.4258708f, 85.5189856f, 85.5850977f, 85.6085545f,
+    85.577576f, 85.4859712f, 85.3344968f, 85.1316872f, 84.8940272f, 84.6453892f, 84.415725f, 84.2390766f,
+    84.1510505f, 84.1859722f, 84.3739949f, 84.7384748f, 85.2939312f, 86.0448809f, 86.9857699f, 88.1021363f,
+    89.3730194f, 90.7745388f, 92.2845179f, 93.8881028f, 95.5846092f, 97.396446f, 99.3820713f, 101.656742f,
+    104.4276f, 108.0537f, 113.147384f, 120.741374f, 132.556779f, 151.421556f, 181.907711f, 231.279746f,
+    310.877664f, 438.096762f, 639.175003f, 953.058952f, 1436.69322f, 2172.16862f, 3276.27362f, 4913.1257f,
+    7310.71702f, 10782.3975f, 15754.5419f, 22801.911f,
+    // under_y = 3
+    -2859.0483f, -1632.19715f, -861.354008f, -392.810096f, -119.833279f, 30.2928979f, 106.022547f, 138.799351f,
+    148.376354f, 146.659122f, 140.433682f, 133.263367f, 126.775686f, 121.509333f, 117.450562f, 114.355602f,
+    111.930271f, 109.918021f, 108.132505f, 106.459209f, 104.842254f, 103.266327f, 101.739372f, 100.278795f,
+    98.902048f, 97.6213417f, 96.4417044f, 95.3613603f, 94.3734517f, 93.4682767f, 92.6354297f, 91.8654604f,
+    91.1508708f, 90.4864356f, 89.868949f, 89.2965742f, 88.7679993f, 88.2815952f, 87.8347413f, 87.423432f,
+    87.0422219f, 86.6845105f, 86.3431166f, 86.0110523f, 85.6823865f, 85.3530709f, 85.0216146f, 84.6895059f,
+    84.3613131f, 84.04443f, 83.7484735f, 83.4843761f, 83.2632563f, 83.0951708f, 82.9878755f, 82.9457233f,
+    82.9688234f, 83.0525652f, 83.1875828f, 83.3601956f, 83.5533188f, 83.7477906f, 83.9240199f, 84.0638202f,
+    84.1522686f, 84.1794133f, 84.1416567f, 84.042656f, 83.8936248f, 83.7129646f, 83.525224f, 83.3594512f,
+    83.2470789f, 83.2195433f, 83.3058892f, 83.5306345f, 83.9121613f, 84.4618499f, 85.1840917f, 86.0771939f,
+    87.1350524f, 88.3493369f, 89.711853f, 91.2167739f, 92.8626693f, 94.6548149f, 96.6092992f, 98.7621741f,
+    101.189564f, 104.048605f, 107.654714f, 112.618504f, 120.076238f, 132.061803f, 152.086614f, 186.017655f,
+    243.374216f, 339.202195f, 496.732714f, 751.091107f, 1154.39531f, 1782.6717f, 2745.12442f, 4196.42436f,
+    6352.84f, 9513.2183f, 14086.0446f, 20624.0713f,
+    // under_y = 4
+    -2388.72573f, -1289.28761f, -613.998823f, -216.632293f, 3.72850617f, 115.296651f, 163.052779f, 175.772618f,
+    171.169142f, 159.595603f, 146.663324f, 135.052246f, 125.730389f, 118.748373f, 113.734996f, 110.188045f,
+    107.629463f, 105.674539f, 104.049958f, 102.584306f, 101.186362f, 99.8205777f, 98.4849018f, 97.1933694f,
+    95.9640317f, 94.8117835f, 93.7451141f, 92.7656376f, 91.8693115f, 91.0484283f, 90.293699f, 89.5959835f,
+    88.9474405f, 88.3420457f, 87.77555f, 87.2450324f, 86.7482337f, 86.2828569f, 85.8459941f, 85.4337906f,
+    85.0414072f, 84.6632847f, 84.293668f, 83.9273086f, 83.5602403f, 83.1905138f, 82.8187792f, 82.448625f,
+    82.0866076f, 81.7419416f, 81.4258583f, 81.1506769f, 80.9286665f, 80.7708017f, 80.6855334f, 80.6776984f,
+    80.7476866f, 80.8909665f, 81.0980381f, 81.3548505f, 81.6436734f, 81.9443741f, 82.2360053f, 82.4985762f,
+    82.7148534f, 82.8720244f, 82.9630615f, 82.9876401f, 82.9525037f, 82.8712168f, 82.7633078f, 82.6528715f,
+    82.5667677f, 82.5326059f, 82.5767514f, 82.7225935f, 82.9893001f, 83.3912177f, 83.9379737f, 84.6351974f,
+    85.4856151f, 86.4901129f, 87.6482523f, 88.9577117f, 90.4123203f, 91.9988516f, 93.6937192f, 95.4623669f,
+    97.2667277f, 99.0899658f, 100.993216f, 103.226669f, 106.427745f, 111.952909f, 122.407814f, 142.463877f,
+    180.079268f, 248.280059f, 367.704448f, 570.171491f, 903.607721f, 1438.75287f, 2278.1725f, 3568.2337f,
+    5514.85424f, 8404.01893f, 12628.275f, 18720.676f,
+    // under_y = 5
+    -1950.29556f, -970.061371f, -384.058544f, -53.1262905f, 118.172675f, 193.818663f, 215.535005f, 209.600787f,
+    191.823451f, 171.108517f, 151.972938f, 136.274134f, 124.366025f, 115.844339f, 110.004118f, 106.101138f,
+    103.484421f, 101.648022f, 100.235705f, 99.0212207f, 97.8787963f, 96.752672f, 95.6304588f, 94.5223775f,
+    93.4467252f, 92.4209242f, 91.4570273f, 90.5604154f, 89.7304992f, 88.9624322f, 88.2490895f, 87.5828158f,
+    86.9566735f, 86.3651036f, 85.804046f, 85.2706516f, 84.7627573f, 84.2783009f, 83.8148283f, 83.3692033f,
+    82.9375815f, 82.5156566f, 82.0991422f, 81.6844141f, 81.269217f, 80.8533252f, 80.4390569f, 80.031553f,
+    79.6387596f, 79.2710879f, 78.9407574f, 78.6608688f, 78.4442795f, 78.3023832f, 78.2439092f, 78.27386f,
+    78.3927019f, 78.5959026f, 78.8738834f, 79.2124183f, 79.5934703f, 79.9964157f, 80.3995658f, 80.7818635f,
+    81.1246079f, 81.4130488f, 81.6376988f, 81.7952279f, 81.8888434f, 81.9281046f, 81.9281845f, 81.9086483f,
+    81.8918862f, 81.9013856f, 81.9600574f, 82.088839f, 82.305759f, 82.625575f, 83.0599778f, 83.6181964f,
+    84.3076582f, 85.1341726f, 86.1009694f, 87.2058835f, 88.4361271f, 89.7605507f, 91.1202129f, 92.41966f,
+    93.52382f, 94.2691519f, 94.5030636f, 94.1730984f, 93.4975758f, 93.2629635f, 95.3110815f, 103.302295f,
+    123.870295f, 168.321268f, 255.07678f, 413.117397f, 686.755052f, 1142.14884f, 1876.08407f, 3027.66127f,
+    4793.6937f, 7448.79349f, 11371.3415f, 17076.7902f,
+    // under_y = 6
+    -1543.34396f, -673.9471f, -170.828143f, 98.520282f, 224.39169f, 266.804662f, 264.442799f, 241.261967f,
+    211.301204f, 182.125746f, 157.241519f, 137.747301f, 123.43121f, 113.470021f, 106.851255f, 102.607377f,
+    99.9274468f, 98.192914f, 96.9700898f, 95.981093f, 95.0672433f, 94.153209f, 93.2162959f, 92.262639f,
+    91.3104131f, 90.3792417f, 89.4845407f, 88.635425f, 87.834904f, 87.0813051f, 86.3701216f, 85.6957438f,
+    85.0527658f, 84.4367505f, 83.8444739f, 83.2737633f, 82.7230858f, 82.1910557f, 81.6760059f, 81.1757339f,
+    80.6874835f, 80.2081748f, 79.7348489f, 79.265261f, 78.7985297f, 78.3357409f, 77.8804093f, 77.4387154f,
+    77.01946f, 76.6337105f, 76.2941479f, 76.0141576f, 75.8067346f, 75.6833026f, 75.6525542f, 75.7194305f,
+    75.884344f, 76.1427395f, 76.4850515f, 76.8970915f, 77.3608508f, 77.8556734f, 78.3597081f, 78.8515232f,
+    79.3117429f, 79.7245556f, 80.078951f, 80.3695604f, 80.5970139f, 80.7677737f, 80.8934603f, 80.9897503f,
+    81.0749811f, 81.1686426f, 81.289963f, 81.4567871f, 81.6849082f, 81.987922f, 82.3775454f, 82.8641674f,
+    83.4571997f, 84.164597f, 84.9907458f, 85.9318632f, 86.9681596f, 88.0524409f, 89.0956964f, 89.9517408f,
+    90.4054081f, 90.1724375f, 88.9244521f, 86.3597671f, 82.3507767f, 77.2120254f, 72.1506185f, 69.9833308f,
+    76.2337889f, 100.759769f, 160.106538f, 280.83909f, 504.176132f, 892.334244f, 1537.09441f, 2571.22826f,
+    4183.5715f, 6638.71093f, 10302.464f, 15674.5809f,
+    // under_y = 7
+    -1168.14037f, -401.105165f, 25.6377642f, 238.349483f, 322.511485f, 334.44952f, 310.024157f, 271.041535f,
+    229.910196f, 192.963831f, 162.782297f, 139.771424f, 123.203723f, 111.874846f, 104.492835f, 99.8872489f,
+    97.1016628f, 95.4149108f, 94.322467f, 93.4989756f, 92.755254f, 91.9976043f, 91.1934527f, 90.3448068f,
+    89.4694366f, 88.5888003f, 87.7213288f, 86.8796025f, 86.0700699f, 85.2941874f, 84.5501272f, 83.8344719f,
+    83.1435548f, 82.4743006f, 81.8245676f, 81.1930866f, 80.5791426f, 79.9821564f, 79.4013101f, 78.8353207f,
+    78.2824276f, 77.7406065f, 77.2079833f, 76.6833846f, 76.16694f, 75.6606403f, 75.1687599f, 74.6980644f,
+    74.2577502f, 73.8590914f, 73.5148024f, 73.2381582f, 73.0419417f, 72.937311f, 72.9326919f, 73.0328055f,
+    73.2379344f, 73.5435109f, 73.9400875f, 74.4137156f, 74.9467199f, 75.5188202f, 76.1085134f, 76.6946034f,
+    77.2577424f, 77.7818418f, 78.2552183f, 78.6713594f, 79.0292302f, 79.333091f, 79.5918495f, 79.8180316f,
+    80.0265078f, 80.2331529f, 80.4536376f, 80.702537f, 80.9928923f, 81.3362648f, 81.743181f, 82.2236819f,
+    82.7874776f, 83.4429895f, 84.1943784f, 85.035572f, 85.9403924f, 86.8482719f, 87.6458735f, 88.146403f,
+    88.0707617f, 87.0382481f, 84.5796681f, 80.1929209f, 73.4709598f, 64.3451794f, 53.5045545f, 43.0732273f,
+    37.6578426f, 45.912083f, 82.8111175f, 172.884827f, 354.72776f, 687.188207f, 1257.7412f, 2193.67379f,
+    3676.85918f, 5963.0729f, 9407.01417f, 14494.4433f,
+    // under_y = 8
+    -825.238869f, -152.044497f, 204.890687f, 365.980161f, 412.218972f, 396.504597f, 352.088389f, 298.798548f,
+    247.550227f, 203.5542f, 168.549606f, 142.315768f, 123.660766f, 111.03806f, 102.905429f, 97.9110615f,
+    94.9686328f, 93.2653452f, 92.2333448f, 91.5047212f, 90.8628267f, 90.1973015f, 89.466489f, 88.6684781f,
+    87.8204921f, 86.9454998f, 86.0645577f, 85.1933301f, 84.3413752f, 83.5130204f, 82.7089334f, 81.9277725f,
+    81.1675451f, 80.4265075f, 79.7035844f, 78.9983922f, 78.3109969f, 77.6415594f, 76.9900037f, 76.3558149f,
+    75.7380293f, 75.1354338f, 74.5469527f, 73.9721611f, 73.4118485f, 72.8685395f, 72.3468857f, 71.8538543f,
+    71.3986617f, 70.9924294f, 70.6475713f, 70.3769511f, 70.1928784f, 70.1060312f, 70.1244058f, 70.2524f,
+    70.4901252f, 70.8330284f, 71.2718802f, 71.7931487f, 72.3797491f, 73.0121169f, 73.6695223f, 74.3315134f,
+    74.9793604f, 75.5973633f, 76.1738976f, 76.7020908f, 77.1800598f, 77.610689f, 78.0009783f, 78.3610521f,
+    78.7029679f, 79.0395021f, 79.3831056f, 79.7452035f, 80.1359573f, 80.5645042f, 81.0395391f, 81.569909f,
+    82.164666f, 82.8317945f, 83.5746287f, 84.3848699f, 85.2311821f, 86.0427003f, 86.6875768f, 86.9481199f,
+    86.4963741f, 84.8774825f, 81.5132181f, 75.7451553f, 66.9466247f, 54.7455416f, 39.4172153f, 22.5282975f,
+    7.94122482f, 3.32417245f, 22.3561793f, 87.8725077f, 236.263486f, 523.523398f, 1033.44709f, 1888.59397f,
+    3264.78517f, 5410.07453f, 8669.34057f, 13515.892f,
+    // under_y = 9
+    -515.192592f, 72.6543297f, 366.354707f, 480.86244f, 493.003441f, 452.505236f, 390.219195f, 324.164121f,
+    263.896715f, 213.61213f, 174.293458f, 145.159768f, 124.606045f, 110.782907f, 101.927639f, 96.5292656f,
+    93.3878205f, 91.6105368f, 90.5743745f, 89.8743602f, 89.2699131f, 88.6361273f, 87.9233854f, 87.1263087f,
+    86.2615935f, 85.3534852f, 84.425301f, 83.495379f, 82.5759828f, 81.6739424f, 80.7921018f, 79.9309249f,
+    79.0898673f, 78.2683228f, 77.4661096f, 76.6835636f, 75.9213634f, 75.1802283f, 74.4606248f, 73.7625835f,
+    73.0856908f, 72.4292762f, 71.7927725f, 71.1761989f, 70.5806899f, 70.0089852f, 69.4657976f, 68.9579884f,
+    68.4945018f, 68.0860346f, 67.7444535f, 67.4819938f, 67.3103084f, 67.2394485f, 67.276875f, 67.4265985f,
+    67.688542f, 68.0581997f, 68.5266447f, 69.0809032f, 69.7046816f, 70.3793956f, 71.0854189f, 71.8034426f,
+    72.5158223f, 73.2077814f, 73.8683514f, 74.4909514f, 75.0735449f, 75.6183609f, 76.1312163f, 76.6205371f,
+    77.0962186f, 77.5685042f, 78.0470707f, 78.5404874f, 79.0561539f, 79.6007125f, 80.1807748f, 80.8035991f,
+    81.4771235f, 82.2085162f, 83.0001969f, 83.8421568f, 84.6994599f, 85.494135f, 86.0814317f, 86.2217996f,
+    85.5521924f, 83.5637198f, 79.597626f, 72.8785398f, 62.6134622f, 48.1977082f, 29.5857942f, 7.90699645f,
+    -13.5668803f, -27.9588124f, -22.6421833f, 23.8267007f, 146.007925f, 397.500065f, 858.975811f, 1648.94229f,
+    2937.98157f, 4967.39925f, 8073.41327f, 12718.2571f,
+    // under_y = 10
+    -238.359772f, 272.53009f, 509.512473f, 582.457104f, 564.328076f, 501.933446f, 423.92781f, 346.684568f,
+    278.533559f, 222.759237f, 179.671714f, 147.99505f, 125.761926f, 110.859261f, 101.333664f, 95.5374025f,
+    92.1734479f, 90.2810976f, 89.1906597f, 88.4659724f, 87.8464094f, 87.1949495f, 86.4554019f, 85.6195833f,
+    84.7038433f, 83.7335791f, 82.734068f, 81.7259339f, 80.7237302f, 79.7363826f, 78.7685317f, 77.8221034f,
+    76.8976925f, 75.9955516f, 75.1161357f, 74.2602587f, 73.4289761f, 72.6233307f, 71.844092f, 71.0915896f,
+    70.3657066f, 69.6660533f, 68.9923063f, 68.344662f, 67.7243359f, 67.1340255f, 66.5782589f, 66.0635604f,
+    65.5983889f, 65.1928254f, 64.8580206f, 64.6054387f, 64.4459587f, 64.3889155f, 64.4411725f, 64.6063207f,
+    64.8840921f, 65.2700577f, 65.7556568f, 66.3285749f, 66.9734519f, 67.6728705f, 68.4085437f, 69.1625944f,
+    69.9188079f, 70.6637325f, 71.3875147f, 72.0843777f, 72.7526914f, 73.3946258f, 74.0154337f, 74.6224642f,
+    75.2240517f, 75.8284614f, 76.443077f, 77.0739926f, 77.7261047f, 78.4036864f, 79.1112633f, 79.8544056f,
+    80.6398067f, 81.4737744f, 82.3580371f, 83.2816355f, 84.207705f, 85.0542646f, 85.6688636f, 85.7982876f,
+    85.0567208f, 82.8991196f, 78.6114233f, 71.3360828f, 60.1607695f, 44.3106856f, 23.5014401f, -1.46911449f,
+    -27.7842543f, -49.1864344f, -53.8860195f, -21.5627559f, 80.8443736f, 304.944425f, 728.782931f, 1467.41437f,
+    2686.90407f, 4622.67504f, 7603.31704f, 12081.214f,
+    // under_y = 11
+    5.21743729f, 447.363351f, 634.02691f, 670.354914f, 625.745517f, 544.32865f, 452.758112f, 365.920258f,
+    291.045328f, 230.608741f, 184.328306f, 150.496617f, 126.833685f, 111.001136f, 100.884302f, 94.7209196f,
+    91.1334635f, 89.1054277f, 87.9291719f, 87.1434286f, 86.4716327f, 85.7672926f, 84.9692285f, 84.0672867f,
+    83.0777919f, 82.0272788f, 80.942764f, 79.8468217f, 78.7559073f, 77.6806421f, 76.6270753f, 75.5982305f,
+    74.5955052f, 73.6197013f, 72.6716241f, 71.7522966f, 70.8628951f, 70.0045387f, 69.1780574f, 68.3838413f,
+    67.6218344f, 66.8916969f, 66.1931231f, 65.5262689f, 64.8922243f, 64.2934513f, 63.7341159f, 63.2202466f,
+    62.7596768f, 62.3617518f, 62.0368073f, 61.795456f, 61.6477425f, 61.6022421f, 61.6651946f, 61.8397613f,
+    62.1254894f, 62.5180488f, 63.0092861f, 63.587607f, 64.2386698f, 64.9463375f, 65.6938086f, 66.464822f,
+    67.2448205f, 68.0219523f, 68.7878033f, 69.5377764f, 70.2710721f, 70.9902683f, 71.7005545f, 72.4087237f,
+    73.122074f, 73.8473993f, 74.5902577f, 75.3546739f, 76.1433667f, 76.9584737f, 77.8025796f, 78.679645f,
+    79.5951852f, 80.5547978f, 81.5599061f, 82.5994491f, 83.6362661f, 84.5872224f, 85.2968348f, 85.5054724f,
+    84.8153656f, 82.6609514f, 78.294879f, 70.8077511f, 59.2089179f, 42.6080279f, 20.5533461f, -6.3960009f,
+    -35.7596364f, -61.748938f, -73.2220844f, -50.7465526f, 37.5310706f, 241.588207f, 637.27982f, 1336.73715f,
+    2502.14713f, 4363.81592f, 7243.61911f, 11585.177f,
+    // under_y = 12
+    215.877194f, 597.2452f, 739.81244f, 744.348651f, 676.969346f, 579.357476f, 476.35382f, 381.509518f,
+    301.077344f, 236.821361f, 187.944703f, 152.369755f, 127.551825f, 110.964459f, 100.360299f, 93.8842632f,
+    90.0945879f, 87.9309554f, 86.6564506f, 85.7908276f, 85.0457822f, 84.2681138f, 83.393363f, 82.4103633f,
+    81.3358484f, 80.1975744f, 79.0241581f, 77.8398529f, 76.662677f, 75.5045824f, 74.3726617f, 73.2706867f,
+    72.2005296f, 71.1632377f, 70.1596847f, 69.1908404f, 68.2577559f, 67.3613932f, 66.5024218f, 65.6810807f,
+    64.8971736f, 64.15022f, 63.4397535f, 62.7657256f, 62.1289515f, 61.5315266f, 60.9771415f, 60.4712342f,
+    60.0209378f, 59.634804f, 59.3223122f, 59.0931972f, 58.9566541f, 58.9204932f, 58.9903324f, 59.1689099f,
+    59.455598f, 59.8461794f, 60.3329253f, 60.904985f, 61.5490681f, 62.250364f, 62.9936219f, 63.7642871f,
+    64.5495815f, 65.3394117f, 66.1270049f, 66.9091915f, 67.6862972f, 68.4616491f, 69.2407549f, 70.0302659f,
+    70.8368772f, 71.6663496f, 72.5228392f, 73.4086923f, 74.3247917f, 75.2714201f, 76.2494404f, 77.2613776f,
+    78.3117399f, 79.4056583f, 80.5446944f, 81.7185166f, 82.8911574f, 83.9808506f, 84.8331381f, 85.188227f,
+    84.6456986f, 82.6329098f, 78.388155f, 70.976306f, 59.3637615f, 42.5917543f, 20.1031485f, -7.7012751f,
+    -38.5743483f, -67.0653692f, -82.5154645f, -66.1741003f, 12.8593086f, 203.24381f, 579.026437f, 1249.87973f,
+    2374.67304f, 4179.26903f, 6979.63372f, 11211.5807f,
+    // under_y = 13
+    394.358708f, 722.604784f, 827.067384f, 804.468724f, 717.911521f, 606.851867f, 494.496336f, 393.205459f,
+    308.370895f, 241.138457f, 190.270655f, 153.378168f, 127.69746f, 110.549652f, 99.5821472f, 92.867942f,
+    88.9167513f, 86.6360847f, 85.2682217f, 84.3199671f, 83.4954524f, 82.6375549f, 81.6803009f, 80.6125398f,
+    79.4519271f, 78.2276017f, 76.9697137f, 75.7039903f, 74.44973f, 73.2198986f, 72.0223089f, 70.8611656f,
+    69.7385191f, 68.6553854f, 67.6124518f, 66.6103991f, 65.6499356f, 64.7316648f, 63.8559077f, 63.0225795f,
+    62.2311838f, 61.4809547f, 60.7711366f, 60.1013641f, 59.4720837f, 58.8849489f, 58.3431184f, 57.8514021f,
+    57.4162118f, 57.0453002f, 56.7472976f, 56.5310773f, 56.4050066f, 56.3761555f, 56.4495425f, 56.627501f,
+    56.9092405f, 57.2906604f, 57.7644528f, 58.3205011f, 58.9465528f, 59.6291121f, 60.3544739f, 61.1097985f,
+    61.8841157f, 62.6691487f, 63.4598581f, 64.2546352f, 65.0551093f, 65.8655812f, 66.6921462f, 67.5416228f,
+    68.4204436f, 69.3336955f, 70.2844963f, 71.2738664f, 72.3011775f, 73.3651439f, 74.4651512f, 75.6025008f,
+    76.7809036f, 78.0052931f, 79.2777971f, 80.589555f, 81.9070742f, 83.1520921f, 84.1745899f, 84.7198707f,
+    84.3926987f, 82.6246919f, 78.6558144f, 71.5473782f, 60.2529468f, 43.7855915f, 21.535818f, -6.1849296f,
+    -37.2739311f, -66.5054135f, -83.5609584f, -70.1938596f, 3.76465374f, 185.927445f, 548.866602f, 1200.2008f,
+    2295.9711f, 4058.18501f, 6797.60272f, 10943.069f,
+    // under_y = 14
+    541.790759f, 824.206176f, 896.277317f, 850.991427f, 748.694175f, 626.823284f, 507.120411f, 400.892312f,
+    312.779613f, 243.397955f, 191.139284f, 153.357931f, 127.114945f, 109.612805f, 98.4197171f, 91.5566157f,
+    87.4996565f, 85.1352899f, 83.6931049f, 82.6727636f, 81.7748816f, 80.8411429f, 79.805815f, 78.6588151f,
+    77.4192746f, 76.1179295f, 74.7864542f, 73.4519014f, 72.1346236f, 70.8483364f, 69.6012975f, 68.3978757f,
+    67.2400443f, 66.1285519f, 65.0636828f, 64.0456316f, 63.0745846f, 62.1506238f, 61.2735757f, 60.4428998f,
+    59.6576849f, 58.9167804f, 58.2190594f, 57.5637756f, 56.9509621f, 56.3818033f, 55.8589185f, 55.3864982f,
+    54.970257f, 54.6171852f, 54.3351093f, 54.1320912f, 54.0157216f, 53.9923766f, 54.0665138f, 54.2400886f,
+    54.5121594f, 54.8787376f, 55.3329144f, 55.8652697f, 56.4645378f, 57.1184777f, 57.814867f, 58.5425211f,
+    59.2922304f, 60.0575062f, 60.8350428f, 61.6248277f, 62.4298708f, 63.2555682f, 64.1087713f, 64.9966779f,
+    65.9257089f, 66.9005574f, 67.9236009f, 68.9948347f, 70.1124096f, 71.2737388f, 72.4769679f, 73.7223874f,
+    75.0131184f, 76.3541445f, 77.7485265f, 79.1894856f, 80.6470417f, 82.0481617f, 83.2500371f, 84.0073571f,
+    83.9365003f, 82.4827143f, 78.9009468f, 72.2674653f, 61.5482681f, 45.7621857f, 24.2922343f, -2.58090066f,
+    -32.823366f, -61.33783f, -78.024336f, -64.9871161f, 7.4008525f, 185.940786f, 542.017251f, 1181.54507f,
+    2258.16076f, 3990.5268f, 6684.80856f, 10763.6104f,
+    // under_y = 15
+    659.657353f, 903.123292f, 948.197499f, 884.427373f, 769.642759f, 639.459461f, 514.313563f, 404.586746f,
+    314.272044f, 243.537645f, 190.470681f, 152.221074f, 125.715182f, 108.068526f, 96.7945352f, 89.8807146f,
+    85.7837061f, 83.3793438f, 81.8921661f, 80.8201705f, 79.8642909f, 78.8676175f, 77.7663468f, 76.5524917f,
+    75.24722f, 73.8831061f, 72.4933781f, 71.1063126f, 69.7431388f, 68.4181079f, 67.1396973f, 65.9122181f,
+    64.7373582f, 63.6154076f, 62.5460742f, 61.5289124f, 60.5634485f, 59.6491229f, 58.7851622f, 57.9704814f,
+    57.2036806f, 56.4831681f, 55.8074056f, 55.1752444f, 54.5862994f, 54.0413006f, 53.5423581f, 53.0930895f,
+    52.6985712f, 52.3651003f, 52.0997736f, 51.9099173f, 51.8024174f, 51.783019f, 51.8556691f, 52.0219768f,
+    52.2808606f, 52.6284317f, 53.0581441f, 53.5612142f, 54.1272826f, 54.7452651f, 55.4043126f, 56.0947825f,
+    56.8091159f, 57.5425153f, 58.2933336f, 59.0631095f, 59.8562253f, 60.6792081f, 61.5397462f, 62.4455443f,
+    63.4031815f, 64.4171634f, 65.4893598f, 66.6189869f, 67.8032211f, 69.0384086f, 70.3216679f, 71.6524681f,
+    73.0335204f, 74.4700584f, 75.966356f, 77.5181732f, 79.0998248f, 80.6448262f, 82.0197286f, 82.9919845f,
+    83.1947112f, 82.094331f, 78.9715952f, 72.9328935f, 62.977499f, 48.1581419f, 27.8877646f, 2.46536408f,
+    -26.0805053f, -52.6995109f, -67.4068579f, -52.5278868f, 21.1844932f, 199.919988f, 554.121437f, 1188.29969f,
+    2254.0504f, 3967.12955f, 6629.63375f, 10658.5548f,
+    // under_y = 16
+    749.748169f, 960.700016f, 983.821045f, 905.496301f, 781.266266f, 645.108985f, 516.304137f, 404.428636f,
+    312.9245f, 241.58958f, 188.26743f, 149.951868f, 123.472403f, 105.887f, 94.6769576f, 87.8136108f,
+    83.7470901f, 81.3522759f, 79.8557205f, 78.7588242f, 77.7663866f, 76.725314f, 75.5753019f, 74.3114216f,
+    72.9574132f, 71.5479309f, 70.1178064f, 68.69647f, 67.3058897f, 65.9606819f, 64.6693635f, 63.4360126f,
+    62.2618685f, 61.1466157f, 60.089257f, 59.0885936f, 58.1433967f, 57.2523841f, 56.4141174f, 55.6269163f,
+    54.8888566f, 54.1978851f, 53.5520482f, 52.9498068f, 52.3903872f, 51.87411f, 51.4026371f, 50.979087f,
+    50.607983f, 50.2950207f, 50.0466627f, 49.8695926f, 49.770078f, 49.7533079f, 49.8227752f, 49.9797786f,
+    50.2231067f, 50.5489526f, 50.951086f, 51.421284f, 51.9499905f, 52.5271527f, 53.1431512f, 53.7897315f,
+    54.4608293f, 55.153189f, 55.8666882f, 56.6043083f, 57.3717294f, 58.1765746f, 59.0273789f, 59.9324098f,
+    60.8985059f, 61.9301262f, 63.0288054f, 64.1931743f, 65.4196363f, 66.7036657f, 68.0415328f, 69.4320422f,
+    70.8776325f, 72.383927f, 73.956595f, 75.5942344f, 77.2759851f, 78.9428418f, 80.4722855f, 81.6470646f,
+    82.1209632f, 81.3874611f, 78.7616683f, 73.3922268f, 64.3285125f, 50.6800617f, 31.9204103f, 8.40732513f,
+    -17.7832562f, -41.5802019f, -53.0275457f, -34.5628511f, 42.8171731f, 224.859561f, 581.27329f, 1215.41943f,
+    2277.16163f, 3979.72255f, 6621.57845f, 10614.6447f,
+    // under_y = 17
+    814.100003f, 998.501306f, 1004.33822f, 915.093253f, 784.229159f, 644.258002f, 513.44194f, 400.664914f,
+    308.907502f, 237.668612f, 184.604797f, 146.598322f, 120.416674f, 103.087276f, 92.0800495f, 85.3659502f,
+    81.4004647f, 79.0663171f, 77.5984913f, 76.5063805f, 75.5018566f, 74.4378126f, 73.2588547f, 71.9639769f,
+    70.5799723f, 69.1437956f, 67.6919327f, 66.2549151f, 64.8553399f, 63.5080527f, 62.2214689f, 60.9992985f,
+    59.8422111f, 58.7491802f, 57.7184142f, 56.7478885f, 55.8355612f, 54.9793838f, 54.1772222f, 53.4267834f,
+    52.7256154f, 52.071213f, 51.4612318f, 50.8937811f, 50.3677526f, 49.8831258f, 49.4411962f, 49.0446765f,
+    48.6976387f, 48.4052841f, 48.1735491f, 48.0085794f, 47.9161195f, 47.9008829f, 47.9659702f, 48.1124071f,
+    48.3388613f, 48.6415863f, 49.0146135f, 49.4501938f, 49.9394579f, 50.4732394f, 51.0429829f, 51.6416403f,
+    52.2644529f, 52.9095198f, 53.578068f, 54.2743665f, 55.0052677f, 55.7794018f, 56.6061048f, 57.4942065f,
+    58.4508494f, 59.4805327f, 60.5845776f, 61.761176f, 63.0061168f, 64.3141604f, 65.6808715f, 67.1045092f,
+    68.5873324f, 70.1354287f, 71.7559481f, 73.450473f, 75.203263f, 76.9633661f, 78.6202347f, 79.9736838f,
+    80.7010141f, 80.3271525f, 78.2080899f, 73.5441258f, 65.4479648f, 53.104155f, 36.0714262f, 14.7990234f,
+    -8.54685949f, -28.8188005f, -36.0186513f, -12.6062514f, 70.2907708f, 258.117248f, 620.021752f, 1258.42824f,
+    2321.72742f, 4020.92229f, 6651.24637f, 10619.9909f,
+    // under_y = 18
+    854.934124f, 1018.2599f, 1011.09116f, 914.250111f, 779.318702f, 637.50245f, 506.17459f, 393.629367f,
+    302.468456f, 231.957446f, 179.61776f, 142.260835f, 116.623892f, 99.7283574f, 89.0515842f, 82.5784022f,
+    78.7803263f, 76.5558033f, 75.1539676f, 74.0962737f, 73.1044882f, 72.0393879f, 70.8517103f, 69.5451111f,
+    68.1498398f, 66.7053304f, 65.2497592f, 63.81471f, 62.4233155f, 61.0905409f, 59.8245892f, 58.6287023f,
+    57.5028938f, 56.4453568f, 55.4534518f, 54.52429f, 53.6549911f, 52.8427277f, 52.0846692f, 51.3779199f,
+    50.7195208f, 50.1065484f, 49.5363124f, 49.0066289f, 48.5161255f, 48.064524f, 47.6528482f, 47.2835094f,
+    46.9602398f, 46.6878614f, 46.4718994f, 46.3180708f, 46.2316966f, 46.2170987f, 46.2770488f, 46.4123372f,
+    46.6215198f, 46.9008866f, 47.2446731f, 47.6455126f, 48.0950972f, 48.5849931f, 49.1075292f, 49.6566661f,
+    50.2287421f, 50.8230004f, 51.4418138f, 52.0905527f, 52.777081f, 53.5109096f, 54.3020882f, 55.1599658f,
+    56.0919904f, 57.1027452f, 58.1934177f, 59.3618683f, 60.6033938f, 61.9121637f, 63.2831474f, 64.7141415f,
+    66.2072739f, 67.7691115f, 69.4082792f, 71.1293522f, 72.9217933f, 74.7429595f, 76.4948474f, 77.9954332f,
+    78.9474298f, 78.910278f, 77.2855686f, 73.3322438f, 66.2363598f, 55.2714938f, 40.1007547f, 21.2906449f,
+    1.13170447f, -15.1079052f, -17.3306112f, 12.0543732f, 101.880423f, 297.405034f, 667.358723f, 1313.40344f,
+    2382.67086f, 4084.20396f, 6710.30692f, 10664.0231f,
+    // under_y = 19
+    874.593353f, 1021.82219f, 1005.5273f, 904.095596f, 767.410572f, 625.518467f, 495.022023f, 383.720623f,
+    293.912598f, 224.690094f, 173.486569f, 137.079544f, 112.204629f, 95.8993259f, 85.6652447f, 79.5137795f,
+    75.9419218f, 73.8707687f, 72.568596f, 71.5724369f, 70.6163653f, 69.5706395f, 68.3931372f, 67.0927681f,
+    65.7035466f, 64.2675081f, 62.8245268f, 61.4071817f, 60.0390545f, 58.735136f, 57.5033298f, 56.346336f,
+    55.2634556f, 54.2520613f, 53.3086422f, 52.429435f, 51.6107234f, 50.8489139f, 50.1405011f, 49.4820178f,
+    48.8700387f, 48.3012708f, 47.7727377f, 47.2820321f, 46.8275982f, 46.4089912f, 46.0270636f, 45.6840339f,
+    45.3834092f, 45.1297492f, 44.9282832f, 44.7844099f, 44.703126f, 44.6884454f, 44.7428739f, 44.8670044f,
+    45.0592894f, 45.3160316f, 45.6316127f, 45.9989553f, 46.4101871f, 46.8574495f, 47.3337723f, 47.8339201f,
+    48.3551112f, 48.8975107f, 49.4644191f, 50.0621038f, 50.6992585f, 51.3861235f, 52.1333484f, 52.9507285f,
+    53.845988f, 54.823806f, 55.8852849f, 57.0280306f, 58.2469406f, 59.5356892f, 60.8887317f, 62.3034549f,
+    63.7818668f, 65.3309755f, 66.9607971f, 68.6787888f, 70.4795166f, 72.3286273f, 74.1408285f, 75.7527659f,
+    76.8936286f, 77.1592829f, 76.0000592f, 72.7384018f, 66.6409193f, 57.0805352f, 43.8391272f, 27.6200819f,
+    10.8645569f, -1.00394524f, 2.256509f, 38.3449704f, 136.128938f, 340.770419f, 720.696231f, 1376.94754f,
+    2455.57015f, 4163.85786f, 6791.44069f, 10737.4211f,
+    // under_y = 20
+    875.481771f, 1011.09597f, 989.154159f, 885.816091f, 749.434939f, 609.033007f, 480.551023f, 371.380048f,
+    283.583766f, 216.13511f, 166.422107f, 131.221491f, 107.292862f, 91.7093988f, 82.0118287f, 76.2492361f,
+    72.9523063f, 71.0707567f, 69.8962548f, 68.9843663f, 68.0834615f, 67.0745655f, 65.9234782f, 64.6447975f,
+    63.2765038f, 61.8632881f, 60.4466904f, 59.0602103f, 57.72779f, 56.4643603f, 55.2774536f, 54.1691751f,
+    53.1380789f, 52.1807013f, 51.2926594f, 50.4693287f, 49.7061803f, 48.9988865f, 48.3433066f, 47.7354485f,
+    47.1714726f, 46.647777f, 46.1611661f, 45.7090848f, 45.2898779f, 44.9030264f, 44.5493123f, 44.2308685f,
+    43.9510887f, 43.714384f, 43.5258002f, 43.3905237f, 43.313323f, 43.2979853f, 43.3468115f, 43.4602342f,
+    43.636611f, 43.872235f, 44.1615781f, 44.4977628f, 44.8732293f, 45.2805405f, 45.7132461f, 46.1667134f,
+    46.6388235f, 47.1304397f, 47.645569f, 48.1911647f, 48.7765596f, 49.4125595f, 50.1102848f, 50.8798869f,
+    51.7293167f, 52.66334f, 53.6830013f, 54.7857061f, 55.9660248f, 57.2172101f, 58.5332636f, 59.9111913f,
+    61.3528617f, 62.8656442f, 64.4607994f, 66.1484564f, 67.9280336f, 69.7732179f, 71.6112524f, 73.2974612f,
+    74.5878638f, 75.1156695f, 74.3817231f, 71.7749843f, 66.6473534f, 58.4781782f, 47.1782809f, 33.6021364f,
+    20.3608789f, 13.0592229f, 22.1174603f, 65.3869446f, 171.82563f, 386.571295f, 777.836317f, 1446.1519f,
+    2536.61444f, 4254.93548f, 6888.27359f, 10832.0352f,
+    // under_y = 21
+    860.009118f, 988.002021f, 963.497207f, 860.619001f, 726.344607f, 588.796143f, 463.35112f, 357.07076f,
+    271.846129f, 206.579662f, 158.651975f, 124.868457f, 102.035307f, 87.2785754f, 78.1910298f, 72.8690356f,
+    69.8839766f, 68.2192117f, 67.1933164f, 66.3827801f, 65.5518332f, 64.5932359f, 63.4812614f, 62.2364647f,
+    60.9008792f, 59.5218303f, 58.1424462f, 56.7970478f, 55.5098397f, 54.2956095f, 53.161456f, 52.1088499f,
+    51.1355809f, 50.2373512f, 49.4089235f, 48.6448418f, 47.9398039f, 47.2887942f, 46.6870883f, 46.1302245f,
+    45.6140097f, 45.1345969f, 44.6886415f, 44.2735164f, 43.8875491f, 43.5302356f, 43.2023825f, 42.9061386f,
+    42.6448887f, 42.4230019f, 42.2454453f, 42.1172927f, 42.0431746f, 42.0267277f, 42.0701066f, 42.1736187f,
+    42.3355365f, 42.5521233f, 42.8178898f, 43.1260747f, 43.4693153f, 43.8404505f, 44.2333788f, 44.6438764f,
+    45.070279f, 45.5139319f, 45.9793322f, 46.4739118f, 47.0074515f, 47.5911577f, 48.2364866f, 48.9538479f,
+    49.7513598f, 50.6338535f, 51.6023288f, 52.6540317f, 53.783263f, 54.9829137f, 56.2465773f, 57.5708911f,
+    58.957544f, 60.4141563f, 61.9530377f, 63.586704f, 65.3190551f, 67.131382f, 68.9630068f, 70.6875282f,
+    72.0875539f, 72.8337138f, 72.4779789f, 70.4772542f, 66.2713478f, 59.4503013f, 50.0603869f, 39.116628f,
+    29.4134272f, 26.7548909f, 41.7640029f, 92.4764089f, 207.981938f, 433.447066f, 836.936598f, 1518.5554f,
+    2622.55412f, 4353.18949f, 6995.30425f, 10940.7975f,
+    // under_y = 22
+    830.541327f, 954.430883f, 930.06213f, 829.699858f, 699.086334f, 565.556075f, 444.012822f, 341.258678f,
+    259.067664f, 196.315131f, 150.407938f, 118.206015f, 96.5818795f, 82.7293107f, 74.3041742f, 69.4582179f,
+    66.8093536f, 65.3786807f, 64.5144847f, 63.81602f, 63.0645246f, 62.1651501f, 61.1009645f, 59.8985836f,
+    58.6040652f, 57.2672699f, 55.9327859f, 54.6356279f, 53.4001507f, 52.2409125f, 51.1645204f, 50.1717801f,
+    49.2597113f, 48.4231965f, 47.6561749f, 46.9524014f, 46.3058507f, 45.7108747f, 45.1622237f, 44.6550275f,
+    44.1848016f, 43.7475195f, 43.3397553f, 42.9588813f, 42.6032842f, 42.2725564f, 41.9676158f, 41.6907179f,
+    41.4453333f, 41.2358853f, 41.067357f, 40.9448002f, 40.8727898f, 40.8548826f, 40.8931405f, 40.9877803f,
+    41.1369992f, 41.3370143f, 41.5823297f, 41.8662253f, 42.1814302f, 42.5209267f, 42.8788037f, 43.2510675f,
+    43.6363143f, 44.0361686f, 44.455414f, 44.9017644f, 45.3852665f, 45.9173671f, 46.5097276f, 47.172918f,
+    47.9151619f, 48.7413305f, 49.652386f, 50.6454488f, 51.7145994f, 52.8524197f, 54.0521324f, 55.3100095f,
+    56.6275077f, 58.0123681f, 59.477723f, 61.038135f, 62.7015244f, 64.4562076f, 66.2529076f, 67.9827595f,
+    69.4542298f, 70.3747499f, 70.3470533f, 68.8960817f, 65.550358f, 60.0124773f, 52.4675004f, 44.0963465f,
+    37.8846922f, 39.8474888f, 60.8262614f, 119.062326f, 243.805632f, 480.288048f, 896.473788f, 1592.10082f,
+    2710.64842f, 4455.01073f, 7107.82809f, 11057.6307f,
+    // under_y = 23
+    789.358048f, 912.205704f, 890.302325f, 794.213912f, 668.576047f, 540.03751f, 423.10878f, 324.396108f,
+    245.605886f, 185.624702f, 141.915149f, 111.414174f, 91.0775717f, 78.1794824f, 70.4481392f, 66.0973526f,
+    63.796268f, 62.6069453f, 61.9094972f, 61.3272598f, 60.6592263f, 59.8232966f, 58.8114344f, 57.6562593f,
+    56.4077121f, 55.1180114f, 53.8330278f, 52.5883102f, 51.4082363f, 50.3070417f, 49.2907845f, 48.35958f,
+    47.50968f, 46.7351708f, 46.0292075f, 45.3848064f, 44.7952764f, 44.2543973f, 43.7564563f, 43.2962364f,
+    42.8690237f, 42.4706735f, 42.0977411f, 41.7476628f, 41.4189516f, 41.1113671f, 40.8260132f, 40.5653308f,
+    40.3329583f, 40.1334564f, 39.9719073f, 39.8534203f, 39.7825883f, 39.7629512f, 39.7965282f, 39.883477f,
+    40.0219313f, 40.2080493f, 40.4362907f, 40.6999109f, 40.9916392f, 41.3044833f, 41.6325809f, 41.972008f,
+    42.3214456f, 42.6826137f, 43.0603963f, 43.4626089f, 43.8993969f, 44.3822997f, 44.9230619f, 45.5323227f,
+    46.2183535f, 46.9860413f, 47.8363176f, 48.7662094f, 49.7696244f, 50.8388852f, 51.9668791f, 53.1495133f,
+    54.3879558f, 55.6899303f, 57.069147f, 58.5418418f, 60.1194336f, 61.7965814f, 63.5345633f, 65.2410539f,
+    66.7492603f, 67.8022313f, 68.0522985f, 67.0914166f, 64.53611f, 60.201345f, 54.4116063f, 48.5155221f,
+    45.6934825f, 52.1768983f, 79.0342908f, 144.724739f, 278.674994f, 526.20471f, 955.206944f, 1665.09078f,
+    2798.61253f, 4557.36468f, 7221.86099f, 11177.3565f,
+    // under_y = 24
+    738.617601f, 863.051484f, 845.592003f, 755.25262f, 635.678309f, 512.923773f, 401.178215f, 306.908217f,
+    231.796102f, 174.773193f, 133.383345f, 104.659783f, 85.6559202f, 73.7367841f, 66.7105592f, 62.8584585f,
+    60.9045088f, 59.954122f, 59.4207133f, 58.952524f, 58.3666751f, 57.5938914f, 56.6349252f, 55.5281932f,
+    54.3272706f, 53.0864841f, 51.8527596f, 50.6619915f, 49.5384348f, 48.4959022f, 47.539844f, 46.6696623f,
+    45.8808473f, 45.1667184f, 44.5196918f, 43.9321007f, 43.3966489f, 42.9066072f, 42.4558617f, 42.0389086f,
+    41.6508627f, 41.2875168f, 40.9454623f, 40.6222538f, 40.3165868f, 40.0284459f, 39.7591826f, 39.5114875f,
+    39.2892343f, 39.0971903f, 38.940607f, 38.8247191f, 38.7542006f, 38.7326301f, 38.7620285f, 38.842525f,
+    38.9722015f, 39.1471499f, 39.3617551f, 39.6091942f, 39.8821187f, 40.1734607f, 40.4772847f, 40.7895959f,
+    41.1090066f, 41.4371702f, 41.7789068f, 42.1419735f, 42.5364656f, 42.9738838f, 43.4659482f, 44.0232871f,
+    44.6541703f, 45.3634825f, 46.1521356f, 47.0170974f, 47.9521528f, 48.9494166f, 50.0014786f, 51.1038849f,
+    52.2574611f, 53.4697761f, 54.7548693f, 56.1302609f, 57.6103109f, 59.1952704f, 60.8560089f, 62.5155511f,
+    64.0304291f, 65.1776804f, 65.6574258f, 65.1267007f, 63.2880595f, 60.0669509f, 55.9256384f, 52.3792689f,
+    52.8024793f, 63.6437304f, 96.2005989f, 169.153954f, 312.113943f, 570.497891f, 1012.14172f, 1736.14478f,
+    2884.56593f, 4657.72919f, 7334.06433f, 11295.605f,
+    // under_y = 25
+    680.329409f, 808.570909f, 797.20501f, 713.825143f, 601.190188f, 484.842763f, 378.714718f, 289.182467f,
+    217.942287f, 163.999188f, 125.000103f, 98.090761f, 80.4340923f, 69.4945659f, 63.166329f, 59.8020884f,
+    58.1834178f, 57.4607058f, 57.0815523f, 56.7194724f, 56.2097442f, 55.4957361f, 54.5866931f, 53.5264853f,
+    52.3719769f, 51.1792858f, 49.9961222f, 48.8585091f, 47.7904179f, 46.8051299f, 45.9074262f, 45.0959736f,
+    44.3655105f, 43.7086217f, 43.1170332f, 42.5824531f, 42.0970423f, 41.6536251f, 41.2457468f, 40.8676734f,
+    40.5144003f, 40.1817062f, 39.8662636f, 39.5657892f, 39.279204f, 39.0067622f, 38.7501093f, 38.5122353f,
+    38.2973014f, 38.1103365f, 37.9568168f, 37.8421586f, 37.7711696f, 37.747515f, 37.7732563f, 37.8485218f,
+    37.9713559f, 38.137781f, 38.3420847f, 38.577324f, 38.8360096f, 39.1109145f, 39.3959281f, 39.6868672f,
+    39.9821447f, 40.283209f, 40.5946762f, 40.9241075f, 41.2814206f, 41.6779657f, 42.1253471f, 42.6341161f,
+    43.2125032f, 43.8653813f, 44.5936607f, 45.39429f, 46.2609855f, 47.1857111f, 48.1608028f, 49.1814566f,
+    50.2481106f, 51.3680508f, 52.5554036f, 53.8285846f, 55.2043251f, 56.687682f, 58.2580778f, 59.8525664f,
+    61.3493722f, 62.5575562f, 63.2227172f, 63.064314f, 61.8679403f, 59.6662347f, 57.0556983f, 55.7142856f,
+    59.2071067f, 74.1959823f, 112.204121f, 192.131261f, 343.768814f, 612.630782f, 1066.49653f, 1804.15836f,
+    2966.98306f, 4754.03504f, 7441.67331f, 11408.7287f,
+    // under_y = 26
+    616.333711f, 750.226541f, 746.299251f, 670.844744f, 565.829419f, 456.356685f, 356.157381f, 271.560968f,
+    204.310522f, 153.509445f, 116.926087f, 91.8320983f, 75.5095436f, 65.5290696f, 59.8753451f, 56.9755148f,
+    55.6704655f, 55.1564872f, 54.9157082f, 54.6468755f, 54.2031447f, 53.5401174f, 52.6750671f, 51.6568527f,
+    50.5451978f, 49.3976369f, 48.2623555f, 47.1752647f, 46.1598774f, 45.2288288f, 44.3861669f, 43.629802f,
+    42.9537315f, 42.3498407f, 41.8092158f, 41.3229984f, 40.882869f, 40.4812661f, 40.1114509f, 39.7675108f,
+    39.4443669f, 39.1378235f, 38.8446693f, 38.5628148f, 38.2914367f, 38.031089f, 37.7837431f, 37.5527221f,
+    37.3425119f, 37.1584431f, 37.0062592f, 36.8916008f, 36.8194521f, 36.793604f, 36.8161927f, 36.8873715f,
+    37.0051618f, 37.1655177f, 37.3626165f, 37.5893642f, 37.8380825f, 38.1013203f, 38.3727109f, 38.6477865f,
+    38.9246547f, 39.2044453f, 39.491454f, 39.7929333f, 40.118518f, 40.4793164f, 40.8867439f, 41.3512247f,
+    41.8809246f, 42.4807062f, 43.1515039f, 43.8902945f, 44.690786f, 45.5448554f, 46.4446366f, 47.3849971f,
+    48.3659554f, 49.394401f, 50.4843215f, 51.6546532f, 52.9239353f, 54.3012346f, 55.7734537f, 57.2902747f,
+    58.7498365f, 59.9910169f, 60.8022062f, 60.9620689f, 60.3354412f, 59.0577286f, 57.8545782f, 58.5609546f,
+    64.9259061f, 83.8173159f, 126.975952f, 213.511564f, 373.387207f, 652.203196f, 1117.67129f, 1868.2651f,
+    3044.6472f, 4844.60999f, 7542.42921f, 11513.7208f,
+    // under_y = 27
+    548.288106f, 689.329022f, 693.906382f, 627.119824f, 530.226636f, 427.955352f, 333.885049f, 254.335586f,
+    191.124863f, 143.475429f, 109.292182f, 85.9835033f, 70.9581275f, 61.897943f, 56.8813755f, 54.411911f,
+    53.3907025f, 53.0602391f, 52.9370409f, 52.7446824f, 52.3536456f, 51.7311555f, 50.9019062f, 49.919179f,
+    48.8450562f, 47.7380672f, 46.6465336f, 45.6059957f, 44.6393235f, 43.7583863f, 42.9664346f, 42.2606012f,
+    41.6341555f, 41.0783198f, 40.5835914f, 40.1406051f, 39.7406213f, 39.3757511f, 39.0390248f, 38.7243965f,
+    38.4267511f, 38.1419495f, 37.8669207f, 37.5997893f, 37.3400048f, 37.0884377f, 36.847402f, 36.6205734f,
+    36.4127848f, 36.229694f, 36.0773405f, 35.9616206f, 35.8877272f, 35.8596084f, 35.879504f, 35.9476152f,
+    36.0619566f, 36.2184201f, 36.4110663f, 36.6326313f, 36.8752147f, 37.1310935f, 37.3935833f, 37.657859f,
+    37.9216395f, 38.1856471f, 38.4537656f, 38.7328492f, 39.0321673f, 39.3625155f, 39.7350659f, 40.1600808f,
+    40.6456494f, 41.1966361f, 41.8140341f, 42.4949027f, 43.2330096f, 44.0202156f, 44.848514f, 45.7124771f,
+    46.6116873f, 47.5525445f, 48.5486942f, 49.6192433f, 50.7839976f, 52.0552534f, 53.4263162f, 54.858062f,
+    56.2666829f, 57.5185094f, 58.4417716f, 58.8707083f, 58.7449837f, 58.2974596f, 58.3765977f, 60.9668796f,
+    69.9924843f, 92.5170621f, 140.486966f, 233.208098f, 400.799164f, 688.92843f, 1165.21902f, 1927.80185f,
+    3116.60804f, 4928.12708f, 7634.51665f, 11608.1388f,
+    // under_y = 28
+    477.660368f, 627.030784f, 640.926331f, 583.349186f, 494.921314f, 400.052742f, 312.213431f, 237.745553f,
+    178.565395f, 134.031766f, 102.198293f, 80.6185255f, 66.8334947f, 58.6398828f, 54.2119157f, 52.1303913f,
+    51.3569604f, 51.180055f, 51.1500315f, 51.0145734f, 50.6607074f, 50.0665047f, 49.263353f, 48.3083074f,
+    47.2652533f, 46.1932574f, 45.1404168f, 44.1416302f, 43.2189343f, 42.3833117f, 41.6371512f, 40.9767896f,
+    40.3947828f, 39.8817279f, 39.427586f, 39.0225435f, 38.6575002f, 38.3242953f, 38.0157765f, 37.7258048f,
+    37.4492597f, 37.1820803f, 36.9213513f, 36.6654197f, 36.4140131f, 36.1683213f, 35.9310046f, 35.7060966f,
+    35.4987852f, 35.3150677f, 35.1612957f, 35.0436411f, 34.9675279f, 34.9370855f, 34.9546806f, 35.020584f,
+    35.1328196f, 35.2872274f, 35.4777529f, 35.6969535f, 35.9366873f, 36.1889285f, 36.4466327f, 36.7045654f,
+    36.9599967f, 37.213175f, 37.4675043f, 37.7293738f, 38.007627f, 38.3126952f, 38.6554705f, 39.046034f,
+    39.4923989f, 39.9994531f, 40.568292f, 41.1961184f, 41.8768336f, 42.6023608f, 43.364623f, 44.1579438f,
+    44.9814702f, 45.8410412f, 46.7497857f, 47.7266635f, 48.7922416f, 49.9612976f, 51.2324871f, 52.5764501f,
+    53.9255405f, 55.1710914f, 56.1780532f, 56.8323203f, 57.1435198f, 57.435987f, 58.6737005f, 62.9818197f,
+    74.4490116f, 100.321948f, 152.737372f, 251.179298f, 425.900758f, 722.612833f, 1208.82051f, 1982.2775f,
+    3182.14322f, 5003.55751f, 7716.50595f, 11690.0343f,
+    // under_y = 29
+    405.726832f, 564.324641f, 588.126113f, 540.121064f, 460.361009f, 372.986436f, 291.394733f, 221.977277f,
+    166.768204f, 125.276368f, 95.7136156f, 75.7849439f, 63.167591f, 55.7752297f, 51.8788677f, 50.1367623f,
+    49.5706623f, 49.5142084f, 49.5506791f, 49.4508858f, 49.1174273f, 48.5383091f, 47.7507926f, 46.8149962f,
+    45.7960135f, 44.7529678f, 43.7333584f, 42.7711667f, 41.887405f, 41.0920502f, 40.3865686f, 39.7664852f,
+    39.2236601f, 38.7481055f, 38.3292992f, 37.9570378f, 37.6219189f, 37.3155621f, 37.0306771f, 36.7610661f,
+    36.5016276f, 36.2483932f, 35.9986084f, 35.7508416f, 35.505092f, 35.2628603f, 35.0271436f, 34.802326f,
+    34.593946f, 34.40834f, 34.2521763f, 34.1319114f, 34.0532145f, 34.0204129f, 34.0360189f, 34.1003918f,
+    34.2115822f, 34.3653917f, 34.5556591f, 34.7747642f, 35.0143167f, 35.2659722f, 35.5223022f, 35.7776297f,
+    36.0287367f, 36.2753536f, 36.5203579f, 36.7696285f, 37.0315417f, 37.3161323f, 37.6339911f, 37.9950121f,
+    38.4071445f, 38.8753304f, 39.4008168f, 39.9810171f, 40.6100452f, 41.2799714f, 41.9827272f, 42.7124457f,
+    43.467857f, 44.2541923f, 45.0839202f, 45.9755747f, 46.9500228f, 48.0238231f, 49.1999753f, 50.4574889f,
+    51.743002f, 52.9703762f, 54.0380768f, 54.8795587f, 55.5692407f, 56.5164648f, 58.7927049f, 64.6539211f,
+    78.3411812f, 107.269469f, 163.74811f, 267.417768f, 448.640048f, 753.13808f, 1248.2621f, 2031.34521f,
+    3240.7239f, 5070.12815f, 7787.30088f, 11757.8894f,
+    // under_y = 30
+    333.575606f, 502.046623f, 536.142347f, 497.915388f, 426.903419f, 347.019521f, 271.619426f, 207.166007f,
+    155.826965f, 117.271957f, 89.8781062f, 71.5061961f, 59.9720516f, 53.307331f, 49.8798734f, 48.4248283f,
+    48.023101f, 48.0524019f, 48.1277213f, 48.0418025f, 47.711694f, 47.1343214f, 46.3519329f, 45.4269583f,
+    44.4250812f, 43.4049897f, 42.4132091f, 41.4825294f, 40.6327524f, 39.8727356f, 39.2029676f, 38.6181509f,
+    38.1094717f, 37.6663999f, 37.2779851f, 36.9336929f, 36.6238751f, 36.3399827f, 36.0746279f, 35.8215844f,
+    35.5757876f, 35.333369f, 35.0917324f, 34.849657f, 34.6073982f, 34.3667479f, 34.1310203f, 33.9049308f,
+    33.6943528f, 33.5059504f, 33.3467027f, 33.223351f, 33.1418144f, 33.1066289f, 33.1204668f, 33.1837925f,
+    33.294701f, 33.4489722f, 33.6403518f, 33.8610526f, 34.1024397f, 34.3558485f, 34.6134576f, 34.8691328f,
+    35.1191468f, 35.3626876f, 35.6020791f, 35.8426633f, 36.0923261f, 36.3606892f, 36.6580352f, 36.9940766f,
+    37.3767194f, 37.8109974f, 38.298364f, 38.836513f, 39.419854f, 40.0406929f, 40.6910555f, 41.3649538f,
+    42.0607358f, 42.7830025f, 43.5434512f, 44.3599533f, 45.2532662f, 46.2410888f, 47.3298208f, 48.5055087f,
+    49.727248f, 50.9289807f, 52.0394655f, 53.0355406f, 54.0510641f, 55.5735962f, 58.7735736f, 66.0271129f,
+    81.7144947f, 113.402777f, 173.553985f, 281.941219f, 469.005312f, 780.446047f, 1283.41641f, 2074.77814f,
+    3291.98434f, 5127.28359f, 7846.0918f, 11810.5588f,
+    // under_y = 31
+    262.113837f, 440.882342f, 485.486861f, 457.108738f, 394.820781f, 322.344513f, 253.019773f, 193.399019f,
+    145.795838f, 110.048709f, 84.7049094f, 67.7836224f, 57.2402843f, 51.2244831f, 48.200133f, 46.9780986f,
+    46.6970456f, 46.7772826f, 46.8640626f, 46.7707005f, 46.42746f, 45.8391018f, 45.0519325f, 44.1299196f,
+    43.1387107f, 42.1360683f, 41.1671734f, 40.2633595f, 39.4430414f, 38.7138526f, 38.0752571f, 37.5211313f,
+    37.0420144f, 36.6268807f, 36.2644083f, 35.9437917f, 35.6551934f, 35.3899442f, 35.1405972f, 34.9009235f,
+    34.665909f, 34.4317863f, 34.1961088f, 33.9578488f, 33.7174931f, 33.4770973f, 33.240263f, 33.0120085f,
+    32.7985165f, 32.6067581f, 32.4440081f, 32.3172838f, 32.2327529f, 32.1951645f, 32.207361f, 32.2699266f,
+    32.3810185f, 32.5364139f, 32.7297847f, 32.9531935f, 33.1977755f, 33.4545555f, 33.7153248f, 33.973492f,
+    34.2248168f, 34.4679367f, 34.704612f, 34.9396376f, 35.1804013f, 35.4361083f, 35.7167377f, 36.0318354f,
+    36.3892914f, 36.7942734f, 37.2484982f, 37.7500118f, 38.2936028f, 38.8719039f, 39.4771255f, 40.1032369f,
+    40.7482542f, 41.4161481f, 42.1177671f, 42.8701275f, 43.6935225f, 44.606217f, 45.617143f, 46.7181322f,
+    47.8789899f, 49.0513587f, 50.1911115f, 51.3142883f, 52.6087588f, 54.6333334f, 58.6485498f, 67.1395062f,
+    84.6117106f, 118.76691f, 182.198357f, 294.785218f, 487.015357f, 804.526101f, 1314.22594f, 2112.44839f,
+    3335.69526f, 5174.65274f, 7892.31385f, 11847.2179f,
+    // under_y = 32
+    192.078257f, 381.37622f, 436.554777f, 417.981444f, 364.306129f, 299.088884f, 235.674721f, 180.719971f,
+    136.693351f, 103.607738f, 80.1834965f, 64.5993021f, 54.9500438f, 49.5022769f, 46.8145494f, 45.7717536f,
+    45.5685486f, 45.6661055f, 45.7383099f, 45.6175668f, 45.2460481f, 44.6352229f, 43.8345096f, 42.9086376f,
+    41.9225994f, 40.9327533f, 39.9825815f, 39.1017109f, 38.3070068f, 37.6047877f, 36.9934565f, 36.4660685f,
+    36.0125492f, 35.6214289f, 35.281074f, 34.9804689f, 34.7096433f, 34.4598557f, 34.2236364f, 33.9947767f,
+    33.7683229f, 33.5406063f, 33.3093149f, 33.0735906f, 32.8341213f, 32.5931909f, 32.3546514f, 32.1237875f,
+    31.9070579f, 31.7117117f, 31.5452968f, 31.4150909f, 31.3275022f, 31.2874925f, 31.2980807f, 31.3599836f,
+    31.4714379f, 31.6282392f, 31.8240088f, 32.0506822f, 32.2991873f, 32.5602587f, 32.825317f, 33.0873276f,
+    33.3415465f, 33.5860673f, 33.8220915f, 34.0538702f, 34.2882974f, 34.5341699f, 34.8011762f, 35.0987171f,
+    35.4346986f, 35.8144658f, 36.2400561f, 36.7099381f, 37.219362f, 37.7613775f, 38.3284723f, 38.9146577f,
+    39.5176809f, 40.1409044f, 40.7942813f, 41.4938241f, 42.2590651f, 43.108332f, 44.052306f, 45.0874477f,
+    46.1926266f, 47.3349068f, 48.4941847f, 49.721583f, 51.2535688f, 53.7131728f, 58.4420006f, 68.0226316f,
+    87.0712805f, 123.406188f, 189.729191f, 305.997533f, 502.711715f, 825.404601f, 1340.68915f, 2144.30906f,
+    3371.74073f, 5212.01947f, 7925.61016f, 11867.317f,
+    // under_y = 33
+    124.04826f, 323.942901f, 389.634478f, 380.726305f, 335.480923f, 277.321757f, 219.615796f, 169.134088f,
+    128.506987f, 97.9251576f, 76.2832771f, 61.9192729f, 53.0663103f, 48.1061796f, 45.6900491f, 44.7747374f,
+    44.6088362f, 44.6924442f, 44.7263202f, 44.560402f, 44.1474222f, 43.504419f, 42.6829801f, 41.7478356f,
+    40.7627244f, 39.7821454f, 38.8475497f, 37.9866291f, 37.214556f, 36.5362581f, 35.9490545f, 35.4451944f,
+    35.0140306f, 34.6437062f, 34.3223394f, 34.0387676f, 33.7829451f, 33.5461055f, 33.3207913f, 33.1008357f,
+    32.8813524f, 32.658765f, 32.4308787f, 32.1969768f, 31.9579127f, 31.7161582f, 31.4757728f, 31.2422654f,
+    31.0223306f, 30.8234603f, 30.6534466f, 30.5198063f, 30.4291748f, 30.3867215f, 30.3956453f, 30.4568061f,
+    30.5685374f, 30.7266756f, 30.9248171f, 31.1547992f, 31.407371f, 31.6730053f, 31.9427792f, 32.2092386f,
+    32.4671575f, 32.714104f, 32.9507362f, 33.1807762f, 33.4106385f, 33.6487271f, 33.9044595f, 34.1871167f,
+    34.5046537f, 34.8626363f, 35.2634771f, 35.7061343f, 36.1863976f, 36.6978215f, 37.2332631f, 37.7868642f,
+    38.3561765f, 38.9439945f, 39.5593596f, 40.217174f, 40.93597f, 41.7337083f, 42.622126f, 43.6012616f,
+    44.6575214f, 45.7712376f, 46.943366f, 48.2561068f, 49.9891979f, 52.8228984f, 58.1708103f, 68.7013431f,
+    89.12659f, 127.362572f, 196.19627f, 315.633861f, 516.152481f, 843.13635f, 1362.84901f, 2170.37894f,
+    3400.09837f, 5239.29722f, 7945.79947f, 11870.5405f,
+    // under_y = 34
+    58.4608005f, 268.880221f, 344.918909f, 345.458429f, 308.403636f, 257.061398f, 204.833639f, 158.613893f,
+    121.198202f, 92.95649f, 72.9574738f, 59.696947f, 51.5443075f, 46.9942056f, 44.787952f, 43.9518627f,
+    43.7861811f, 43.8278586f, 43.8026874f, 43.576543f, 43.1113642f, 42.4286309f, 41.5811818f, 40.6330167f,
+    39.6460554f, 38.6725144f, 37.7515111f, 36.9086005f, 36.1571409f, 35.5006129f, 34.9352428f, 34.4525006f,
+    34.0412165f, 33.6892088f, 33.3844151f, 33.1155918f, 32.8726761f, 32.6469247f, 32.430927f, 32.2185782f,
+    32.0050655f, 31.786897f, 31.5619744f, 31.329692f, 31.0910297f, 30.8486032f, 30.606633f, 30.3708049f,
+    30.1480051f, 29.9459284f, 29.772577f, 29.6356811f, 29.5420855f, 29.4971589f, 29.5042805f, 29.564462f,
+    29.6761506f, 29.8352461f, 30.0353488f, 30.2682291f, 30.5244918f, 30.7943829f, 31.06867f, 31.3395123f,
+    31.6012322f, 31.8508996f, 32.0886543f, 32.3177121f, 32.5440288f, 32.7756371f, 33.0217067f, 33.2914248f,
+    33.5928281f, 33.9317432f, 34.3110077f, 34.7301297f, 35.1855106f, 35.6712916f, 36.1807878f, 36.7083614f,
+    37.2514488f, 37.8123327f, 38.3991531f, 39.0256362f, 39.70913f, 40.4668722f, 41.3110547f, 42.244354f,
+    43.2593147f, 44.3475285f, 45.5282004f, 46.9107594f, 48.8130336f, 51.9656393f, 57.8451762f, 69.1942301f,
+    90.805833f, 130.674805f, 201.649362f, 323.754722f, 527.407565f, 857.797753f, 1380.78343f, 2190.72979f,
+    3420.82247f, 5256.50699f, 7952.84807f, 11856.7716f,
+    // under_y = 35
+    -4.37353273f, 216.383169f, 302.517688f, 312.22575f, 283.078872f, 238.283133f, 191.284891f, 149.105181f,
+    114.707626f, 88.6411911f, 70.1470694f, 57.8765559f, 50.3325123f, 46.1195504f, 44.0662773f, 43.2658317f,
+    43.0676742f, 43.0434479f, 42.9421025f, 42.6438539f, 42.1185131f, 41.3909092f, 40.514255f, 39.5511338f,
+    38.5611238f, 37.5937762f, 36.6856083f, 35.8598666f, 35.1280007f, 34.4920073f, 33.9470286f, 33.483794f,
+    33.0906701f, 32.7552196f, 32.4652718f, 32.2095701f, 31.9780952f, 31.7621755f, 31.5544824f, 31.3489933f,
+    31.1409742f, 30.9270089f, 30.7050743f, 30.4746436f, 30.2367831f, 29.9942062f, 29.7512449f, 29.5137126f,
+    29.2886393f, 29.0838793f, 28.9076082f, 28.7677394f, 28.6713067f, 28.6238665f, 28.6289762f, 28.6878068f,
+    28.7989342f, 28.9583457f, 29.1596743f, 29.3946585f, 29.6537962f, 29.9271464f, 30.2052068f, 30.4797892f,
+    30.7448012f, 30.996849f, 31.2355853f, 31.4637475f, 31.6868591f, 31.9126051f, 32.1499315f, 32.4079577f,
+    32.6948306f, 33.0166727f, 33.376789f, 33.7752902f, 34.2092524f, 34.6734773f, 35.161821f, 35.6689537f,
+    36.1922813f, 36.7336434f, 37.3003124f, 37.9048085f, 38.5631656f, 39.291613f, 40.1022879f, 40.9996787f,
+    41.9812055f, 43.0478672f, 44.2344829f, 45.6740496f, 47.7174979f, 51.1391168f, 57.4696693f, 69.5143867f,
+    92.132352f, 133.378155f, 206.137143f, 330.423297f, 536.555114f, 869.481418f, 1394.59762f, 2205.47564f,
+    3434.02969f, 5263.75863f, 7946.84538f, 11826.0604f,
+    // under_y = 36
+    -64.2538557f, 166.558304f, 262.469578f, 281.019807f, 259.466689f, 220.927398f, 178.899134f, 140.533016f,
+    108.960235f, 84.9071206f, 67.7846664f, 56.3964842f, 49.3755361f, 45.4330797f, 43.4818947f, 42.6790954f,
+    42.4208297f, 42.3112345f, 42.1205434f, 41.741745f, 41.1512342f, 40.3761503f, 39.469261f, 38.491102f,
+    37.4984397f, 36.5378239f, 35.6429455f, 34.8346055f, 34.1222772f, 33.50646f, 32.9812368f, 32.5366485f,
+    32.160666f, 31.8406726f, 31.5644655f, 31.3208467f, 31.0999027f, 30.893083f, 30.6931768f, 30.4942645f,
+    30.2916967f, 30.0821243f, 29.8635783f, 29.6355785f, 29.3992371f, 29.1573183f, 28.9142158f, 28.6758195f,
+    28.449254f, 28.2424878f, 28.0638304f, 27.9213468f, 27.8222365f, 27.7722296f, 27.7750578f, 27.8320568f,
+    27.9419464f, 28.1008237f, 28.3023851f, 28.5383725f, 28.7992175f, 29.0748341f, 29.3554944f, 29.6327058f,
+    29.9000026f, 30.1535661f, 30.3925975f, 30.6193873f, 30.8390544f, 31.0589616f, 31.2878535f, 31.5348041f,
+    31.8080949f, 32.1141716f, 32.4568404f, 32.8368564f, 33.2520228f, 33.6978656f, 34.1688569f, 34.6600578f,
+    35.1689295f, 35.6969461f, 36.2505657f, 36.8411066f, 37.4832064f, 38.1918694f, 38.978758f, 39.8494591f,
+    40.8051437f, 41.8545295f, 43.0456027f, 44.5314782f, 46.6914304f, 50.3369752f, 57.0444438f, 69.6704061f,
+    93.1253006f, 135.504592f, 209.7067f, 335.704023f, 543.678896f, 878.291968f, 1404.41784f, 2214.76406f,
+    3439.88709f, 5261.23476f, 7927.98304f, 11778.5975f,
+    // under_y = 37
+    -121.072261f, 119.438185f, 224.754923f, 251.786443f, 237.491785f, 204.907625f, 167.585667f, 132.807538f,
+    103.870329f, 81.6747958f, 65.7981249f, 55.1923782f, 48.6167778f, 44.8855922f, 42.9924518f, 42.1554901f,
+    41.814972f, 41.605335f, 41.3162598f, 40.8519957f, 40.1942996f, 39.3716531f, 38.4356281f, 37.4441477f,
+    36.4507548f, 35.4987133f, 34.6187057f, 33.8289867f, 33.1370152f, 32.5418023f, 32.0364142f, 31.6102681f,
+    31.2510167f, 30.9459461f, 30.6829021f, 30.4508194f, 30.239954f, 30.0419281f, 29.8496852f, 29.6574302f,
+    29.460605f, 29.2559202f, 29.0414407f, 28.8167018f, 28.5828218f, 28.3425699f, 28.1003516f, 27.8620827f,
+    27.6349327f, 27.4269385f, 27.2465028f, 27.1018092f, 27.0001977f, 26.947557f, 26.9477873f, 27.0023931f,
+    27.1102516f, 27.2675921f, 27.4682042f, 27.7038698f, 27.9649947f, 28.2413928f, 28.5231562f, 28.8015336f,
+    29.0697305f, 29.3235446f, 29.5617626f, 29.7862613f, 30.0017833f, 30.2153925f, 30.4356525f, 30.6716096f,
+    30.9316966f, 31.2227012f, 31.5489541f, 31.911885f, 32.3100644f, 32.7397939f, 33.1962262f, 33.6748895f,
+    34.1733842f, 34.6929027f, 35.2391574f, 35.8222975f, 36.4555269f, 37.1524713f, 37.9239837f, 38.7761461f,
+    39.7128931f, 40.7491388f, 41.9437861f, 43.4668438f, 45.7214256f, 49.5501072f, 56.5664909f, 69.667486f,
+    93.8004971f, 137.083257f, 212.403458f, 339.661749f, 548.866435f, 884.342826f, 1410.38643f, 2218.76897f,
+    3438.60205f, 5249.17721f, 7896.53685f, 11714.6906f,
+    // under_y = 38
+    -174.797462f, 74.9954279f, 189.307695f, 224.436119f, 217.05232f, 190.117775f, 157.23991f, 125.829406f,
+    99.346148f, 78.8613091f, 64.1138748f, 54.1999405f, 48.0007763f, 44.4297941f, 42.558024f, 41.6616129f,
+    41.222375f, 40.9028973f, 40.5105357f, 39.9593671f, 39.2353723f, 38.3674904f, 37.4054267f, 36.4039984f,
+    35.4131782f, 34.4727138f, 33.610144f, 32.8411135f, 32.171059f, 31.5975351f, 31.1126512f, 30.7052781f,
+    30.3628364f, 30.0726028f, 29.8225561f, 29.6018404f, 29.4009466f, 29.2117219f, 29.0273017f, 28.8420385f,
+    28.6514731f, 28.4523703f, 28.2428102f, 28.0223148f, 27.7919705f, 27.5545071f, 27.3142943f, 27.0772236f,
+    26.8504612f, 26.6420666f, 26.4604954f, 26.3140155f, 26.2100825f, 26.1547266f, 26.1520096f, 26.2036078f,
+    26.3085679f, 26.4632728f, 26.6616343f, 26.8955101f, 27.1553218f, 27.4308274f, 27.7119857f, 27.9898338f,
+    28.257293f, 28.5098196f, 28.745824f, 28.9668016f, 29.1771454f, 29.3836414f, 29.5946878f, 29.8193146f,
+    30.0661148f, 30.3422273f, 30.6525185f, 30.9991101f, 31.381366f, 31.7964023f, 32.240104f, 32.708534f,
+    33.1995111f, 33.7140322f, 34.2571451f, 34.8378864f, 35.4680284f, 36.159723f, 36.9227585f, 37.7632141f,
+    38.6869342f, 39.7136721f, 40.911196f, 42.4634197f, 44.7930627f, 48.7679022f, 56.0308564f, 69.5085494f,
+    94.1713619f, 138.141108f, 214.27137f, 342.361312f, 552.207729f, 887.753786f, 1412.65791f, 2217.68472f,
+    3430.41401f, 5227.8756f, 7852.85149f, 11634.7436f,
+    // under_y = 39
+    -225.459178f, 33.1560519f, 156.026889f, 198.853613f, 198.028149f, 176.439302f, 147.749296f, 119.494763f,
+    95.2940459f, 76.3838164f, 62.6598257f, 53.3573474f, 47.4752098f, 44.0219427f, 42.1424589f, 41.1679093f,
+    40.6191336f, 40.1847884f, 39.6882222f, 39.0520025f, 38.2652937f, 37.3567012f, 36.3734793f, 35.3669234f,
+    34.3831557f, 33.4582362f, 32.6164702f, 31.8708674f, 31.2248636f, 30.6746116f, 30.2113402f, 29.8234623f,
+    29.4982603f, 29.2230945f, 28.9861641f, 28.7769006f, 28.5860964f, 28.4058767f, 28.2296078f, 28.0518133f,
+    27.8681431f, 27.6754119f, 27.4716992f, 27.2564869f, 27.0307944f, 26.7972709f, 26.5602041f, 26.3254147f,
+    26.100018f, 25.8920521f, 25.7099857f, 25.562138f, 25.4560538f, 25.3978879f, 25.3918558f, 25.439807f,
+    25.5409687f, 25.6918974f, 25.8866549f, 26.1172096f, 26.3740388f, 26.6468891f, 26.9256319f, 27.2011387f,
+    27.4660919f, 27.7156478f, 27.9478769f, 28.1639241f, 28.3678567f, 28.5662f, 28.7671969f, 28.9798653f,
+    29.212959f, 29.4739656f, 29.7682868f, 30.0987398f, 30.4654938f, 30.8665032f, 31.2984247f, 31.7579119f,
+    32.243075f, 32.7548008f, 33.2975622f, 33.8793589f, 34.5105687f, 35.2018253f, 35.9616713f, 36.7957837f,
+    37.7111907f, 38.7312885f, 39.9308571f, 41.5049642f, 43.8919838f, 47.9793632f, 55.4317577f, 69.1953065f,
+    94.2498508f, 138.70362f, 215.35328f, 343.867379f, 553.79438f, 888.649177f, 1411.39584f, 2211.72136f,
+    3415.58745f, 5197.65762f, 7797.32736f, 11539.2399f,
+    // under_y = 40
+    -273.133555f, -6.18811847f, 124.787034f, 174.906908f, 180.288306f, 163.747444f, 138.998527f, 113.699616f,
+    91.6221162f, 74.1625314f, 61.3678225f, 52.6072495f, 46.9925111f, 43.623139f, 41.7143953f, 40.6494653f,
+    39.9857645f, 39.436036f, 38.8380451f, 38.1216239f, 37.2781873f, 36.3353162f, 35.3373206f, 34.3316387f,
+    33.3603312f, 32.4556548f, 31.63864f, 30.919673f, 30.3002387f, 29.7751636f, 29.3348874f, 28.9674641f,
+    28.6601379f, 28.4004496f, 28.176908f, 27.979311f, 27.7988196f, 27.6278903f, 27.4601592f, 27.2903464f,
+    27.114222f, 26.928649f, 26.7316929f, 26.5227718f, 26.3028066f, 26.0743276f, 25.8414983f, 25.6100238f,
+    25.3869248f, 25.1801755f, 24.9982198f, 24.8493955f, 24.7413113f, 24.6802292f, 24.6705098f, 24.7141761f,
+    24.8106458f, 24.9566668f, 25.1464775f, 25.3721898f, 25.6243755f, 25.8928122f, 26.1673285f, 26.4386755f,
+    26.6993394f, 26.9442163f, 27.1710716f, 27.3807275f, 27.576946f, 27.7660037f, 27.9559926f, 28.1559149f,
+    28.3746759f, 28.6200996f, 28.8981091f, 29.2122071f, 29.5633651f, 29.9503848f, 30.3707197f, 30.8216578f,
+    31.3016652f, 31.8116014f, 32.3554582f, 32.94029f, 33.5751449f, 34.2691409f, 35.0294599f, 35.8610682f,
+    36.7715724f, 37.7869696f, 38.9873907f, 40.5765432f, 43.0047894f, 47.1740552f, 54.7635529f, 68.7291998f,
+    94.0473156f, 138.795487f, 215.691343f, 344.244461f, 553.719017f, 887.156479f, 1406.77037f, 2201.10069f,
+    3394.4062f, 5158.88094f, 7730.40948f, 11428.7274f,
+    // under_y = 41
+    -317.929858f, -43.1682049f, 95.4476657f, 152.45513f, 163.697639f, 151.916729f, 130.874126f, 108.343567f,
+    88.2432415f, 72.1231913f, 60.1756211f, 51.8983354f, 46.5110889f, 43.2002618f, 41.2479609f, 40.086508f,
+    39.3075448f, 38.646033f, 37.9527009f, 37.1635386f, 36.2713925f, 35.3022334f, 34.2970267f, 33.2990989f,
+    32.3463066f, 31.4670456f, 30.6790745f, 29.9902037f, 29.4000438f, 28.9021903f, 28.486398f, 28.1404697f,
+    27.8517169f, 27.6079593f, 27.3981057f, 27.2123992f, 27.0424356f, 26.8810555f, 26.7222046f, 26.5608251f,
+    26.3928199f, 26.2151007f, 26.0257086f, 25.8239779f, 25.6107025f, 25.3882595f, 25.16065f, 24.9334226f,
+    24.7134623f, 24.5086403f, 24.3273394f, 24.1778853f, 24.0679259f, 24.0038132f, 23.9900435f, 24.0288135f,
+    24.1197389f, 24.2597761f, 24.4433638f, 24.6627888f, 24.9087536f, 25.1711068f, 25.439677f, 25.7051369f,
+    25.9598179f, 26.1983928f, 26.4183531f, 26.6202231f, 26.8074756f, 26.9861453f, 27.1641707f, 27.3505276f,
+    27.5542542f, 27.7834868f, 28.0446446f, 28.3418914f, 28.6769839f, 29.0495648f, 29.4578946f, 29.8999268f,
+    30.3745377f, 30.882637f, 31.4278308f, 32.0163309f, 32.6559442f, 33.3543143f, 34.1172061f, 34.9486502f,
+    35.8563374f, 36.8679695f, 38.0675529f, 39.6651521f, 42.119736f, 46.3428623f, 54.0215326f, 68.1121959f,
+    93.5752444f, 138.44124f, 215.327437f, 343.557001f, 552.074911f, 883.405265f, 1398.95624f, 2186.0531f,
+    3367.16863f, 5111.92638f, 7652.57807f, 11303.8054f,
+    // under_y = 42
+    -359.97858f, -77.9283071f, 67.861643f, 131.355453f, 148.122501f, 140.825642f, 123.268231f, 103.332881f,
+    85.0775344f, 70.1989789f, 59.0283769f, 51.1864609f, 45.9961588f, 42.7265546f, 40.7231584f, 39.464629f,
+    38.5746041f, 37.8085256f, 37.0287608f, 36.1764778f, 35.2452529f, 34.2589668f, 33.2549338f, 32.2721945f,
+    31.3443261f, 30.4958594f, 29.7413284f, 29.086048f, 28.5278558f, 28.0592283f, 27.6693515f, 27.345891f,
+    27.0763334f, 26.8488778f, 26.6529215f, 26.4792308f, 26.3199006f, 26.168208f, 26.0184465f, 25.8658065f,
+    25.7063377f, 25.5370031f, 25.3558113f, 25.1619963f, 24.9562007f, 24.7406184f, 24.5190535f, 24.2968616f,
+    24.0807548f, 23.8784648f, 23.6982804f, 23.5484859f, 23.436745f, 23.3694828f, 23.3513227f, 23.3846329f,
+    23.4692345f, 23.6023067f, 23.7785107f, 23.9903364f, 24.2286508f, 24.4834113f, 24.7444856f, 25.0025078f,
+    25.2496922f, 25.4805222f, 25.6922438f, 25.8851035f, 26.0622964f, 26.2296172f, 26.3948417f, 26.566901f,
+    26.7549383f, 26.9673684f, 27.2110687f, 27.4908274f, 27.8091542f, 28.1665123f, 28.5619649f, 28.9941485f,
+    29.462393f, 29.9677281f, 30.5134689f, 31.1050941f, 31.7492766f, 32.4522595f, 33.218386f, 34.0505995f,
+    34.9562833f, 35.9640832f, 37.1605817f, 38.7601405f, 41.2272326f, 45.4785443f, 53.2025194f, 67.3473986f,
+    92.84585f, 137.665754f, 214.303516f, 341.869465f, 548.955679f, 877.526359f, 1388.13119f, 2166.81494f,
+    3334.18367f, 5057.19215f, 7564.34052f, 11165.1143f,
+    // under_y = 43
+    -399.42108f, -110.616898f, 41.882252f, 111.468922f, 133.435484f, 130.360437f, 116.081633f, 98.5828603f,
+    82.0541756f, 68.3319086f, 57.8796588f, 50.4353573f, 45.4202027f, 42.1818844f, 40.1259642f, 38.7747565f,
+    37.7817978f, 36.9214093f, 36.0664096f, 35.1622932f, 34.2027825f, 33.2092934f, 32.215274f, 31.2553819f,
+    30.3589039f, 29.5465538f, 28.8297279f, 28.2113561f, 27.687626f, 27.2500216f, 26.8872845f, 26.5870614f,
+    26.3371239f, 26.1261487f, 25.944109f, 25.7823686f, 25.6335841f, 25.4915181f, 25.3508498f, 25.2070435f,
+    25.05631f, 24.8956677f, 24.7230881f, 24.5376911f, 24.3399478f, 24.1318432f, 23.9169543f, 23.7004116f,
+    23.4887206f, 23.2894414f, 23.1107382f, 22.9608269f, 22.8473654f, 22.7768361f, 22.7539795f, 22.7813338f,
+    22.8589306f, 22.9841845f, 23.1519992f, 23.3550931f, 23.5845285f, 23.8304058f, 24.082668f, 24.3319475f,
+    24.5703754f, 24.7922762f, 24.9946748f, 25.1775563f, 25.343845f, 25.4990917f, 25.6508954f, 25.8081157f,
+    25.9799657f, 26.1750949f, 26.4007903f, 26.6624149f, 26.9631869f, 27.3043549f, 27.6857667f, 28.1067457f,
+    28.5671065f, 29.068061f, 29.6127239f, 30.2059541f, 30.8534106f, 31.5600372f, 32.328794f, 33.1614512f,
+    34.0647845f, 35.0677476f, 36.2583642f, 37.8534468f, 40.3201401f, 44.5760952f, 52.3052706f, 66.4394762f,
+    91.8724894f, 136.494617f, 212.661863f, 339.246403f, 544.455041f, 869.651139f, 1374.47466f, 2143.62634f,
+    3295.76749f, 4995.08904f, 7466.22462f, 11013.3257f,
+    // under_y = 44
+    -436.400802f, -141.379612f, 17.3690715f, 92.6651795f, 119.519184f, 120.418094f, 109.226052f, 94.0195717f,
+    79.1126694f, 66.4737025f, 56.6920157f, 49.6169494f, 44.7630892f, 41.5527057f, 39.4481714f, 38.0129065f,
+    36.9283902f, 35.9863644f, 35.0690489f, 34.1255404f, 33.1492394f, 32.1588245f, 31.1837499f, 30.2542674f,
+    29.3954213f, 28.6242045f, 27.9489987f, 27.370486f, 26.8833449f, 26.4782049f, 26.1434942f, 25.8669604f,
+    25.6367687f, 25.4421695f, 25.273795f, 25.123677f, 24.9850918f, 24.8523346f, 24.7205051f, 24.5853662f,
+    24.4433046f, 24.2913999f, 24.1275831f, 23.9508503f, 23.7614848f, 23.5612407f, 23.353443f, 23.1429686f,
+    22.9360878f, 22.7401602f, 22.5631978f, 22.4133246f, 22.2981718f, 22.2242641f, 22.1964501f, 22.2174351f,
+    22.2874652f, 22.4042013f, 22.5628062f, 22.7562502f, 22.9758183f, 23.2117847f, 23.4542009f, 23.6937299f,
+    23.9224508f, 24.1345559f, 24.3268693f, 24.4991276f, 24.6539867f, 24.7967452f, 24.9348045f, 25.0769215f,
+    25.2323353f, 25.4098782f, 25.6171885f, 25.8601442f, 26.1426145f, 26.4665859f, 26.8326588f, 27.2408347f,
+    27.6914325f, 28.1858979f, 28.7272308f, 29.3197839f, 29.9683319f, 30.6766407f, 31.4463623f, 32.2780637f,
+    33.1776944f, 34.1739933f, 35.3554433f, 36.9396611f, 39.3938904f, 43.632914f, 51.3306938f, 65.3949058f,
+    90.6699128f, 134.954346f, 210.445227f, 335.752439f, 538.666568f, 859.910933f, 1358.16663f, 2116.72938f,
+    3252.24072f, 4926.03633f, 7358.77282f, 10849.1351f,
+    // under_y = 45
+    -471.056056f, -170.353428f, -5.8073809f, 74.8261171f, 106.269026f, 110.908452f, 102.625703f, 89.5809342f,
+    76.2035556f, 64.5861944f, 55.4371356f, 48.7113217f, 44.011891f, 40.8317664f, 38.6870141f, 37.1797499f,
+    36.0175842f, 35.0083645f, 34.0427961f, 33.0729789f, 32.0916347f, 31.1145292f, 30.1670773f, 29.2751699f,
+    28.459713f, 27.7341163f, 27.1039023f, 26.5676649f, 26.1187293f, 25.747017f, 25.440776f, 25.1879753f,
+    24.9772785f, 24.7986012f, 24.6433121f, 24.5041761f, 24.3751429f, 24.2510821f, 24.1275464f, 24.0006202f,
+    23.8668804f, 23.7234739f, 23.5682909f, 23.4001962f, 23.2192724f, 23.0270256f, 22.8265075f, 22.6223183f,
+    22.4204681f, 22.2280908f, 22.053023f, 21.9032743f, 21.7864314f, 21.709047f, 21.6760688f, 21.6903659f,
+    21.7524016f, 21.8600915f, 22.0088727f, 22.1919867f, 22.4009658f, 22.6262856f, 22.8581353f, 23.0872377f,
+    23.3056472f, 23.5074471f, 23.6892778f, 23.8506359f, 23.9939081f, 24.124128f, 24.2484747f, 24.3755645f,
+    24.514614f, 24.6745787f, 24.8633817f, 25.0873463f, 25.3509253f, 25.6567839f, 26.006231f, 26.3999247f,
+    26.8386958f, 27.3242659f, 27.8595979f, 28.4486498f, 29.0954468f, 29.8027134f, 30.5708976f, 31.3993808f,
+    32.2931387f, 33.2802742f, 34.4488864f, 36.0159382f, 38.4464455f, 42.6488085f, 50.28189f, 64.2220456f,
+    89.2543485f, 133.072462f, 207.69684f, 331.452174f, 531.683405f, 848.436453f, 1339.38667f, 2086.36649f,
+    3203.92606f, 4850.45836f, 7242.53736f, 10673.2547f,
+    // under_y = 46
+    -503.514344f, -197.662182f, -27.7621744f, 57.848515f, 93.5952047f, 101.755575f, 96.2181933f, 85.2172423f,
+    73.2886288f, 62.6413122f, 54.0956455f, 47.7063807f, 43.1604467f, 40.0175995f, 37.844614f, 36.2800337f,
+    35.0559338f, 33.9950913f, 32.9959126f, 32.0130202f, 31.0382053f, 30.0842349f, 29.1725159f, 28.3246852f,
+    27.5576632f, 26.881452f, 26.2988972f, 25.8066824f, 25.3969461f, 25.0590529f, 24.7812051f, 24.5517095f,
+    24.3598288f, 24.1962279f, 24.0530831f, 23.9239506f, 23.8035003f, 23.6872135f, 23.5711247f, 23.4516597f,
+    23.3255991f, 23.190164f, 23.0432042f, 22.8834486f, 22.7107697f, 22.5264123f, 22.3331381f, 22.1352515f,
+    21.9384816f, 21.7497157f, 21.5765942f, 21.4269936f, 21.3084396f, 21.2274997f, 21.1892121f, 21.1966058f,
+    21.2503625f, 21.3486598f, 21.4872206f, 21.6595751f, 21.8575236f, 22.0717674f, 22.292659f, 22.511007f,
+    22.7188647f, 22.9102264f, 23.0815626f, 23.2321355f, 23.3640583f, 23.4820836f, 23.5931398f, 23.705661f,
+    23.8287874f, 23.9715328f, 24.1420325f, 24.3469774f, 24.5913277f, 24.8783579f, 25.2100309f, 25.5876283f,
+    26.012489f, 26.4866419f, 27.0130828f, 27.5954822f, 28.2372512f, 28.9402204f, 29.70376f, 30.526122f,
+    31.4112223f, 32.3861961f, 33.5380428f, 35.081786f, 37.4781201f, 41.6258546f, 49.1640475f, 62.9310572f,
+    87.643441f, 130.877419f, 204.460319f, 326.410016f, 523.597958f, 835.357264f, 1318.31304f, 2052.77917f,
+    3151.14625f, 4768.7816f, 7118.07614f, 10486.408f,
+    // under_y = 47
+    -533.888139f, -223.413361f, -48.5935895f, 41.6457241f, 81.4238003f, 92.898413f, 89.9548189f, 80.8911743f,
+    70.3407251f, 60.620696f, 52.6566063f, 46.5972644f, 42.2087152f, 39.1138467f, 36.9272924f, 35.3218978f,
+    34.0526762f, 32.9562922f, 31.9381927f, 30.9551522f, 29.9978763f, 29.076131f, 28.2074139f, 27.4092703f,
+    26.6948301f, 26.0708952f, 25.5378384f, 25.0906252f, 24.7203806f, 24.4160653f, 24.1659676f, 23.9588437f,
+    23.7846479f, 23.6348712f, 23.5025597f, 23.3821108f, 23.2689547f, 23.1592156f, 23.0494332f, 22.9363925f,
+    22.817089f, 22.6888244f, 22.54941f, 22.3974364f, 22.2325596f, 22.0557532f, 21.8694765f, 21.6777229f,
+    21.4859242f, 21.3007038f, 21.1294884f, 20.9800053f, 20.8597043f, 20.7751563f, 20.7314814f, 20.7318639f,
+    20.7772044f, 20.8659471f, 20.9941107f, 21.155528f, 21.3422853f, 21.5453304f, 21.7552015f, 21.9628152f,
+    22.1602447f, 22.341412f, 22.5026287f, 22.6429261f, 22.7641365f, 22.8707138f, 22.9693042f, 23.0681158f,
+    23.1761549f, 23.3024253f, 23.4551962f, 23.6414435f, 23.8665512f, 24.1343261f, 24.4473205f, 24.8073967f,
+    25.2163875f, 25.6766499f, 26.1912735f, 26.7637416f, 27.3969861f, 28.0920955f, 28.8475053f, 29.6604257f,
+    30.5336775f, 31.4931752f, 32.624216f, 34.1387583f, 36.4912988f, 40.5681392f, 47.9842118f, 61.5337008f,
+    85.8560643f, 128.398424f, 200.779465f, 320.689923f, 514.501537f, 820.801256f, 1295.12197f, 2016.20676f,
+    3094.22243f, 4681.43223f, 6985.94932f, 10289.3249f,
+    // under_y = 48
+    -562.272021f, -247.696054f, -68.3817481f, 26.1484911f, 69.6971689f, 84.2908483f, 83.8003397f, 76.5773635f,
+    67.343143f, 58.5150159f, 51.1167628f, 45.3855536f, 41.1619725f, 38.1284598f, 35.9447916f, 34.3161258f,
+    33.019021f, 31.9031131f, 30.8803423f, 29.9093671f, 28.9797397f, 28.0982958f, 27.2787834f, 26.5348652f,
+    25.8761123f, 25.3063592f, 24.8237273f, 24.4216645f, 24.0904594f, 23.8188201f, 23.5952475f, 23.4090507f,
+    23.2509597f, 23.1133581f, 22.9902141f, 22.8768075f, 22.7693602f, 22.6646638f, 22.5597814f, 22.4518707f,
+    22.3381515f, 22.2160119f, 22.0832269f, 21.9382479f, 21.7805111f, 21.6107122f, 21.4309992f, 21.2450436f,
+    21.0579673f, 20.8761161f, 20.7066889f, 20.5572498f, 20.4351606f, 20.3469842f, 20.2979148f, 20.2912874f,
+    20.3282202f, 20.4074274f, 20.5252306f, 20.6757765f, 20.8514526f, 21.0434705f, 21.2425734f, 21.4398055f,
+    21.6272774f, 21.7988535f, 21.9506952f, 22.0816039f, 22.1931233f, 22.2893881f, 22.3767307f, 22.4630873f,
+    22.5572716f, 22.6682063f, 22.8042143f, 22.9724691f, 23.1786907f, 23.4271342f, 23.7208701f, 24.0622893f,
+    24.4536945f, 24.8977821f, 25.3977866f, 25.957097f, 26.5782955f, 27.2618834f, 28.0055143f, 28.8054678f,
+    29.663477f, 30.6040496f, 31.7102794f, 33.1900792f, 35.4900738f, 39.4814169f, 46.7509629f, 60.0430325f,
+    83.9120363f, 125.665162f, 196.697978f, 314.355087f, 504.483977f, 804.89414f, 1269.98688f, 1976.88548f,
+    3033.47264f, 4588.83402f, 6846.71636f, 10082.7378f,
+    // under_y = 49
+    -588.74105f, -270.579972f, -87.1881417f, 11.3050232f, 58.3736894f, 75.9011982f, 77.7323085f, 72.2616037f,
+    64.2887696f, 56.3230508f, 49.4796055f, 44.0783399f, 40.0299024f, 37.0728273f, 34.9094457f, 33.275368f,
+    31.9674296f, 30.8474357f, 29.8333774f, 28.8856187f, 27.9925687f, 27.1582673f, 26.3929236f, 25.7065673f,
+    25.1054705f, 24.5907532f, 24.1585179f, 23.8009009f, 23.5075307f, 23.2670095f, 23.0681694f, 22.9009668f,
+    22.75698f, 22.6295408f, 22.513581f, 22.4052936f, 22.3017149f, 22.2003206f, 22.0987095f, 21.9944212f,
+    21.8849063f, 21.7676436f, 21.6403745f, 21.5014119f, 21.3499705f, 21.1864649f, 21.012726f, 20.8320965f,
+    20.6493791f, 20.4706318f, 20.3028147f, 20.1533174f, 20.0294024f, 19.9376158f, 19.8832175f, 19.8696882f,
+    19.8983616f, 19.9682232f, 20.0759027f, 20.2158696f, 20.3808242f, 20.562257f, 20.7511322f, 20.9386384f,
+    21.1169391f, 21.279853f, 21.4233991f, 21.5461487f, 21.6493478f, 21.7367924f, 21.8144683f, 21.8899942f,
+    21.9719326f, 22.0690538f, 22.1896525f, 22.3410115f, 22.5290952f, 22.7585192f, 23.0327951f, 23.3547833f,
+    23.7272242f, 24.1531551f, 24.6359969f, 25.1791284f, 25.7849058f, 26.4533948f, 27.1816262f, 27.9650775f,
+    28.8044346f, 29.7226701f, 30.8002617f, 32.2402276f, 34.4798348f, 38.3727083f, 45.4740274f, 58.4730329f,
+    81.8317634f, 122.707449f, 192.259116f, 307.467578f, 493.633224f, 787.758949f, 1243.07777f, 1935.04752f,
+    2969.2106f, 4491.40668f, 6700.93359f, 9867.3779f,
+    // under_y = 50
+    -613.350234f, -292.115383f, -105.055938f, -2.91959874f, 47.4269717f, 67.7112822f, 71.7400436f, 67.9397691f,
+    61.1789801f, 54.0505966f, 47.7543058f, 42.6872025f, 38.8256276f, 35.9608668f, 33.8353406f, 32.2133715f,
+    30.9109154f, 29.8012492f, 28.808063f, 27.893328f, 27.0443862f, 26.262671f, 25.5551057f, 24.9283674f,
+    24.3857121f, 23.925811f, 23.5429869f, 23.2282714f, 22.9708049f, 22.759223f, 22.5827978f, 22.4322156f,
+    22.2999637f, 22.1803651f, 22.069345f, 21.9640293f, 21.8622819f, 21.7622711f, 21.6621375f, 21.5598065f,
+    21.4529633f, 21.3391801f, 21.2161668f, 21.0820992f, 20.9359711f, 20.7779151f, 20.6094429f, 20.433564f,
+    20.2547567f, 20.0787836f, 19.9123582f, 19.7626864f, 19.6369227f, 19.541587f, 19.4819981f, 19.4617765f,
+    19.4824683f, 19.5433301f, 19.6413027f, 19.7711845f, 19.9259982f, 20.097525f, 20.276964f, 20.4556623f,
+    20.6258494f, 20.7813098f, 20.9179257f, 21.0340386f, 21.1305877f, 21.2110109f, 21.2809162f, 21.347561f,
+    21.4191988f, 21.5043779f, 21.6112839f, 21.7472201f, 21.918303f, 22.1294192f, 22.3844398f, 22.6866305f,
+    23.0391297f, 23.4453088f, 23.9088073f, 24.4330679f, 25.020336f, 25.6703893f, 26.3797956f, 27.1433692f,
+    27.9608163f, 28.8534928f, 29.8989257f, 31.2945077f, 33.4668352f, 37.2498697f, 44.1638557f, 56.8381963f,
+    79.6358439f, 119.554851f, 187.505318f, 300.087962f, 482.034942f, 769.515583f, 1214.56065f, 1890.92029f,
+    2901.74469f, 4389.56438f, 6549.15226f, 9643.97289f,
+    // under_y = 51
+    -636.134945f, -312.333849f, -122.010949f, -16.5445456f, 36.8446286f, 59.7151368f, 65.8233251f, 63.6165235f,
+    58.0223824f, 51.7092621f, 45.9545776f, 41.2271447f, 37.5647255f, 34.8081248f, 32.7374979f, 31.1442469f,
+    29.8623929f, 28.7760766f, 27.8144149f, 26.9409547f, 26.1421028f, 25.4169191f, 24.7693272f, 24.2029565f,
+    23.7183439f, 23.3119861f, 22.9766671f, 22.7025169f, 22.4783533f, 22.2929741f, 22.1361884f, 21.999482f,
+    21.8762981f, 21.7619812f, 21.6534667f, 21.5488222f, 21.4467421f, 21.3460874f, 21.2455394f, 21.1434088f,
+    21.037615f, 20.9258244f, 20.8057173f, 20.6753343f, 20.5334501f, 20.3799169f, 20.2159276f, 20.0441575f,
+    19.8687579f, 19.6951923f, 19.5299211f, 19.3799604f, 19.2523486f, 19.1535723f, 19.0890016f, 19.0623909f,
+    19.0754946f, 19.1278387f, 19.216676f, 19.3371379f, 19.4825764f, 19.6450726f, 19.816072f, 19.9870924f,
+    20.1504416f, 20.299879f, 20.4311565f, 20.5423854f, 20.6341905f, 20.7096341f, 20.7739176f, 20.8338952f,
+    20.8974575f, 20.9728633f, 21.0681113f, 21.1904384f, 21.3460223f, 21.5399298f, 21.7763084f, 22.0587614f,
+    22.3907794f, 22.7760536f, 23.2184649f, 23.7215845f, 24.2876528f, 24.9162987f, 25.6037844f, 26.3444065f,
+    27.136977f, 28.0011925f, 29.011362f, 30.3586283f, 32.4577632f, 36.1211601f, 42.8311917f, 55.153108f,
+    77.3446576f, 116.236286f, 182.477824f, 292.274925f, 469.772114f, 750.280378f, 1184.59705f, 1844.72585f,
+    2831.37714f, 4283.7146f, 6391.91688f, 9413.2442f,
+    // under_y = 52
+    -657.112136f, -331.249613f, -138.063122f, -29.5747931f, 26.62671f, 51.9174714f, 59.9908994f, 59.3038902f,
+    54.8334685f, 49.3152124f, 44.0975176f, 39.7155345f, 36.2642701f, 33.6309173f, 31.6311123f, 30.0817991f,
+    28.8340957f, 27.782476f, 26.8612779f, 26.0356476f, 25.2912325f, 24.6249857f, 24.0381422f, 23.5316041f,
+    23.1034953f, 22.7484144f, 22.4578448f, 22.221211f, 22.0271634f, 21.864779f, 21.7244875f, 21.5986289f,
+    21.4816357f, 21.3698896f, 21.2613408f, 21.1549952f, 21.0503705f, 20.947012f, 20.8441339f, 20.7404258f,
+    20.6340373f, 20.5227281f, 20.4041492f, 20.2762084f, 20.1374645f, 19.9874927f, 19.82717f, 19.6588391f,
+    19.4863246f, 19.3147891f, 19.1504374f, 19.0000902f, 18.8706641f, 18.7686052f, 18.6993283f, 18.6667153f,
+    18.6727238f, 18.7171457f, 18.7975452f, 18.9093884f, 19.0463612f, 19.2008522f, 19.3645623f, 19.5291908f,
+    19.6871343f, 19.8321365f, 19.9598249f, 20.068082f, 20.157212f, 20.2298866f, 20.2908751f, 20.3465912f,
+    20.404512f, 20.4725446f, 20.5584264f, 20.6692455f, 20.811152f, 20.989304f, 21.2080425f, 21.4712375f,
+    21.7826827f, 22.1463677f, 22.5664292f, 23.0466212f, 23.5892739f, 24.1939982f, 24.8569019f, 25.5719098f,
+    26.3370386f, 27.1703143f, 28.1426172f, 29.438311f, 31.4593361f, 34.9948277f, 41.4866579f, 53.4320348f,
+    74.977967f, 112.779642f, 177.216304f, 284.084918f, 456.924703f, 730.165751f, 1153.34359f, 1796.68031f,
+    2758.40334f, 4174.25725f, 6229.76396f, 9175.90544f,
+    // under_y = 53
+    -676.2822f, -348.861511f, -153.208459f, -42.0029935f, 16.7838982f, 44.3319521f, 54.2588657f, 55.0197534f,
+    51.6312356f, 46.8879112f, 42.2024696f, 38.1710884f, 34.941932f, 32.4455412f, 30.5308673f, 29.0389409f,
+    27.8370821f, 26.8296308f, 25.9559932f, 25.1829814f, 24.4956927f, 23.8892643f, 23.3625693f, 22.9141116f,
+    22.5399108f, 22.2329411f, 21.9836162f, 21.780842f, 21.6132437f, 21.4702807f, 21.3430714f, 21.2248506f,
+    21.111058f, 20.9991145f, 20.8879765f, 20.7775731f, 20.6682281f, 20.5601539f, 20.4530824f, 20.3460709f,
+    20.2374918f, 20.1251939f, 20.0067986f, 19.8800834f, 19.7433954f, 19.5960376f, 19.4385759f, 19.273025f,
+    19.1028852f, 18.9330193f, 18.7693751f, 18.618575f, 18.487409f, 18.3822767f, 18.3086306f, 18.2704735f,
+    18.2699601f, 18.3071436f, 18.3798969f, 18.4840209f, 18.6135381f, 18.7611494f, 18.9188193f, 19.0784373f,
+    19.2324989f, 19.3747413f, 19.5006745f, 19.6079545f, 19.6965618f, 19.7687658f, 19.8288825f, 19.8828523f,
+    19.9376945f, 20.0009074f, 20.079899f, 20.1815304f, 20.3118407f, 20.4759935f, 20.6784415f, 20.9232504f,
+    21.2144645f, 21.5563452f, 21.9532914f, 22.4092844f, 22.9268278f, 23.5056337f, 24.1417985f, 24.8290185f,
+    25.5646213f, 26.3649749f, 27.2973694f, 28.538945f, 30.4779375f, 33.878737f, 40.1403781f, 51.6885506f,
+    72.5545521f, 109.211425f, 171.758528f, 275.571844f, 443.569343f, 709.279894f, 1120.95169f, 1746.99356f,
+    2683.11135f, 4061.58393f, 6063.22097f, 8932.66087f,
+    // under_y = 54
+    -693.631331f, -365.155265f, -167.43121f, -53.8115626f, 7.33555451f, 36.9793918f, 48.6490157f, 50.7863489f,
+    48.4378257f, 44.4489076f, 40.2899523f, 36.6129329f, 33.6151652f, 31.2675783f, 29.4503487f, 28.027207f,
+    26.8808397f, 25.9250364f, 25.1041593f, 24.3867846f, 23.7576912f, 23.2105062f, 22.7420755f, 22.3488356f,
+    22.0250073f, 21.7622069f, 21.5499991f, 21.3769445f, 21.2317718f, 21.10441f, 20.9867191f, 20.8728533f,
+    20.7592626f, 20.6443952f, 20.5281919f, 20.4114788f, 20.2953582f, 20.1806841f, 20.0676849f, 19.9557683f,
+    19.8435184f, 19.7288668f, 19.609404f, 19.4827792f, 19.3471327f, 19.2015017f, 19.046148f, 18.8827642f,
+    18.7145315f, 18.546016f, 18.3829091f, 18.2316335f, 18.0988488f, 17.9909028f, 17.913279f, 17.8700939f,
+    17.8636923f, 17.894383f, 17.9603434f, 18.0577072f, 18.1808339f, 18.3227408f, 18.4756615f, 18.6316844f,
+    18.783413f, 18.9245876f, 19.0506086f, 19.1589103f, 19.249149f, 19.3231847f, 19.3848632f, 19.4396254f,
+    19.4939944f, 19.5550096f, 19.6296886f, 19.7245945f, 19.8455771f, 19.9977245f, 20.1855225f, 20.4131625f,
+    20.6848853f, 21.0051932f, 21.3787464f, 21.8097879f, 22.3010673f, 22.852505f, 23.4603179f, 24.1181116f,
+    24.8226333f, 25.5886236f, 26.4796628f, 27.6652978f, 29.5193108f, 32.7800494f, 38.8016532f, 49.9352133f,
+    70.0918969f, 105.556464f, 166.140089f, 266.786803f, 429.779113f, 687.726559f, 1087.56731f, 1695.86892f,
+    2605.78157f, 3946.07748f, 5892.80565f, 8684.20429f,
+    // under_y = 55
+    -709.13424f, -380.106053f, -180.706273f, -64.9748873f, -1.69230085f, 29.8859188f, 43.1871878f, 46.6287979f,
+    45.2772333f, 42.0207059f, 38.3806813f, 35.059769f, 32.300503f, 30.1113112f, 28.401569f, 27.0563756f,
+    25.9729958f, 25.0742891f, 24.3094902f, 23.6490582f, 23.0776978f, 22.5878379f, 22.1746323f, 21.8327768f,
+    21.5549906f, 21.331787f, 21.1520893f, 21.0042711f, 20.8772769f, 20.7615765f, 20.6498083f, 20.5370546f,
+    20.4207643f, 20.3003868f, 20.1768134f, 20.0517299f, 19.9269802f, 19.8040265f, 19.6835653f, 19.5653335f,
+    19.4481116f, 19.3299058f, 19.2082728f, 19.0807357f, 18.9452331f, 18.8005443f, 18.6466351f, 18.4848845f,
+    18.3181615f, 18.1507401f, 17.9880582f, 17.8363383f, 17.7021072f, 17.5916557f, 17.5104919f, 17.4628384f,
+    17.4512224f, 17.4762011f, 17.5362504f, 17.6278334f, 17.7456459f, 17.8830231f, 18.0324729f, 18.1862896f,
+    18.3371943f, 18.4789401f, 18.6068273f, 18.718076f, 18.8120212f, 18.8901104f, 18.9557092f, 19.0137384f,
+    19.070194f, 19.1316147f, 19.2045741f, 19.2952741f, 19.4093043f, 19.5516025f, 19.726613f, 19.9385856f,
+    20.1919026f, 20.4912732f, 20.8416119f, 21.2474486f, 21.7118395f, 22.2350075f, 22.8134102f, 23.4406905f,
+    24.1131243f, 24.8438682f, 25.692707f, 26.8212927f, 28.5883186f, 31.7049707f, 37.4787019f, 48.1833074f,
+    67.6059405f, 101.837675f, 160.394192f, 257.777912f, 415.62338f, 665.604924f, 1053.33085f, 1643.50305f,
+    2526.68654f, 3828.11168f, 5719.02548f, 8431.21822f,
+    // under_y = 56
+    -722.7571f, -393.681216f, -193.001667f, -75.4615693f, -10.2690014f, 23.081187f, 37.9016901f, 42.5737305f,
+    42.1741142f, 39.6257486f, 36.4947122f, 33.5291598f, 31.0129768f, 28.98926f, 27.3946096f, 26.1342054f,
+    25.1191356f, 24.280976f, 23.573768f, 22.9699813f, 22.454495f, 22.01885f, 21.6568364f, 21.3617264f,
+    21.1250218f, 20.9363737f, 20.7842551f, 20.6569944f, 20.5438471f, 20.4358784f, 20.3265252f, 20.2117919f,
+    20.0900996f, 19.9618606f, 19.8288708f, 19.6936279f, 19.5586718f, 19.4260321f, 19.2968395f, 19.1711337f,
+    19.0478736f, 18.9251293f, 18.80042f, 18.6711442f, 18.5350453f, 18.3906527f, 18.2376465f, 18.0771017f,
+    17.9115837f, 17.7450812f, 17.5827822f, 17.4307107f, 17.2952582f, 17.1826545f, 17.0984256f, 17.0468919f,
+    17.0307545f, 17.0508108f, 17.1058283f, 17.1925938f, 17.3061371f, 17.4401119f, 17.5873039f, 17.7402204f,
+    17.891709f, 18.0355466f, 18.1669445f, 18.2829185f, 18.3824893f, 18.4666944f, 18.5384142f, 18.6020364f,
+    18.6630071f, 18.7273304f, 18.8010915f, 18.8900767f, 18.9995527f, 19.134239f, 19.2984699f, 19.4964889f,
+    19.7327664f, 20.012182f, 20.3398916f, 20.720729f, 21.1581058f, 21.6526283f, 22.2011014f, 22.7973236f,
+    23.4372036f, 24.1323666f, 24.9387459f, 26.0098567f, 27.6887733f, 30.6585697f, 36.1784745f, 46.4426598f,
+    65.1109027f, 98.0759077f, 154.551523f, 248.590201f, 401.167725f, 643.009544f, 1018.37711f, 1590.08592f,
+    2446.09086f, 3708.05105f, 5542.37735f, 8174.37331f,
+    // under_y = 57
+    -734.460597f, -405.843025f, -204.281011f, -85.2366288f, -18.3611768f, 16.5966793f, 32.8218331f, 38.6480314f,
+    39.1527279f, 37.2855353f, 34.6507189f, 32.0369534f, 29.7656672f, 27.9118469f, 26.4373847f, 25.2662845f,
+    24.3227265f, 23.5466633f, 22.8968838f, 22.3479976f, 21.8853017f, 21.4997501f, 21.1840863f, 20.9304602f,
+    20.7294251f, 20.5699925f, 20.4403586f, 20.3289303f, 20.225352f, 20.1213217f, 20.0110796f, 19.8915303f,
+    19.7620281f, 19.6238967f, 19.4797802f, 19.3329311f, 19.1865319f, 19.0431322f, 18.9042576f, 18.7702204f,
+    18.6401366f, 18.5121283f, 18.3836721f, 18.2520439f, 18.1147977f, 17.9702231f, 17.8177254f, 17.658087f,
+    17.4935796f, 17.327915f, 17.1660366f, 17.0137715f, 16.8773753f, 16.7630125f, 16.6762201f, 16.6214082f,
+    16.6014423f, 16.6173503f, 16.6681828f, 16.7510441f, 16.8612937f, 16.9929031f, 17.1389386f, 17.2921266f,
+    17.4454506f, 17.5927232f, 17.7290796f, 17.8513442f, 17.9582345f, 18.0503854f, 18.1301934f, 18.2015079f,
+    18.2692103f, 18.3387454f, 18.4156748f, 18.505324f, 18.612583f, 18.7418935f, 18.8974173f, 19.0833318f,
+    19.3041435f, 19.5648645f, 19.8708752f, 20.2273213f, 20.6380078f, 21.1039921f, 21.6225186f, 22.1876475f,
+    22.7950189f, 23.4547839f, 24.2189932f, 25.2328378f, 26.8233408f, 29.6446723f, 34.9065433f, 44.7215327f,
+    62.6191871f, 94.2898617f, 148.640195f, 239.265586f, 386.473953f, 620.030401f, 982.835384f, 1535.80086f,
+    2364.25127f, 3586.25086f, 5363.34744f, 7914.32797f,
+    // under_y = 58
+    -744.202986f, -416.551398f, -214.505928f, -94.2636063f, -25.9345738f, 10.4641482f, 27.9766099f, 34.877737f,
+    36.2360303f, 35.0198926f, 32.865421f, 30.5968476f, 28.5693895f, 26.8871866f, 25.535522f, 24.4559892f,
+    23.5851412f, 22.870973f, 22.2769595f, 21.7799721f, 21.3659574f, 21.0255688f, 20.7508024f, 20.5329697f,
+    20.3619236f, 20.22624f, 20.1139923f, 20.013771f, 19.9156694f, 19.8120397f, 19.6979139f, 19.5710619f,
+    19.4317192f, 19.2820588f, 19.1255068f, 18.9660052f, 18.8073185f, 18.6524633f, 18.5033165f, 18.3604295f,
+    18.2230523f, 18.0893444f, 17.9567352f, 17.8223789f, 17.6836474f, 17.5386007f, 17.3863818f, 17.2274929f,
+    17.0639239f, 16.8991185f, 16.7377822f, 16.5855484f, 16.448536f, 16.3328402f, 16.2440025f, 16.1865137f,
+    16.1633933f, 16.1758893f, 16.2233256f, 16.303116f, 16.4109444f, 16.5410981f, 16.6869259f, 16.8413793f,
+    16.997587f, 17.14941f, 17.2919227f, 17.4217735f, 17.5373921f, 17.639023f, 17.7285875f, 17.8093979f,
+    17.885765f, 17.9625587f, 18.0447916f, 18.1372933f, 18.2445327f, 18.3706223f, 18.5194964f, 18.6952116f,
+    18.9022612f, 19.1457518f, 19.4312668f, 19.7642652f, 20.1489721f, 20.5869502f, 21.0759618f, 21.6104217f,
+    22.1857917f, 22.8108098f, 23.5336333f, 24.4909909f, 25.9935138f, 28.6658281f, 33.6670675f, 43.0265934f,
+    60.1413628f, 90.4960915f, 142.68577f, 229.842929f, 371.600187f, 596.753023f, 946.829566f, 1480.82473f,
+    2281.41679f, 3463.05724f, 5182.41118f, 7651.72816f,
+    // under_y = 59
+    -751.943053f, -425.766509f, -223.638309f, -102.506511f, -32.9557126f, 4.71422428f, 23.3935452f, 31.2871014f,
+    33.4449323f, 32.8464023f, 31.1531603f, 29.2200968f, 27.4325122f, 25.9209994f, 24.6923554f, 23.7045422f,
+    22.9057704f, 22.2517388f, 21.7105375f, 21.2614065f, 20.8911562f, 20.5904056f, 20.350681f, 20.1627173f,
+    20.0158942f, 19.8985343f, 19.7987221f, 19.7053182f, 19.6089076f, 19.5025015f, 19.381899f, 19.2456873f,
+    19.0949197f, 18.9325466f, 18.7627018f, 18.5899446f, 18.4185552f, 18.2519596f, 18.0923388f, 17.9404472f,
+    17.7956433f, 17.6561098f, 17.5192224f, 17.3820158f, 17.241687f, 17.0960779f, 16.9440824f, 16.7859364f,
+    16.6233605f, 16.4595413f, 16.2989532f, 16.1470398f, 16.0097835f, 15.8932062f, 15.8028472f, 15.7432682f,
+    15.7176321f, 15.7273951f, 15.7721438f, 15.8495919f, 15.9557411f, 16.0851916f, 16.2315757f, 16.388075f,
+    16.5479738f, 16.7051951f, 16.8547687f, 16.9931864f, 17.1186087f, 17.2309075f, 17.3315434f, 17.4233008f,
+    17.5099219f, 17.5956957f, 17.6850702f, 17.7823534f, 17.8915589f, 18.0164274f, 18.1606187f, 18.3280196f,
+    18.5230642f, 18.7509157f, 19.0173361f, 19.3280919f, 19.6878455f, 20.0987057f, 20.5590167f, 21.0636273f,
+    21.6079029f, 22.1992295f, 22.8818789f, 23.7840249f, 25.1996517f, 27.7233456f, 32.4628288f, 41.3629567f,
+    57.6862197f, 86.7090798f, 136.711368f, 220.358174f, 356.601035f, 573.258688f, 910.478419f, 1425.32818f,
+    2197.82893f, 3338.80732f, 5000.03333f, 7387.2072f,
+    // under_y = 60
+    -757.642916f, -433.451205f, -231.642386f, -109.931574f, -39.3933504f, -0.624783812f, 19.0977305f, 27.8978399f,
+    30.7977272f, 30.7799886f, 29.5256265f, 27.9153545f, 26.3608984f, 25.0166353f, 23.9090173f, 23.0111596f,
+    22.2822123f, 21.6852284f, 21.1928263f, 20.786701f, 20.4547179f, 20.1877034f, 19.9769675f, 19.8129055f,
+    19.6846279f, 19.5803643f, 19.4883241f, 19.3977059f, 19.2996123f, 19.187704f, 19.058509f, 18.9113728f,
+    18.7480931f, 18.5723183f, 18.3888083f, 18.202662f, 18.0186043f, 17.8404101f, 17.6705143f, 17.5098366f,
+    17.3578178f, 17.212648f, 17.0716437f, 16.9317219f, 16.7899131f, 16.643853f, 16.492201f, 16.3349415f,
+    16.1735397f, 16.0109363f, 15.8513833f, 15.7001386f, 15.5630482f, 15.4460575f, 15.354696f, 15.2935869f,
+    15.2660242f, 15.2736602f, 15.3163318f, 15.3920422f, 15.4971031f, 15.6264232f, 15.7739186f, 15.9330063f,
+    16.0971357f, 16.2603063f, 16.4175224f, 16.5651398f, 16.7010731f, 16.8248441f, 16.9374728f, 17.0412324f,
+    17.1393067f, 17.2354068f, 17.33341f, 17.4370871f, 17.5499717f, 17.6753998f, 17.8167172f, 17.977598f,
+    18.1623751f, 18.3762314f, 18.6250806f, 18.9149849f, 19.2510513f, 19.6359637f, 20.0686974f, 20.5446016f,
+    21.0590175f, 21.6180401f, 22.2620793f, 23.1107035f, 24.4410765f, 26.8173875f, 31.2953304f, 39.7342923f,
+    55.2608904f, 82.9413793f, 130.737827f, 210.844539f, 341.527818f, 549.624688f, 873.895845f, 1369.47595f,
+    2113.722f, 3213.82951f, 4816.66808f, 7121.38578f,
+    // under_y = 61
+    -761.27059f, -439.573203f, -238.486582f, -116.508785f, -45.2197308f, -5.52788542f, 15.1110526f, 24.728554f,
+    28.309686f, 28.8326594f, 27.991722f, 26.6886425f, 25.3579606f, 24.1751983f, 23.1846169f, 22.3732712f,
+    21.7105236f, 21.1664162f, 20.7179864f, 20.3494464f, 20.0498805f, 19.8105371f, 19.6227362f, 19.4767451f,
+    19.3615842f, 19.2655287f, 19.1770064f, 19.0856038f, 18.9829517f, 18.8633372f, 18.7239673f, 18.564877f,
+    18.388528f, 18.1991798f, 18.002132f, 17.8029411f, 17.6067034f, 17.4174788f, 17.2379053f, 17.0690285f,
+    16.9103451f, 16.7600373f, 16.6153565f, 16.4731051f, 16.3301556f, 16.1839508f, 16.0329308f, 15.8768448f,
+    15.7169171f, 15.5558548f, 15.3976965f, 15.2475192f, 15.1110334f, 14.9941039f, 14.9022438f, 14.8401266f,
+    14.8111655f, 14.8171952f, 14.8582895f, 14.9327295f, 15.037128f, 15.1666968f, 15.3156351f, 15.4775999f,
+    15.6462157f, 15.8155738f, 15.9806725f, 16.137756f, 16.2845188f, 16.4201596f, 16.5452841f, 16.6616771f,
+    16.7719825f, 16.8793446f, 16.9870734f, 17.0983969f, 17.2163531f, 17.3438497f, 17.4838868f, 17.6398898f,
+    17.8160523f, 18.0175411f, 18.2503931f, 18.5209492f, 18.8347593f, 19.1950993f, 19.6016119f, 20.0501993f,
+    20.5362413f, 21.0646018f, 21.6718671f, 22.4689893f, 23.7162166f, 25.9471165f, 30.1649491f, 38.142987f,
+    52.8710272f, 79.2038106f, 124.78393f, 201.33277f, 326.428854f, 525.924632f, 837.191216f, 1313.42716f,
+    2029.32344f, 3088.44372f, 4632.75923f, 6854.87191f,
+    // under_y = 62
+    -762.802283f, -444.107016f, -244.145102f, -122.213181f, -50.4116082f, -9.97419482f, 11.4516144f, 21.794332f,
+    25.9928117f, 27.0133913f, 26.5575554f, 25.5434322f, 24.4248132f, 23.3957533f, 22.5164891f, 21.7867991f,
+    21.1855182f, 20.6892918f, 20.2794425f, 19.9427331f, 19.6696016f, 19.4519032f, 19.2811659f, 19.1477133f,
+    19.0406308f, 18.9483553f, 18.8596073f, 18.7643944f, 18.6548716f, 18.5259174f, 18.3753588f, 18.2038434f,
+    18.0144099f, 17.8118374f, 17.6018755f, 17.3904539f, 17.1829645f, 16.9836883f, 16.7954142f, 16.619275f,
+    16.4547968f, 16.3001387f, 16.1524828f, 16.0085197f, 15.8649741f, 15.71911f, 15.5691647f, 15.4146685f,
+    15.2566209f, 15.0975085f, 14.9411657f, 14.7924944f, 14.6570699f, 14.5406735f, 14.4487935f, 14.3861436f,
+    14.3562424f, 14.3610928f, 14.4009913f, 14.4744841f, 14.5784745f, 14.7084714f, 14.8589556f, 15.0238279f,
+    15.1968977f, 15.3723639f, 15.5452401f, 15.711684f, 15.8691997f, 16.0166939f, 16.1543889f, 16.2836106f,
+    16.4064881f, 16.5256184f, 16.6437563f, 16.7635904f, 16.887657f, 17.0184204f, 17.1585114f, 17.311077f,
+    17.4801376f, 17.6708103f, 17.8892254f, 18.1419801f, 18.4350579f, 18.7723326f, 19.1541376f, 19.5769683f,
+    20.0362962f, 20.5358132f, 21.1083335f, 21.8562202f, 23.0227855f, 25.1108794f, 29.0711272f, 36.5903492f,
+    50.5210234f, 75.5057033f, 118.866669f, 191.85143f, 311.349772f, 502.228789f, 800.469728f, 1257.33573f,
+    1944.85408f, 2962.96165f, 4448.74031f, 6588.26082f,
+    // under_y = 63
+    -762.224373f, -447.035587f, -248.599259f, -127.025894f, -54.951046f, -13.9475125f, 8.13334094f, 19.1065159f,
+    23.8557414f, 25.3281431f, 25.2265455f, 24.4808215f, 23.5605043f, 22.6755997f, 21.9004966f, 21.2464769f,
+    20.7010937f, 20.2471879f, 19.8702053f, 19.5594626f, 19.306855f, 19.1049987f, 18.9457979f, 18.8197903f,
+    18.7162569f, 18.623891f, 18.5317617f, 18.4303154f, 18.3122151f, 18.1728856f, 18.0107062f, 17.8268548f,
+    17.6248555f, 17.4099133f, 17.1881355f, 16.9657396f, 16.7483378f, 16.5403675f, 16.3447176f, 16.1625698f,
+    15.9934539f, 15.8354925f, 15.6857941f, 15.5409426f, 15.3975255f, 15.2526431f, 15.1043472f, 14.9519673f,
+    14.7962942f, 14.6396076f, 14.4855482f, 14.338848f, 14.2049485f, 14.0895436f, 13.9980892f, 13.9353276f,
+    13.9048692f, 13.9088697f, 13.947833f, 14.0205562f, 14.1242223f, 14.2546297f, 14.4065379f, 14.574095f,
+    14.7513051f, 14.9324902f, 15.112701f, 15.2880368f, 15.4558422f, 15.6147666f, 15.7646846f, 15.9064976f,
+    16.041852f, 16.1728243f, 16.3016341f, 16.4304422f, 16.5612865f, 16.6961803f, 16.83737f, 16.9876999f,
+    17.1509885f, 17.3322711f, 17.5377402f, 17.774224f, 18.0481222f, 18.3639024f, 18.7226001f, 19.1213321f,
+    19.5557061f, 20.0282998f, 20.5682204f, 21.2693057f, 22.357984f, 24.3064174f, 28.0125932f, 35.0768426f,
+    48.2142626f, 71.8551644f, 113.001534f, 182.427214f, 296.333844f, 478.604435f, 763.832754f, 1201.35067f,
+    1860.52852f, 2837.68701f, 4265.03471f, 6322.1349f,
+    // under_y = 64
+    -759.535052f, -448.351623f, -251.838524f, -130.934948f, -58.8259925f, -17.4367097f, 5.1657594f, 16.672619f,
+    21.9037785f, 23.7799804f, 23.9996195f, 23.4997882f, 22.7623097f, 22.0105921f, 21.3313655f, 20.7461917f,
+    20.2505722f, 19.8331118f, 19.4831895f, 19.1926475f, 18.9549099f, 18.7634767f, 18.6107675f, 18.4876651f,
+    18.3837532f, 18.2880561f, 18.1900303f, 18.0805651f, 17.952804f, 17.8026647f, 17.6290058f, 17.4334489f,
+    17.2199096f, 16.9939233f, 16.7618634f, 16.5301503f, 16.3045413f, 16.089568f, 15.8881693f, 15.7015393f,
+    15.5291877f, 15.369188f, 15.2185731f, 15.0738258f, 14.9314087f, 14.7882745f, 14.642308f, 14.492656f,
+    14.339918f, 14.1861814f, 14.034903f, 13.8906513f, 13.7587352f, 13.6447573f, 13.554133f, 13.4916215f,
+    13.4609105f, 13.4642925f, 13.5024627f, 13.574454f, 13.6777163f, 13.808329f, 13.9613273f, 14.1311087f,
+    14.3118808f, 14.4981047f, 14.6848908f, 14.8683078f, 15.045575f, 15.2151213f, 15.3765131f, 15.5302668f,
+    15.677583f, 15.8200515f, 15.9593837f, 16.0972326f, 16.2351477f, 16.3746927f, 16.5177205f, 16.6667554f,
+    16.825389f, 16.998545f, 17.1924468f, 17.4141238f, 17.6703687f, 17.9662293f, 18.3034436f, 18.6797672f,
+    19.0909806f, 19.5386045f, 20.0481173f, 20.7049312f, 21.7187133f, 23.5310882f, 26.987596f, 33.6023341f,
+    45.9533825f, 68.2593595f, 107.202812f, 173.085263f, 281.42232f, 455.116191f, 727.378177f, 1145.61639f,
+    1776.55535f, 2712.91568f, 4082.05565f, 6057.06348f,
+    // under_y = 65
+    -754.745626f, -448.058616f, -253.861298f, -133.935816f, -62.0306479f, -20.4359312f, 2.55393448f, 14.4963763f,
+    20.1390351f, 22.3692913f, 22.8754834f, 22.5974994f, 22.0260683f, 21.3954894f, 20.8030386f, 20.2793327f,
+    19.8270375f, 19.4400668f, 19.1115141f, 18.8356882f, 18.6075814f, 18.4216701f, 18.2709996f, 18.1469035f,
+    18.0393525f, 17.937758f, 17.8319872f, 17.7133645f, 17.5754776f, 17.4146775f, 17.2302248f, 17.024096f,
+    16.8005041f, 16.5652203f, 16.3247931f, 16.0857635f, 15.8539613f, 15.6339521f, 15.4286774f, 15.2393097f,
+    15.0653169f, 14.9047131f, 14.7544548f, 14.6109315f, 14.4704939f, 14.3299647f, 14.1870806f, 14.0408255f,
+    13.8916248f, 13.7413883f, 13.5934003f, 13.4520716f, 13.3225796f, 13.2104319f, 13.1209954f, 13.0590338f,
+    13.028297f, 13.0311977f, 13.0686049f, 13.1397717f, 13.2424012f, 13.3728442f, 13.5264068f, 13.6977375f,
+    13.8812557f, 14.0715767f, 14.2638931f, 14.4542723f, 14.6398427f, 14.8188524f, 14.9906014f, 15.1552644f,
+    15.3136387f, 15.4668657f, 15.6161825f, 15.7627605f, 15.9076786f, 16.0520591f, 16.1973587f, 16.3457701f,
+    16.5006368f, 16.6667437f, 16.8503133f, 17.0585435f, 17.2985908f, 17.5760615f, 17.8933867f, 18.2489681f,
+    18.6387891f, 19.0633702f, 19.544653f, 20.1597592f, 21.1017858f, 22.7820889f, 25.9941401f, 32.1663423f,
+    43.7405385f, 64.7247918f, 101.483882f, 163.84947f, 266.654735f, 431.826336f, 691.200692f, 1090.27301f,
+    1693.13736f, 2588.93578f, 3900.20612f, 5793.60246f,
+    // under_y = 66
+    -747.881467f, -446.171564f, -254.675431f, -136.031751f, -64.5656375f, -22.9446343f, 0.298540384f, 12.577906f,
+    18.5606647f, 21.0940718f, 21.8509447f, 21.7696583f, 21.3465397f, 20.824314f, 20.3090281f, 19.8391305f,
+    19.4236549f, 19.0613484f, 18.7487729f, 18.4826149f, 18.2594438f, 18.0747748f, 17.9223629f, 17.7940726f,
+    17.6803264f, 17.5709609f, 17.4562646f, 17.3279786f, 17.1800917f, 17.0093241f, 16.8152594f, 16.60014f,
+    16.3683835f, 16.1259042f, 15.8793386f, 15.6352683f, 15.3995272f, 15.176658f, 14.9695611f, 14.7793562f,
+    14.6054503f, 14.4457901f, 14.2972576f, 14.1561577f, 14.0187443f, 13.8817281f, 13.7427182f, 13.6005549f,
+    13.4555083f, 13.3093257f, 13.1651298f, 13.02718f, 12.9005235f, 12.7905692f, 12.7026267f, 12.641452f,
+    12.6108415f, 12.6133105f, 12.6498844f, 12.720019f, 12.8216563f, 12.9514076f, 13.104844f, 13.2768656f,
+    13.4621106f, 13.6553634f, 13.8519207f, 14.0478776f, 14.2403072f, 14.4273173f, 14.607986f, 14.7821921f,
+    14.9503753f, 15.1132724f, 15.2716849f, 15.4263347f, 15.5778542f, 15.726938f, 15.8746508f, 16.0228462f,
+    16.1746033f, 16.3345423f, 16.5088528f, 16.7048666f, 16.9300695f, 17.1905973f, 17.4895556f, 17.8259916f,
+    18.1961151f, 18.599505f, 19.0546716f, 19.6306156f, 20.5041233f, 22.0566659f, 25.0302077f, 30.7682736f,
+    41.5776524f, 61.257563f, 95.8574843f, 154.742758f, 252.069193f, 408.795073f, 655.392038f, 1035.45651f,
+    1610.47161f, 2466.0277f, 3719.87869f, 5532.29388f,
+    // under_y = 67
+    -738.982622f, -442.717401f, -254.298483f, -137.233911f, -66.4380108f, -24.9674867f, -1.60395331f, 10.9139611f,
+    17.1651621f, 19.9502594f, 20.9212661f, 21.0108667f, 20.7177664f, 20.2907048f, 19.8427521f, 19.4189717f,
+    19.0339608f, 18.6908056f, 18.3892657f, 18.1282875f, 17.9059985f, 17.7189871f, 17.5617756f, 17.4268185f,
+    17.3050348f, 17.1867101f, 17.0625525f, 16.9246939f, 16.7674757f, 16.5879213f, 16.385858f, 16.163707f,
+    15.9259999f, 15.6787061f, 15.4284667f, 15.1818294f, 14.9445678f, 14.7211495f, 14.5143939f, 14.3253405f,
+    14.1533197f, 13.9962058f, 13.8508095f, 13.7133623f, 13.5800371f, 13.4474526f, 13.3131106f, 13.1757289f,
+    13.0354405f, 12.8938458f, 12.7539169f, 12.6197686f, 12.4963189f, 12.388874f, 12.3026778f, 12.2424654f,
+    12.2120642f, 12.214074f, 12.2496578f, 12.3184564f, 12.4186351f, 12.5470536f, 12.6995414f, 12.8712489f,
+    13.0570394f, 13.25188f, 13.4511927f, 13.651129f, 13.848742f, 14.0420405f, 14.229926f, 14.4120297f,
+    14.5884823f, 14.7596626f, 14.9259797f, 15.087743f, 15.2451674f, 15.3985392f, 15.54854f, 15.6966819f,
+    15.8457657f, 16.0002237f, 16.1661811f, 16.3510663f, 16.5626554f, 16.8075785f, 17.0895898f, 17.4083736f,
+    17.7603851f, 18.1443224f, 18.5753839f, 19.114654f, 19.9229329f, 21.3523025f, 24.0939589f, 29.4076331f,
+    39.4666341f, 57.8636031f, 90.3359577f, 145.787315f, 237.702588f, 386.080731f, 620.041166f, 981.298806f,
+    1528.74949f, 2344.46387f, 3541.45509f, 5273.66522f,
+    // under_y = 68
+    -728.104099f, -437.735148f, -252.757761f, -137.561289f, -67.6610915f, -26.5141442f, -3.16100462f, 9.49824696f,
+    15.9467086f, 18.9320937f, 20.0805315f, 20.3149859f, 20.1334221f, 19.7882466f, 19.3978405f, 19.0126778f,
+    18.6521116f, 18.3230576f, 18.0281813f, 17.7685467f, 17.5437925f, 17.3515903f, 17.1872637f, 17.0438956f,
+    16.9129296f, 16.7851108f, 16.6515562f, 16.5047561f, 16.3393535f, 16.152608f, 15.9445129f, 15.7175846f,
+    15.4763831f, 15.2268496f, 14.9755522f, 14.7289357f, 14.492655f, 14.2710552f, 14.0668401f, 13.8809452f,
+    13.7126126f, 13.5596415f, 13.4187775f, 13.2861913f, 13.1579926f, 13.0307281f, 12.9018143f, 12.7698671f,
+    12.6349015f, 12.4983863f, 12.3631549f, 12.2331835f, 12.113262f, 12.0085904f, 11.9243376f, 11.8652053f,
+    11.835035f, 11.8364932f, 11.8708609f, 11.9379455f, 12.036119f, 12.1624765f, 12.3130974f, 12.4833807f,
+    12.6684193f, 12.8633752f, 13.0638156f, 13.2659763f, 13.4669253f, 13.6646133f, 13.8578111f, 14.0459514f,
+    14.228906f, 14.4067453f, 14.579532f, 14.7472037f, 14.909591f, 15.0665959f, 15.2185295f, 15.3665642f,
+    15.5132121f, 15.6626958f, 15.8210445f, 15.9957443f, 16.1948196f, 16.4253534f, 16.6917165f, 16.9942153f,
+    17.3295666f, 17.6956508f, 18.1044889f, 18.6094879f, 19.3558508f, 20.6668746f, 23.1838975f, 28.0842001f,
+    37.4095647f, 54.5488593f, 84.9314264f, 137.004775f, 223.590767f, 363.739898f, 585.234311f, 927.927805f,
+    1448.15652f, 2224.50854f, 3365.30571f, 5018.22857f,
+    // under_y = 69
+    -715.315844f, -431.275817f, -250.090156f, -137.04049f, -68.2541988f, -27.5989342f, -4.38365402f, 8.32178415f,
+    14.8975425f, 18.0324857f, 19.3220055f, 19.6754805f, 19.5871334f, 19.3107657f, 18.9684005f, 18.6147382f,
+    18.2730821f, 17.9536589f, 17.6617295f, 17.4003113f, 17.1704848f, 16.9709909f, 16.7979682f, 16.6451481f,
+    16.5045126f, 16.3672656f, 16.2249148f, 16.0702725f, 15.8982308f, 15.7062203f, 15.494326f, 15.26508f,
+    15.0229916f, 14.7738965f, 14.5242193f, 14.2802397f, 14.0474414f, 13.8300061f, 13.6304917f, 13.4497114f,
+    13.28681f, 13.1395127f, 13.0045085f, 12.8779216f, 12.7558176f, 12.6346923f, 12.5118988f, 12.3859727f,
+    12.25683f, 12.1258237f, 11.9956592f, 11.8701809f, 11.7540519f, 11.6523616f, 11.5701953f, 11.512208f,
+    11.4822391f, 11.4830025f, 11.5158782f, 11.5808205f, 11.6763908f, 11.7999056f, 11.9476849f, 12.1153724f,
+    12.2982939f, 12.491817f, 12.6916728f, 12.8942073f, 13.0965373f, 13.2965955f, 13.4930675f, 13.6852365f,
+    13.8727666f, 14.0554704f, 14.2331125f, 14.4053021f, 14.5715216f, 14.731316f, 14.8846427f, 15.0323388f,
+    15.1766199f, 15.3214788f, 15.4728175f, 15.6381397f, 15.8256725f, 16.0429065f, 16.2947911f, 16.5822351f,
+    16.9022308f, 17.2519075f, 17.6402591f, 18.1132875f, 18.8010499f, 19.9987677f, 22.2989971f, 26.7981617f,
+    35.408834f, 51.3194319f, 79.6559308f, 128.416334f, 209.768621f, 341.827463f, 551.05498f, 875.467241f,
+    1368.87217f, 2106.41729f, 3191.78894f, 4766.47957f,
+    // under_y = 70
+    -700.702435f, -423.402086f, -246.34179f, -135.70536f, -68.2422672f, -28.2404663f, -5.28613297f, 7.37329548f,
+    14.0083352f, 17.2433768f, 18.6384706f, 19.0857294f, 19.0727614f, 18.8525788f, 18.5492314f, 18.2204899f,
+    17.8928111f, 17.5792086f, 17.2872164f, 17.0216222f, 16.7848591f, 16.5767037f, 16.3941048f, 16.2314468f,
+    16.0812516f, 15.9351727f, 15.7850842f, 15.6240822f, 15.4472559f, 15.2521442f, 15.0388544f, 14.8098616f,
+    14.5695513f, 14.3235846f, 14.0781797f, 13.8393959f, 13.6125006f, 13.4014771f, 13.208713f, 13.0348854f,
+    12.8790372f, 12.7388234f, 12.6108871f, 12.4913226f, 12.3761706f, 12.2618988f, 12.1458191f, 12.0264082f,
+    11.903502f, 11.7783532f, 11.6535507f, 11.5328131f, 11.420678f, 11.3221199f, 11.2421318f, 11.1853085f,
+    11.155471f, 11.1553619f, 11.1864396f, 11.2487861f, 11.3411337f, 11.4610056f, 11.6049514f, 11.7688547f,
+    11.9482758f, 12.1387966f, 12.3363288f, 12.5373532f, 12.7390671f, 12.9394237f, 13.137068f, 13.3311821f,
+    13.5212732f, 13.7069472f, 13.8877196f, 14.0629164f, 14.2317103f, 14.3933189f, 14.5473651f, 14.6943579f,
+    14.8362108f, 14.9766682f, 15.1214739f, 15.278108f, 15.4549522f, 15.6598558f, 15.8983041f, 16.1717856f,
+    16.4775794f, 16.8121364f, 17.181588f, 17.6248365f, 18.2573057f, 19.3469512f, 21.4387818f, 25.5501965f,
+    33.4672252f, 48.1816551f, 74.521495f, 120.042792f, 196.270093f, 320.396573f, 517.583817f, 824.036457f,
+    1291.0694f, 1990.43643f, 3021.25021f, 4518.89621f,
+    // under_y = 71
+    -684.362513f, -414.187764f, -241.567515f, -133.59651f, -67.6553853f, -28.4611922f, -5.88544634f, 6.63959877f,
+    13.2685568f, 16.5560748f, 18.0225305f, 18.5392942f, 18.584634f, 18.4086886f, 18.1359839f, 17.8262404f,
+    17.5082875f, 17.1974039f, 16.903065f, 16.6316329f, 16.3867871f, 16.1692897f, 15.9768793f, 15.8045853f,
+    15.6454606f, 15.4915917f, 15.3351922f, 15.1696027f, 14.9900593f, 14.7941515f, 14.5819448f, 14.3557919f,
+    14.1198896f, 13.8796639f, 13.6410711f, 13.4099037f, 13.1911744f, 12.98864f, 12.8044994f, 12.639284f,
+    12.4919345f, 12.3600421f, 12.2402176f, 12.1285428f, 12.0210548f, 11.9142151f, 11.8053177f, 11.6928012f,
+    11.5764406f, 11.4574034f, 11.3381731f, 11.2223484f, 11.1143424f, 11.0190109f, 10.9412453f, 10.8855676f,
+    10.8557634f, 10.8545852f, 10.8835499f, 10.9428465f, 11.0313601f, 11.1468041f, 11.2859466f, 11.4449041f,
+    11.6194715f, 11.8054519f, 11.998952f, 12.1966097f, 12.3957324f, 12.5943307f, 12.791051f, 12.9850213f,
+    13.1756417f, 13.3623621f, 13.5444982f, 13.7211381f, 13.8911844f, 14.053559f, 14.2075711f, 14.353411f,
+    14.4926861f, 14.6288747f, 14.767532f, 14.9160727f, 15.082983f, 15.2764187f, 15.5023558f, 15.7628354f,
+    16.0554361f, 16.3760071f, 16.7279978f, 17.1435486f, 17.7240198f, 18.7110075f, 20.6033587f, 24.3415088f,
+    31.5879442f, 45.142116f, 69.5401289f, 111.90453f, 183.128106f, 299.498497f, 484.898385f, 773.750053f,
+    1214.91421f, 1876.80233f, 2854.02106f, 4275.93737f,
+    // under_y = 72
+    -666.407992f, -403.717084f, -235.830279f, -130.760739f, -66.5282765f, -28.2869342f, -6.20094616f, 6.10599005f,
+    12.6668167f, 15.9615527f, 17.4668684f, 18.0301372f, 18.1177238f, 17.974923f, 17.7252601f, 17.4293312f,
+    17.1175803f, 16.8070367f, 16.508783f, 16.23055f, 15.9771448f, 15.7502513f, 15.5483654f, 15.3671421f,
+    15.200149f, 15.0398842f, 14.8788718f, 14.7106584f, 14.5305808f, 14.3362258f, 14.1275611f, 13.9067589f,
+    13.6777716f, 13.4457376f, 13.2163059f, 12.9949628f, 12.7864364f, 12.5942351f, 12.4203563f, 12.2651812f,
+    12.1275516f, 12.0050048f, 11.8941341f, 11.7910277f, 11.6917412f, 11.5927527f, 11.4913603f, 11.3859862f,
+    11.2763623f, 11.1635864f, 11.0500466f, 10.9392281f, 10.8354201f, 10.7433555f, 10.6678156f, 10.6132363f,
+    10.5833519f, 10.5809056f, 10.6074526f, 10.6632689f, 10.7473731f, 10.8576522f, 10.9910799f, 11.1439979f,
+    11.3124336f, 11.4924164f, 11.6802601f, 11.8727794f, 12.0674187f, 12.2622801f, 12.4560513f, 12.6478511f,
+    12.8370201f, 13.0229014f, 13.2046593f, 13.3811896f, 13.5511645f, 13.7132422f, 13.8664409f, 14.0106423f,
+    14.1471453f, 14.2791456f, 14.4119794f, 14.5529537f, 14.7106083f, 14.8933508f, 15.1075997f, 15.3559206f,
+    15.6362037f, 15.9437792f, 16.2796102f, 16.6694437f, 17.2012012f, 18.0911165f, 19.7934037f, 23.1738101f,
+    29.7745941f, 42.2076145f, 64.7237629f, 104.021405f, 170.374411f, 279.182399f, 453.072835f, 724.717424f,
+    1140.56494f, 1765.74044f, 2690.41783f, 4038.04124f,
+    // under_y = 73
+    -646.963051f, -392.083851f, -229.200384f, -127.250393f, -64.8997403f, -27.7464007f, -6.25391159f, 5.75660438f,
+    12.1911707f, 15.4507048f, 16.9644544f, 17.5527834f, 17.6677676f, 17.5480136f, 17.3146556f, 17.0281447f,
+    16.7198128f, 16.4079391f, 16.1048815f, 15.8195287f, 15.5576882f, 15.3218915f, 15.1113493f, 14.9223151f,
+    14.7488486f, 14.5838357f, 14.4200807f, 14.2513006f, 14.0728905f, 13.8823885f, 13.6796152f, 13.4665137f,
+    13.2467449f, 13.0251171f, 12.8069344f, 12.5973469f, 12.4007751f, 12.2204642f, 12.0582028f, 11.9142224f,
+    11.7872722f, 11.6748481f, 11.5735426f, 11.4794709f, 11.3887286f, 11.2978332f, 11.2041095f, 11.1059833f,
+    11.0031618f, 10.8966867f, 10.7888616f, 10.6830631f, 10.5834576f, 10.494651f, 10.4213057f, 10.367759f,
+    10.3376777f, 10.3337773f, 10.3576313f, 10.4095824f, 10.4887631f, 10.5932174f, 10.7201102f, 10.8659996f,
+    11.0271418f, 11.1997952f, 11.3804905f, 11.566236f, 11.7546377f, 11.9439194f, 12.1328476f, 12.3205733f,
+    12.5064233f, 12.6896808f, 12.8694057f, 13.0443452f, 13.2129809f, 13.3737394f, 13.5253707f, 13.6674593f,
+    13.8009939f, 13.9288719f, 14.0561809f, 14.1900775f, 14.3391029f, 14.5118608f, 14.7151619f, 14.952067f,
+    15.2207911f, 15.5162341f, 15.8370826f, 16.2030877f, 16.6894082f, 17.4879983f, 19.0101009f, 22.0492533f,
+    28.031097f, 39.3850658f, 60.0841219f, 96.4125869f, 158.039356f, 259.495027f, 422.177491f, 677.042192f,
+    1068.17157f, 1657.46434f, 2530.74045f, 3805.62356f,
+    // under_y = 74
+    -626.162957f, -379.390448f, -221.754658f, -123.122669f, -62.8120709f, -26.8706998f, -6.06714656f, 5.57474511f,
+    11.8293844f, 15.0145522f, 16.508699f, 17.1024261f, 17.231328f, 17.1256179f, 16.9027448f, 16.6220576f,
+    16.3150873f, 16.0008824f, 15.692752f, 15.4005316f, 15.1308964f, 14.8871448f, 14.6691523f, 14.473738f,
+    14.2954273f, 14.1274677f, 13.9629156f, 13.795625f, 13.6210131f, 13.4365295f, 13.2418074f, 13.0385206f,
+    12.8300012f, 12.6206938f, 12.4155295f, 12.2193001f, 12.0361033f, 11.8689125f, 11.7193058f, 11.5873693f,
+    11.4717697f, 11.3699762f, 11.2785987f, 11.1938f, 11.1117379f, 11.0289918f, 10.9429345f, 10.8520154f,
+    10.7559338f, 10.6556892f, 10.5535098f, 10.4526692f, 10.3572111f, 10.2716106f, 10.2004029f, 10.1478143f,
+    10.1174285f, 10.1119153f, 10.1328467f, 10.1806124f, 10.2544391f, 10.3525102f, 10.4721677f, 10.6101753f,
+    10.7630129f, 10.9271686f, 11.099397f, 11.2769144f, 11.4575087f, 11.6395537f, 11.8219276f, 12.0038524f,
+    12.1846833f, 12.3636878f, 12.5398654f, 12.7118579f, 12.877994f, 13.0365007f, 13.1858821f, 13.3254378f,
+    13.4558447f, 13.5796873f, 13.7017754f, 13.8290724f, 13.9700686f, 14.1335069f, 14.3265388f, 14.5526904f,
+    14.8105161f, 15.0945795f, 15.4015147f, 15.7455003f, 16.1896567f, 16.9028186f, 18.2550435f, 20.9703236f,
+    26.3615694f, 36.6813522f, 55.6325434f, 89.0963217f, 146.151596f, 240.480335f, 392.278346f, 630.821561f,
+    997.874816f, 1552.17465f, 2375.27092f, 3579.07583f,
+    // under_y = 75
+    -604.15274f, -365.746746f, -213.575563f, -118.43889f, -60.3104652f, -25.6928643f, -5.66460324f, 5.54317575f,
+    11.5691525f, 14.6443982f, 16.0935519f, 16.6749767f, 16.8058003f, 16.7062882f, 16.4890169f, 16.2113471f,
+    15.9043661f, 15.5874375f, 15.2745096f, 14.9761578f, 14.6997909f, 14.4493891f, 14.2254385f, 14.0252866f,
+    13.8438959f, 13.6748495f, 13.5114291f, 13.3475971f, 13.1787619f, 13.0022526f, 12.8174828f, 12.6258263f,
+    12.4302584f, 12.2348356f, 12.0440967f, 11.8624612f, 11.6936959f, 11.5404999f, 11.4042443f, 11.2848779f,
+    11.1809977f, 11.0900626f, 11.0087193f, 10.933199f, 10.8597438f, 10.7850166f, 10.7064589f, 10.6225622f,
+    10.5330339f, 10.438844f, 10.3421541f, 10.2461393f, 10.1547213f, 10.0722402f, 10.0030959f, 9.95139212f,
+    9.92061421f, 9.91336908f, 9.93120838f, 9.97454859f, 10.0426921f, 10.1339434f, 10.2458067f, 10.3752402f,
+    10.5189403f, 10.6736234f, 10.8362729f, 11.0043238f, 11.1757639f, 11.3491405f, 11.5234735f, 11.6980907f,
+    11.872414f, 12.0457363f, 12.2170385f, 12.3848964f, 12.5475229f, 12.7029755f, 12.849535f, 12.9862274f,
+    13.1134179f, 13.2333632f, 13.3505665f, 13.4717565f, 13.6053196f, 13.7600807f, 13.9434803f, 14.1594795f,
+    14.4069883f, 14.6803334f, 14.9743318f, 15.2980381f, 15.7033f, 16.3370645f, 17.5301012f, 19.9396931f,
+    24.7701585f, 34.1031328f, 51.3797496f, 82.0896589f, 134.737743f, 222.179042f, 363.436511f, 586.145598f,
+    929.805243f, 1450.0578f, 2224.27184f, 3358.7633f,
+    // under_y = 76
+    -581.085727f, -351.268931f, -204.750249f, -113.263749f, -57.4424323f, -24.2473942f, -5.07103624f, 5.64437185f,
+    11.3982713f, 14.3319331f, 15.7135503f, 16.2670637f, 16.3893694f, 16.2893935f, 16.0737675f, 15.7970586f,
+    15.4893193f, 15.1698058f, 14.8528119f, 14.5494531f, 14.2677399f, 14.0122481f, 13.7840173f, 13.5808845f,
+    13.3982198f, 13.2299167f, 13.069458f, 12.9108907f, 12.7495898f, 12.5827394f, 12.4095099f, 12.2309533f,
+    12.0496691f, 11.8693108f, 11.6940135f, 11.5278184f, 11.3741596f, 11.2354655f, 11.1129075f, 11.0063091f,
+    10.9142128f, 10.8340851f, 10.7626289f, 10.6961651f, 10.6310409f, 10.5640235f, 10.4926423f, 10.4154485f,
+    10.3321721f, 10.243765f, 10.1523306f, 10.0609495f, 9.97342124f, 9.89394724f, 9.82678448f, 9.77590274f,
+    9.74467513f, 9.73562882f, 9.7502769f, 9.78904384f, 9.85128859f, 9.93541962f, 10.0390875f, 10.1594324f,
+    10.2933596f, 10.4378102f, 10.5899984f, 10.7475861f, 10.9087752f, 11.0723064f, 11.2373673f, 11.4034221f,
+    11.569994f, 11.7364386f, 11.9017562f, 12.0644941f, 12.2227834f, 12.3745413f, 12.5178465f, 12.6514632f,
+    12.7754442f, 12.8917048f, 13.0044137f, 13.1200234f, 13.2467643f, 13.3934859f, 13.5678658f, 13.7742697f,
+    14.0119811f, 14.2751934f, 14.557153f, 14.8622587f, 15.2318892f, 15.7923976f, 16.8372633f, 18.9600495f,
+    23.26085f, 31.6566225f, 47.3355866f, 75.4081348f, 123.821982f, 204.628156f, 335.707609f, 543.096477f,
+    864.082303f, 1351.28486f, 2077.98485f, 3145.02305f,
+    // under_y = 77
+    -557.121986f, -336.078257f, -195.369576f, -107.664548f, -54.2572095f, -22.5698211f, -4.31168917f, 5.86073335f,
+    11.3047669f, 14.0692936f, 15.3638207f, 15.8759878f, 15.9809264f, 15.8750032f, 15.6579574f, 15.3808437f,
+    15.0721471f, 14.7506312f, 14.4306631f, 14.1237107f, 13.8382587f, 13.5793933f, 13.3486506f, 13.1443174f,
+    12.962142f, 12.796305f, 12.6404695f, 12.4887479f, 12.3364638f, 12.1806392f, 12.020186f, 11.8558217f,
+    11.6897594f, 11.5252426f, 11.3660002f, 11.2156954f, 11.0774343f, 10.9533831f, 10.844525f, 10.7505729f,
+    10.6700315f, 10.6003935f, 10.5384382f, 10.4805963f, 10.4233401f, 10.3635604f, 10.2988923f, 10.2279621f,
+    10.1505361f, 10.0675583f, 9.9810805f, 9.89409258f, 9.81027199f, 9.73367751f, 9.66841601f, 9.61831292f,
+    9.58661575f, 9.57575644f, 9.58719227f, 9.6213376f, 9.67758979f, 9.7544438f, 9.84968112f, 9.96061118f,
+    10.0843382f, 10.2180233f, 10.359111f, 10.5054952f, 10.6556024f, 10.8083837f, 10.9632154f, 11.1197248f,
+    11.2775669f, 11.4361928f, 11.5946571f, 11.7515127f, 11.9048405f, 12.0524443f, 12.1922215f, 12.3226852f,
+    12.4435758f, 12.5564541f, 12.6651273f, 12.775731f, 12.8962882f, 13.0356163f, 13.2015779f, 13.3989136f,
+    13.6272988f, 13.8809012f, 14.1516509f, 14.4397766f, 14.7770224f, 15.2704953f, 16.1784683f, 18.0339096f,
+    21.8372588f, 29.3473519f, 43.5087442f, 69.065438f, 113.425662f, 187.860468f, 309.141156f, 501.747704f,
+    800.813357f, 1256.01029f, 1936.6291f, 2938.16207f,
+    // under_y = 78
+    -532.426671f, -320.299752f, -185.527109f, -101.710433f, -50.8051909f, -20.6962958f, -3.41201255f, 6.17476066f,
+    11.2769859f, 13.8490835f, 15.0400427f, 15.4996402f, 15.5799512f, 15.4637434f, 15.2430475f, 14.9647799f,
+    14.6553893f, 14.332803f, 14.0112151f, 13.7022726f, 13.4148147f, 13.154356f, 12.9228731f, 12.7190636f,
+    12.5390259f, 12.3772065f, 12.2274318f, 12.0838654f, 11.9417674f, 11.7979883f, 11.651174f, 11.5017021f,
+    11.3513978f, 11.2030957f, 11.060122f, 10.9257695f, 10.8028265f, 10.693209f, 10.5977276f, 10.5160009f,
+    10.4465143f, 10.3868057f, 10.3337499f, 10.2839066f, 10.2338921f, 10.180738f, 10.1222009f, 10.0569965f,
+    9.98493845f, 9.90697194f, 9.82510325f, 9.7422342f, 9.66191977f, 9.58807261f, 9.52464272f, 9.47530157f,
+    9.44315887f, 9.43053691f, 9.43882116f, 9.46839884f, 9.51868844f, 9.58825463f, 9.67499432f, 9.77637277f,
+    9.88968295f, 10.0122988f, 10.1418932f, 10.276594f, 10.4150598f, 10.5564643f, 10.7003904f, 10.8466504f,
+    10.9950572f, 11.1451867f, 11.2961781f, 11.4466206f, 11.5945741f, 11.7377542f, 11.8738956f, 12.0012713f,
+    12.1193093f, 12.2292034f, 12.3343734f, 12.4405989f, 12.5556449f, 12.6882406f, 12.8463822f, 13.0351554f,
+    13.2546468f, 13.4991079f, 13.7594128f, 14.0321181f, 14.3401929f, 14.7728887f, 15.5554293f, 17.1634271f,
+    20.5024148f, 27.1799232f, 39.9064709f, 63.0730723f, 103.566896f, 171.904067f, 283.779952f, 462.163356f,
+    740.092725f, 1164.37075f, 1800.39976f, 2738.45531f,
+    // under_y = 79
+    -507.168307f, -304.060879f, -175.318091f, -95.4716246f, -47.1373687f, -18.6631985f, -2.3974098f, 6.56919962f,
+    11.3036525f, 13.6643622f, 14.7383849f, 15.136397f, 15.186375f, 15.0566353f, 14.8308209f, 14.5511825f,
+    14.2417317f, 13.9192613f, 13.5975748f, 13.2883423f, 13.0006478f, 12.7403571f, 12.5098337f, 12.3081487f,
+    12.1317245f, 11.9752544f, 11.8327151f, 11.6983119f, 11.5672355f, 11.4361616f, 11.30347f, 11.1692014f,
+    11.0347981f, 10.9026938f, 10.7758229f, 10.6571202f, 10.5490708f, 10.4533574f, 10.370635f, 10.3004464f,
+    10.2412764f, 10.1907268f, 10.1457866f, 10.103162f, 10.0596301f, 10.0123785f, 9.95929927f, 9.89920911f,
+    9.83197883f, 9.75856209f, 9.6809244f, 9.60188171f, 9.52486581f, 9.45363988f, 9.39199092f, 9.34342773f,
+    9.3109112f, 9.29664095f, 9.30191598f, 9.32708067f, 9.37155843f, 9.43396759f, 9.5123054f, 9.60417938f,
+    9.70706004f, 9.81852614f, 9.93647402f, 10.0592655f, 10.1857952f, 10.3154681f, 10.4480874f, 10.583668f,
+    10.7222026f, 10.8634165f, 11.0065603f, 11.1502869f, 11.2926609f, 11.4313332f, 11.5638934f, 11.6883846f,
+    11.8039226f, 11.9113228f, 12.0135932f, 12.1161193f, 12.2263595f, 12.3528995f, 12.5038183f, 12.6845169f,
+    12.8955123f, 13.1312495f, 13.38181f, 13.6405848f, 13.9226443f, 14.3008088f, 14.9694673f, 16.3502103f,
+    19.2585577f, 25.157776f, 36.5343018f, 57.4400338f, 94.2601657f, 156.781857f, 259.659501f, 424.397365f,
+    682.000802f, 1076.48401f, 1669.46659f, 2546.14404f,
+    // under_y = 80
+    -481.517021f, -287.490178f, -164.838417f, -89.0186566f, -43.3047878f, -16.506768f, -1.29300582f, 7.02716259f,
+    11.373904f, 13.5086129f, 14.4554205f, 14.7849971f, 14.8004317f, 14.6549279f, 14.4232044f, 14.1424203f,
+    13.8338205f, 13.512814f, 13.1926271f, 12.8848171f, 12.5986133f, 12.3401627f, 12.1121653f, 11.9140307f,
+    11.7424812f, 11.5924406f, 11.458026f, 11.3334796f, 11.2139221f, 11.0958575f, 10.9774059f, 10.8582802f,
+    10.739552f, 10.6232682f, 10.5119874f, 10.408304f, 10.3144186f, 10.2317996f, 10.1609658f, 10.1014035f,
+    10.0516157f, 10.0092861f, 9.9715348f, 9.93523052f, 9.89732537f, 9.85517624f, 9.80682177f, 9.75118927f,
+    9.68821442f, 9.61886496f, 9.54506921f, 9.46955858f, 9.39564084f, 9.32692643f, 9.26703393f, 9.21930179f,
+    9.18653239f, 9.17079106f, 9.17327732f, 9.19427843f, 9.23320786f, 9.28872257f, 9.35890557f, 9.44149319f,
+    9.53412174f, 9.63456549f, 9.74093796f, 9.85183188f, 9.96637921f, 10.0842213f, 10.205391f, 10.3301198f,
+    10.4585972f, 10.5907188f, 10.7258691f, 10.8627888f, 10.9995708f, 11.1338216f, 11.2630026f, 11.3849367f,
+    11.4984284f, 11.6039045f, 11.7039381f, 11.803485f, 11.9096493f, 12.0308199f, 12.175108f, 12.3481998f,
+    12.5510608f, 12.7784383f, 13.0198841f, 13.2661329f, 13.5252432f, 13.8550496f, 14.4213625f, 15.5951567f,
+    18.1069526f, 23.282976f, 33.395813f, 52.1725218f, 85.5159798f, 142.511144f, 236.807492f, 388.492878f,
+    626.603249f, 992.447925f, 1543.97273f, 2361.43418f,
+    // under_y = 81
+    -455.642744f, -270.715886f, -154.183598f, -82.4216191f, -39.3580125f, -14.2627461f, -0.12343228f, 7.53223327f,
+    11.4773101f, 13.375698f, 14.1880369f, 14.4444174f, 14.4225089f, 14.2599359f, 14.0220987f, 13.7407442f,
+    13.4340948f, 13.1159757f, 12.7988838f, 12.4941474f, 12.2110555f, 11.9559723f, 11.7318886f, 11.5385199f,
+    11.372866f, 11.2300682f, 11.1043768f, 10.9900703f, 10.8822034f, 10.7771167f, 10.6726825f, 10.5683013f,
+    10.4646915f, 10.3635325f, 10.2670279f, 10.1774534f, 10.0967465f, 10.0261823f, 9.96616435f, 9.91614199f,
+    9.87465426f, 9.8394838f, 9.80789691f, 9.77693847f, 9.74374759f, 9.70586066f, 9.66147169f, 9.6096257f,
+    9.55032878f, 9.48456669f, 9.41423281f, 9.34197465f, 9.27097474f, 9.20468789f, 9.14655948f, 9.09975107f,
+    9.06689817f, 9.04992194f, 9.04991099f, 9.06708293f, 9.10082788f, 9.1498276f, 9.21223708f, 9.2859083f,
+    9.3686314f, 9.45836584f, 9.55343444f, 9.6526558f, 9.75539728f, 9.86153869f, 9.97134811f, 10.0852832f,
+    10.2037437f, 10.3268118f, 10.4540254f, 10.5842329f, 10.7155762f, 10.8456369f, 10.9717635f, 11.0915682f,
+    11.2035459f, 11.307726f, 11.4062255f, 11.503537f, 11.6063653f, 11.72285f, 11.8610846f, 12.02701f,
+    12.2220559f, 12.4413775f, 12.6742562f, 12.9092776f, 13.1483759f, 13.4358565f, 13.9112327f, 14.8983199f,
+    17.0477387f, 21.5560423f, 30.49242f, 47.2736982f, 77.3405825f, 129.103279f, 215.243363f, 354.481718f,
+    573.95033f, 912.3396f, 1424.03364f, 2184.49502f,
+    // under_y = 82
+    -429.713382f, -253.864544f, -143.447722f, -75.7494071f, -35.3466017f, -11.9660328f, 1.08737736f, 8.06856362f,
+    11.6038886f, 13.2598143f, 13.9333462f, 14.113754f, 14.0530117f, 13.872892f, 13.6292286f, 13.3481396f,
+    13.0446443f, 12.730836f, 12.418363f, 12.1182311f, 11.839716f, 11.5893431f, 11.3703526f, 11.1827356f,
+    11.0237497f, 10.8887418f, 10.772092f, 10.6681169f, 10.5718134f, 10.4793716f, 10.3884328f, 10.2981049f,
+    10.2087753f, 10.1217799f, 10.0389919f, 9.96239219f, 9.89367924f, 9.83395782f, 9.78353681f, 9.7418479f,
+    9.70748353f, 9.67834016f, 9.65184338f, 9.62522517f, 9.59582085f, 9.56135383f, 9.52017945f, 9.47146506f,
+    9.41529048f, 9.35266163f, 9.28543798f, 9.21618288f, 9.1479523f, 9.08404273f, 9.02772236f, 8.98197045f,
+    8.94924887f, 8.93132636f, 8.92917104f, 8.94292015f, 8.97192866f, 9.01489071f, 9.07002051f, 9.135273f,
+    9.20858008f, 9.28807552f, 9.37228211f, 9.46023731f, 9.55153954f, 9.64630579f, 9.74504167f, 9.84843672f,
+    9.95711033f, 10.0713439f, 10.190844f, 10.3145845f, 10.4407743f, 10.5669872f, 10.6904737f, 10.8086453f,
+    10.9196896f, 11.0232314f, 11.1209136f, 11.2167339f, 11.3169553f, 11.4294176f, 11.5621471f, 11.7213073f,
+    11.9088049f, 12.120303f, 12.3450647f, 12.5700254f, 12.7918768f, 13.0428493f, 13.4384484f, 14.2588134f,
+    16.0798217f, 19.9758225f, 27.8232311f, 42.7435134f, 69.735742f, 116.563397f, 194.977983f, 322.383974f,
+    524.076393f, 836.214749f, 1309.73625f, 2015.45818f,
+    // under_y = 83
+    -403.892995f, -237.05962f, -132.722427f, -69.0689766f, -31.3185921f, -9.65034661f, 2.3163897f, 8.62097083f,
+    11.7441239f, 13.1554546f, 13.6886081f, 13.7921194f, 13.6922445f, 13.494824f, 13.2460193f, 12.9662088f,
+    12.6671015f, 12.3589622f, 12.0525063f, 11.7583452f, 11.4856814f, 11.2411538f, 11.0282142f, 10.847102f,
+    10.6953143f, 10.5683938f, 10.4608479f, 10.3670368f, 10.2819102f, 10.2015243f, 10.12331f, 10.0461063f,
+    9.9699957f, 9.89599771f, 9.82568197f, 9.76076182f, 9.70272161f, 9.65251897f, 9.61038928f, 9.57576477f,
+    9.54730694f, 9.5230391f, 9.50055661f, 9.47728678f, 9.45076739f, 9.41891339f, 9.38024464f, 9.3340528f,
+    9.28049257f, 9.22059037f, 9.15617146f, 9.08971414f, 9.02414619f, 8.96260345f, 8.90817371f, 8.86364979f,
+    8.83131465f, 8.81277821f, 8.80888043f, 8.8196693f, 8.84445468f, 8.88193217f, 8.93036358f, 8.98779486f,
+    9.05228774f, 9.12213889f, 9.19606079f, 9.27330093f, 9.35368215f, 9.43755458f, 9.52566027f, 9.61892293f,
+    9.71818727f, 9.82394307f, 9.93607767f, 10.0537049f, 10.1751165f, 10.2978948f, 10.419206f, 10.5362714f,
+    10.6469753f, 10.7505331f, 10.8480974f, 10.9431435f, 11.0414518f, 11.1505141f, 11.2782404f, 11.430983f,
+    11.6111336f, 11.8149557f, 12.0319353f, 12.2478426f, 12.4549933f, 12.6749826f, 13.0015895f, 13.6747627f,
+    15.2008174f, 18.5394273f, 25.3849682f, 38.5786087f, 62.6986299f, 104.890268f, 176.013451f, 292.207757f,
+    476.999549f, 764.107266f, 1201.13841f, 1854.41684f,
+    // under_y = 84
+    -378.33998f, -220.420127f, -122.095885f, -62.4446095f, -27.319986f, -7.34788704f, 3.54167528f, 9.17504077f,
+    11.888997f, 13.0573854f, 13.4511727f, 13.4785643f, 13.3403219f, 13.1264617f, 12.8735077f, 12.5960889f,
+    12.3025706f, 12.0013425f, 11.7021362f, 11.4151184f, 11.1493718f, 10.9116082f, 10.7054574f, 10.5313817f,
+    10.3871004f, 10.2683433f, 10.1697444f, 10.0857137f, 10.0111676f, 9.94204698f, 9.8755958f, 9.81041085f,
+    9.74629842f, 9.6839911f, 9.62478443f, 9.57015193f, 9.52138992f, 9.47933219f, 9.44416084f, 9.41532571f,
+    9.39157112f, 9.37105785f, 9.35155881f, 9.33070196f, 9.30623069f, 9.27625305f, 9.23945373f, 9.19524815f,
+    9.14386484f, 9.08634933f, 9.02449112f, 8.96068182f, 8.89771927f, 8.83857669f, 8.78615914f, 8.74307009f,
+    8.71140994f, 8.69262516f, 8.68742191f, 8.69575201f, 8.71687212f, 8.74947f, 8.79184472f, 8.84212213f,
+    8.8984822f, 8.95937289f, 9.02368512f, 9.09086622f, 9.16095473f, 9.23452731f, 9.31255846f, 9.39620506f,
+    9.48653954f, 9.58426583f, 9.68946123f, 9.80139141f, 9.91844525f, 10.0382281f, 10.1578364f, 10.2743119f,
+    10.3852415f, 10.4894291f, 10.5875244f, 10.6824551f, 10.7794827f, 10.8857036f, 11.008863f, 11.1554661f,
+    11.3283918f, 11.5245863f, 11.7339849f, 11.9416586f, 12.1363889f, 12.3305498f, 12.5984482f, 13.1433073f,
+    14.4070533f, 17.2422292f, 23.1719632f, 34.7723081f, 56.2218042f, 94.0762644f, 158.343051f, 263.94912f,
+    432.721559f, 696.029061f, 1098.26869f, 1701.42548f,
+    // under_y = 85
+    -353.205286f, -204.059279f, -111.651798f, -55.9371902f, -23.3942457f, -5.08899678f, 4.74261866f, 9.71724303f,
+    12.0300314f, 12.9606465f, 13.218449f, 13.1720274f, 12.9971113f, 12.7681802f, 12.51229f, 12.23841f,
+    11.9515972f, 11.6583687f, 11.3674534f, 11.0885434f, 10.8305676f, 10.6002763f, 10.4014475f, 10.2347423f,
+    10.0980855f, 9.9873854f, 9.89740228f, 9.82260378f, 9.75788737f, 9.69909922f, 9.64332171f, 9.5889381f,
+    9.53550896f, 9.48351106f, 9.43399626f, 9.38822687f, 9.34733724f, 9.31206009f, 9.28254343f, 9.25827001f,
+    9.23807862f, 9.22027556f, 9.20281628f, 9.1835316f, 9.16037072f, 9.13163334f, 9.09616649f, 9.05350636f,
+    9.00395206f, 8.94856524f, 8.88909692f, 8.82784977f, 8.76748981f, 8.71082609f, 8.66057946f, 8.61916244f,
+    8.58849081f, 8.56984486f, 8.56379323f, 8.57018672f, 8.58822254f, 8.61657302f, 8.65356555f, 8.69739571f,
+    8.74635061f, 8.79901778f, 8.85445472f, 8.91229713f, 8.97278878f, 9.03672396f, 9.10530294f, 9.17991194f,
+    9.26185041f, 9.35203935f, 9.45075243f, 9.55741705f, 9.67053163f, 9.78773886f, 9.90607951f, 10.0224284f,
+    10.1340831f, 10.2394365f, 10.3386267f, 10.4340127f, 10.5303031f, 10.6341549f, 10.7531f, 10.8937572f,
+    11.059488f, 11.2479915f, 11.4498604f, 11.6499064f, 11.8341871f, 12.0072296f, 12.2260803f, 12.6606571f,
+    13.6936305f, 16.0779318f, 21.1762343f, 31.3147022f, 50.2933021f, 84.1074635f, 141.951364f, 237.592176f,
+    391.227947f, 631.970168f, 1001.12641f, 1556.49984f,
+    // under_y = 86
+    -328.630682f, -188.08318f, -101.468424f, -49.6034982f, -19.5817942f, -2.90182268f, 5.90013688f, 10.2350609f,
+    12.1593612f, 12.8605751f, 12.9879026f, 12.8713203f, 12.6622122f, 12.4199807f, 12.1625103f, 11.8932926f,
+    11.6141787f, 11.32986f, 11.0480745f, 10.7780284f, 10.5284736f, 10.3061709f, 10.1150188f, 9.95585384f,
+    9.8267894f, 9.72390334f, 9.64208182f, 9.57585767f, 9.52012448f, 9.47065523f, 9.42439701f, 9.37954929f,
+    9.33545848f, 9.29237742f, 9.25114515f, 9.21284149f, 9.17846437f, 9.14866727f, 9.12358176f, 9.10273697f,
+    9.08507539f, 9.06905432f, 9.05281378f, 9.0343868f, 9.01192553f, 8.98391703f, 8.94936555f, 8.90792264f,
+    8.85995287f, 8.80652941f, 8.74936107f, 8.69065876f, 8.63295482f, 8.57889297f, 8.53100933f, 8.49152509f,
+    8.46217102f, 8.44406031f, 8.43762235f, 8.44260396f, 8.45813864f, 8.48287738f, 8.51516835f, 8.55326775f,
+    8.59555926f, 8.64075833f, 8.68807672f, 8.73732599f, 8.78894309f, 8.84392907f, 8.90370096f, 8.96986777f,
+    9.04395269f, 9.12709402f, 9.219766f, 9.32156569f, 9.43111248f, 9.54610026f, 9.66352913f, 9.78012108f,
+    9.89289469f, 9.99983674f, 10.1005683f, 10.1968632f, 10.2928473f, 10.394696f, 10.5096793f, 10.6444875f,
+    10.802952f, 10.9835803f, 11.1778083f, 11.3705982f, 11.5460524f, 11.7021751f, 11.8809027f, 12.2222004f,
+    13.0545453f, 15.0387074f, 19.3876431f, 28.1928293f, 44.8968487f, 74.9638885f, 126.814537f, 213.10941f,
+    352.488363f, 571.899148f, 909.682159f, 1419.61748f,
+    // under_y = 87
+    -304.747093f, -172.589558f, -91.6176431f, -43.4955249f, -15.9195287f, -0.811978617f, 6.99690497f, 10.7171357f,
+    12.269818f, 12.7528565f, 12.7570844f, 12.5751437f, 12.3349704f, 12.0815082f, 11.8238855f, 11.560384f,
+    11.2898118f, 11.0151237f, 10.7431048f, 10.4824814f, 10.2418144f, 10.0278521f, 9.84458718f, 9.69300796f,
+    9.57139883f, 9.47599709f, 9.40181315f, 9.34345203f, 9.29581831f, 9.25463318f, 9.21673503f, 9.18016966f,
+    9.14410118f, 9.10859055f, 9.07429473f, 9.04213923f, 9.01301026f, 8.98750258f, 8.96574732f, 8.94733129f,
+    8.93130759f, 8.91628731f, 8.90059433f, 8.88246034f, 8.86023479f, 8.83258515f, 8.79866528f, 8.7582346f,
+    8.71171616f, 8.66018874f, 8.60531432f, 8.54920882f, 8.49426901f, 8.44297272f, 8.39767163f, 8.36039662f,
+    8.33269454f, 8.31551238f, 8.30914038f, 8.31322046f, 8.32681993f, 8.34856418f, 8.37681608f, 8.40988432f,
+    8.44623928f, 8.48471279f, 8.52465818f, 8.56604951f, 8.60950354f, 8.65621541f, 8.70780778f, 8.76610366f,
+    8.83284424f, 8.90938315f, 8.99639737f, 9.09366018f, 9.19992251f, 9.31294343f, 9.42969838f, 9.54677266f,
+    9.66091979f, 9.76972855f, 9.87230285f, 9.96981923f, 10.0657947f, 10.165884f, 10.277047f, 10.4059994f,
+    10.5570204f, 10.7294652f, 10.9157736f, 11.101431f, 11.2693056f, 11.4121396f, 11.5588334f, 11.8226616f,
+    12.4828672f, 14.1154009f, 17.7941303f, 25.3909489f, 40.0121766f, 66.6198826f, 112.900731f, 190.462199f,
+    316.457179f, 515.763789f, 823.878527f, 1290.71869f,
+    // under_y = 88
+    -281.673034f, -157.666589f, -82.16407f, -37.6598243f, -12.4403522f, 1.15778542f, 8.01758551f, 11.1534242f,
+    12.3550388f, 12.6335994f, 12.5236869f, 12.2821366f, 12.0145262f, 11.7521043f, 11.495766f, 11.2389287f,
+    10.9775744f, 10.7130469f, 10.4512405f, 10.2004217f, 9.96895441f, 9.76355377f, 9.58828153f, 9.44425312f,
+    9.32990436f, 9.24162013f, 9.17453189f, 9.12332253f, 9.08292143f, 9.04901883f, 9.01837065f, 8.98889877f,
+    8.95961664f, 8.93042494f, 8.90182871f, 8.87462649f, 8.84961626f, 8.82735307f, 8.80798174f, 8.79115599f,
+    8.77604403f, 8.76141102f, 8.74576139f, 8.72751928f, 8.70522327f, 8.67771182f, 8.6442787f, 8.60478174f,
+    8.55969404f, 8.51009291f, 8.45758813f, 8.40419711f, 8.35217938f, 8.30384678f, 8.26136785f, 8.22658532f,
+    8.2008648f, 8.18498961f, 8.17911284f, 8.18277233f, 8.19496845f, 8.21429843f, 8.23913499f, 8.26783226f,
+    8.29893802f, 8.33138918f, 8.36466768f, 8.39889595f, 8.43485603f, 8.47392293f, 8.51791192f, 8.56884916f,
+    8.62868603f, 8.69898757f, 8.78063403f, 8.8735803f, 8.976719f, 9.08788883f, 9.20405802f, 9.32169385f,
+    9.43730211f, 9.54808635f, 9.65263802f, 9.75152935f, 9.84764724f, 9.94608958f, 10.0534579f, 10.1764432f,
+    10.3197404f, 10.4835738f, 10.6615192f, 10.8399174f, 11.0010663f, 11.1336343f, 11.2554674f, 11.4562991f,
+    11.9709665f, 13.2977922f, 16.3820218f, 22.8909018f, 35.6154513f, 59.0446136f, 100.170714f, 169.601522f,
+    283.07434f, 463.492105f, 743.631338f, 1169.70784f,
+    // under_y = 89
+    -259.513175f, -143.3918f, -73.1642402f, -32.1369107f, -9.17273492f, 2.98789972f, 8.94905561f, 11.5353618f,
+    12.4095872f, 12.4994311f, 12.2856255f, 11.9909518f, 11.6998907f, 11.4308889f, 11.1772251f, 10.9278662f,
+    10.6762321f, 10.4222125f, 10.1708929f, 9.93011109f, 9.70803321f, 9.51132301f, 9.34408505f, 9.2075355f,
+    9.10023974f, 9.01871587f, 8.95821098f, 8.91348962f, 8.87951834f, 8.85197611f, 8.82756161f, 8.80410187f,
+    8.78049049f, 8.75649876f, 8.73250893f, 8.70921877f, 8.68736018f, 8.66746585f, 8.64970659f, 8.63381017f,
+    8.61906223f, 8.60437995f, 8.58844261f, 8.56985831f, 8.54734431f, 8.51989865f, 8.48694338f, 8.44842378f,
+    8.40485328f, 8.35729979f, 8.30731502f, 8.25681421f, 8.20791818f, 8.16277333f, 8.12336724f, 8.09135791f,
+    8.06793374f, 8.05371856f, 8.04873191f, 8.05241008f, 8.06368742f, 8.08113177f, 8.10312215f, 8.12805203f,
+    8.15453787f, 8.18161054f, 8.20886736f, 8.2365644f, 8.26563334f, 8.29761346f, 8.33449797f, 8.37850348f,
+    8.43178192f, 8.49610409f, 8.57255272f, 8.66126884f, 8.76129683f, 8.87057017f, 8.98606913f, 9.10416452f,
+    9.22113566f, 9.33381849f, 9.44030214f, 9.54055314f, 9.63681203f, 9.73358673f, 9.83707292f, 9.95388287f,
+    10.0890845f, 10.2437729f, 10.412761f, 10.5835317f, 10.7384144f, 10.8631079f, 10.9662789f, 11.1171364f,
+    11.5107795f, 12.5749069f, 15.1363947f, 20.6725447f, 31.6797907f, 52.2026969f, 88.5786106f, 150.468853f,
+    252.266431f, 414.993614f, 668.831141f, 1056.45519f,
+    // under_y = 90
+    -238.357058f, -129.831103f, -64.6658815f, -26.9607193f, -6.14031724f, 4.66226607f, 9.7806221f, 11.8560259f,
+    12.4290817f, 12.3476047f, 12.0411355f, 11.7003499f, 11.3900425f, 11.1168616f, 10.867168f, 10.6259481f,
+    10.3843633f, 10.141031f, 9.9003251f, 9.66969383f, 9.45710841f, 9.26916276f, 9.10997643f, 8.98083729f,
+    8.88041541f, 8.80534482f, 8.75098024f, 8.71216941f, 8.68392651f, 8.66193735f, 8.64286738f, 8.62447664f,
+    8.60556867f, 8.58581508f, 8.5655034f, 8.54525546f, 8.52575774f, 8.50753638f, 8.49079863f, 8.47535161f,
+    8.46059869f, 8.445605f, 8.42921695f, 8.41021615f, 8.38748628f, 8.36017183f, 8.32781011f, 8.29042167f,
+    8.24854967f, 8.20324404f, 8.15599228f, 8.10860385f, 8.06305976f, 8.02134215f, 7.98526073f, 7.95629331f,
+    7.93545648f, 7.92322015f, 7.91947544f, 7.9235611f, 7.93434778f, 7.95037405f, 7.97002275f, 7.99172136f,
+    8.01414679f, 8.03641289f, 8.05821891f, 8.0799392f, 8.10263849f, 8.12800339f, 8.15818885f, 8.19558764f,
+    8.24254093f, 8.30101815f, 8.37230256f, 8.45672527f, 8.55349264f, 8.66064908f, 8.77520822f, 8.89346911f,
+    9.0115101f, 9.12582242f, 9.23400888f, 9.33543495f, 9.43168395f, 9.52664472f, 9.62606029f, 9.73640601f,
+    9.86306913f, 10.007997f, 10.167308f, 10.3298647f, 10.4785608f, 10.5971381f, 10.6868384f, 10.799212f,
+    11.094101f, 11.9353605f, 14.0414883f, 18.7142444f, 28.1758615f, 46.0549168f, 78.0727783f, 132.997226f,
+    223.947959f, 370.160879f, 599.345068f, 950.799116f,
+    // under_y = 91
+    -218.278008f, -117.03797f, -56.7072996f, -22.1581494f, -3.36157122f, 6.16851006f, 10.5042129f, 12.1102856f,
+    12.41032f, 12.17611f, 11.7888769f, 11.4093044f, 11.0840357f, 10.809016f, 10.5644517f, 10.3318649f,
+    10.100491f, 9.86787649f, 9.63779069f, 9.41733678f, 9.21429451f, 9.0351682f, 8.88406185f, 8.76230261f,
+    8.66863694f, 8.59979432f, 8.55122613f, 8.51786235f, 8.49477321f, 8.47766765f, 8.46320036f, 8.44909093f,
+    8.43408133f, 8.41777197f, 8.40038239f, 8.38248202f, 8.36473113f, 8.34766352f, 8.33153181f, 8.31622606f,
+    8.30126598f, 8.28585892f, 8.26900911f, 8.24965969f, 8.22684709f, 8.19984795f, 8.16830075f, 8.13228838f,
+    8.09237253f, 8.04957633f, 8.00531689f, 7.96129449f, 7.9193497f, 7.88130225f, 7.84878801f, 7.82311018f,
+    7.80512012f, 7.79514067f, 7.79294098f, 7.79776757f, 7.8084309f, 7.82344147f, 7.84118433f, 7.8601163f,
+    7.8789669f, 7.896922f, 7.91376907f, 7.92998471f, 7.94674914f, 7.96587819f, 7.98967094f, 8.02068044f,
+    8.06142431f, 8.11406219f, 8.18007493f, 8.25998726f, 8.35317796f, 8.45781976f, 8.57098326f, 8.6889238f,
+    8.80754885f, 8.9230333f, 9.03251595f, 9.13477237f, 9.23072368f, 9.32361489f, 9.41869082f, 9.52222812f,
+    9.63986895f, 9.77437326f, 9.92319851f, 10.0767734f, 10.2190153f, 10.3326212f, 10.4130313f, 10.4968344f,
+    10.712886f, 11.3677209f, 13.0811418f, 16.9934107f, 25.0725314f, 40.5590268f, 68.596785f, 117.11243f,
+    198.022816f, 328.871285f, 535.018978f, 852.548654f,
+    // under_y = 92
+    -199.332279f, -105.052788f, -49.3168983f, -17.7487094f, -0.849537115f, 7.49817936f, 11.1145311f, 12.294928f,
+    12.3513892f, 11.9837757f, 11.5280351f, 11.1171047f, 10.7811084f, 10.5064537f, 10.2680055f, 10.04437f,
+    9.82321115f, 9.60121658f, 9.38166447f, 9.17135822f, 8.97788841f, 8.80764707f, 8.66468842f, 8.55034263f,
+    8.46340055f, 8.40066319f, 8.35766471f, 8.32941383f, 8.31104301f, 8.29829883f, 8.28784608f, 8.27738895f,
+    8.265635f, 8.25214065f, 8.23708285f, 8.22100082f, 8.20454653f, 8.18827427f, 8.17248958f, 8.15716767f,
+    8.14194192f, 8.12615489f, 8.10895813f, 8.08944328f, 8.06678499f, 8.04037698f, 8.00994429f, 7.97561879f,
+    7.93796942f, 7.89798369f, 7.8570023f, 7.81661344f, 7.77851713f, 7.74437335f, 7.71564897f, 7.69347916f,
+    7.67855768f, 7.67106826f, 7.67066561f, 7.67651038f, 7.68735735f, 7.70169096f, 7.71789755f, 7.73445907f,
+    7.75015f, 7.7642172f, 7.77652224f, 7.78762727f, 7.79880956f, 7.81199478f, 7.82960719f, 7.85434277f,
+    7.88888139f, 7.93556321f, 7.9960629f, 8.07110195f, 8.1602424f, 8.26180406f, 8.37294034f, 8.48989457f,
+    8.60843804f, 8.72446353f, 8.8346747f, 8.93727528f, 9.03252571f, 9.12300731f, 9.21342309f, 9.3097862f,
+    9.41791872f, 9.54133264f, 9.67882343f, 9.8225183f, 9.95774082f, 10.0669494f, 10.1412647f, 10.2048275f,
+    10.3595456f, 10.8608692f, 12.2392395f, 15.4870477f, 22.3375537f, 35.6705998f, 60.0904653f, 102.734314f,
+    174.385886f, 290.98901f, 475.679858f, 761.486441f,
+    // under_y = 93
+    -181.558452f, -93.9024279f, -42.5128631f, -13.744287f, 1.3883446f, 8.64687047f, 11.6091558f, 12.4087445f,
+    12.2517465f, 11.7703498f, 11.2584058f, 10.8234467f, 10.4807791f, 10.2084868f, 9.97693808f, 9.76239223f,
+    9.5513062f, 9.3397267f, 9.13055427f, 8.93033598f, 8.74647191f, 8.58521489f, 8.45053076f, 8.3437122f,
+    8.26355866f, 8.20691546f, 8.16938276f, 8.14604211f, 8.13209236f, 8.12333047f, 8.11645056f, 8.10916513f,
+    8.10017314f, 8.08901294f, 8.07584307f, 8.06119353f, 8.04572468f, 8.03002301f, 8.01445337f, 7.99907735f,
+    7.98363834f, 7.9676063f, 7.95026892f, 7.93085274f, 7.9086557f, 7.88317328f, 7.8542024f, 7.82191066f,
+    7.7868631f, 7.75000315f, 7.7125897f, 7.67609638f, 7.64208337f, 7.61205425f, 7.58731261f, 7.56883306f,
+    7.55716029f, 7.55234778f, 7.5539442f, 7.56103152f, 7.57231403f, 7.58625276f, 7.60123485f, 7.61576339f,
+    7.62865019f, 7.63919187f, 7.64730947f, 7.65363331f, 7.65951816f, 7.66697905f, 7.67854501f, 7.69703621f,
+    7.7252792f, 7.76578373f, 7.82041359f, 7.89008987f, 7.97456914f, 8.0723382f, 8.18066158f, 8.29580577f,
+    8.41344546f, 8.52923141f, 8.63946789f, 8.74181212f, 8.83587242f, 8.92355215f, 9.00897166f, 9.0978136f,
+    9.1959954f, 9.30770022f, 9.43302533f, 9.56587463f, 9.69328112f, 9.79816025f, 9.86864613f, 9.9187492f,
+    10.0272183f, 10.4043396f, 11.50014f, 14.1722978f, 19.9382568f, 31.3438992f, 52.4910168f, 89.7781615f,
+    152.92475f, 256.367136f, 421.138424f, 677.371878f,
+    // under_y = 94
+    -164.977153f, -83.6000428f, -36.3030327f, -10.1490667f, 3.35028788f, 9.61426784f, 11.9885752f, 12.4525655f,
+    12.1122585f, 11.5365482f, 10.9804515f, 10.5284986f, 10.1829211f, 9.91471928f, 9.69062419f, 9.48512388f,
+    9.28383472f, 9.08237775f, 8.8833853f, 8.69318627f, 8.51898342f, 8.36685807f, 8.24064416f, 8.14155214f,
+    8.06835059f, 8.01789882f, 7.98584371f, 7.96733161f, 7.95763012f, 7.95259769f, 7.94897574f, 7.94450743f,
+    7.93790774f, 7.92872167f, 7.91711244f, 7.90362073f, 7.88893094f, 7.87367256f, 7.85827534f, 7.84288773f,
+    7.827359f, 7.81127823f, 7.79405787f, 7.77504571f, 7.75364812f, 7.72944729f, 7.70229767f, 7.67238987f,
+    7.64027451f, 7.60684318f, 7.57326817f, 7.54090703f, 7.51118148f, 7.48544294f, 7.46483824f, 7.45018968f,
+    7.44190217f, 7.43990851f, 7.44366037f, 7.45216878f, 7.46409325f, 7.47787436f, 7.49189974f, 7.50468968f,
+    7.51508555f, 7.52242208f, 7.52666461f, 7.52849332f, 7.52931997f, 7.53122713f, 7.53682686f, 7.54904333f,
+    7.57083265f, 7.60486205f, 7.65317879f, 7.71690595f, 7.79600608f, 7.88915412f, 7.99375624f, 8.1061407f,
+    8.2219299f, 8.3365787f, 8.4460347f, 8.54744159f, 8.63977164f, 8.72424241f, 8.80435438f, 8.88539174f,
+    8.97327431f, 9.07275644f, 9.18516698f, 9.30621058f, 9.42485272f, 9.52504823f, 9.59312255f, 9.635069f,
+    9.70999942f, 9.98861995f, 10.8490691f, 13.026955f, 17.8422106f, 27.5327401f, 45.7341038f, 78.1560934f,
+    133.521462f, 224.849865f, 371.191867f, 599.944511f,
+    // under_y = 95
+    -149.591096f, -74.1451468f, -30.6849848f, -6.95961589f, 5.04008173f, 10.4040771f, 12.2561365f, 12.4292266f,
+    11.9351863f, 11.2840552f, 10.6953187f, 10.2329308f, 9.88780322f, 9.62509508f, 9.40875771f, 9.21207703f,
+    9.02018701f, 8.82848933f, 8.63944876f, 8.45920597f, 8.29475229f, 8.15195903f, 8.03447964f, 7.94339344f,
+    7.87739541f, 7.83332598f, 7.80685745f, 7.79319121f, 7.78766465f, 7.78620765f, 7.78562567f, 7.78371384f,
+    7.77922672f, 7.77173969f, 7.76144267f, 7.748906f, 7.73485299f, 7.71996615f, 7.70474519f, 7.68942555f,
+    7.67395795f, 7.65804243f, 7.64120495f, 7.62290134f, 7.60263208f, 7.58005173f, 7.55505877f, 7.52785497f,
+    7.49896698f, 7.46922774f, 7.43971922f, 7.41168222f, 7.38640239f, 7.365084f, 7.34872446f, 7.33800268f,
+    7.33319369f, 7.33411971f, 7.3401449f, 7.35021739f, 7.36295785f, 7.37678947f, 7.39010006f, 7.40142302f,
+    7.40962112f, 7.41405507f, 7.41471858f, 7.41232253f, 7.40831397f, 7.4048199f, 7.40451221f, 7.41039731f,
+    7.4255423f, 7.45275832f, 7.49426936f, 7.55140224f, 7.62433697f, 7.71195868f, 7.81184763f, 7.92043576f,
+    8.03334195f, 8.14587721f, 8.25368231f, 8.35342829f, 8.44347545f, 8.52435487f, 8.59891485f, 8.67197355f,
+    8.74935359f, 8.83626326f, 8.93516046f, 9.0435221f, 9.1523896f, 9.24722519f, 9.31356585f, 9.35128867f,
+    9.40311305f, 9.60539237f, 10.2724536f, 12.0299208f, 16.0178417f, 24.1913065f, 39.7549289f, 67.7784553f,
+    116.054325f, 196.274773f, 325.626679f, 528.927546f,
+    // under_y = 96
+    -135.385503f, -65.5239831f, -25.646357f, -4.16515828f, 6.46686272f, 11.0238404f, 12.4178993f, 12.3434584f,
+    11.7241054f, 11.0154707f, 10.4048056f, 9.937902f, 9.59608837f, 9.33990683f, 9.13136606f, 8.94310021f,
+    8.76010151f, 8.57774335f, 8.39841046f, 8.2280745f, 8.07349264f, 7.94028108f, 7.83185913f, 7.74912246f,
+    7.69064704f, 7.65321977f, 7.63251563f, 7.62378041f, 7.62242137f, 7.624449f, 7.62674877f, 7.62718823f,
+    7.62458418f, 7.61856518f, 7.60936906f, 7.59761397f, 7.58407623f, 7.5695009f, 7.55446232f, 7.53928292f,
+    7.52401061f, 7.50844853f, 7.49222552f, 7.47489298f, 7.45603219f, 7.43535684f, 7.41279718f, 7.38855553f,
+    7.36312634f, 7.33727837f, 7.3120007f, 7.28841785f, 7.26768276f, 7.2508585f, 7.23880106f, 7.23205553f,
+    7.23077743f, 7.23468884f, 7.24307611f, 7.25483269f, 7.2685463f, 7.28262574f, 7.29545847f, 7.30558655f,
+    7.31188554f, 7.31372936f, 7.31112336f, 7.30478892f, 7.29618552f, 7.28746013f, 7.28131972f, 7.28082953f,
+    7.28914744f, 7.30921332f, 7.34341987f, 7.39329838f, 7.45925757f, 7.54041522f, 7.6345598f, 7.73827153f,
+    7.8472189f, 7.95662672f, 8.06188577f, 8.15924339f, 8.24648057f, 8.32344927f, 8.39231931f, 8.45737747f,
+    8.52424499f, 8.59845211f, 8.68345371f, 8.77842044f, 8.87653573f, 8.96512419f, 9.02979575f, 9.06599648f,
+    9.10301199f, 9.2476992f, 9.75817809f, 11.1615827f, 14.4349712f, 21.2748946f, 34.4892378f, 58.5551509f,
+    100.399624f, 170.475041f, 284.221491f, 464.031412f,
+    // under_y = 97
+    -122.328925f, -57.7102113f, -21.1654212f, -1.74804903f, 7.64472567f, 11.4846211f, 12.4823846f, 12.2016884f,
+    11.4837524f, 10.7341932f, 10.1112755f, 9.64499383f, 9.30878581f, 9.05975895f, 8.85878039f, 8.67835171f,
+    8.50363814f, 8.33015467f, 8.16027682f, 7.99981363f, 7.85525593f, 7.73191295f, 7.63291172f, 7.55890877f,
+    7.50831406f, 7.47782525f, 7.4630969f, 7.45940825f, 7.46223633f, 7.4676811f, 7.47272353f, 7.4753235f,
+    7.47438196f, 7.46960266f, 7.46129171f, 7.45013245f, 7.43696767f, 7.42261406f, 7.40772502f, 7.39271f,
+    7.37771017f, 7.36262449f, 7.34717495f, 7.33099716f, 7.31374122f, 7.29516816f, 7.27522928f, 7.25411846f,
+    7.23229124f, 7.21044819f, 7.18948434f, 7.17040964f, 7.15424874f, 7.14193033f, 7.13417772f, 7.13141226f,
+    7.1336807f, 7.1406156f, 7.15143529f, 7.16498667f, 7.17983029f, 7.19436325f, 7.20697181f, 7.21620177f,
+    7.22093231f, 7.22053708f, 7.21501547f, 7.20507817f, 7.19217299f, 7.17844096f, 7.16659781f, 7.15974246f,
+    7.16110151f, 7.17372663f, 7.20016944f, 7.24216521f, 7.30036173f, 7.37413201f, 7.46150773f, 7.55926435f,
+    7.66317672f, 7.7684464f, 7.87027786f, 7.96455181f, 8.0485115f, 8.121346f, 8.18452787f, 8.24175119f,
+    8.29832969f, 8.35997188f, 8.43097163f, 8.5120686f, 8.59858069f, 8.67993984f, 8.74253355f, 8.77884563f,
+    8.8073963f, 8.91002143f, 9.29574831f, 10.4040948f, 13.0652514f, 18.7405542f, 29.8742228f, 50.3968764f,
+    86.4332816f, 147.281618f, 246.749852f, 404.957292f,
+    // under_y = 98
+    -110.374462f, -50.6659257f, -17.211921f, 0.315539669f, 8.59216648f, 11.8005541f, 12.4602138f, 12.0117536f,
+    11.2197965f, 10.4442385f, 9.81751126f, 9.35609427f, 9.02715419f, 8.78548487f, 8.59156138f, 8.41822982f,
+    8.25110939f, 8.08600046f, 7.92532047f, 7.77470796f, 7.64034547f, 7.52717703f, 7.43797551f, 7.37310112f,
+    7.33075016f, 7.30749563f, 7.29894909f, 7.30041291f, 7.30743427f, 7.31621164f, 7.32383698f, 7.32838193f,
+    7.32885295f, 7.32505019f, 7.31736754f, 7.30657008f, 7.2935799f, 7.27929383f, 7.26444858f, 7.24954071f,
+    7.23480114f, 7.22021814f, 7.20559817f, 7.19065105f, 7.17508523f, 7.15869903f, 7.14145586f, 7.12353406f,
+    7.10534532f, 7.0875197f, 7.07085853f, 7.05626025f, 7.04462679f, 7.03676019f, 7.0332605f, 7.03443585f,
+    7.04023522f, 7.05021239f, 7.06352737f, 7.07898848f, 7.09513456f, 7.11035342f, 7.12302879f, 7.13170478f,
+    7.13525446f, 7.133037f, 7.12502744f, 7.11190351f, 7.09507609f, 7.07665296f, 7.05933059f, 7.04621461f,
+    7.04057623f, 7.04555992f, 7.06386444f, 7.09742671f, 7.14714261f, 7.2126622f, 7.29229573f, 7.38306234f,
+    7.48090303f, 7.58106376f, 7.67863277f, 7.76918921f, 7.84948946f, 7.9180856f, 7.97574305f, 8.0255081f,
+    8.07228176f, 8.12179919f, 8.17901371f, 8.2460681f, 8.32033888f, 8.39350548f, 8.45328495f, 8.49045394f,
+    8.51514488f, 8.58826191f, 8.87635152f, 9.74154675f, 11.8824837f, 16.5476041f, 25.8492951f, 43.2162205f,
+    74.0323662f, 126.525241f, 212.982887f, 351.400543f,
+    // under_y = 99
+    -99.4614259f, -44.3430081f, -13.7481759f, 2.0547224f, 9.33135741f, 11.988262f, 12.3636399f, 11.7825235f,
+    10.938537f, 10.1499948f, 9.52651547f, 9.0732308f, 8.75255919f, 8.51802128f, 8.3303842f, 8.16326357f,
+    8.00297337f, 7.84571282f, 7.69397057f, 7.55319186f, 7.42919929f, 7.3265081f, 7.2474727f, 7.19209929f,
+    7.15832383f, 7.14256075f, 7.14035779f, 7.14703161f, 7.15820116f, 7.17017322f, 7.1801664f, 7.18638335f,
+    7.18795677f, 7.18480356f, 7.17742389f, 7.16668016f, 7.15358563f, 7.13912515f, 7.12412263f, 7.10916185f,
+    7.09456029f, 7.08038982f, 7.06653377f, 7.05276763f, 7.03884942f, 7.02460658f, 7.01000771f, 6.99521039f,
+    6.98057954f, 6.96667417f, 6.95420394f, 6.94396027f, 6.93672909f, 6.93319442f, 6.93384312f, 6.93888108f,
+    6.94817067f, 6.96119761f, 6.97707323f, 6.99457493f, 7.01222507f, 7.02840412f, 7.04149154f, 7.05002392f,
+    7.05285791f, 7.04932342f, 7.03935195f, 7.02356519f, 7.00331065f, 6.98063415f, 6.9581833f, 6.93904147f,
+    6.92649825f, 6.92376945f, 6.93368676f, 6.95838403f, 6.99901222f, 7.0555188f, 7.12652729f, 7.20934958f,
+    7.30015474f, 7.39430464f, 7.48684718f, 7.57313285f, 7.64949136f, 7.71387416f, 7.76633999f, 7.8092408f,
+    7.84696382f, 7.88511551f, 7.92911272f, 7.98230053f, 8.04397664f, 8.1081105f, 8.16415502f, 8.20222676f,
+    8.22616059f, 8.2796317f, 8.49280877f, 9.16001384f, 10.8628059f, 14.6580047f, 22.3567027f, 36.9286f,
+    63.0764314f, 108.038282f, 182.691761f, 303.053929f,
+    // under_y = 100
+    -89.5173942f, -38.6848059f, -10.7304401f, 3.50280404f, 9.88726557f, 12.0661482f, 12.2059806f, 11.523446f,
+    10.646537f, 9.85592511f, 9.24126485f, 8.79836357f, 8.48629466f, 8.25824887f, 8.07589199f, 7.91397397f,
+    7.75969879f, 7.60974489f, 7.46667841f, 7.33571344f, 7.22225241f, 7.13031401f, 7.06176912f, 7.01621367f,
+    6.99127904f, 6.98319024f, 6.98741324f, 6.99927282f, 7.01446319f, 7.02941044f, 7.04147595f, 7.04901246f,
+    7.05129892f, 7.04838825f, 7.0409041f, 7.0298204f, 7.01625225f, 7.00127942f, 6.98581618f, 6.97053338f,
+    6.95583211f, 6.94186267f, 6.92857876f, 6.91581435f, 6.90337002f, 6.89109601f, 6.87896121f, 6.86709938f,
+    6.85582773f, 6.84563557f, 6.83714463f, 6.83104523f, 6.82801522f, 6.82863016f, 6.83327442f, 6.84206295f,
+    6.8547829f, 6.87086268f, 6.88937431f, 6.90907184f, 6.92846597f, 6.94593156f, 6.95984177f, 6.96871946f,
+    6.97139422f, 6.96715151f, 6.95585964f, 6.93806039f, 6.91501056f, 6.88866409f, 6.86158849f, 6.83681398f,
+    6.81761985f, 6.80726917f, 6.80870941f, 6.82426365f, 6.85534205f, 6.9022074f, 6.96382962f, 7.03786185f,
+    7.12076411f, 7.20808858f, 7.29492376f, 7.37647156f, 7.44870465f, 7.50902126f, 7.55678564f, 7.59361969f,
+    7.62330345f, 7.65116023f, 7.68286413f, 7.72273375f, 7.77179734f, 7.82626817f, 7.87760496f, 7.916112f,
+    7.94113683f, 7.98244603f, 8.13942376f, 8.64748882f, 9.98474489f, 13.0365804f, 19.3419799f, 31.4530076f,
+    53.4486475f, 91.6563634f, 155.649902f, 259.610588f,
+    // under_y = 101
+    -80.4606743f, -33.6281162f, -8.1104973f, 4.69600246f, 10.2866328f, 12.0535837f, 12.0009711f, 11.2440304f,
+    10.3502079f, 9.56622999f, 8.96443244f, 8.53315162f, 8.22938067f, 8.00681243f, 7.82853081f, 7.67071824f,
+    7.52161475f, 7.37842353f, 7.24377126f, 7.12258902f, 7.01979164f, 6.93883146f, 6.88103197f, 6.84552587f,
+    6.82960019f, 6.82926424f, 6.83988858f, 6.85680343f, 6.87578437f, 6.89338935f, 6.9071393f, 6.91555585f,
+    6.91808323f, 6.91492818f, 6.90685327f, 6.89495633f, 6.88046317f, 6.86455385f, 6.84823505f, 6.83226385f,
+    6.81712178f, 6.8030328f, 6.79001523f, 6.77795559f, 6.76669152f, 6.7560917f, 6.74612235f, 6.73689243f,
+    6.72867247f, 6.7218854f, 6.71707038f, 6.71482406f, 6.71572531f, 6.72025166f, 6.72869634f, 6.74109508f,
+    6.75717129f, 6.77630684f, 6.7975438f, 6.81962019f, 6.8410398f, 6.86017344f, 6.87538585f, 6.88517992f,
+    6.88834751f, 6.88411434f, 6.87226566f, 6.85323917f, 6.82817297f, 6.79889818f, 6.7678695f, 6.73803113f,
+    6.71262101f, 6.69492233f, 6.6879778f, 6.69428836f, 6.71552375f, 6.75227653f, 6.80389322f, 6.86841493f,
+    6.94265514f, 7.02243236f, 7.10296047f, 7.17937941f, 7.24738357f, 7.30387681f, 7.34755411f, 7.3792849f,
+    7.40215968f, 7.42107013f, 7.44173738f, 7.46920493f, 7.50599709f, 7.55044692f, 7.59616397f, 7.63430065f,
+    7.66125817f, 7.69584121f, 7.81173755f, 8.19370264f, 9.22913983f, 11.6510895f, 16.7542209f, 26.712557f,
+    45.0367021f, 77.219712f, 131.634927f, 220.766666f,
+    // under_y = 102
+    -72.2031079f, -29.1054337f, -5.83745299f, 5.67202571f, 10.5568505f, 11.9700192f, 11.7620636f, 10.9532939f,
+    10.0553703f, 9.2844956f, 8.69810057f, 8.27871382f, 7.98235877f, 7.76394031f, 7.58838539f, 7.43353625f,
+    7.28876384f, 7.15180654f, 7.02531244f, 6.91386545f, 6.82182047f, 6.75199394f, 6.70510186f, 6.67976641f,
+    6.67289686f, 6.68026679f, 6.69714337f, 6.71886403f, 6.74129503f, 6.76114065f, 6.77609869f, 6.78487799f,
+    6.78710571f, 6.78315817f, 6.77394989f, 6.76071237f, 6.74478857f, 6.727462f, 6.70983202f, 6.6927398f,
+    6.67674346f, 6.66213566f, 6.6489941f, 6.63725284f, 6.62678246f, 6.61746728f, 6.60926985f, 6.60227522f,
+    6.59671031f, 6.59293672f, 6.59141816f, 6.59266639f, 6.59717156f, 6.6053245f, 6.61733922f, 6.63318434f,
+    6.65253128f, 6.67472616f, 6.69879051f, 6.72345368f, 6.74721738f, 6.76845006f, 6.78550618f, 6.79686277f,
+    6.80126367f, 6.79785999f, 6.78633433f, 6.76699625f, 6.74083693f, 6.70953309f, 6.67539275f, 6.6412394f,
+    6.61023596f, 6.58565545f, 6.57061138f, 6.56776677f, 6.57904664f, 6.60538314f, 6.64652531f, 6.70094557f,
+    6.76587149f, 6.83746391f, 6.91114946f, 6.98209816f, 7.04581342f, 7.09877518f, 7.13904851f, 7.16674327f,
+    7.18419301f, 7.19572027f, 7.20688597f, 7.22319876f, 7.24841132f, 7.28278664f, 7.32211892f, 7.35889595f,
+    7.38785865f, 7.41943572f, 7.50621156f, 7.78985465f, 8.57895209f, 10.472156f, 14.5461859f, 22.6348278f,
+    37.7334615f, 64.5742333f, 110.430242f, 186.223581f,
+    // under_y = 103
+    -64.653166f, -25.0474056f, -3.85967145f, 6.46855225f, 10.7247729f, 11.8340632f, 11.5017124f, 10.6592079f,
+    9.76682326f, 9.01335562f, 8.44349209f, 8.03541043f, 7.74510957f, 7.52928683f, 7.35503841f, 7.20202089f,
+    7.06077975f, 6.92956521f, 6.81098754f, 6.70920971f, 6.62795234f, 6.56932975f, 6.53339681f, 6.51822596f,
+    6.52032383f, 6.53521632f, 6.55806603f, 6.58422478f, 6.60966255f, 6.63124634f, 6.64686865f, 6.65544291f,
+    6.65679488f, 6.65148344f, 6.64058484f, 6.62547066f, 6.60760403f, 6.58837202f, 6.56896433f, 6.55030211f,
+    6.53301482f, 6.51745824f, 6.50376404f, 6.49190937f, 6.48179463f, 6.4733184f, 6.46644014f, 6.4612237f,
+    6.45785719f, 6.4566477f, 6.45799208f, 6.46232738f, 6.47006638f, 6.48152534f, 6.49685162f, 6.51595924f,
+    6.53847963f, 6.56373421f, 6.59073354f, 6.61820592f, 6.64465618f, 6.66845269f, 6.68793847f, 6.70155966f,
+    6.7080028f, 6.70633049f, 6.69610408f, 6.6774816f, 6.65127951f, 6.6189884f, 6.58273494f, 6.5451856f,
+    6.50939215f, 6.47858372f, 6.45591583f, 6.44419272f, 6.44558468f, 6.4613673f, 6.49171233f, 6.53556177f,
+    6.59061415f, 6.65344685f, 6.71978747f, 6.7849322f, 6.84428841f, 6.89399404f, 6.93153843f, 6.95628229f,
+    6.96975293f, 6.97558257f, 6.97897478f, 6.98564162f, 7.00027453f, 7.02482435f, 7.05720773f, 7.09157856f,
+    7.1220659f, 7.15296439f, 7.21986727f, 7.42827936f, 8.0189878f, 9.47308503f, 12.6742553f, 19.1520185f,
+    31.4373949f, 53.5722944f, 91.8262909f, 155.689857f,
+    // under_y = 104
+    -57.7192519f, -21.3854225f, -2.12679192f, 7.1216735f, 10.8155235f, 11.6625735f, 11.2306882f, 10.3681822f,
+    9.48795804f, 8.75420165f, 8.2007514f, 7.80267484f, 7.51671991f, 7.30182375f, 7.12747802f, 6.97523601f,
+    6.83681202f, 6.71091372f, 6.60003754f, 6.50784569f, 6.43735178f, 6.38990831f, 6.36486495f, 6.35971599f,
+    6.3705512f, 6.39264657f, 6.42106705f, 6.45119217f, 6.47911263f, 6.50187664f, 6.51758926f, 6.52538445f,
+    6.52529945f, 6.51808504f, 6.50498476f, 6.48751213f, 6.46724922f, 6.44568268f, 6.4240867f, 6.40345542f,
+    6.38448229f, 6.36757917f, 6.35292577f, 6.34053783f, 6.33034302f, 6.32225381f, 6.31622851f, 6.31231398f,
+    6.31066589f, 6.31154517f, 6.31529186f, 6.32227963f, 6.33285623f, 6.3472763f, 6.3656337f, 6.38780077f,
+    6.41338132f, 6.44168345f, 6.47171675f, 6.50221671f, 6.53169725f, 6.55852996f, 6.58104653f, 6.59765872f,
+    6.60698817f, 6.6079969f, 6.60010811f, 6.58330647f, 6.55820701f, 6.52608303f, 6.48884489f, 6.44896452f,
+    6.4093441f, 6.37313158f, 6.34349102f, 6.32334116f, 6.3150809f, 6.32032576f, 6.33968303f, 6.37259555f,
+    6.4172839f, 6.47081235f, 6.52929646f, 6.58825693f, 6.64310648f, 6.68973372f, 6.72512173f, 6.74791156f,
+    6.75879643f, 6.7606183f, 6.75804346f, 6.75673315f, 6.76201791f, 6.77725634f, 6.80234592f, 6.83329944f,
+    6.86446461f, 6.89591986f, 6.94991762f, 7.10208463f, 7.53556607f, 8.62959208f, 11.0982612f, 16.2009294f,
+    26.0527729f, 44.073217f, 75.6214349f, 128.882515f,
+    // under_y = 105
+    -51.3130988f, -18.0542417f, -0.591734009f, 7.66437911f, 10.851366f, 11.4698277f, 10.9574782f, 10.0846405f,
+    9.22046337f, 8.50698387f, 7.96881351f, 7.57893042f, 7.29543217f, 7.07981066f, 6.9040815f, 6.75170809f,
+    6.61552237f, 6.49460838f, 6.39126042f, 6.30855837f, 6.24874178f, 6.212352f, 6.19800215f, 6.20259342f,
+    6.22179739f, 6.25064921f, 6.28413226f, 6.31767385f, 6.34750665f, 6.37088028f, 6.3861299f, 6.39262368f,
+    6.39061955f, 6.38106483f, 6.36537053f, 6.3451885f, 6.3222129f, 6.29802097f, 6.273961f, 6.25108935f,
+    6.23015314f, 6.21161126f, 6.19568413f, 6.18242111f, 6.17177471f, 6.16367151f, 6.15807159f, 6.15501027f,
+    6.15461846f, 6.15712061f, 6.16281113f, 6.17201276f, 6.18502143f, 6.20204376f, 6.22313378f, 6.24813555f,
+    6.27663806f, 6.30794799f, 6.34108463f, 6.37479979f, 6.40762369f, 6.43793602f, 6.46405926f, 6.48436956f,
+    6.49741864f, 6.50205853f, 6.49756012f, 6.48371537f, 6.46091325f, 6.43017994f, 6.39317502f, 6.35213769f,
+    6.30978003f, 6.26912806f, 6.2333159f, 6.20534361f, 6.18781425f, 6.18267116f, 6.19096074f, 6.21264906f,
+    6.24652166f, 6.29019377f, 6.34025237f, 6.39254117f, 6.44258417f, 6.48612315f, 6.51971957f, 6.54134442f,
+    6.55085324f, 6.55022373f, 6.54342899f, 6.53584208f, 6.53313491f, 6.5397706f, 6.55742388f, 6.58404105f,
+    6.61482281f, 6.64724774f, 6.69343812f, 6.80481031f, 7.11618219f, 7.91949431f, 9.78123817f, 13.7228165f,
+    21.4896768f, 35.9435086f, 61.622491f, 105.52801f,
+    // under_y = 106
+    -45.353142f, -14.9945387f, 0.787402044f, 8.1251677f, 10.8507115f, 11.2668357f, 10.6878294f, 9.81073472f,
+    8.96416535f, 8.27014032f, 7.74539519f, 7.36162306f, 7.07870298f, 6.86086937f, 6.68269796f, 6.52951255f,
+    6.39517207f, 6.2790349f, 6.18309804f, 6.10978085f, 6.06049195f, 6.03492647f, 6.03094572f, 6.04485893f,
+    6.0719331f, 6.1069843f, 6.14494056f, 6.18130413f, 6.21247508f, 6.2359261f, 6.25023889f, 6.2550264f,
+    6.25077181f, 6.23861771f, 6.22013632f, 6.19710742f, 6.17132386f, 6.14443824f, 6.11785708f, 6.09268353f,
+    6.06970432f, 6.04941346f, 6.03206294f, 6.01772966f, 6.00638817f, 5.99797964f, 5.99246948f, 5.98988775f,
+    5.9903494f, 5.99405306f, 6.00125974f, 6.01225447f, 6.02729525f, 6.04655487f, 6.07006163f, 6.09764511f,
+    6.12889276f, 6.16312235f, 6.19937449f, 6.23642769f, 6.27283741f, 6.3069985f, 6.33722902f, 6.36187147f,
+    6.37940611f, 6.3885694f, 6.38846951f, 6.37868997f, 6.35937222f, 6.33126793f, 6.2957528f, 6.25479512f,
+    6.21087485f, 6.16685199f, 6.12578709f, 6.09072134f, 6.0644288f, 6.04915845f, 6.04638847f, 6.05661931f,
+    6.07923392f, 6.11245361f, 6.15341396f, 6.19837771f, 6.24308856f, 6.28325206f, 6.31510711f, 6.33602515f,
+    6.34504663f, 6.34324101f, 6.33376281f, 6.32148525f, 6.3121377f, 6.31097609f, 6.3212046f, 6.34268018f,
+    6.37191744f, 6.4051345f, 6.44711907f, 6.53015017f, 6.74920902f, 7.32240685f, 8.68913688f, 11.663151f,
+    17.6638458f, 29.0568489f, 49.6449229f, 85.3627147f,
+    // under_y = 107
+    -39.7677101f, -12.1552499f, 2.04565779f, 8.52688472f, 10.8273513f, 11.0608693f, 10.4244984f, 9.5462545f,
+    8.71704961f, 8.04069572f, 7.52714365f, 7.14739988f, 6.86339821f, 6.64218544f, 6.46085039f, 6.3064728f,
+    6.1738162f, 6.06239738f, 5.97382036f, 5.90977472f, 5.8707962f, 5.85571687f, 5.86165022f, 5.88433333f,
+    5.91865883f, 5.95925947f, 6.00104481f, 6.03962652f, 6.07160144f, 6.0946878f, 6.1077285f, 6.11058773f,
+    6.10397264f, 6.08921288f, 6.06802797f, 6.04230733f, 6.01392146f, 5.98457591f, 5.95571321f, 5.92846238f,
+    5.9036313f, 5.8817338f, 5.86304187f, 5.84765238f, 5.83555839f, 5.82671602f, 5.82109984f, 5.81874167f,
+    5.81974993f, 5.8243089f, 5.83265911f, 5.84506173f, 5.86175114f, 5.88288077f, 5.90846759f, 5.9383408f,
+    5.97209999f, 6.0090873f, 6.0483773f, 6.08878717f, 6.1289087f, 6.1671618f, 6.20186831f, 6.23134308f,
+    6.253998f, 6.26845321f, 6.27364883f, 6.26894916f, 6.25423107f, 6.229948f, 6.19716111f, 6.15753061f,
+    6.11326146f, 6.06700067f, 6.02168638f, 5.98035333f, 5.94590394f, 5.9208592f, 5.90710905f, 5.90568609f,
+    5.91658999f, 5.93869145f, 5.96974259f, 6.0065158f, 6.04508251f, 6.08122868f, 6.11098287f, 6.13120794f,
+    6.14017965f, 6.13804846f, 6.12706087f, 6.11141267f, 6.09663165f, 6.08846068f, 6.09135897f, 6.10699414f,
+    6.13350563f, 6.16693875f, 6.20715332f, 6.27179488f, 6.42369685f, 6.8195052f, 7.79055965f, 9.97134662f,
+    14.49642f, 23.2938848f, 39.512734f, 68.132967f,
+    // under_y = 108
+    -34.4978733f, -9.49556943f, 3.2098772f, 8.88588463f, 10.7899947f, 10.8552763f, 10.1672634f, 9.28877657f,
+    8.47550163f, 7.81455845f, 7.30996513f, 6.93245181f, 6.64613742f, 6.4208471f, 6.23606465f, 6.08047734f,
+    5.94960846f, 5.84301151f, 5.76180827f, 5.70690388f, 5.67793901f, 5.67288778f, 5.6881421f, 5.71890736f,
+    5.75975018f, 5.80517047f, 5.85010718f, 5.89032301f, 5.92264444f, 5.94505784f, 5.95667914f, 5.95762518f,
+    5.94881893f, 5.93176087f, 5.90829517f, 5.88039381f, 5.84997534f, 5.81876799f, 5.78822098f, 5.75946234f,
+    5.73329772f, 5.71024171f, 5.69057205f, 5.67439626f, 5.66172143f, 5.65251862f, 5.64677557f, 5.64453315f,
+    5.64590326f, 5.65106783f, 5.66026017f, 5.67373167f, 5.69170754f, 5.71433634f, 5.74163804f, 5.77345562f,
+    5.80941481f, 5.84889595f, 5.89102134f, 5.93466064f, 5.97845551f, 6.02086414f, 6.06022454f, 6.09483486f,
+    6.12304726f, 6.14337101f, 6.15457921f, 6.15581241f, 6.14667182f, 6.12729393f, 6.0983986f, 6.06130289f,
+    6.01789399f, 5.97055664f, 5.92205289f, 5.87535589f, 5.83344351f, 5.79906265f, 5.77448056f, 5.76124418f,
+    5.75997346f, 5.77021693f, 5.79039871f, 5.81788262f, 5.84917249f, 5.88025448f, 5.90707003f, 5.92608407f,
+    5.93488607f, 5.93273232f, 5.92091235f, 5.90280799f, 5.88352137f, 5.86899554f, 5.86466008f, 5.87383617f,
+    5.89647169f, 5.92930011f, 5.96929766f, 6.02343713f, 6.12931521f, 6.39339887f, 7.05656446f, 8.60049615f,
+    11.9136187f, 18.5418649f, 31.0580826f, 53.594702f,
+    // under_y = 109
+    -29.4997689f, -6.98644979f, 4.29783147f, 9.21161989f, 10.7421951f, 10.649644f, 9.91324806f, 9.03409076f,
+    8.23479188f, 7.58703364f, 7.08954411f, 6.71302466f, 6.42378811f, 6.19431794f, 6.00631898f, 5.84990632f,
+    5.72120633f, 5.61969049f, 5.54592248f, 5.49998874f, 5.48063669f, 5.48501298f, 5.50883864f, 5.54685012f,
+    5.5933553f, 5.64278677f, 5.69017157f, 5.73147169f, 5.76377886f, 5.7853694f, 5.7956404f, 5.79495662f,
+    5.78444089f, 5.76573934f, 5.74078869f, 5.71160696f, 5.68012205f, 5.6480463f, 5.61679902f, 5.58747421f,
+    5.56084694f, 5.53740979f, 5.51742928f, 5.50101256f, 5.48817535f, 5.47890332f, 5.47320142f, 5.47112717f,
+    5.47280627f, 5.47843046f, 5.48823921f, 5.50248805f, 5.52140713f, 5.54515412f, 5.57376585f, 5.60711285f,
+    5.64486081f, 5.68644245f, 5.7310426f, 5.77759883f, 5.824819f, 5.87121645f, 5.9151625f, 5.95495526f,
+    5.98890247f, 6.01541528f, 6.03310855f, 6.04090244f, 6.03811881f, 6.02456523f, 6.00059884f, 5.96716208f,
+    5.92578292f, 5.87853322f, 5.82794098f, 5.77685514f, 5.72826561f, 5.68508564f, 5.64990939f, 5.62476277f,
+    5.61087114f, 5.6084715f, 5.61669937f, 5.63357955f, 5.65614571f, 5.6807039f, 5.70323991f, 5.71994906f,
+    5.72784041f, 5.72533748f, 5.71276752f, 5.69260856f, 5.6693564f, 5.64889817f, 5.63735387f, 5.63950215f,
+    5.65717683f, 5.68845768f, 5.72914443f, 5.77898038f, 5.85648213f, 6.02816495f, 6.46058753f, 7.50716995f,
+    9.84640402f, 14.6941616f, 24.120662f, 41.5126954f,
+    // under_y = 110
+    -24.7462204f, -4.6114579f, 5.31792286f, 9.50674477f, 10.6827285f, 10.4403564f, 9.65758525f, 8.77691696f,
+    7.98980811f, 7.35354503f, 6.86203855f, 6.48607832f, 6.19408475f, 5.9610154f, 5.77058383f, 5.61413607f,
+    5.48824441f, 5.39219124f, 5.32592655f, 5.28870916f, 5.27842276f, 5.29144472f, 5.32290186f, 5.36714732f,
+    5.41831657f, 5.47085496f, 5.51994646f, 5.56180639f, 5.59382896f, 5.61460051f, 5.62380266f, 5.62203639f,
+    5.61059987f, 5.59125017f, 5.56597469f, 5.53679125f, 5.50558936f, 5.47401872f, 5.44342514f, 5.41482974f,
+    5.38894427f, 5.36621316f, 5.34687263f, 5.33101721f, 5.31866529f, 5.30981681f, 5.30449821f, 5.3027916f,
+    5.30484697f, 5.31087803f, 5.32114345f, 5.3359162f, 5.35544446f, 5.37990788f, 5.40937272f, 5.44374968f,
+    5.48275746f, 5.52589502f, 5.57242495f, 5.62136965f, 5.67152199f, 5.72147113f, 5.7696439f, 5.81436138f,
+    5.85390975f, 5.88662319f, 5.91097625f, 5.92568138f, 5.92978665f, 5.92276717f, 5.90460309f, 5.87583611f,
+    5.83759643f, 5.79159241f, 5.74005667f, 5.68564452f, 5.63128395f, 5.57998103f, 5.53458946f, 5.49755931f,
+    5.47068573f, 5.45488398f, 5.45002107f, 5.45483607f, 5.46697898f, 5.48319137f, 5.49963961f, 5.51239254f,
+    5.5180104f, 5.5141816f, 5.50031094f, 5.4779333f, 5.45080733f, 5.4245481f, 5.40570338f, 5.40028973f,
+    5.41201706f, 5.44078772f, 5.48261773f, 5.53296949f, 5.59670306f, 5.70956718f, 5.97851289f, 6.65130504f,
+    8.23015838f, 11.6497073f, 18.5468644f, 31.659429f,
+    // under_y = 111
+    -20.2274808f, -2.3668586f, 6.26956124f, 9.76779657f, 10.606461f, 10.2215594f, 9.39441523f, 8.51189202f,
+    7.73600154f, 7.11052287f, 6.62490059f, 6.25003811f, 5.95631307f, 5.72093312f, 5.52938913f, 5.37405892f,
+    5.25181404f, 5.16166076f, 5.10290577f, 5.07400047f, 5.07202437f, 5.09267247f, 5.13058011f, 5.17982515f,
+    5.2344749f, 5.28908097f, 5.33906171f, 5.38094409f, 5.41246247f, 5.43253023f, 5.44111121f, 5.43902329f,
+    5.42770646f, 5.40898451f, 5.38484392f, 5.35724687f, 5.32798843f, 5.29860164f, 5.27030921f, 5.24401598f,
+    5.22033426f, 5.1996322f, 5.1820956f, 5.16779388f, 5.15674253f, 5.14895609f, 5.14448751f, 5.14345195f,
+    5.14603446f, 5.15248267f, 5.16308667f, 5.1781488f, 5.19794663f, 5.22269243f, 5.2524922f, 5.2873071f,
+    5.32691988f, 5.37090832f, 5.41862741f, 5.46920194f, 5.52153054f, 5.57430233f, 5.62602688f, 5.67507794f,
+    5.719751f, 5.75833389f, 5.7891891f, 5.810845f, 5.82209234f, 5.82208064f, 5.81040804f, 5.78719672f,
+    5.7531454f, 5.70955014f, 5.65828505f, 5.60173657f, 5.54268699f, 5.4841477f, 5.42914696f, 5.38048354f,
+    5.34046409f, 5.31064838f, 5.29163239f, 5.28290288f, 5.28279749f, 5.2886007f, 5.29679627f, 5.30348084f,
+    5.30492017f, 5.29819961f, 5.28188622f, 5.25658453f, 5.22523889f, 5.19302286f, 5.16667574f, 5.1532213f,
+    5.1581631f, 5.18353775f, 5.22667437f, 5.2812271f, 5.34310671f, 5.42545072f, 5.58888116f, 5.99617898f,
+    7.00437052f, 9.3123349f, 14.1887184f, 23.8135619f,
+    // under_y = 112
+    -15.9509369f, -0.2608114f, 7.14428454f, 9.98648911f, 10.5057087f, 9.98651097f, 9.11817556f, 8.23476654f,
+    7.47047311f, 6.85637325f, 6.3777309f, 6.00554136f, 5.71195963f, 5.4762062f, 5.2853186f, 5.13251933f,
+    5.01485337f, 4.93099034f, 4.87959394f, 4.85835948f, 4.86365187f, 4.89059852f, 4.93347041f, 4.98619826f,
+    5.04290104f, 5.09834091f, 5.14825445f, 5.18954077f, 5.22031066f, 5.23981727f, 5.24829784f, 5.24675975f,
+    5.23674247f, 5.22008319f, 5.19870723f, 5.17445786f, 5.14897279f, 5.12360907f, 5.09941275f, 5.0771265f,
+    5.05722592f, 5.03997474f, 5.02548912f, 5.01380243f, 5.00492356f, 4.99888383f, 4.99576936f, 4.99573793f,
+    4.99902077f, 5.00591091f, 5.01674077f, 5.03185181f, 5.05155934f, 5.07611538f, 5.10567195f, 5.14024709f,
+    5.17969493f, 5.22368143f, 5.27166662f, 5.32289433f, 5.37639046f, 5.43097075f, 5.48525921f, 5.53771835f,
+    5.58669221f, 5.63046293f, 5.66732057f, 5.69564539f, 5.71400003f, 5.72122779f, 5.71655126f, 5.6996641f,
+    5.67080721f, 5.63081961f, 5.58115416f, 5.52384921f, 5.46144911f, 5.39687002f, 5.33321232f, 5.27352691f,
+    5.22054963f, 5.17642553f, 5.14245162f, 5.11887241f, 5.10476538f, 5.0980526f, 5.09566807f, 5.09389718f,
+    5.08888413f, 5.07727442f, 5.05692468f, 5.02757321f, 4.9913278f, 4.95280056f, 4.91871817f, 4.89687747f,
+    4.89443056f, 4.91570695f, 4.9601624f, 5.02165165f, 5.09113705f, 5.1662755f, 5.27320411f, 5.50843747f,
+    6.11230013f, 7.58999619f, 10.9025668f, 17.7579693f,
+    // under_y = 113
+    -11.9396643f, 1.68837519f, 7.92763228f, 10.1515878f, 10.3720265f, 9.72922665f, 8.82506917f, 7.94368091f,
+    7.19305634f, 6.59237667f, 6.12300835f, 5.75601801f, 5.46516524f, 5.23145978f, 5.04327494f, 4.89451576f,
+    4.78230328f, 4.70494056f, 4.66047957f, 4.64594058f, 4.6570911f, 4.6886298f, 4.73461057f, 4.78896087f,
+    4.84598238f, 4.90075893f, 4.94943198f, 4.98933261f, 5.01898072f, 5.03797616f, 5.04681351f, 5.0466542f,
+    5.03908672f, 5.02590062f, 5.00889308f, 4.98971964f, 4.96979389f, 4.95023515f, 4.93185862f, 4.91519966f,
+    4.90056208f, 4.88808019f, 4.87778511f, 4.8696674f, 4.86372975f, 4.86002612f, 4.85868535f, 4.85991937f,
+    4.86401738f, 4.87132864f, 4.88223674f, 4.89712861f, 4.9163611f, 4.94022753f, 4.9689262f, 5.00253191f,
+    5.04097127f, 5.08400221f, 5.13119769f, 5.18193411f, 5.23538483f, 5.29051965f, 5.34611186f, 5.40075435f,
+    5.452887f, 5.50083701f, 5.54287384f, 5.57727916f, 5.60243123f, 5.61690109f, 5.61955633f, 5.60966576f,
+    5.58699639f, 5.5518927f, 5.50532682f, 5.44890872f, 5.38484639f, 5.3158491f, 5.24497086f, 5.17539753f,
+    5.11018764f, 5.05198576f, 5.00273464f, 4.96342048f, 4.93389007f, 4.91278091f, 4.89760133f, 4.88498806f,
+    4.87115029f, 4.8524831f, 4.82629837f, 4.79158036f, 4.74963052f, 4.70442866f, 4.66251735f, 4.63223131f,
+    4.62216729f, 4.63895802f, 4.68472098f, 4.7550602f, 4.83928481f, 4.92567188f, 5.01626897f, 5.15806038f,
+    5.50050604f, 6.39373908f, 8.54736858f, 13.2772264f,
+    // under_y = 114
+    -8.22977541f, 3.4549284f, 8.60171573f, 10.2512659f, 10.1982885f, 9.44625229f, 8.51452043f, 7.64031268f,
+    6.90717625f, 6.32328685f, 5.86646225f, 5.50787192f, 5.22275129f, 4.99371495f, 4.81029755f, 4.66695882f,
+    4.56083104f, 4.48985104f, 4.45151802f, 4.4422828f, 4.45745342f, 4.49145558f, 4.53828591f, 4.59202094f,
+    4.64728055f, 4.69958228f, 4.74555691f, 4.78302266f, 4.81093483f, 4.8292394f, 4.83866438f, 4.84048229f,
+    4.83627344f, 4.82771339f, 4.81640048f, 4.80373198f, 4.79083078f, 4.77851897f, 4.76733073f, 4.75755459f,
+    4.74929422f, 4.74253711f, 4.73722195f, 4.73329747f, 4.73076778f, 4.72972154f, 4.73034466f, 4.73291771f,
+    4.73780082f, 4.7454093f, 4.75618377f, 4.77055798f, 4.78892732f, 4.81161986f, 4.83887109f, 4.87080272f,
+    4.90740508f, 4.94852245f, 4.99384047f, 5.04287498f, 5.09496242f, 5.1492521f, 5.20470221f, 5.26008152f,
+    5.31397973f, 5.3648297f, 5.41094441f, 5.45057105f, 5.48196323f, 5.50347073f, 5.51364357f, 5.51134525f,
+    5.49586691f, 5.46703209f, 5.42528011f, 5.371715f, 5.30810774f, 5.2368412f, 5.16079132f, 5.08314326f,
+    5.00714897f, 4.93584056f, 4.87172339f, 4.81648151f, 4.7707352f, 4.73389467f, 4.70415359f, 4.67865902f,
+    4.65387953f, 4.62616946f, 4.59249384f, 4.55123699f, 4.50297136f, 4.45101734f, 4.4015903f, 4.36332279f,
+    4.34598991f, 4.35838603f, 4.4055422f, 4.4858932f, 4.58967296f, 4.70083151f, 4.80624471f, 4.91807746f,
+    5.11804842f, 5.63625493f, 6.98242862f, 10.1543401f,
+    // under_y = 115
+    -4.86659098f, 5.00913484f, 9.14832696f, 10.2757359f, 9.9808157f, 9.13828896f, 8.1903205f, 7.33057993f,
+    6.62015832f, 6.05729883f, 5.61675535f, 5.26993461f, 4.99349787f, 4.77154136f, 4.59463478f, 4.45770311f,
+    4.35785554f, 4.29268723f, 4.25922207f, 4.25346049f, 4.27039793f, 4.30434745f, 4.34940908f, 4.39995818f,
+    4.45106292f, 4.49877901f, 4.54030185f, 4.57398203f, 4.59922642f, 4.61631715f, 4.62618341f, 4.63015929f,
+    4.62975536f, 4.62646494f, 4.62161761f, 4.6162853f, 4.6112397f, 4.60695463f, 4.60364348f, 4.60132052f,
+    4.59987401f, 4.59914076f, 4.59897293f, 4.59929114f, 4.60011979f, 4.60160377f, 4.60400751f, 4.60769929f,
+    4.61312464f, 4.62077342f, 4.63114469f, 4.64471323f, 4.66190029f, 4.68305021f, 4.70841321f, 4.73813358f,
+    4.77224183f, 4.81064861f, 4.85313857f, 4.89936237f, 4.94882596f, 5.00087743f, 5.05469271f, 5.1092627f,
+    5.16338568f, 5.21566913f, 5.26454563f, 5.30830699f, 5.34515956f, 5.37330198f, 5.39102422f, 5.39682394f,
+    5.38953289f, 5.36844347f, 5.33342275f, 5.28499967f, 5.22441066f, 5.15359023f, 5.07509601f, 4.99196277f,
+    4.9074871f, 4.82495308f, 4.747319f, 4.67689548f, 4.61505405f, 4.56201218f, 4.51674309f, 4.47705479f,
+    4.43987152f, 4.40172982f, 4.35947018f, 4.3110646f, 4.25647162f, 4.19835935f, 4.14249105f, 4.09754124f,
+    4.07412292f, 4.08288496f, 4.13172452f, 4.22250122f, 4.34820851f, 4.49243925f, 4.6342909f, 4.76373059f,
+    4.9150584f, 5.22968536f, 6.06424547f, 8.16641145f,
+    // under_y = 116
+    -1.89978778f, 6.32147576f, 9.55229716f, 10.2198154f, 9.72116884f, 8.81125875f, 7.86102859f, 7.02445317f,
+    6.34253291f, 5.80493034f, 5.38402623f, 5.05174938f, 4.78624516f, 4.57304482f, 4.40367939f, 4.27348399f,
+    4.17953094f, 4.11910802f, 4.08884274f, 4.08439931f, 4.10059742f, 4.13178407f, 4.17230686f, 4.21697136f,
+    4.26140496f, 4.30228663f, 4.33743321f, 4.36575584f, 4.38711435f, 4.40210499f, 4.41181722f, 4.41759211f,
+    4.42080781f, 4.42270999f, 4.42429631f, 4.42625676f, 4.42896515f, 4.43251256f, 4.43677076f, 4.44147263f,
+    4.44629697f, 4.45094717f, 4.45521521f, 4.45902597f, 4.46245954f, 4.46575207f, 4.46927806f, 4.47351871f,
+    4.47902162f, 4.48635751f, 4.49607909f, 4.50868613f, 4.52459935f, 4.5441442f, 4.56754404f, 4.59492079f,
+    4.62630014f, 4.66161788f, 4.70072379f, 4.74338031f, 4.78925386f, 4.83789838f, 4.88873225f, 4.94101131f,
+    4.9938023f, 5.0459623f, 5.0961303f, 5.14273683f, 5.18403696f, 5.21817001f, 5.24324701f, 5.2574636f,
+    5.25923278f, 5.24732814f, 5.22102483f, 5.18022326f, 5.12553868f, 5.0583405f, 4.98072693f, 4.89542539f,
+    4.80561531f, 4.71467887f, 4.62589538f, 4.54210609f, 4.46538662f, 4.39677324f, 4.33609425f, 4.28195716f,
+    4.23193467f, 4.18297445f, 4.13203018f, 4.07687181f, 4.01698448f, 3.95441104f, 3.89433951f, 3.84519641f,
+    3.8179966f, 3.82474614f, 3.87583216f, 3.97661045f, 4.12388174f, 4.30371389f, 4.49322521f, 4.67062843f,
+    4.84021251f, 5.08221826f, 5.64199729f, 7.07874284f,
+    // under_y = 117
+    0.622164582f, 7.36698062f, 9.80464462f, 10.0849162f, 9.42705555f, 8.47622882f, 7.53902706f, 6.73426298f,
+    6.08571984f, 5.57620634f, 5.17669208f, 4.86010354f, 4.6062576f, 4.40215577f, 4.24026281f, 4.11628816f,
+    4.02725266f, 3.97015567f, 3.94128145f, 3.93603905f, 3.9491717f, 3.97516683f, 4.0087229f, 4.04516704f,
+    4.08075862f, 4.11284993f, 4.13990497f, 4.16139719f, 4.17761974f, 4.18944563f, 4.19807446f, 4.20479663f,
+    4.21079826f, 4.2170209f, 4.22408158f, 4.23225109f, 4.24148222f, 4.25147588f, 4.26177076f, 4.27184214f,
+    4.28119659f, 4.28945198f, 4.29639535f, 4.30201462f, 4.30650367f, 4.31024336f, 4.31376335f, 4.31769111f,
+    4.32269534f, 4.32943067f, 4.33848973f, 4.35036701f, 4.36543721f, 4.3839485f, 4.4060293f, 4.43170529f,
+    4.46092219f, 4.49356928f, 4.52949817f, 4.5685327f, 4.61046633f, 4.65504576f, 4.70194124f, 4.75070642f,
+    4.8007325f, 4.85120347f, 4.90105982f, 4.94897912f, 4.99338067f, 5.0324603f, 5.06425866f, 5.08676315f,
+    5.09803957f, 5.09638556f, 5.08049356f, 5.04960778f, 5.00365711f, 4.94334511f, 4.8701795f, 4.78642693f,
+    4.6949848f, 4.59917049f, 4.50243824f, 4.40804602f, 4.31870636f, 4.23626582f, 4.16146545f, 4.09383731f,
+    4.03178768f, 3.97290369f, 3.91449588f, 3.85435274f, 3.79163638f, 3.72779242f, 3.66729003f, 3.61795674f,
+    3.59064643f, 3.59799771f, 3.6521388f, 3.76141723f, 3.92663793f, 4.13796026f, 4.37463252f, 4.61125927f,
+    4.83646258f, 5.09281091f, 5.55099298f, 6.63670731f,
+    // under_y = 118
+    2.65776571f, 8.12920061f, 9.90484498f, 9.87973407f, 9.11158936f, 8.14740634f, 7.23742769f, 6.47069623f,
+    5.85729063f, 5.375357f, 4.99574258f, 4.69306666f, 4.4491414f, 4.25254665f, 4.09667815f, 3.97757304f,
+    3.89214963f, 3.83708322f, 3.80830156f, 3.80096631f, 3.80976706f, 3.82936177f, 3.85482915f, 3.88203983f,
+    3.90789458f, 3.93041309f, 3.94868439f, 3.96270736f, 3.97315937f, 3.98113316f, 3.98787812f, 3.99457563f,
+    4.00216826f, 4.01125337f, 4.02204254f, 4.03438037f, 4.04781111f, 4.06167767f, 4.07523657f, 4.08777291f,
+    4.09870179f, 4.10764563f, 4.11448107f, 4.11935304f, 4.12265753f, 4.12499774f, 4.12712086f, 4.12984405f,
+    4.13397861f, 4.1402609f, 4.149297f, 4.1615261f, 4.17720522f, 4.19641513f, 4.21908495f, 4.24503063f,
+    4.27400123f, 4.30572556f, 4.33995233f, 4.3764771f, 4.41515126f, 4.45587016f, 4.49854019f, 4.54302733f,
+    4.5890923f, 4.63632002f, 4.68405243f, 4.73133496f, 4.77688648f, 4.81910155f, 4.85609107f, 4.88576428f,
+    4.9059507f, 4.91455565f, 4.90973861f, 4.89009876f, 4.85484893f, 4.80395714f, 4.73823477f, 4.65935306f,
+    4.56977463f, 4.47259439f, 4.37129437f, 4.2694291f, 4.17027061f, 4.07645474f, 3.98968009f, 3.91051669f,
+    3.83838068f, 3.77172139f, 3.70844694f, 3.64658225f, 3.58510873f, 3.52488112f, 3.46945693f, 3.42561809f,
+    3.40332567f, 3.41484834f, 3.47287339f, 3.58758763f, 3.76305931f, 3.99383551f, 4.26358698f, 4.5490055f,
+    4.83413994f, 5.14313717f, 5.60316649f, 6.55443933f,
+    // under_y = 119
+    4.17766389f, 8.60293191f, 9.86128394f, 9.61864831f, 8.78987378f, 7.83715529f, 6.96377243f, 6.23542802f,
+    5.65277038f, 5.19201557f, 4.82554437f, 4.53059452f, 4.29142212f, 4.0983377f, 3.94564915f, 3.82961451f,
+    3.74690742f, 3.69373203f, 3.66552275f, 3.65707259f, 3.66291119f, 3.67777196f, 3.69702536f, 3.7169993f,
+    3.7351488f, 3.75007155f, 3.76138998f, 3.76953633f, 3.77548278f, 3.78045874f, 3.78569131f, 3.79219596f,
+    3.80063414f, 3.81124419f, 3.82384231f, 3.83788327f, 3.85256517f, 3.8669598f, 3.8801501f, 3.89135729f,
+    3.90004385f, 3.90598231f, 3.90928488f, 3.9103932f, 3.9100323f, 3.90913582f, 3.90875234f, 3.90994384f,
+    3.91368757f, 3.92079121f, 3.93182988f, 3.94711028f, 3.96666454f, 3.99027306f, 4.01751243f, 4.04782208f,
+    4.08058126f, 4.11518699f, 4.15112335f, 4.18801339f, 4.22564673f, 4.26397833f, 4.30309708f, 4.34316612f,
+    4.38434025f, 4.42666876f, 4.46999451f, 4.51386138f, 4.55744286f, 4.59950334f, 4.63840176f, 4.67214352f,
+    4.69848239f, 4.71506856f, 4.71963387f, 4.71019936f, 4.68528635f, 4.64410843f, 4.58672088f, 4.51410511f,
+    4.42816948f, 4.33165485f, 4.22794287f, 4.12077649f, 4.01391603f, 3.91076699f, 3.81402814f, 3.7254165f,
+    3.64552853f, 3.57389136f, 3.50924181f, 3.45004361f, 3.39521313f, 3.34497262f, 3.30169211f, 3.27052271f,
+    3.25957904f, 3.27941498f, 3.34158374f, 3.4562173f, 3.62885636f, 3.85727711f, 4.12988742f, 4.4285173f,
+    4.74025298f, 5.08554336f, 5.5733681f, 6.49907461f,
+    // under_y = 120
+    5.16816575f, 8.79450951f, 9.68864333f, 9.31653209f, 8.47158134f, 7.54669112f, 6.70918522f, 6.00906083f,
+    5.44267779f, 4.98765277f, 4.61994043f, 4.32053982f, 4.07668755f, 3.8805672f, 3.72729742f, 3.6131162f,
+    3.53414111f, 3.48576722f, 3.46259729f, 3.45873069f, 3.46823165f, 3.48562463f, 3.5063079f, 3.52682173f,
+    3.54494874f, 3.55965592f, 3.57090958f, 3.57940673f, 3.58626969f, 3.59274705f, 3.59995655f, 3.60869428f,
+    3.61932319f, 3.63174266f, 3.64543144f, 3.65954913f, 3.67307648f, 3.68497336f, 3.69433323f, 3.70051608f,
+    3.70324544f, 3.70266065f, 3.69932055f, 3.69416064f, 3.68840996f, 3.68347792f, 3.68082379f, 3.68182257f,
+    3.68764084f, 3.69913452f, 3.71677814f, 3.74063169f, 3.77034748f, 3.80521538f, 3.84424125f, 3.88625012f,
+    3.93000342f, 3.97431811f, 4.01817537f, 4.06080743f, 4.10175301f, 4.14087486f, 4.1783364f, 4.21453851f,
+    4.25002173f, 4.2853427f, 4.32093717f, 4.3569839f, 4.39328491f, 4.42917707f, 4.46348834f, 4.49454818f,
+    4.5202577f, 4.5382187f, 4.54591527f, 4.54093483f, 4.52121001f, 4.48525818f, 4.43239268f, 4.36287956f,
+    4.27801611f, 4.18011295f, 4.07237047f, 3.9586512f, 3.84316368f, 3.73008711f, 3.6231797f, 3.52542462f,
+    3.4387729f, 3.36404171f, 3.30101519f, 3.24877291f, 3.20623632f, 3.17287793f, 3.14948303f, 3.13879796f,
+    3.14585169f, 3.17771745f, 3.24251386f, 3.34756592f, 3.49690609f, 3.68875895f, 3.91440656f, 4.16098576f,
+    4.42246366f, 4.72544935f, 5.17984554f, 6.06889271f,
+    // under_y = 121
+    5.63158596f, 8.71809082f, 9.40057423f, 8.97828499f, 8.14781739f, 7.25074047f, 6.43127714f, 5.73270339f,
+    5.1531803f, 4.67568152f, 4.28214651f, 3.95864957f, 3.69596239f, 3.48818662f, 3.33096929f, 3.22004798f,
+    3.15039588f, 3.11596343f, 3.10987821f, 3.12491913f, 3.15408921f, 3.19114716f, 3.23100537f, 3.26994811f,
+    3.30566389f, 3.33711522f, 3.36428794f, 3.38787092f, 3.40891696f, 3.42852961f, 3.44761006f, 3.46668584f,
+    3.4858302f, 3.50466914f, 3.52246373f, 3.53824808f, 3.55099972f, 3.55981772f, 3.56408595f, 3.56360194f,
+    3.55865774f, 3.55006446f, 3.53911921f, 3.52751866f, 3.51722879f, 3.5103243f, 3.50881353f, 3.51446583f,
+    3.52865742f, 3.55224999f, 3.58551273f, 3.62809475f, 3.67905f, 3.73691215f, 3.79981263f, 3.86563099f,
+    3.93216424f, 3.99729982f, 4.05917653f, 4.11631895f, 4.16773264f, 4.21295102f, 4.25202901f, 4.28548313f,
+    4.31418266f, 4.33920139f, 4.36164328f, 4.38245873f, 4.40226973f, 4.42122265f, 4.43888577f, 4.45420574f,
+    4.46553239f, 4.47071548f, 4.46726997f, 4.45259944f, 4.42426017f, 4.38024261f, 4.31924256f, 4.24089237f,
+    4.14592343f, 4.03623502f, 3.91485223f, 3.78576579f, 3.65365989f, 3.52354835f, 3.40035425f, 3.2884808f,
+    3.19143032f, 3.11153077f, 3.04982363f, 3.00615025f, 2.97944611f, 2.96821315f, 2.97109203f, 2.98740524f,
+    3.01749809f, 3.06268336f, 3.12462238f, 3.20408283f, 3.29924921f, 3.4041889f, 3.50877582f, 3.60245221f,
+    3.68580183f, 3.79618272f, 4.05683834f, 4.76322814f,
+    // under_y = 122
+    5.58147631f, 8.38588096f, 8.99555008f, 8.58094713f, 7.7701187f, 6.87402826f, 6.02869899f, 5.28113306f,
+    4.6383736f, 4.09332117f, 3.63662605f, 3.26083453f, 2.96071343f, 2.73210163f, 2.57057226f, 2.47049923f,
+    2.42470219f, 2.42461279f, 2.46079995f, 2.52366661f, 2.60415133f, 2.69431166f, 2.78771615f, 2.87961858f,
+    2.96692605f, 3.04799895f, 3.12233638f, 3.19020519f, 3.25226795f, 3.30925531f, 3.36171602f, 3.40986297f,
+    3.45351998f, 3.49216137f, 3.52502698f, 3.55128849f, 3.57023985f, 3.58148443f, 3.58509419f, 3.58172115f,
+    3.57264764f, 3.55976883f, 3.54550853f, 3.53267565f, 3.52427421f, 3.52328433f, 3.53243347f, 3.55397837f,
+    3.58951667f, 3.63984444f, 3.70487236f, 3.7836075f, 3.87420299f, 3.97407185f, 4.08005601f, 4.18863736f,
+    4.29617401f, 4.39914281f, 4.49436886f, 4.57922337f, 4.6517738f, 4.71087396f, 4.75618647f, 4.78813552f,
+    4.8077938f, 4.81671289f, 4.81671191f, 4.809643f, 4.79715512f, 4.78047863f, 4.76025249f, 4.73641289f,
+    4.70815785f, 4.67399606f, 4.63188086f, 4.57942223f, 4.51416154f, 4.43388637f, 4.3369567f, 4.22260983f,
+    4.09121024f, 3.94441279f, 3.78521321f, 3.61786888f, 3.44768504f, 3.28067562f, 3.12312342f, 2.98107831f,
+    2.8598443f, 2.76351252f, 2.69459657f, 2.65381694f, 2.64006026f, 2.65050845f, 2.68089324f, 2.72578865f,
+    2.77881757f, 2.83263266f, 2.87855988f, 2.90589669f, 2.90108113f, 2.84735242f, 2.72618732f, 2.52282109f,
+    2.23967818f, 1.92370895f, 1.71665951f, 1.94144352f
+};
+
+// 補間による高速予測関数 (表の範囲外はHorner法にフォールバック)
+float predict_distance_lut_bilinear(float under_y, float theta);
+float predict_distance_lut_bicubic(float under_y, float theta);
+
+#endif // TEENSY_LUT_MODEL_H
@@ -0,0 +1,145 @@
+/*
+ * Teensy 4.1 多項式回帰モデル - バイナリモデルファイル (.dpm) の読み込み実装
+ *
+ * 検証はヘッダの各フィールドとCRC32のみで、係数はコピーせずファイルの内容をそのまま評価する
+ * (ホストではメモリマップした領域、実機ではSDカードから読み込んだバッファ)
+ */
+
+#include "teensy_model_blob.h"
+#include "teensy_horner_model.h"
+#include <stddef.h>
+#include <string.h>
+
+const RuntimeModel BUILTIN_RUNTIME_MODEL = {
+    POLY_DEGREE, HORNER_TERM_COUNT, HORNER_INTERCEPT, HORNER_COEFFICIENTS,
+    UNDER_Y_MIN, UNDER_Y_MAX, THETA_MIN, THETA_MAX, 0.900133f
+};
+
+// 4ビットずつ処理するCRC32表 (反転多項式 0xEDB88320, 64バイト)
+static const uint32_t CRC32_NIBBLE_TABLE[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+uint32_t model_blob_crc32(const uint8_t* data, size_t size, uint32_t crc) {
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ CRC32_NIBBLE_TABLE[crc & 0x0F];
+        crc = (crc >> 4) ^ CRC32_NIBBLE_TABLE[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+ModelBlobStatus parse_model_blob(const uint8_t* data, size_t size, RuntimeModel& model) {
+    if (size < MODEL_BLOB_HEADER_SIZE) {
+        return MODEL_BLOB_TOO_SMALL;
+    }
+    // ヘッダは境界を仮定せずコピーして読む
+    ModelBlobHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != MODEL_BLOB_MAGIC) {
+        return MODEL_BLOB_BAD_MAGIC;
+    }
+    if (header.version != MODEL_BLOB_VERSION) {
+        return MODEL_BLOB_BAD_VERSION;
+    }
+    if (header.basis != MODEL_BASIS_MONOMIAL_HORNER) {
+        return MODEL_BLOB_UNSUPPORTED_BASIS;
+    }
+    const uint32_t expected_terms = (uint32_t)(header.degree + 1) * (header.degree + 2) / 2;
+    if (header.header_size < MODEL_BLOB_HEADER_SIZE || header.degree > MODEL_BLOB_MAX_DEGREE ||
+        header.term_count != expected_terms || header.coefficient_offset < header.header_size ||
+        header.coefficient_offset > size ||
+        sizeof(double) * header.term_count > size - header.coefficient_offset) {  // 加算の桁あふれを避ける
+        return MODEL_BLOB_BAD_LAYOUT;
+    }
+    const uint8_t* coefficients = data + header.coefficient_offset;
+    if ((uintptr_t)coefficients % alignof(double) != 0) {
+        return MODEL_BLOB_MISALIGNED;
+    }
+    const size_t coefficient_bytes = sizeof(double) * header.term_count;
+    uint32_t crc = model_blob_crc32(data, offsetof(ModelBlobHeader, crc32));
+    crc = model_blob_crc32(coefficients, coefficient_bytes, crc);
+    if (crc != header.crc32) {
+        return MODEL_BLOB_BAD_CRC;
+    }
+
+    model.degree = header.degree;
+    model.term_count = (int)header.term_count;
+    model.intercept = header.intercept;
+    model.coefficients = (const double*)coefficients;
+    model.under_y_min = header.under_y_min;
+    model.under_y_max = header.under_y_max;
+    model.theta_min = header.theta_min;
+    model.theta_max = header.theta_max;
+    model.validation_mae = header.validation_mae;
+    return MODEL_BLOB_OK;
+}
+
+const char* model_blob_status_name(ModelBlobStatus status) {
+    switch (status) {
+        case MODEL_BLOB_OK: return "ok";
+        case MODEL_BLOB_TOO_SMALL: return "file too small";
+        case MODEL_BLOB_BAD_MAGIC: return "bad magic";
+        case MODEL_BLOB_BAD_VERSION: return "unsupported version";
+        case MODEL_BLOB_UNSUPPORTED_BASIS: return "unsupported basis";
+        case MODEL_BLOB_BAD_LAYOUT: return "inconsistent layout";
+        case MODEL_BLOB_MISALIGNED: return "coefficients not 8-byte aligned";
+        case MODEL_BLOB_BAD_CRC: return "CRC mismatch";
+    }
+    return "unknown";
+}
+
+// evaluate_horner_double と同じ順序 (次数のみ実行時に決まる)
+TEENSY_FAST double evaluate_runtime_model(const RuntimeModel& model, double under_y, double theta) {
+    const double* coeff = model.coefficients;
+    const int degree = model.degree;
+    double acc = 0.0;
+
+    for (int i = degree; i >= 0; i--) {
+        double q = *coeff++;
+        for (int j = degree - i; j > 0; j--) {
+            q = q * theta + *coeff++;
+        }
+        acc = acc * under_y + q;
+    }
+
+    return acc + model.intercept;
+}
+
+TEENSY_FAST float predict_distance_runtime(const RuntimeModel& model, float under_y, float theta) {
+    if (!(under_y >= model.under_y_min && under_y <= model.under_y_max &&
+          theta >= model.theta_min && theta <= model.theta_max)) {
+        return -1.0f;  // エラー指標
+    }
+    return (float)evaluate_runtime_model(model, (double)under_y, (double)theta);
+}
+
+// 2面バッファ (係数を直接参照するため8バイト境界)
+alignas(8) static uint8_t blob_slots[2][MODEL_BLOB_MAX_BYTES];
+static RuntimeModel slot_models[2];
+static int staging_slot = 0;
+static const RuntimeModel* volatile active_model = &BUILTIN_RUNTIME_MODEL;
+
+uint8_t* model_blob_staging_buffer() {
+    return blob_slots[staging_slot];
+}
+
+ModelBlobStatus commit_model_blob(size_t size) {
+    if (size > MODEL_BLOB_MAX_BYTES) {
+        return MODEL_BLOB_BAD_LAYOUT;
+    }
+    ModelBlobStatus status = parse_model_blob(blob_slots[staging_slot], size, slot_models[staging_slot]);
+    if (status != MODEL_BLOB_OK) {
+        return status;
+    }
+    // ポインタの切り替えは1ワードの書き込み (以後は旧アクティブ面が書き込み先)
+    active_model = &slot_models[staging_slot];
+    staging_slot ^= 1;
+    return MODEL_BLOB_OK;
+}
+
+const RuntimeModel* active_runtime_model() {
+    return active_model;
+}
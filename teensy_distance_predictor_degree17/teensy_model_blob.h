@@ -0,0 +1,97 @@
+/*
+ * Teensy 4.1 多項式回帰モデル - バイナリモデルファイル (.dpm) の読み込み
+ * 生成スクリプト: export_teensy_model.py blob
+ *
+ * 係数表をコンパイルせずに任意の .joblib のモデルへ切り替えるための形式 (リトルエンディアン):
+ *   ヘッダ 64バイト (ModelBlobHeader) + 倍精度係数 term_count 個 (coefficient_offset から, 8バイト境界)
+ * 係数はStandardScaler畳み込み済み・Horner評価順 (HORNER_COEFFICIENTS と同じ並び) のため、
+ * 読み込み時の変換は不要で、ファイルの内容をそのまま参照して評価する
+ * CRC32 (zlib互換) はヘッダの先頭60バイトと係数領域を対象とする
+ */
+
+#ifndef TEENSY_MODEL_BLOB_H
+#define TEENSY_MODEL_BLOB_H
+
+#include "teensy_polynomial_model.h"
+
+const uint32_t MODEL_BLOB_MAGIC = 0x424D5044;  // "DPMB"
+const uint16_t MODEL_BLOB_VERSION = 1;
+const uint16_t MODEL_BLOB_HEADER_SIZE = 64;
+const int MODEL_BLOB_MAX_DEGREE = 20;
+
+// 係数の基底・並び
+const uint16_t MODEL_BASIS_MONOMIAL_HORNER = 0;  // 単項式, 外側under_y^N→^0, 内側theta降順
+
+struct ModelBlobHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_size;
+    uint16_t degree;
+    uint16_t basis;
+    uint32_t term_count;          // (degree + 1)(degree + 2) / 2
+    uint32_t coefficient_offset;  // ファイル先頭からの係数の位置 (8の倍数)
+    uint32_t flags;               // 予約 (0)
+    double intercept;             // 畳み込み済み切片
+    float under_y_min;            // 入力検証範囲
+    float under_y_max;
+    float theta_min;
+    float theta_max;
+    float validation_mae;         // 学習時の検証MAE (不明ならNaN)
+    uint32_t reserved[2];
+    uint32_t crc32;
+};
+
+static_assert(sizeof(ModelBlobHeader) == MODEL_BLOB_HEADER_SIZE, "ModelBlobHeader must be 64 bytes");
+
+// 最大次数のモデルが収まるファイルサイズ (実機の読み込みバッファ用)
+const size_t MODEL_BLOB_MAX_BYTES = MODEL_BLOB_HEADER_SIZE +
+                                    sizeof(double) * (MODEL_BLOB_MAX_DEGREE + 1) * (MODEL_BLOB_MAX_DEGREE + 2) / 2;
+
+enum ModelBlobStatus {
+    MODEL_BLOB_OK = 0,
+    MODEL_BLOB_TOO_SMALL,
+    MODEL_BLOB_BAD_MAGIC,
+    MODEL_BLOB_BAD_VERSION,
+    MODEL_BLOB_UNSUPPORTED_BASIS,
+    MODEL_BLOB_BAD_LAYOUT,
+    MODEL_BLOB_MISALIGNED,
+    MODEL_BLOB_BAD_CRC
+};
+
+// 評価に必要な情報 (係数はファイルの内容を直接指す)
+struct RuntimeModel {
+    int degree;
+    int term_count;
+    double intercept;
+    const double* coefficients;  // Horner評価順
+    float under_y_min;
+    float under_y_max;
+    float theta_min;
+    float theta_max;
+    float validation_mae;
+};
+
+// コンパイル時に組み込まれた17次モデル (HORNER_COEFFICIENTS)
+extern const RuntimeModel BUILTIN_RUNTIME_MODEL;
+
+// zlib互換のCRC32 (crc に前回の値を渡すと続きから計算)
+uint32_t model_blob_crc32(const uint8_t* data, size_t size, uint32_t crc = 0);
+
+// data (8バイト境界) を検証して model に展開する。data はモデル使用中は解放しないこと
+ModelBlobStatus parse_model_blob(const uint8_t* data, size_t size, RuntimeModel& model);
+const char* model_blob_status_name(ModelBlobStatus status);
+
+// 任意次数のネストHorner評価 (入力検証なし)
+double evaluate_runtime_model(const RuntimeModel& model, double under_y, double theta);
+
+// モデル自身の入力検証範囲で検証して予測 (範囲外は -1.0f)
+float predict_distance_runtime(const RuntimeModel& model, float under_y, float theta);
+
+// 実機用の2面バッファ切り替え
+// 非アクティブ面に書き込み (model_blob_staging_buffer)、検証に成功したら
+// アクティブなモデルのポインタを1回の書き込みで切り替える (割り込み内の予測も古い面か新しい面の一方を読む)
+uint8_t* model_blob_staging_buffer();
+ModelBlobStatus commit_model_blob(size_t size);
+const RuntimeModel* active_runtime_model();
+
+#endif // TEENSY_MODEL_BLOB_H
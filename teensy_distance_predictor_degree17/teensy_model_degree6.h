@@ -0,0 +1,42 @@
+/*
+ * Teensy 4.1 多項式回帰モデル (6次) - PolynomialModel<6> 用係数
+ * 自動生成元: models/20250719_191645-全データそのまま多項式/polynomial_degree6_mae0.70.joblib
+ * 生成日時: 2026-10-16 23:47:40
+ * 生成スクリプト: export_teensy_model.py template --name degree6
+ * 検証MAE: 0.7001
+ *
+ * StandardScalerを係数に畳み込み済み、PolynomialFeaturesの順序のまま格納
+ */
+
+#ifndef TEENSY_MODEL_DEGREE6_H
+#define TEENSY_MODEL_DEGREE6_H
+
+#include "teensy_polynomial_template.h"
+
+// 畳み込み済み切片: intercept - Σ coef_k * mean_k / scale_k
+constexpr double MODEL_DEGREE6_INTERCEPT = 100.69816128797456;
+
+// 畳み込み済み係数 coef_k / scale_k (倍精度でFlashメモリに格納)
+constexpr double MODEL_DEGREE6_COEFFICIENTS[PolynomialModel<6>::TERM_COUNT] PROGMEM = {
+    // 次数 0: under_y^0..^0 * theta^0..^0
+      1.0048270944918190e-09,
+    // 次数 1: under_y^1..^0 * theta^0..^1
+     -4.5341043138285855e+00,  -3.9353699125101615e-01,
+    // 次数 2: under_y^2..^0 * theta^0..^2
+      1.1520631339095481e-01,   3.2063798959484871e-02,   4.9434076516205752e-02,
+    // 次数 3: under_y^3..^0 * theta^0..^3
+     -1.6553145391090224e-03,  -1.1289458322494160e-03,  -2.1337665570969628e-03,  -1.4961795823494080e-04,
+    // 次数 4: under_y^4..^0 * theta^0..^4
+      1.2415779969028671e-05,   1.8824963343084521e-05,   3.7249185286247793e-05,   4.5720856062384257e-06,
+      5.3977091400640650e-06,
+    // 次数 5: under_y^5..^0 * theta^0..^5
+     -4.1740069564165865e-08,  -1.4750705759998067e-07,  -2.7329220592413633e-07,  -3.3819728713172916e-08,
+     -2.1988934764560116e-07,   1.9686078469365179e-08,
+    // 次数 6: under_y^6..^0 * theta^0..^6
+      3.7186674133181929e-11,   4.3287172207276716e-10,   7.0994326072491956e-10,   1.5847588472526121e-10,
+      9.5846672911979464e-10,  -8.2848627357935488e-10,   2.8216433977012056e-09
+};
+
+constexpr PolynomialModel<6> MODEL_DEGREE6(MODEL_DEGREE6_COEFFICIENTS, MODEL_DEGREE6_INTERCEPT);
+
+#endif // TEENSY_MODEL_DEGREE6_H
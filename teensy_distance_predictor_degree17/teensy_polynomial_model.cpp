@@ -9,10 +9,14 @@
  */
 
 #include "teensy_polynomial_model.h"
+#include "teensy_gradient_weights.h"
+#include "teensy_profiler.h"
 #include <pgmspace.h>
 
 // Teensy 4.1向けに最適化されたメイン予測関数 (倍精度のみ)
 TEENSY_FAST float predict_distance_teensy(float under_y, float theta) {
+    PROFILE_SCOPE(PROFILE_STAGE_PREDICT);
+
     // 入力値検証
     if (!validate_input_range(under_y, theta)) {
         return -1.0f;  // エラー指標
@@ -22,25 +26,37 @@ TEENSY_FAST float predict_distance_teensy(float under_y, float theta) {
     double features[FEATURE_COUNT];
 
     // 倍精度で多項式特徴量を生成
-    generate_polynomial_features_double(under_y, theta, features);
+    {
+        PROFILE_SCOPE(PROFILE_STAGE_FEATURES);
+        generate_polynomial_features_double(under_y, theta, features);
+    }
 
     // 倍精度でStandardScaler正規化を適用
-    apply_standard_scaling_double(features);
+    {
+        PROFILE_SCOPE(PROFILE_STAGE_SCALING);
+        apply_standard_scaling_double(features);
+    }
 
     // 倍精度とKahan総和法で最終予測を計算
+    PROFILE_SCOPE(PROFILE_STAGE_DOT_PRODUCT);
     return (float)compute_linear_combination_double(features);
 }
 
 // 精度確保のための倍精度多項式特徴量生成
 TEENSY_FAST void generate_polynomial_features_double(float under_y, float theta, double* features) {
+    double under_y_powers[POLY_DEGREE + 1];
+    double theta_powers[POLY_DEGREE + 1];
+    generate_power_tables_double(under_y, theta, under_y_powers, theta_powers);
+    generate_features_from_powers_double(under_y_powers, theta_powers, features);
+}
+
+// 倍精度でべき乗 (0から17乗) を事前計算
+TEENSY_FAST void generate_power_tables_double(float under_y, float theta, double* under_y_powers,
+                                              double* theta_powers) {
     // PC版scikit-learnの精度と一致させるため倍精度を使用
     double under_y_d = (double)under_y;
     double theta_d = (double)theta;
 
-    // 倍精度でべき乗を事前計算
-    double under_y_powers[18];  // 0から17
-    double theta_powers[18];    // 0から17
-
     under_y_powers[0] = 1.0;
     theta_powers[0] = 1.0;
     under_y_powers[1] = under_y_d;
@@ -52,11 +68,15 @@ TEENSY_FAST void generate_polynomial_features_double(float under_y, float theta,
         under_y_powers[i] = under_y_powers[i-1] * under_y_d;
         theta_powers[i] = theta_powers[i-1] * theta_d;
     }
+}
 
+// べき乗表から171個の特徴量を生成
+TEENSY_FAST void generate_features_from_powers_double(const double* under_y_powers, const double* theta_powers,
+                                                      double* features) {
     // scikit-learn順序で171個の全特徴量を精度向上して生成
     features[0] = 1.0;  // バイアス項
-    features[1] = under_y_d;  // under_y^1 * theta^0 (精度のため直接代入)
-    features[2] = theta_d;    // under_y^0 * theta^1 (精度のため直接代入)
+    features[1] = under_y_powers[1];  // under_y^1 * theta^0 (精度のため直接代入)
+    features[2] = theta_powers[1];    // under_y^0 * theta^1 (精度のため直接代入)
     features[3] = under_y_powers[2] * theta_powers[0];  // under_y^2 * theta^0
     features[4] = under_y_powers[1] * theta_powers[1];  // under_y^1 * theta^1
     features[5] = under_y_powers[0] * theta_powers[2];  // under_y^0 * theta^2
@@ -427,6 +447,86 @@ TEENSY_FAST double compute_linear_combination_double(const double* features) {
     return sum;
 }
 
+// 線形結合 (compute_linear_combination_double と同じ Kahan 総和) と同時に、
+// べき乗表から各特徴量 u^i t^j の偏微分を求めて勾配 (と Hessian) を積算する
+// 偏微分に掛ける重み GRADIENT_WEIGHTS (係数 / 標準化の尺度) は生成済みの Flash 上の表を使う
+TEENSY_FAST double compute_linear_combination_gradient_double(const double* features, const double* under_y_powers,
+                                                              const double* theta_powers, double* gradient,
+                                                              double* hessian) {
+    double sum = MODEL_INTERCEPT;
+    double c = 0.0;  // 下位ビット欠落の補償値
+    double d_under_y = 0.0;
+    double d_theta = 0.0;
+    double d_under_y2 = 0.0;
+    double d_under_y_theta = 0.0;
+    double d_theta2 = 0.0;
+
+    // scikit-learn順序: 次数 d ごとに under_y の指数 i = d, d-1, ..., 0 (theta の指数 j = d - i)
+    int k = 0;
+    for (int d = 0; d <= POLY_DEGREE; d++) {
+        for (int i = d; i >= 0; i--, k++) {
+            const int j = d - i;
+            double product = MODEL_COEFFICIENTS[k] * features[k];
+
+            // Kahan総和法
+            double y = product - c;
+            double t = sum + y;
+            c = (t - sum) - y;
+            sum = t;
+
+            const double w = GRADIENT_WEIGHTS[k];
+            if (i > 0) d_under_y += w * i * under_y_powers[i - 1] * theta_powers[j];
+            if (j > 0) d_theta += w * j * under_y_powers[i] * theta_powers[j - 1];
+            if (hessian != nullptr) {
+                if (i > 1) d_under_y2 += w * (i * (i - 1)) * under_y_powers[i - 2] * theta_powers[j];
+                if (i > 0 && j > 0) d_under_y_theta += w * (i * j) * under_y_powers[i - 1] * theta_powers[j - 1];
+                if (j > 1) d_theta2 += w * (j * (j - 1)) * under_y_powers[i] * theta_powers[j - 2];
+            }
+        }
+    }
+
+    gradient[0] = d_under_y;
+    gradient[1] = d_theta;
+    if (hessian != nullptr) {
+        hessian[0] = d_under_y2;
+        hessian[1] = d_under_y_theta;
+        hessian[2] = d_theta2;
+    }
+    return sum;
+}
+
+// 予測値と勾配 (と Hessian) を1回の評価で求める
+TEENSY_FAST float predict_distance_gradient(float under_y, float theta, float* gradient, float* hessian) {
+    // 入力値検証
+    if (!validate_input_range(under_y, theta)) {
+        gradient[0] = gradient[1] = 0.0f;
+        if (hessian != nullptr) {
+            hessian[0] = hessian[1] = hessian[2] = 0.0f;
+        }
+        return -1.0f;  // エラー指標
+    }
+
+    double under_y_powers[POLY_DEGREE + 1];
+    double theta_powers[POLY_DEGREE + 1];
+    double features[FEATURE_COUNT];
+    generate_power_tables_double(under_y, theta, under_y_powers, theta_powers);
+    generate_features_from_powers_double(under_y_powers, theta_powers, features);
+    apply_standard_scaling_double(features);
+
+    double gradient_d[2];
+    double hessian_d[3];
+    double distance = compute_linear_combination_gradient_double(features, under_y_powers, theta_powers, gradient_d,
+                                                                 hessian != nullptr ? hessian_d : nullptr);
+    gradient[0] = (float)gradient_d[0];
+    gradient[1] = (float)gradient_d[1];
+    if (hessian != nullptr) {
+        hessian[0] = (float)hessian_d[0];
+        hessian[1] = (float)hessian_d[1];
+        hessian[2] = (float)hessian_d[2];
+    }
+    return (float)distance;
+}
+
 
 
 // 入力検証関数
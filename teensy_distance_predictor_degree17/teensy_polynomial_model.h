@@ -24,7 +24,19 @@ const int FEATURE_COUNT = 171;
 const int INPUT_FEATURES = 2;
 
 // PC版と同等の精度を確保するため、重要な計算には倍精度を使用
+// 倍精度では predict_distance_selected() は従来パス (predict_distance_teensy) で予測する
+// 0にすると predict_distance_selected() が単精度 (USE_MIXED_PRECISION 1 なら混合精度) のHorner評価になる
+#ifndef USE_DOUBLE_PRECISION
 #define USE_DOUBLE_PRECISION 1
+#endif
+#ifndef USE_MIXED_PRECISION
+#define USE_MIXED_PRECISION 0
+#endif
+// 1にすると倍精度の predict_distance_selected() が Horner法 (predict_distance_horner, バッチは
+// predict_distance_batch) になる。特徴量生成・標準化がないぶん速いが、結果は従来パスと丸め誤差の範囲で異なる
+#ifndef USE_HORNER
+#define USE_HORNER 0
+#endif
 
 // モデル係数 (倍精度でFlashメモリに格納)
 const double MODEL_COEFFICIENTS[FEATURE_COUNT] PROGMEM = {
@@ -173,9 +185,19 @@ const double SCALER_SCALE[FEATURE_COUNT] PROGMEM = {
 // Teensy 4.1最適化予測パイプライン用関数プロトタイプ (倍精度のみ)
 float predict_distance_teensy(float under_y, float theta);
 void generate_polynomial_features_double(float under_y, float theta, double* features);
+void generate_power_tables_double(float under_y, float theta, double* under_y_powers, double* theta_powers);
+void generate_features_from_powers_double(const double* under_y_powers, const double* theta_powers,
+                                          double* features);
 void apply_standard_scaling_double(double* features);
 double compute_linear_combination_double(const double* features);
 
+// 予測値と解析的な勾配を1回の評価で求める (EKF などの下流のフィルタ用)
+// gradient[2] = {∂d/∂under_y, ∂d/∂theta}, hessian[3] = {∂²d/∂under_y², ∂²d/∂under_y∂theta, ∂²d/∂theta²} (nullptr 可)
+// 予測値は predict_distance_teensy と同じ。範囲外の入力は -1.0f (勾配・Hessian は 0)
+float predict_distance_gradient(float under_y, float theta, float* gradient, float* hessian = nullptr);
+double compute_linear_combination_gradient_double(const double* features, const double* under_y_powers,
+                                                  const double* theta_powers, double* gradient, double* hessian);
+
 // デバッグ・テスト用ユーティリティ関数
 void print_model_info();
 void print_feature_values_double(const double* features);
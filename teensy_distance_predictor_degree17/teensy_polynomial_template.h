@@ -0,0 +1,94 @@
+/*
+ * Teensy 4.1 多項式回帰モデル - 任意次数のコンパイル時展開評価器
+ *
+ * PolynomialModel<Degree> は scikit-learn PolynomialFeatures と同じ並び (合計次数の昇順、
+ * 同じ次数内では theta の次数の昇順) の畳み込み済み係数をそのまま受け取り、
+ * 並べ替えとネストHorner評価 (外側under_y・内側theta) を index_sequence で完全に展開する。
+ * 係数表は export_teensy_model.py template で生成する (teensy_model_<名前>.h)。
+ *
+ * 使用例 (次数の切り替えはインクルードとモデル名の変更のみ):
+ *   #include "teensy_model_degree6.h"
+ *   float distance = MODEL_DEGREE6.predict(under_y, theta);
+ */
+
+#ifndef TEENSY_POLYNOMIAL_TEMPLATE_H
+#define TEENSY_POLYNOMIAL_TEMPLATE_H
+
+#include <utility>
+#include "teensy_polynomial_model.h"
+
+template <int Degree>
+class PolynomialModel {
+    static_assert(Degree >= 0, "degree must be non-negative");
+
+public:
+    static constexpr int DEGREE = Degree;
+    static constexpr int TERM_COUNT = (Degree + 1) * (Degree + 2) / 2;
+
+    // under_y^i * theta^j の PolynomialFeatures 上の位置
+    static constexpr int feature_index(int under_y_power, int theta_power) {
+        return (under_y_power + theta_power) * (under_y_power + theta_power + 1) / 2 + theta_power;
+    }
+
+    // coefficients: StandardScalerを畳み込んだ係数 (sklearn順), intercept: 畳み込み済み切片
+    constexpr PolynomialModel(const double (&coefficients)[TERM_COUNT], double intercept)
+        : coefficients_(coefficients), intercept_(intercept) {}
+
+    // 入力検証付き予測 (範囲外は -1.0f)
+    TEENSY_INLINE float predict(float under_y, float theta) const {
+        if (!validate_input_range(under_y, theta)) {
+            return -1.0f;  // エラー指標
+        }
+        return (float)evaluate((double)under_y, (double)theta);
+    }
+
+    // 倍精度ネストHorner評価 (ループなし)
+    TEENSY_INLINE double evaluate(double under_y, double theta) const {
+        return evaluate_rows(under_y, theta, std::make_integer_sequence<int, Degree + 1>()) + intercept_;
+    }
+
+    // theta のべき乗表 theta_powers[0..Degree] を受け取る評価 (複数のモデルで表を共有する PolynomialEnsemble 用)
+    // 行 q_i(theta) は表との内積 (乗算が加算の依存から外れる)、外側は under_y のHorner法
+    TEENSY_INLINE double evaluate_with_theta_powers(double under_y, const double* theta_powers) const {
+        return evaluate_rows_dot(under_y, theta_powers, std::make_integer_sequence<int, Degree + 1>()) + intercept_;
+    }
+
+private:
+    // 外側: acc = acc * under_y + q_i(theta), i = Degree..0 (K = Degree - i)
+    template <int... K>
+    TEENSY_INLINE double evaluate_rows(double under_y, double theta, std::integer_sequence<int, K...>) const {
+        double acc = 0.0;
+        ((acc = acc * under_y + evaluate_row<Degree - K>(theta, std::make_integer_sequence<int, K>())), ...);
+        return acc;
+    }
+
+    // 内側: q_i(theta) = Σ_j a_ij theta^j を j = Degree-i から降順に (最高次の係数で初期化)
+    template <int I, int... K>
+    TEENSY_INLINE double evaluate_row(double theta, std::integer_sequence<int, K...>) const {
+        double q = coefficients_[feature_index(I, Degree - I)];
+        ((q = q * theta + coefficients_[feature_index(I, Degree - I - 1 - K)]), ...);
+        return q;
+    }
+
+    // 外側: evaluate_rows と同じ。行は theta_powers との内積
+    template <int... K>
+    TEENSY_INLINE double evaluate_rows_dot(double under_y, const double* theta_powers,
+                                           std::integer_sequence<int, K...>) const {
+        double acc = 0.0;
+        ((acc = acc * under_y + row_dot<Degree - K>(theta_powers, std::make_integer_sequence<int, K + 1>())), ...);
+        return acc;
+    }
+
+    // q_i(theta) = Σ_j a_ij theta^j (j = 0..Degree-i の昇順)
+    template <int I, int... J>
+    TEENSY_INLINE double row_dot(const double* theta_powers, std::integer_sequence<int, J...>) const {
+        double q = 0.0;
+        ((q += coefficients_[feature_index(I, J)] * theta_powers[J]), ...);
+        return q;
+    }
+
+    const double* coefficients_;
+    double intercept_;
+};
+
+#endif // TEENSY_POLYNOMIAL_TEMPLATE_H
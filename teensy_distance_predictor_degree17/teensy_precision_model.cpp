@@ -0,0 +1,119 @@
+/*
+ * Teensy 4.1 多項式回帰モデル実装 (17次) - 単精度・混合精度Horner評価
+ * 係数表: teensy_precision_model.h (export_teensy_model.py precision で生成)
+ *
+ * Cortex-M7の倍精度FPU演算は単精度より大幅に遅いため、入力を学習領域が [-1, 1]^2 に
+ * なるよう正規化し (係数の大きさが揃い、x^17 などのべき乗も桁あふれしない)、単精度で評価する
+ * - 単精度: 正規化・内側・外側すべて単精度
+ * - 混合精度: 正規化と外側 (x方向) の累積は倍精度、内側 (y方向) は単精度
+ *   ただし x^0..x^(MIXED_DOUBLE_ROWS-1) の行は内側も倍精度 (誤差の寄与が大きい低次の長い行)
+ */
+
+#include "teensy_precision_model.h"
+#include <pgmspace.h>
+#include "teensy_batch_model.h"
+#include "teensy_profiler.h"
+
+// 単精度Horner評価 (入力検証なし)
+TEENSY_FAST float evaluate_horner_float(float under_y, float theta) {
+    const float x = (under_y - (float)PRECISION_UNDER_Y_CENTER) * (float)PRECISION_UNDER_Y_INV_HALF_WIDTH;
+    const float y = (theta - (float)PRECISION_THETA_CENTER) * (float)PRECISION_THETA_INV_HALF_WIDTH;
+    const float* coeff = PRECISION_COEFFICIENTS_F;
+    float acc = 0.0f;
+
+    for (int i = POLY_DEGREE; i >= 0; i--) {
+        float q = *coeff++;
+        for (int j = POLY_DEGREE - i; j > 0; j--) {
+            q = q * y + *coeff++;
+        }
+        acc = acc * x + q;
+    }
+
+    return acc;
+}
+
+// 混合精度Horner評価 (入力検証なし)
+// double_rows: 内側も倍精度で評価する低次側の行数 (0..POLY_DEGREE+1)
+TEENSY_FAST double evaluate_horner_mixed(float under_y, float theta, int double_rows) {
+    const double x = ((double)under_y - PRECISION_UNDER_Y_CENTER) * PRECISION_UNDER_Y_INV_HALF_WIDTH;
+    const double y = ((double)theta - PRECISION_THETA_CENTER) * PRECISION_THETA_INV_HALF_WIDTH;
+    const float y_f = (float)y;
+    const float* coeff_f = PRECISION_COEFFICIENTS_F;
+    double acc = 0.0;
+
+    int i = POLY_DEGREE;
+    for (; i >= double_rows; i--) {
+        float q = *coeff_f++;
+        for (int j = POLY_DEGREE - i; j > 0; j--) {
+            q = q * y_f + *coeff_f++;
+        }
+        acc = acc * x + (double)q;
+    }
+
+    // 残りの行は同じ位置から倍精度係数を読む
+    const double* coeff = PRECISION_COEFFICIENTS + (coeff_f - PRECISION_COEFFICIENTS_F);
+    for (; i >= 0; i--) {
+        double q = *coeff++;
+        for (int j = POLY_DEGREE - i; j > 0; j--) {
+            q = q * y + *coeff++;
+        }
+        acc = acc * x + q;
+    }
+
+    return acc;
+}
+
+TEENSY_FAST float predict_distance_horner_float(float under_y, float theta) {
+    // 入力値検証
+    if (!validate_input_range(under_y, theta)) {
+        return -1.0f;  // エラー指標
+    }
+
+    return evaluate_horner_float(under_y, theta);
+}
+
+TEENSY_FAST float predict_distance_horner_mixed(float under_y, float theta) {
+    // 入力値検証
+    if (!validate_input_range(under_y, theta)) {
+        return -1.0f;  // エラー指標
+    }
+
+    return (float)evaluate_horner_mixed(under_y, theta, MIXED_DOUBLE_ROWS);
+}
+
+// コンパイル時に選択した精度モードで予測 (全体の所要時間を PROFILE_STAGE_SELECTED に記録)
+TEENSY_FAST float predict_distance_selected(float under_y, float theta) {
+    PROFILE_SCOPE(PROFILE_STAGE_SELECTED);
+#if USE_DOUBLE_PRECISION && USE_HORNER
+    return predict_distance_horner(under_y, theta);
+#elif USE_DOUBLE_PRECISION
+    return predict_distance_teensy(under_y, theta);
+#elif USE_MIXED_PRECISION
+    return predict_distance_horner_mixed(under_y, theta);
+#else
+    return predict_distance_horner_float(under_y, theta);
+#endif
+}
+
+// コンパイル時に選択した精度モードでまとめて予測
+TEENSY_FAST void predict_distance_selected_batch(const float* under_y, const float* theta, float* out, size_t n) {
+#if USE_DOUBLE_PRECISION && USE_HORNER
+    predict_distance_batch(under_y, theta, out, n);
+#else
+    for (size_t i = 0; i < n; i++) {
+        out[i] = predict_distance_selected(under_y[i], theta[i]);
+    }
+#endif
+}
+
+const char* selected_precision_name() {
+#if USE_DOUBLE_PRECISION && USE_HORNER
+    return "double-horner";
+#elif USE_DOUBLE_PRECISION
+    return "double";
+#elif USE_MIXED_PRECISION
+    return "mixed";
+#else
+    return "float";
+#endif
+}
@@ -0,0 +1,192 @@
+/*
+ * Teensy 4.1 多項式回帰モデル (17次) - 単精度・混合精度Horner評価用係数
+ * 自動生成元: models/20250721_233056-LNN蒸留多項式/polynomial_degree17_mae0.90.joblib
+ * 生成日時: 2026-10-16 23:46:37
+ * 生成スクリプト: export_teensy_model.py precision
+ *
+ * 正規化変数 x = (under_y - 60.5) / 60.5, y = (theta - 3.5) / 52.5
+ * (under_y 0..121, theta -49..56 が [-1, 1]^2 に写る) に対する係数:
+ *   distance = Σ b_ij * x^i * y^j (切片は b_00 に含む)
+ * 係数は評価順 (外側x^17→^0, 内側y降順) に格納
+ * 単精度評価の倍精度参照との差 (生成時の見積もり): 最大 3.250e-02, 平均 5.225e-04
+ */
+
+#ifndef TEENSY_PRECISION_MODEL_H
+#define TEENSY_PRECISION_MODEL_H
+
+#include <stddef.h>
+#include "teensy_horner_model.h"
+
+// 正規化の中心と半幅の逆数
+const double PRECISION_UNDER_Y_CENTER = 60.5;
+const double PRECISION_UNDER_Y_INV_HALF_WIDTH = 0.01652892561983471;
+const double PRECISION_THETA_CENTER = 3.5;
+const double PRECISION_THETA_INV_HALF_WIDTH = 0.01904761904761905;
+
+// 正規化係数 b_ij (単精度, 単精度・混合精度モード用)
+const float PRECISION_COEFFICIENTS_F[HORNER_TERM_COUNT] PROGMEM = {
+    // x^17 : y^0..0
+    88.415586f,
+    // x^16 : y^1..0
+    8.07522367f, 589.30879f,
+    // x^15 : y^2..0
+    -2884.47012f, 212.091908f, 849.362297f,
+    // x^14 : y^3..0
+    -1567.87782f, -7702.42827f, 611.98549f, -2092.52631f,
+    // x^13 : y^4..0
+    14005.3819f, 798.533601f, 16206.9041f, -710.498511f,
+    -5058.50263f,
+    // x^12 : y^5..0
+    1619.31108f, -25648.5846f, 2076.73344f, 31028.1886f,
+    -1812.54789f, 3542.16423f,
+    // x^11 : y^6..0
+    10094.0454f, 5959.64622f, -33102.9844f, -2371.52398f,
+    -39138.8118f, 488.761776f, 9885.04402f,
+    // x^10 : y^7..0
+    -19905.9084f, -7561.62602f, 5371.74787f, 73454.3785f,
+    148.450146f, -46195.7187f, 2351.328f, -3992.23589f,
+    // x^9 : y^8..0
+    -20267.242f, 16846.5507f, -1493.23363f, -26108.0507f,
+    15218.0276f, 3888.51859f, 48632.704f, 513.88649f,
+    -9305.07609f,
+    // x^8 : y^9..0
+    15942.8209f, 31774.9557f, 24337.9493f, -17185.7936f,
+    -7438.54143f, -66053.7055f, -2007.35451f, 30790.274f,
+    -1873.15426f, 3016.22144f,
+    // x^7 : y^10..0
+    -12918.8421f, -25667.202f, 35557.9887f, -14355.568f,
+    -10017.5067f, 31127.8366f, 8571.70173f, -3502.2127f,
+    -31230.2712f, -790.170184f, 4547.44665f,
+    // x^6 : y^11..0
+    13256.2267f, 37358.8377f, -10472.7549f, -95768.4563f,
+    -21857.003f, 61056.133f, 4275.97311f, 15550.5386f,
+    1491.19804f, -8700.49998f, 940.65511f, -1324.16001f,
+    // x^5 : y^12..0
+    -18323.0715f, -53868.8867f, 21504.5669f, 94686.9345f,
+    -3569.52966f, -25786.3013f, -10343.4622f, -11010.5417f,
+    -2872.37563f, 1516.93271f, 9560.11086f, 339.49551f,
+    -1145.71468f,
+    // x^4 : y^13..0
+    1214.58429f, 5604.86538f, 19438.1829f, -52183.0262f,
+    -56936.5516f, 82101.3823f, 44950.1936f, -45760.19f,
+    -9285.00599f, 4212.04212f, 192.046285f, 731.692247f,
+    -269.342069f, 298.469379f,
+    // x^3 : y^14..0
+    14213.5349f, 13218.5376f, -2451.55808f, 24634.6026f,
+    2687.73344f, -46423.9557f, -17479.1982f, 15067.8542f,
+    15259.6487f, 1504.65326f, -2761.16689f, -427.341985f,
+    -1117.9342f, -48.280189f, 123.247341f,
+    // x^2 : y^15..0
+    20015.8515f, 5754.32966f, -43208.2044f, -16124.7392f,
+    6979.47429f, 27983.9337f, 34153.2692f, -26468.588f,
+    -25166.712f, 11574.5172f, 5913.98424f, -1601.02281f,
+    -475.312434f, 33.0383754f, 47.4311346f, -5.50488232f,
+    // x^1 : y^16..0
+    -1942.92674f, -58383.6122f, -36345.3514f, 113964.533f,
+    65692.1682f, -90805.8527f, -50972.6657f, 36098.9832f,
+    24470.55f, -6398.15019f, -7902.7092f, 72.9952999f,
+    1324.98422f, 74.1251862f, -45.6988564f, -1.58750839f,
+    -27.3625457f,
+    // x^0 : y^17..0
+    3215.62618f, 864.736134f, 25145.2801f, 20209.6769f,
+    -62537.2202f, -39871.3252f, 59505.192f, 30524.9821f,
+    -30289.7015f, -11906.1024f, 8863.557f, 2619.63712f,
+    -1430.60757f, -351.205347f, 113.428944f, 38.4519584f,
+    -4.82307949f, 15.1711649f
+};
+
+// 正規化係数 b_ij (倍精度, 混合精度モードで倍精度評価する行用)
+const double PRECISION_COEFFICIENTS[HORNER_TERM_COUNT] PROGMEM = {
+    // x^17 : y^0..0
+      8.8415585958093160e+01,
+    // x^16 : y^1..0
+      8.0752236684720433e+00,   5.8930878954301488e+02,
+    // x^15 : y^2..0
+     -2.8844701235684752e+03,   2.1209190790948955e+02,   8.4936229739952421e+02,
+    // x^14 : y^3..0
+     -1.5678778225095602e+03,  -7.7024282732225211e+03,   6.1198549048617838e+02,  -2.0925263089591231e+03,
+    // x^13 : y^4..0
+      1.4005381859709711e+04,   7.9853360144452643e+02,   1.6206904084674949e+04,  -7.1049851120593712e+02,
+     -5.0585026284691239e+03,
+    // x^12 : y^5..0
+      1.6193110822171489e+03,  -2.5648584598186495e+04,   2.0767334448490424e+03,   3.1028188620386820e+04,
+     -1.8125478881324975e+03,   3.5421642328978783e+03,
+    // x^11 : y^6..0
+      1.0094045351941677e+04,   5.9596462158383583e+03,  -3.3102984441085187e+04,  -2.3715239760843178e+03,
+     -3.9138811806754085e+04,   4.8876177636538949e+02,   9.8850440217892137e+03,
+    // x^10 : y^7..0
+     -1.9905908387900166e+04,  -7.5616260189203795e+03,   5.3717478741705027e+03,   7.3454378457599669e+04,
+      1.4845014619356425e+02,  -4.6195718738820586e+04,   2.3513280002542624e+03,  -3.9922358854509353e+03,
+    // x^9 : y^8..0
+     -2.0267241960870302e+04,   1.6846550692903555e+04,  -1.4932336268441034e+03,  -2.6108050675244289e+04,
+      1.5218027561580384e+04,   3.8885185867085011e+03,   4.8632704020730067e+04,   5.1388648972273813e+02,
+     -9.3050760924989481e+03,
+    // x^8 : y^9..0
+      1.5942820938697478e+04,   3.1774955676208076e+04,   2.4337949336004949e+04,  -1.7185793638605919e+04,
+     -7.4385414272917778e+03,  -6.6053705488897700e+04,  -2.0073545088774774e+03,   3.0790274003739280e+04,
+     -1.8731542588096436e+03,   3.0162214351806133e+03,
+    // x^7 : y^10..0
+     -1.2918842057406264e+04,  -2.5667201962535979e+04,   3.5557988716892076e+04,  -1.4355567982306216e+04,
+     -1.0017506698830115e+04,   3.1127836633998235e+04,   8.5717017288627103e+03,  -3.5022126959308230e+03,
+     -3.1230271151945661e+04,  -7.9017018378328180e+02,   4.5474466459946525e+03,
+    // x^6 : y^11..0
+      1.3256226675650116e+04,   3.7358837700259348e+04,  -1.0472754900633823e+04,  -9.5768456304937426e+04,
+     -2.1857002968921322e+04,   6.1056133037070278e+04,   4.2759731077063389e+03,   1.5550538626737583e+04,
+      1.4911980364144022e+03,  -8.7004999801338236e+03,   9.4065510988164203e+02,  -1.3241600109311992e+03,
+    // x^5 : y^12..0
+     -1.8323071457866172e+04,  -5.3868886691342210e+04,   2.1504566869498700e+04,   9.4686934483585967e+04,
+     -3.5695296555097657e+03,  -2.5786301287083061e+04,  -1.0343462164038063e+04,  -1.1010541705248263e+04,
+     -2.8723756279647432e+03,   1.5169327090675517e+03,   9.5601108610926021e+03,   3.3949551025745166e+02,
+     -1.1457146774210380e+03,
+    // x^4 : y^13..0
+      1.2145842910078679e+03,   5.6048653817844615e+03,   1.9438182874648417e+04,  -5.2183026163275623e+04,
+     -5.6936551640808866e+04,   8.2101382282863036e+04,   4.4950193550286887e+04,  -4.5760190020928399e+04,
+     -9.2850059899861444e+03,   4.2120421208194130e+03,   1.9204628482626271e+02,   7.3169224673209931e+02,
+     -2.6934206876100257e+02,   2.9846937857760292e+02,
+    // x^3 : y^14..0
+      1.4213534908629676e+04,   1.3218537624781002e+04,  -2.4515580820350638e+03,   2.4634602614279571e+04,
+      2.6877334419250351e+03,  -4.6423955694813623e+04,  -1.7479198191775875e+04,   1.5067854205277503e+04,
+      1.5259648650597243e+04,   1.5046532558831277e+03,  -2.7611668908208198e+03,  -4.2734198472383497e+02,
+     -1.1179341997957315e+03,  -4.8280188965915336e+01,   1.2324734068427213e+02,
+    // x^2 : y^15..0
+      2.0015851515132628e+04,   5.7543296569636232e+03,  -4.3208204400077440e+04,  -1.6124739240193398e+04,
+      6.9794742902536318e+03,   2.7983933739648532e+04,   3.4153269231698272e+04,  -2.6468587965631632e+04,
+     -2.5166711956123207e+04,   1.1574517159173573e+04,   5.9139842427773056e+03,  -1.6010228109660463e+03,
+     -4.7531243414221672e+02,   3.3038375438644920e+01,   4.7431134630181639e+01,  -5.5048823211699522e+00,
+    // x^1 : y^16..0
+     -1.9429267353245766e+03,  -5.8383612179218508e+04,  -3.6345351426062887e+04,   1.1396453251751134e+05,
+      6.5692168191150253e+04,  -9.0805852693395966e+04,  -5.0972665691082810e+04,   3.6098983155542206e+04,
+      2.4470550025289253e+04,  -6.3981501935403940e+03,  -7.9027092034690477e+03,   7.2995299941599683e+01,
+      1.3249842246481278e+03,   7.4125186213105792e+01,  -4.5698856432039335e+01,  -1.5875083939119670e+00,
+     -2.7362545713823550e+01,
+    // x^0 : y^17..0
+      3.2156261847505107e+03,   8.6473613374985007e+02,   2.5145280053808441e+04,   2.0209676907110945e+04,
+     -6.2537220208460181e+04,  -3.9871325218920269e+04,   5.9505191953916408e+04,   3.0524982116179075e+04,
+     -3.0289701490799172e+04,  -1.1906102358504742e+04,   8.8635570008846553e+03,   2.6196371216754151e+03,
+     -1.4306075666237900e+03,  -3.5120534657877243e+02,   1.1342894388077445e+02,   3.8451958409348471e+01,
+     -4.8230794945109334e+00,   1.5171164878722660e+01
+};
+
+// 混合精度モードで倍精度評価する行数 (x^0..x^(n-1) の行, 0なら内側はすべて単精度)
+// 既定値は precision_report の実測で決めた: 倍精度行を1..8行に増やしても最悪誤差は
+// 0行 (3.3e-2) から下がらず (2行で 4.0e-2)、はっきり改善するのは9行以上 (倍精度演算137以上) から。
+// build/precision_report --tolerance で許容誤差を満たす最小値を確認できる
+#ifndef MIXED_DOUBLE_ROWS
+#define MIXED_DOUBLE_ROWS 0
+#endif
+
+// 単精度・混合精度の予測関数 (入力検証付き)
+float predict_distance_horner_float(float under_y, float theta);
+float predict_distance_horner_mixed(float under_y, float theta);
+
+// 入力検証なしの評価関数 (precision_reportが直接呼び出す)
+float evaluate_horner_float(float under_y, float theta);
+double evaluate_horner_mixed(float under_y, float theta, int double_rows);
+
+// USE_DOUBLE_PRECISION / USE_MIXED_PRECISION / USE_HORNER で選択した精度モードの予測関数
+// (スケッチ・シリアルプロトコル・サンプルパイプラインの予測はすべてここを通る)
+float predict_distance_selected(float under_y, float theta);
+void predict_distance_selected_batch(const float* under_y, const float* theta, float* out, size_t n);
+const char* selected_precision_name();
+
+#endif // TEENSY_PRECISION_MODEL_H
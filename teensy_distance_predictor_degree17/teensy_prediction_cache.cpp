@@ -0,0 +1,102 @@
+/*
+ * Teensy 4.1 多項式回帰モデル - 量子化入力の予測結果キャッシュの実装
+ */
+
+#include "teensy_prediction_cache.h"
+
+// キーの構成: under_y の格子番号 << 20 | theta の格子番号
+static const int THETA_KEY_BITS = 20;
+static const uint32_t UNDER_Y_KEY_LIMIT = (1u << (32 - THETA_KEY_BITS)) - 1;  // 全ビット1 を空きとして残す
+static const uint32_t THETA_KEY_LIMIT = 1u << THETA_KEY_BITS;
+static const uint32_t EMPTY_KEY = 0xFFFFFFFFu;
+
+// 格子番号 (入力検証後は 0 以上)
+static TEENSY_INLINE uint32_t quantize(float value, float min_value, float inv_step) {
+    return (uint32_t)((value - min_value) * inv_step + 0.5f);
+}
+
+PredictionCache::PredictionCache(DistancePredictFunction predict, float under_y_step, float theta_step)
+    : predict_(predict) {
+    if (!set_quantization(under_y_step, theta_step)) {
+        set_quantization(PREDICTION_CACHE_UNDER_Y_STEP, PREDICTION_CACHE_THETA_STEP);
+    }
+    reset_stats();
+}
+
+bool PredictionCache::set_quantization(float under_y_step, float theta_step) {
+    if (!(under_y_step > 0.0f && theta_step > 0.0f)) {
+        return false;
+    }
+    // 入力範囲の両端を含む格子点の数
+    if ((UNDER_Y_MAX - UNDER_Y_MIN) / under_y_step + 1.0f >= (float)UNDER_Y_KEY_LIMIT ||
+        (THETA_MAX - THETA_MIN) / theta_step + 1.0f >= (float)THETA_KEY_LIMIT) {
+        return false;
+    }
+    under_y_step_ = under_y_step;
+    theta_step_ = theta_step;
+    under_y_inv_step_ = 1.0f / under_y_step;
+    theta_inv_step_ = 1.0f / theta_step;
+    clear();
+    return true;
+}
+
+void PredictionCache::clear() {
+    for (int set = 0; set < PREDICTION_CACHE_SETS; set++) {
+        for (int way = 0; way < PREDICTION_CACHE_WAYS; way++) {
+            sets_[set].keys[way] = EMPTY_KEY;
+        }
+        recent_way_[set] = 0;
+    }
+}
+
+void PredictionCache::reset_stats() {
+    stats_.hits = 0;
+    stats_.misses = 0;
+    stats_.evictions = 0;
+    stats_.rejected = 0;
+}
+
+float PredictionCache::hit_rate() const {
+    const uint32_t lookups = stats_.hits + stats_.misses;
+    return lookups > 0 ? (float)stats_.hits / (float)lookups : 0.0f;
+}
+
+TEENSY_FAST float PredictionCache::predict(float under_y, float theta) {
+    // 入力値検証
+    if (!validate_input_range(under_y, theta)) {
+        stats_.rejected++;
+        return -1.0f;  // エラー指標
+    }
+
+    const uint32_t index_u = quantize(under_y, UNDER_Y_MIN, under_y_inv_step_);
+    const uint32_t index_t = quantize(theta, THETA_MIN, theta_inv_step_);
+    const uint32_t key = (index_u << THETA_KEY_BITS) | index_t;
+    // 乗算ハッシュの上位ビットでセットを選ぶ (隣接する格子点を別のセットに散らす)
+    Set& set = sets_[(key * 0x9E3779B1u) >> (32 - PREDICTION_CACHE_SET_BITS)];
+    uint8_t& recent = recent_way_[&set - sets_];
+
+    for (int way = 0; way < PREDICTION_CACHE_WAYS; way++) {
+        if (set.keys[way] == key) {
+            stats_.hits++;
+            recent = (uint8_t)way;
+            return set.values[way];
+        }
+    }
+
+    // ミス: 格子点で評価して、最近使っていない方のウェイに入れる
+    stats_.misses++;
+    const int victim = recent ^ 1;
+    if (set.keys[victim] != EMPTY_KEY) {
+        stats_.evictions++;
+    }
+    // 端の格子点は丸めで範囲をわずかに越えることがあるため範囲内に収める
+    float grid_under_y = UNDER_Y_MIN + (float)index_u * under_y_step_;
+    float grid_theta = THETA_MIN + (float)index_t * theta_step_;
+    if (grid_under_y > UNDER_Y_MAX) grid_under_y = UNDER_Y_MAX;
+    if (grid_theta > THETA_MAX) grid_theta = THETA_MAX;
+    const float value = predict_(grid_under_y, grid_theta);
+    set.keys[victim] = key;
+    set.values[victim] = value;
+    recent = (uint8_t)victim;
+    return value;
+}
@@ -0,0 +1,77 @@
+/*
+ * Teensy 4.1 多項式回帰モデル - 量子化入力の予測結果キャッシュ
+ *
+ * under_y はカメラの画素行 (整数)、theta もセンサの分解能で刻まれているため、同じ入力が繰り返し届く。
+ * PredictionCache は (under_y, theta) を設定した刻みで量子化したキーで、予測関数の結果を
+ * 2ウェイ・セットアソシアティブの固定長の表に保持する (ヒット時は数十サイクル, 171項の評価なし)
+ * - 動的確保なし。表は オブジェクト内の配列のため、グローバル変数として置けば Teensy 4.1 では DTCM (RAM1) に載る
+ * - ミス時は量子化後の代表値 (格子点) で評価するため、結果はキーだけで決まる (先に来た入力に依存しない)
+ *   under_y の刻み 1 で整数の行はそのまま格子点になり、量子化による誤差はない
+ * - キーは under_y の格子番号 12ビット + theta の格子番号 20ビット (刻みの下限はこの範囲で決まる)
+ * - 割り込みやスレッド間で共有しないこと (排他なし)
+ */
+
+#ifndef TEENSY_PREDICTION_CACHE_H
+#define TEENSY_PREDICTION_CACHE_H
+
+#include "teensy_horner_model.h"
+
+// セット数 = 2^PREDICTION_CACHE_SET_BITS (既定 512 セット × 2 ウェイ = 1024 件, 約 8.7KB)
+#ifndef PREDICTION_CACHE_SET_BITS
+#define PREDICTION_CACHE_SET_BITS 9
+#endif
+
+const int PREDICTION_CACHE_SETS = 1 << PREDICTION_CACHE_SET_BITS;
+const int PREDICTION_CACHE_WAYS = 2;
+
+// 既定の量子化の刻み (under_y: 画素行, theta: 0.01度)
+const float PREDICTION_CACHE_UNDER_Y_STEP = 1.0f;
+const float PREDICTION_CACHE_THETA_STEP = 0.01f;
+
+typedef float (*DistancePredictFunction)(float under_y, float theta);
+
+struct PredictionCacheStats {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;  // ミスで有効な項目を追い出した回数
+    uint32_t rejected;   // 入力範囲外 (キャッシュせず -1.0f)
+};
+
+class PredictionCache {
+public:
+    // predict は validate_input_range の範囲内で呼ばれる (既定は倍精度Horner法)
+    explicit PredictionCache(DistancePredictFunction predict = predict_distance_horner,
+                             float under_y_step = PREDICTION_CACHE_UNDER_Y_STEP,
+                             float theta_step = PREDICTION_CACHE_THETA_STEP);
+
+    // 刻みを変更して表を空にする (格子点の数がキーに収まらない刻みは false, 設定は変えない)
+    bool set_quantization(float under_y_step, float theta_step);
+    float under_y_step() const { return under_y_step_; }
+    float theta_step() const { return theta_step_; }
+
+    void clear();
+    void reset_stats();
+
+    // 入力検証付き (範囲外は -1.0f)
+    float predict(float under_y, float theta);
+
+    const PredictionCacheStats& stats() const { return stats_; }
+    float hit_rate() const;
+
+private:
+    struct Set {
+        uint32_t keys[PREDICTION_CACHE_WAYS];
+        float values[PREDICTION_CACHE_WAYS];
+    };
+
+    DistancePredictFunction predict_;
+    float under_y_step_;
+    float theta_step_;
+    float under_y_inv_step_;
+    float theta_inv_step_;
+    Set sets_[PREDICTION_CACHE_SETS];
+    uint8_t recent_way_[PREDICTION_CACHE_SETS];  // 最後に使ったウェイ (もう一方を追い出す)
+    PredictionCacheStats stats_;
+};
+
+#endif // TEENSY_PREDICTION_CACHE_H
@@ -0,0 +1,170 @@
+/*
+ * Teensy 4.1 多項式回帰モデル - 段階別サイクルプロファイラの実装
+ */
+
+#include "teensy_profiler.h"
+#include <string.h>
+
+bool profiler_active_flag = false;
+
+static StageHistogram stage_histograms[PROFILE_STAGE_COUNT];
+static float cycles_per_us = 0.0f;
+static uint32_t overhead_cycles = 0;
+
+static const char* const STAGE_NAMES[PROFILE_STAGE_COUNT] = {
+    "predict", "features", "scaling", "dot_product", "horner", "selected"
+};
+
+// 値 → ヒストグラムの区間番号
+static TEENSY_INLINE int bucket_index(uint32_t cycles) {
+    if (cycles < (uint32_t)PROFILE_SUB_BUCKETS) {
+        return (int)cycles;
+    }
+    int octave = 31 - __builtin_clz(cycles);  // 3以上
+    return (octave - 2) * PROFILE_SUB_BUCKETS + (int)((cycles >> (octave - 3)) & (PROFILE_SUB_BUCKETS - 1));
+}
+
+// 区間番号 → その区間の下限値 (区間は [下限, 次の区間の下限))
+uint32_t histogram_bucket_lower_bound(int bucket) {
+    if (bucket < PROFILE_SUB_BUCKETS) {
+        return (uint32_t)bucket;
+    }
+    int octave = bucket / PROFILE_SUB_BUCKETS + 2;
+    uint32_t sub = (uint32_t)(bucket % PROFILE_SUB_BUCKETS);
+    return (PROFILE_SUB_BUCKETS + sub) << (octave - 3);
+}
+
+void profiler_calibrate() {
+#if defined(__arm__) && defined(ARM_DWT_CYCCNT)
+    // Teensyduinoの起動処理で有効化済みだが念のため
+    ARM_DEMCR |= ARM_DEMCR_TRCENA;
+    ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+    cycles_per_us = (float)F_CPU_ACTUAL * 1e-6f;
+#elif defined(__x86_64__) || defined(__i386__)
+    // TSCの周波数を micros() と比較して求める (約20ms)
+    uint32_t start_us = micros();
+    uint32_t start_cycles = profiler_cycles();
+    while (micros() - start_us < 20000) {
+    }
+    uint32_t elapsed_cycles = profiler_cycles() - start_cycles;
+    cycles_per_us = (float)elapsed_cycles / (float)(micros() - start_us);
+#else
+    cycles_per_us = 1000.0f;  // clock_gettime (ns)
+#endif
+
+    // 空のタイマーの最小コスト (記録時に差し引く)
+    uint32_t minimum = UINT32_MAX;
+    for (int i = 0; i < 1000; i++) {
+        uint32_t start = profiler_cycles();
+        uint32_t elapsed = profiler_cycles() - start;
+        if (elapsed < minimum) minimum = elapsed;
+    }
+    overhead_cycles = minimum;
+}
+
+void profiler_set_active(bool active) {
+    if (active && cycles_per_us == 0.0f) {
+        profiler_calibrate();
+    }
+    profiler_active_flag = active;
+}
+
+void histogram_record(StageHistogram& histogram, uint32_t cycles) {
+    if (histogram.count == 0 || cycles < histogram.min_cycles) histogram.min_cycles = cycles;
+    if (cycles > histogram.max_cycles) histogram.max_cycles = cycles;
+    histogram.total_cycles += cycles;
+    histogram.count++;
+    histogram.buckets[bucket_index(cycles)]++;
+}
+
+void histogram_merge(StageHistogram& into, const StageHistogram& from) {
+    if (from.count == 0) {
+        return;
+    }
+    if (into.count == 0 || from.min_cycles < into.min_cycles) into.min_cycles = from.min_cycles;
+    if (from.max_cycles > into.max_cycles) into.max_cycles = from.max_cycles;
+    into.total_cycles += from.total_cycles;
+    into.count += from.count;
+    for (int bucket = 0; bucket < PROFILE_BUCKET_COUNT; bucket++) {
+        into.buckets[bucket] += from.buckets[bucket];
+    }
+}
+
+void profiler_record(ProfileStage stage, uint32_t cycles) {
+    histogram_record(stage_histograms[stage], cycles > overhead_cycles ? cycles - overhead_cycles : 0);
+}
+
+void profiler_reset() {
+    memset(stage_histograms, 0, sizeof(stage_histograms));
+}
+
+const StageHistogram& profiler_histogram(ProfileStage stage) {
+    return stage_histograms[stage];
+}
+
+const char* profile_stage_name(ProfileStage stage) {
+    return stage >= 0 && stage < PROFILE_STAGE_COUNT ? STAGE_NAMES[stage] : "unknown";
+}
+
+uint32_t histogram_percentile(const StageHistogram& histogram, float p) {
+    if (histogram.count == 0) {
+        return 0;
+    }
+    // 小さい方から数えて rank 番目 (1始まり) を含む区間
+    uint32_t rank = (uint32_t)(p * (float)histogram.count);
+    if (rank < 1) rank = 1;
+    if (rank > histogram.count) rank = histogram.count;
+    uint32_t seen = 0;
+    for (int bucket = 0; bucket < PROFILE_BUCKET_COUNT; bucket++) {
+        seen += histogram.buckets[bucket];
+        if (seen >= rank) {
+            // 区間の上限 (分位を小さく見積もらない側)
+            uint32_t value = bucket + 1 < PROFILE_BUCKET_COUNT ? histogram_bucket_lower_bound(bucket + 1) - 1 : histogram.max_cycles;
+            if (value < histogram.min_cycles) value = histogram.min_cycles;
+            if (value > histogram.max_cycles) value = histogram.max_cycles;
+            return value;
+        }
+    }
+    return histogram.max_cycles;
+}
+
+float profiler_cycles_per_us() {
+    return cycles_per_us;
+}
+
+uint32_t profiler_overhead_cycles() {
+    return overhead_cycles;
+}
+
+float profiler_cycles_to_us(uint32_t cycles) {
+    return cycles_per_us > 0.0f ? (float)cycles / cycles_per_us : 0.0f;
+}
+
+void print_profile_report() {
+    if (cycles_per_us == 0.0f) {
+        profiler_calibrate();
+    }
+    Serial.printf("=== Stage Profile (%.1f cycles/us, timer overhead %u cycles subtracted) ===\n",
+                  (double)cycles_per_us, (unsigned)overhead_cycles);
+#if !ENABLE_PROFILING
+    Serial.println("(profiling compiled out: ENABLE_PROFILING=0)");
+#endif
+    Serial.printf("%-12s %9s %10s %10s %10s %10s %10s   %s\n",
+                  "stage", "count", "min", "mean", "p50", "p99", "max", "(cycles / us)");
+    for (int stage = 0; stage < PROFILE_STAGE_COUNT; stage++) {
+        const StageHistogram& histogram = stage_histograms[stage];
+        if (histogram.count == 0) {
+            continue;
+        }
+        const double mean = (double)histogram.total_cycles / (double)histogram.count;
+        const uint32_t p50 = histogram_percentile(histogram, 0.50f);
+        const uint32_t p99 = histogram_percentile(histogram, 0.99f);
+        Serial.printf("%-12s %9u %10u %10.1f %10u %10u %10u\n", profile_stage_name((ProfileStage)stage),
+                      (unsigned)histogram.count, (unsigned)histogram.min_cycles, mean, (unsigned)p50,
+                      (unsigned)p99, (unsigned)histogram.max_cycles);
+        Serial.printf("%-12s %9s %10.3f %10.3f %10.3f %10.3f %10.3f\n", "", "us",
+                      (double)profiler_cycles_to_us(histogram.min_cycles), mean / (double)cycles_per_us,
+                      (double)profiler_cycles_to_us(p50), (double)profiler_cycles_to_us(p99),
+                      (double)profiler_cycles_to_us(histogram.max_cycles));
+    }
+}
@@ -0,0 +1,124 @@
+/*
+ * Teensy 4.1 多項式回帰モデル - 段階別サイクルプロファイラ
+ *
+ * micros() (1μs分解能, シリアル処理を含む) では見えないサブマイクロ秒の差を計測するため、
+ * 推論の各段階 (特徴量生成・標準化・線形結合など) をスコープ単位のタイマーで囲み、
+ * サイクル数を段階ごとの対数ヒストグラム (最小・平均・p50・p99・最大) に集計する
+ * - 実機: Cortex-M7 DWTサイクルカウンタ (ARM_DWT_CYCCNT, 600MHzで1.7ns)
+ * - ホスト: x86は rdtsc, それ以外は clock_gettime (ns)
+ * ENABLE_PROFILING 0 でタイマーは空文になり、計測コードは一切残らない。
+ * 1 でも profiler_set_active(true) するまではフラグの確認のみ (マルチスレッドのホストツールでは無効のまま使う)
+ */
+
+#ifndef TEENSY_PROFILER_H
+#define TEENSY_PROFILER_H
+
+#include "teensy_polynomial_model.h"
+
+#ifndef ENABLE_PROFILING
+#define ENABLE_PROFILING 1
+#endif
+
+#if !(defined(__arm__) && defined(ARM_DWT_CYCCNT)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#elif !(defined(__arm__) && defined(ARM_DWT_CYCCNT))
+#include <time.h>
+#endif
+
+// 計測する段階
+enum ProfileStage {
+    PROFILE_STAGE_PREDICT,      // predict_distance_teensy 全体 (入力検証を含む)
+    PROFILE_STAGE_FEATURES,     // 多項式特徴量生成
+    PROFILE_STAGE_SCALING,      // StandardScaler 標準化
+    PROFILE_STAGE_DOT_PRODUCT,  // 線形結合 (Kahan総和)
+    PROFILE_STAGE_HORNER,       // predict_distance_horner 全体
+    PROFILE_STAGE_SELECTED,     // predict_distance_selected 全体 (コンパイル時に選択した評価器, 内側の段階も別に記録される)
+    PROFILE_STAGE_COUNT
+};
+
+// ヒストグラム: 8未満はそのまま、それ以上は2の冪ごとに8分割 (相対分解能 12.5%)
+const int PROFILE_SUB_BUCKETS = 8;
+const int PROFILE_BUCKET_COUNT = 30 * PROFILE_SUB_BUCKETS;
+
+struct StageHistogram {
+    uint32_t count;
+    uint32_t min_cycles;
+    uint32_t max_cycles;
+    uint64_t total_cycles;
+    uint32_t buckets[PROFILE_BUCKET_COUNT];
+};
+
+// 現在のサイクル数 (32ビットで循環, 差分は約7秒 (600MHz) まで有効)
+static TEENSY_INLINE uint32_t profiler_cycles() {
+#if defined(__arm__) && defined(ARM_DWT_CYCCNT)
+    return ARM_DWT_CYCCNT;
+#elif defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__rdtsc();
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec);
+#endif
+}
+
+extern bool profiler_active_flag;
+
+// カウンタの有効化と、1μsあたりのサイクル数・タイマー自体のコストの測定 (初回の有効化時に自動で実行)
+void profiler_calibrate();
+void profiler_set_active(bool active);
+static TEENSY_INLINE bool profiler_active() { return profiler_active_flag; }
+
+// タイマーのコストを差し引いて記録
+void profiler_record(ProfileStage stage, uint32_t cycles);
+void profiler_reset();
+
+const StageHistogram& profiler_histogram(ProfileStage stage);
+const char* profile_stage_name(ProfileStage stage);
+
+// p (0〜1) 分位のサイクル数 (該当する区間の上限, 最小・最大で挟む)
+uint32_t histogram_percentile(const StageHistogram& histogram, float p);
+
+// 段階以外のヒストグラム (WCETスイートなど) への記録・合算 (タイマーのコストは差し引かない)
+void histogram_record(StageHistogram& histogram, uint32_t cycles);
+void histogram_merge(StageHistogram& into, const StageHistogram& from);
+// 区間の下限値 (区間は [下限, 次の区間の下限))
+uint32_t histogram_bucket_lower_bound(int bucket);
+
+float profiler_cycles_per_us();
+uint32_t profiler_overhead_cycles();
+float profiler_cycles_to_us(uint32_t cycles);
+
+// 記録のある段階の一覧をSerialへ表示 (サイクル数とμs)
+void print_profile_report();
+
+// スコープの出口で経過サイクル数を記録する
+class ScopedStageTimer {
+public:
+    TEENSY_INLINE explicit ScopedStageTimer(ProfileStage stage)
+        : stage_(stage), active_(profiler_active()), start_(active_ ? profiler_cycles() : 0) {}
+
+    TEENSY_INLINE ~ScopedStageTimer() {
+        if (active_) {
+            profiler_record(stage_, profiler_cycles() - start_);
+        }
+    }
+
+    ScopedStageTimer(const ScopedStageTimer&) = delete;
+    ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+
+private:
+    ProfileStage stage_;
+    bool active_;
+    uint32_t start_;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if ENABLE_PROFILING
+#define PROFILE_SCOPE(stage) ScopedStageTimer PROFILE_CONCAT(profile_scope_, __LINE__)(stage)
+#else
+#define PROFILE_SCOPE(stage) do {} while (0)
+#endif
+
+#endif // TEENSY_PROFILER_H
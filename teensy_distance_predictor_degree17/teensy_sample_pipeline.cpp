@@ -0,0 +1,98 @@
+/*
+ * Teensy 4.1 多項式回帰モデル - 取得→推論→出力のロックフリー・パイプラインの実装
+ */
+
+#include "teensy_sample_pipeline.h"
+#include "teensy_precision_model.h"
+
+SamplePipeline::SamplePipeline() {
+    reset_stats();
+}
+
+TEENSY_FAST bool SamplePipeline::push_sample(float under_y, float theta) {
+    PipelineSample sample;
+    sample.under_y = under_y;
+    sample.theta = theta;
+    sample.acquired_cycles = profiler_cycles();
+    if (!samples_.push(sample)) {
+        add_relaxed(dropped_, 1);
+        return false;
+    }
+    add_relaxed(acquired_, 1);
+
+    // 入れた直後の件数 (消費者が同時に取り出していれば実際より多めに見える)
+    const uint32_t depth = samples_.size();
+    if (depth > max_sample_depth_.load(std::memory_order_relaxed)) {
+        max_sample_depth_.store(depth, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+TEENSY_FAST uint32_t SamplePipeline::run_inference(uint32_t max_batch) {
+    // 結果キューに入りきる分だけ取り出す (出力段が遅れたらサンプルキュー側で溜める)
+    uint32_t limit = max_batch < PIPELINE_BATCH_SIZE ? max_batch : PIPELINE_BATCH_SIZE;
+    const uint32_t space = results_.free_space();
+    if (limit > space) {
+        limit = space;
+    }
+
+    float under_y[PIPELINE_BATCH_SIZE];
+    float theta[PIPELINE_BATCH_SIZE];
+    float distance[PIPELINE_BATCH_SIZE];
+    uint32_t acquired_cycles[PIPELINE_BATCH_SIZE];
+    uint32_t count = 0;
+    PipelineSample sample;
+    while (count < limit && samples_.pop(sample)) {
+        under_y[count] = sample.under_y;
+        theta[count] = sample.theta;
+        acquired_cycles[count] = sample.acquired_cycles;
+        count++;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    predict_distance_selected_batch(under_y, theta, distance, count);
+    const uint32_t completed_cycles = profiler_cycles();
+
+    for (uint32_t i = 0; i < count; i++) {
+        PipelineResult result;
+        result.under_y = under_y[i];
+        result.theta = theta[i];
+        result.distance = distance[i];
+        result.acquired_cycles = acquired_cycles[i];
+        result.completed_cycles = completed_cycles;
+        results_.push(result);  // 空きは確認済み (消費者は空きを増やすだけ)
+    }
+    add_relaxed(inferred_, count);
+    add_relaxed(batches_, 1);
+    return count;
+}
+
+TEENSY_FAST bool SamplePipeline::pop_result(PipelineResult& result) {
+    if (!results_.pop(result)) {
+        return false;
+    }
+    add_relaxed(emitted_, 1);
+    return true;
+}
+
+PipelineStats SamplePipeline::stats() const {
+    PipelineStats stats;
+    stats.acquired = acquired_.load(std::memory_order_relaxed);
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
+    stats.max_sample_depth = max_sample_depth_.load(std::memory_order_relaxed);
+    stats.inferred = inferred_.load(std::memory_order_relaxed);
+    stats.batches = batches_.load(std::memory_order_relaxed);
+    stats.emitted = emitted_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void SamplePipeline::reset_stats() {
+    acquired_.store(0, std::memory_order_relaxed);
+    dropped_.store(0, std::memory_order_relaxed);
+    max_sample_depth_.store(0, std::memory_order_relaxed);
+    inferred_.store(0, std::memory_order_relaxed);
+    batches_.store(0, std::memory_order_relaxed);
+    emitted_.store(0, std::memory_order_relaxed);
+}
@@ -0,0 +1,141 @@
+/*
+ * Teensy 4.1 多項式回帰モデル - 取得→推論→出力のロックフリー・パイプライン
+ *
+ * 取得段 (割り込みハンドラやセンサ読み取り) が (under_y, theta) をサンプルキューへ入れ、
+ * 推論段がまとめて取り出してバッチ予測 (predict_distance_selected_batch) し、結果キューへ入れる。
+ * 出力段は取得時刻・完了時刻 (profiler_cycles) 付きの結果を取り出して送信する
+ * - キューはどちらも単一生産者・単一消費者 (SPSC) のリングバッファ。ロックも割り込み禁止も使わない
+ *   サンプルキュー: 生産者 = 取得段, 消費者 = 推論段 / 結果キュー: 生産者 = 推論段, 消費者 = 出力段
+ * - 各段の関数はそれぞれ1つの文脈 (割り込み・loop()・スレッド) からだけ呼ぶこと
+ * - 取りこぼしは取得段だけで起きる (サンプルキューが満杯なら捨てて数える)。
+ *   推論段は結果キューの空きを超えて取り出さないため、出力の遅れはサンプルキューへ伝わる
+ * - 動的確保なし。グローバル変数として置けば Teensy 4.1 では DTCM (RAM1) に載る
+ */
+
+#ifndef TEENSY_SAMPLE_PIPELINE_H
+#define TEENSY_SAMPLE_PIPELINE_H
+
+#include <atomic>
+#include "teensy_batch_model.h"
+#include "teensy_profiler.h"
+
+// キューの長さ (2の冪)
+#ifndef PIPELINE_SAMPLE_QUEUE_SIZE
+#define PIPELINE_SAMPLE_QUEUE_SIZE 256
+#endif
+#ifndef PIPELINE_RESULT_QUEUE_SIZE
+#define PIPELINE_RESULT_QUEUE_SIZE 256
+#endif
+
+// 推論段が1回に取り出す最大件数 (バッチ予測のブロック長の倍数)
+const uint32_t PIPELINE_BATCH_SIZE = 2 * BATCH_BLOCK_SIZE;
+
+// 単一生産者・単一消費者のリングバッファ
+// head_ は生産者だけ、tail_ は消費者だけが書き込む (カウンタは32ビットで循環し、差が件数になる)
+template <typename T, uint32_t Capacity>
+class SpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    static const uint32_t CAPACITY = Capacity;
+
+    // 生産者側: 満杯なら false
+    bool push(const T& item) {
+        const uint32_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        items_[head & (Capacity - 1)] = item;
+        head_.store(head + 1, std::memory_order_release);  // 要素の書き込みの後に公開する
+        return true;
+    }
+
+    // 消費者側: 空なら false
+    bool pop(T& item) {
+        const uint32_t tail = tail_.load(std::memory_order_relaxed);
+        if (head_.load(std::memory_order_acquire) == tail) {
+            return false;
+        }
+        item = items_[tail & (Capacity - 1)];
+        tail_.store(tail + 1, std::memory_order_release);  // 読み終えてから領域を返す
+        return true;
+    }
+
+    // 件数 (他方の段が動いている間は目安)
+    uint32_t size() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    // 生産者側から見た空き (実際の空きはこれ以上)
+    uint32_t free_space() const { return Capacity - size(); }
+
+private:
+    T items_[Capacity];
+    alignas(64) std::atomic<uint32_t> head_{0};  // 生産者と消費者の添字を別のキャッシュラインに置く
+    alignas(64) std::atomic<uint32_t> tail_{0};
+};
+
+struct PipelineSample {
+    float under_y;
+    float theta;
+    uint32_t acquired_cycles;   // 取得時刻 (profiler_cycles)
+};
+
+struct PipelineResult {
+    float under_y;
+    float theta;
+    float distance;             // 範囲外の入力は -1.0f
+    uint32_t acquired_cycles;
+    uint32_t completed_cycles;  // 推論完了時刻 (profiler_cycles)
+};
+
+// 各カウンタは1つの段だけが書き込む (他の段からの読み出しは目安)
+struct PipelineStats {
+    uint32_t acquired;          // 取得段: 受け付けたサンプル数
+    uint32_t dropped;           // 取得段: サンプルキューが満杯で捨てた数
+    uint32_t max_sample_depth;  // 取得段: 受け付け時のサンプルキューの最大件数
+    uint32_t inferred;          // 推論段: 予測したサンプル数
+    uint32_t batches;           // 推論段: バッチ予測の回数
+    uint32_t emitted;           // 出力段: 取り出した結果の数
+};
+
+class SamplePipeline {
+public:
+    SamplePipeline();
+
+    // 取得段 (割り込みハンドラから呼べる): 取得時刻を付けてサンプルキューへ入れる (満杯なら捨てて false)
+    bool push_sample(float under_y, float theta);
+
+    // 推論段: 最大 max_batch 件 (PIPELINE_BATCH_SIZE 以下, 結果キューの空きまで) を予測し、件数を返す
+    uint32_t run_inference(uint32_t max_batch = PIPELINE_BATCH_SIZE);
+
+    // 出力段: 結果を1件取り出す (空なら false)
+    bool pop_result(PipelineResult& result);
+
+    uint32_t sample_depth() const { return samples_.size(); }
+    uint32_t result_depth() const { return results_.size(); }
+
+    // 各段の統計の写し (動作中は段ごとに少しずれた時点の値になる)
+    PipelineStats stats() const;
+    // 全段が止まっているときに呼ぶこと
+    void reset_stats();
+
+private:
+    // 単一の書き手のカウンタ (読み書きの分断を防ぐためだけの atomic, 順序付けは不要)
+    // Cortex-M7 では64ビットの atomic がロックフリーにならないため32ビットに限る
+    static TEENSY_INLINE void add_relaxed(std::atomic<uint32_t>& counter, uint32_t value) {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    SpscRing<PipelineSample, PIPELINE_SAMPLE_QUEUE_SIZE> samples_;
+    SpscRing<PipelineResult, PIPELINE_RESULT_QUEUE_SIZE> results_;
+
+    std::atomic<uint32_t> acquired_{0};
+    std::atomic<uint32_t> dropped_{0};
+    std::atomic<uint32_t> max_sample_depth_{0};
+    std::atomic<uint32_t> inferred_{0};
+    std::atomic<uint32_t> batches_{0};
+    std::atomic<uint32_t> emitted_{0};
+};
+
+#endif // TEENSY_SAMPLE_PIPELINE_H
@@ -0,0 +1,255 @@
+/*
+ * Teensy 4.1 多項式回帰モデル - バッチ予測要求のバイナリフレーム・プロトコルの実装
+ */
+
+#include "teensy_serial_protocol.h"
+#include <string.h>
+#include <pgmspace.h>
+#include "teensy_precision_model.h"
+#include "teensy_profiler.h"
+
+// 4ビットずつ処理する CRC表 (32 バイト)
+static const uint16_t CRC16_NIBBLE_TABLE[16] PROGMEM = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+static TEENSY_INLINE uint16_t crc16_update(uint16_t crc, uint8_t byte) {
+    crc = (uint16_t)((crc << 4) ^ CRC16_NIBBLE_TABLE[(crc >> 12) ^ (byte >> 4)]);
+    crc = (uint16_t)((crc << 4) ^ CRC16_NIBBLE_TABLE[(crc >> 12) ^ (byte & 0x0F)]);
+    return crc;
+}
+
+static TEENSY_INLINE void put_u16(uint8_t* out, uint16_t value) {
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+}
+
+static TEENSY_INLINE uint16_t get_u16(const uint8_t* in) {
+    return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+static TEENSY_INLINE void put_u32(uint8_t* out, uint32_t value) {
+    put_u16(out, (uint16_t)value);
+    put_u16(out + 2, (uint16_t)(value >> 16));
+}
+
+static TEENSY_INLINE uint32_t get_u32(const uint8_t* in) {
+    return (uint32_t)get_u16(in) | ((uint32_t)get_u16(in + 2) << 16);
+}
+
+// float はビット列をそのまま (memcpy はコンパイラが1命令に置き換える)
+static TEENSY_INLINE void put_f32(uint8_t* out, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    put_u32(out, bits);
+}
+
+static TEENSY_INLINE float get_f32(const uint8_t* in) {
+    const uint32_t bits = get_u32(in);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint16_t protocol_crc16(const uint8_t* data, size_t length, uint16_t crc) {
+    for (size_t i = 0; i < length; i++) {
+        crc = crc16_update(crc, data[i]);
+    }
+    return crc;
+}
+
+FrameParser::FrameParser() {
+    reset();
+    reset_stats();
+}
+
+void FrameParser::reset() {
+    state_ = STATE_SYNC0;
+    position_ = 0;
+}
+
+void FrameParser::reset_stats() {
+    memset(&stats_, 0, sizeof(stats_));
+}
+
+TEENSY_FAST ProtocolStatus FrameParser::feed(uint8_t byte) {
+    switch (state_) {
+        case STATE_SYNC0:
+            if (byte == PROTOCOL_SYNC0) {
+                state_ = STATE_SYNC1;
+            } else {
+                stats_.skipped_bytes++;
+            }
+            return PROTOCOL_PENDING;
+
+        case STATE_SYNC1:
+            if (byte == PROTOCOL_SYNC1) {
+                state_ = STATE_HEADER;
+                position_ = 0;
+                crc_ = 0xFFFF;
+            } else if (byte != PROTOCOL_SYNC0) {  // 0xA5 0xA5 0x5A は後ろの2バイトを同期とみなす
+                stats_.skipped_bytes += 2;
+                state_ = STATE_SYNC0;
+            } else {
+                stats_.skipped_bytes++;
+            }
+            return PROTOCOL_PENDING;
+
+        case STATE_HEADER:
+            crc_ = crc16_update(crc_, byte);
+            header_[position_++] = byte;
+            if (position_ < sizeof(header_)) {
+                return PROTOCOL_PENDING;
+            }
+            frame_.type = header_[0];
+            frame_.flags = header_[1];
+            frame_.sequence = get_u16(header_ + 2);
+            frame_.length = get_u16(header_ + 4);
+            if (frame_.length > PROTOCOL_MAX_PAYLOAD) {
+                stats_.length_errors++;
+                reset();
+                return PROTOCOL_LENGTH_ERROR;
+            }
+            state_ = frame_.length > 0 ? STATE_PAYLOAD : STATE_CRC;
+            position_ = 0;
+            return PROTOCOL_PENDING;
+
+        case STATE_PAYLOAD:
+            crc_ = crc16_update(crc_, byte);
+            frame_.payload[position_++] = byte;
+            if (position_ == frame_.length) {
+                state_ = STATE_CRC;
+                position_ = 0;
+            }
+            return PROTOCOL_PENDING;
+
+        case STATE_CRC:
+            if (position_++ == 0) {
+                received_crc_ = byte;
+                return PROTOCOL_PENDING;
+            }
+            received_crc_ = (uint16_t)(received_crc_ | (byte << 8));
+            reset();
+            if (received_crc_ != crc_) {
+                stats_.crc_errors++;
+                return PROTOCOL_CRC_ERROR;
+            }
+            stats_.frames++;
+            return PROTOCOL_FRAME;
+    }
+    reset();
+    return PROTOCOL_PENDING;
+}
+
+// out + PROTOCOL_HEADER_SIZE にペイロードが書かれている前提で、ヘッダと CRC を付ける
+static size_t finish_frame(uint8_t type, uint8_t flags, uint16_t sequence, uint16_t length, uint8_t* out) {
+    out[0] = PROTOCOL_SYNC0;
+    out[1] = PROTOCOL_SYNC1;
+    out[2] = type;
+    out[3] = flags;
+    put_u16(out + 4, sequence);
+    put_u16(out + 6, length);
+    const size_t crc_offset = PROTOCOL_HEADER_SIZE + length;
+    put_u16(out + crc_offset, protocol_crc16(out + 2, crc_offset - 2));
+    return crc_offset + PROTOCOL_CRC_SIZE;
+}
+
+size_t protocol_encode_frame(uint8_t type, uint8_t flags, uint16_t sequence, const uint8_t* payload, uint16_t length,
+                             uint8_t* out) {
+    if (length > PROTOCOL_MAX_PAYLOAD) {
+        return 0;
+    }
+    if (length > 0) {
+        memmove(out + PROTOCOL_HEADER_SIZE, payload, length);
+    }
+    return finish_frame(type, flags, sequence, length, out);
+}
+
+size_t protocol_encode_predict(uint16_t sequence, uint8_t flags, const float* under_y, const float* theta, size_t n,
+                               uint8_t* out) {
+    if (n == 0 || n > (size_t)PROTOCOL_MAX_PAIRS) {
+        return 0;
+    }
+    uint8_t* payload = out + PROTOCOL_HEADER_SIZE;
+    for (size_t i = 0; i < n; i++) {
+        put_f32(payload + i * PROTOCOL_PAIR_SIZE, under_y[i]);
+        put_f32(payload + i * PROTOCOL_PAIR_SIZE + 4, theta[i]);
+    }
+    return finish_frame(PROTOCOL_TYPE_PREDICT, flags, sequence, (uint16_t)(n * PROTOCOL_PAIR_SIZE), out);
+}
+
+bool protocol_decode_predict_response(const ProtocolFrame& response, size_t n, float* distance, uint32_t* cycles) {
+    const bool has_cycles = (response.flags & PROTOCOL_FLAG_CYCLES) != 0;
+    const size_t expected = n * (has_cycles ? 8 : 4);
+    if (response.type != (PROTOCOL_TYPE_PREDICT | PROTOCOL_TYPE_RESPONSE) || response.length != expected) {
+        return false;
+    }
+    for (size_t i = 0; i < n; i++) {
+        distance[i] = get_f32(response.payload + i * 4);
+    }
+    if (cycles != nullptr) {
+        for (size_t i = 0; i < n; i++) {
+            cycles[i] = has_cycles ? get_u32(response.payload + (n + i) * 4) : 0;
+        }
+    }
+    return true;
+}
+
+static size_t encode_error(const ProtocolFrame& request, ProtocolErrorCode code, uint8_t* out) {
+    out[PROTOCOL_HEADER_SIZE] = (uint8_t)code;
+    return finish_frame(PROTOCOL_TYPE_ERROR, 0, request.sequence, 1, out);
+}
+
+static size_t handle_predict(const ProtocolFrame& request, uint8_t* out) {
+    const size_t n = request.length / PROTOCOL_PAIR_SIZE;
+    if (n == 0 || n > (size_t)PROTOCOL_MAX_PAIRS || request.length % PROTOCOL_PAIR_SIZE != 0) {
+        return encode_error(request, PROTOCOL_ERROR_BAD_LENGTH, out);
+    }
+    uint8_t* payload = out + PROTOCOL_HEADER_SIZE;
+    const uint8_t flags = request.flags & PROTOCOL_FLAG_CYCLES;
+    float distance[PROTOCOL_MAX_PAIRS];
+    if (flags & PROTOCOL_FLAG_CYCLES) {
+        // 1件ずつ評価して計測 (結果はバッチ評価と同じ値)
+        for (size_t i = 0; i < n; i++) {
+            const float under_y = get_f32(request.payload + i * PROTOCOL_PAIR_SIZE);
+            const float theta = get_f32(request.payload + i * PROTOCOL_PAIR_SIZE + 4);
+            const uint32_t start = profiler_cycles();
+            distance[i] = predict_distance_selected(under_y, theta);
+            put_u32(payload + (n + i) * 4, profiler_cycles() - start);
+        }
+    } else {
+        float under_y[PROTOCOL_MAX_PAIRS];
+        float theta[PROTOCOL_MAX_PAIRS];
+        for (size_t i = 0; i < n; i++) {
+            under_y[i] = get_f32(request.payload + i * PROTOCOL_PAIR_SIZE);
+            theta[i] = get_f32(request.payload + i * PROTOCOL_PAIR_SIZE + 4);
+        }
+        predict_distance_selected_batch(under_y, theta, distance, n);
+    }
+    for (size_t i = 0; i < n; i++) {
+        put_f32(payload + i * 4, distance[i]);
+    }
+    const uint16_t length = (uint16_t)(n * (flags & PROTOCOL_FLAG_CYCLES ? 8 : 4));
+    return finish_frame(PROTOCOL_TYPE_PREDICT | PROTOCOL_TYPE_RESPONSE, flags, request.sequence, length, out);
+}
+
+static size_t handle_ping(const ProtocolFrame& request, uint8_t* out) {
+    uint8_t* payload = out + PROTOCOL_HEADER_SIZE;
+    payload[0] = PROTOCOL_VERSION;
+    payload[1] = (uint8_t)POLY_DEGREE;
+    put_u16(payload + 2, (uint16_t)PROTOCOL_MAX_PAIRS);
+    put_f32(payload + 4, profiler_cycles_per_us());
+    return finish_frame(PROTOCOL_TYPE_PING | PROTOCOL_TYPE_RESPONSE, 0, request.sequence, 8, out);
+}
+
+size_t protocol_handle_frame(const ProtocolFrame& request, uint8_t* out) {
+    switch (request.type) {
+        case PROTOCOL_TYPE_PREDICT:
+            return handle_predict(request, out);
+        case PROTOCOL_TYPE_PING:
+            return handle_ping(request, out);
+        default:
+            return encode_error(request, PROTOCOL_ERROR_UNKNOWN_TYPE, out);
+    }
+}
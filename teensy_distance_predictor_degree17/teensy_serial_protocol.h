@@ -0,0 +1,123 @@
+/*
+ * Teensy 4.1 多項式回帰モデル - バッチ予測要求のバイナリフレーム・プロトコル
+ *
+ * 対話メニュー (parseFloat と文字列の出力) を通さずに、1フレームで N 組の (under_y, theta) を送り、
+ * N 個の予測距離 (と、要求すれば1件ごとのサイクル数) を受け取る。ホストからはコプロセッサとして使う
+ *
+ * フレーム (数値はすべてリトルエンディアン, float は IEEE-754 単精度のビット列そのまま):
+ *   [0] 0xA5  [1] 0x5A                   同期バイト
+ *   [2] type  [3] flags  [4..5] sequence  [6..7] length (ペイロードのバイト数)
+ *   [8 .. 8+length-1] ペイロード
+ *   [8+length .. +1] CRC-16/CCITT-FALSE (type からペイロードの末尾まで)
+ * - 受信は1バイトずつの状態機械 (FrameParser)。同期バイト以外の文字は読み飛ばすため、
+ *   メニューのコマンド文字や起動時の文字列と同じ回線に混在してよい
+ * - CRC・長さの誤りは応答せずに捨て、次の同期バイトから読み直す (要求側はタイムアウトで検出)
+ * - 応答の sequence は要求と同じ値。要求は受信順に処理し、応答も同じ順で返す
+ *
+ * 要求と応答:
+ *   PREDICT (0x01): ペイロード = N × {float under_y, float theta} (1 ≤ N ≤ PROTOCOL_MAX_PAIRS)
+ *     → PREDICT_RESPONSE (0x81): N × float distance (範囲外の入力は -1.0f)
+ *        flags に PROTOCOL_FLAG_CYCLES があれば、続けて N × uint32 (1件ごとの推論サイクル数)
+ *   PING (0x02): ペイロードなし
+ *     → PING_RESPONSE (0x82): {uint8 version, uint8 POLY_DEGREE, uint16 PROTOCOL_MAX_PAIRS, float cycles/μs}
+ *   誤った要求 → ERROR_RESPONSE (0xFF): {uint8 ProtocolErrorCode}
+ */
+
+#ifndef TEENSY_SERIAL_PROTOCOL_H
+#define TEENSY_SERIAL_PROTOCOL_H
+
+#include <stddef.h>
+#include "teensy_horner_model.h"
+
+const uint8_t PROTOCOL_VERSION = 1;
+const uint8_t PROTOCOL_SYNC0 = 0xA5;
+const uint8_t PROTOCOL_SYNC1 = 0x5A;
+
+const uint8_t PROTOCOL_TYPE_PREDICT = 0x01;
+const uint8_t PROTOCOL_TYPE_PING = 0x02;
+const uint8_t PROTOCOL_TYPE_RESPONSE = 0x80;  // 応答の type = 要求の type | 0x80
+const uint8_t PROTOCOL_TYPE_ERROR = 0xFF;
+
+const uint8_t PROTOCOL_FLAG_CYCLES = 0x01;    // 1件ごとのサイクル数を返す (バッチ評価の代わりに1件ずつ評価する)
+
+// 1フレームの最大組数 (要求・応答ともペイロードは最大 512 バイト)
+const int PROTOCOL_MAX_PAIRS = 64;
+const int PROTOCOL_PAIR_SIZE = 8;
+const int PROTOCOL_HEADER_SIZE = 8;
+const int PROTOCOL_CRC_SIZE = 2;
+const int PROTOCOL_MAX_PAYLOAD = PROTOCOL_MAX_PAIRS * PROTOCOL_PAIR_SIZE;
+const int PROTOCOL_MAX_FRAME_SIZE = PROTOCOL_HEADER_SIZE + PROTOCOL_MAX_PAYLOAD + PROTOCOL_CRC_SIZE;
+
+enum ProtocolErrorCode {
+    PROTOCOL_ERROR_UNKNOWN_TYPE = 1,
+    PROTOCOL_ERROR_BAD_LENGTH = 2,   // 組の大きさの倍数でない・0組
+};
+
+// feed の結果
+enum ProtocolStatus {
+    PROTOCOL_PENDING,       // フレームの途中 (または同期待ち)
+    PROTOCOL_FRAME,         // フレームを1つ受信した (frame() で参照, 次の feed まで有効)
+    PROTOCOL_CRC_ERROR,     // CRC不一致で捨てた
+    PROTOCOL_LENGTH_ERROR,  // length が PROTOCOL_MAX_PAYLOAD を超えたため捨てた
+};
+
+struct ProtocolFrame {
+    uint8_t type;
+    uint8_t flags;
+    uint16_t sequence;
+    uint16_t length;
+    uint8_t payload[PROTOCOL_MAX_PAYLOAD];
+};
+
+struct ProtocolStats {
+    uint32_t frames;         // 正しく受信したフレーム数
+    uint32_t crc_errors;
+    uint32_t length_errors;
+    uint32_t skipped_bytes;  // フレームの外で読み飛ばしたバイト数
+};
+
+// CRC-16/CCITT-FALSE (多項式 0x1021, 初期値 0xFFFF)。crc に前回の値を渡して続きを計算できる
+uint16_t protocol_crc16(const uint8_t* data, size_t length, uint16_t crc = 0xFFFF);
+
+// 1バイトずつ与える受信側の状態機械 (動的確保なし)
+class FrameParser {
+public:
+    FrameParser();
+
+    ProtocolStatus feed(uint8_t byte);
+    const ProtocolFrame& frame() const { return frame_; }
+
+    // 同期バイト待ち (フレームの途中でない) か
+    bool idle() const { return state_ == STATE_SYNC0; }
+    void reset();
+
+    const ProtocolStats& stats() const { return stats_; }
+    void reset_stats();
+
+private:
+    enum State { STATE_SYNC0, STATE_SYNC1, STATE_HEADER, STATE_PAYLOAD, STATE_CRC };
+
+    State state_;
+    uint16_t position_;  // 現在の状態で受け取ったバイト数
+    uint16_t crc_;       // 受信中に逐次計算する CRC
+    uint16_t received_crc_;
+    uint8_t header_[PROTOCOL_HEADER_SIZE - 2];
+    ProtocolFrame frame_;
+    ProtocolStats stats_;
+};
+
+// フレームを組み立てて out (PROTOCOL_MAX_FRAME_SIZE バイト以上) に書き、全体のバイト数を返す
+size_t protocol_encode_frame(uint8_t type, uint8_t flags, uint16_t sequence, const uint8_t* payload, uint16_t length,
+                             uint8_t* out);
+
+// 要求側: n 組 (1〜PROTOCOL_MAX_PAIRS) の PREDICT 要求を組み立てる (n が範囲外なら 0)
+size_t protocol_encode_predict(uint16_t sequence, uint8_t flags, const float* under_y, const float* theta, size_t n,
+                               uint8_t* out);
+
+// 要求側: PREDICT_RESPONSE から n 個の結果を取り出す (cycles は nullptr 可)。形式が合わなければ false
+bool protocol_decode_predict_response(const ProtocolFrame& response, size_t n, float* distance, uint32_t* cycles);
+
+// 応答側: 受信した要求を処理して応答フレームを out に書き、バイト数を返す
+size_t protocol_handle_frame(const ProtocolFrame& request, uint8_t* out);
+
+#endif // TEENSY_SERIAL_PROTOCOL_H
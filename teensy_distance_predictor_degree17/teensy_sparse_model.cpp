@@ -0,0 +1,61 @@
+/*
+ * Teensy 4.1 多項式回帰モデル実装 - スパース (枝刈り) 多項式
+ * 項の一覧と評価関数: teensy_sparse_model.h (export_teensy_model.py sparse で生成)
+ *
+ * 正規化変数 x, y ∈ [-1, 1] (学習領域) の多項式のうち残った項だけを評価する
+ * - 生成済みの評価関数: 使う指数のべき乗だけを計算し、x の指数ごとにまとめた行を足し合わせる
+ * - 汎用ループ: 項の一覧 (指数の組, 係数) をたどる (べき乗の表を作ってから積和)
+ */
+
+#include "teensy_sparse_model.h"
+#include <pgmspace.h>
+
+static TEENSY_INLINE double normalized_under_y(float under_y) {
+    return ((double)under_y - SPARSE_UNDER_Y_CENTER) * SPARSE_UNDER_Y_INV_HALF;
+}
+
+static TEENSY_INLINE double normalized_theta(float theta) {
+    return ((double)theta - SPARSE_THETA_CENTER) * SPARSE_THETA_INV_HALF;
+}
+
+TEENSY_FAST float predict_distance_sparse(float under_y, float theta) {
+    // 入力値検証
+    if (!validate_input_range(under_y, theta)) {
+        return -1.0f;  // エラー指標
+    }
+    return (float)SPARSE_MODELS[SPARSE_DEFAULT_MODEL].evaluate(normalized_under_y(under_y), normalized_theta(theta));
+}
+
+TEENSY_FAST float predict_distance_sparse_model(const SparseModel& model, float under_y, float theta) {
+    // 入力値検証
+    if (!validate_input_range(under_y, theta)) {
+        return -1.0f;  // エラー指標
+    }
+    return (float)model.evaluate(normalized_under_y(under_y), normalized_theta(theta));
+}
+
+TEENSY_FAST float predict_distance_sparse_terms(const SparseModel& model, float under_y, float theta) {
+    // 入力値検証
+    if (!validate_input_range(under_y, theta)) {
+        return -1.0f;  // エラー指標
+    }
+
+    // べき乗の表 (0〜SPARSE_DEGREE 次)
+    double x_powers[SPARSE_DEGREE + 1];
+    double y_powers[SPARSE_DEGREE + 1];
+    const double x = normalized_under_y(under_y);
+    const double y = normalized_theta(theta);
+    x_powers[0] = 1.0;
+    y_powers[0] = 1.0;
+    for (int k = 1; k <= SPARSE_DEGREE; k++) {
+        x_powers[k] = x_powers[k - 1] * x;
+        y_powers[k] = y_powers[k - 1] * y;
+    }
+
+    double acc = 0.0;
+    for (int k = 0; k < model.term_count; k++) {
+        const SparseTerm& term = model.terms[k];
+        acc += term.coefficient * x_powers[term.under_y_power] * y_powers[term.theta_power];
+    }
+    return (float)acc;
+}
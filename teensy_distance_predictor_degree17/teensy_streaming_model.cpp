@@ -0,0 +1,166 @@
+/*
+ * Teensy 4.1 多項式回帰モデル実装 (17次) - 連続入力用の差分評価
+ *
+ * 係数は HORNER_COEFFICIENTS (外側under_y^17→^0, 内側theta降順) をそのまま使う
+ * a_ij (under_y^i * theta^j) の位置: (N-i)(N-i+1)/2 + (N-i-j)
+ */
+
+#include "teensy_streaming_model.h"
+#include <pgmspace.h>
+
+// 18項の行を1変数のHorner法で評価 (rows は最高次から)
+static TEENSY_INLINE double evaluate_rows(const double* rows, double x) {
+    double acc = rows[0];
+    for (int k = 1; k <= POLY_DEGREE; k++) {
+        acc = acc * x + rows[k];
+    }
+    return acc;
+}
+
+StreamingPredictor::StreamingPredictor()
+    : taylor_enabled_(false),
+      max_delta_under_y_(STREAMING_TAYLOR_MAX_DELTA_UNDER_Y),
+      max_delta_theta_(STREAMING_TAYLOR_MAX_DELTA_THETA) {
+    reset();
+    reset_stats();
+}
+
+void StreamingPredictor::reset() {
+    theta_rows_valid_ = false;
+    under_y_rows_valid_ = false;
+    anchor_valid_ = false;
+    has_last_ = false;
+}
+
+void StreamingPredictor::reset_stats() {
+    stats_.full = 0;
+    stats_.theta_held = 0;
+    stats_.under_y_held = 0;
+    stats_.taylor = 0;
+}
+
+void StreamingPredictor::set_taylor(bool enabled, float max_delta_under_y, float max_delta_theta) {
+    taylor_enabled_ = enabled;
+    max_delta_under_y_ = (double)max_delta_under_y;
+    max_delta_theta_ = (double)max_delta_theta;
+    anchor_valid_ = false;
+}
+
+TEENSY_FAST float StreamingPredictor::predict(float under_y, float theta) {
+    // 入力値検証
+    if (!validate_input_range(under_y, theta)) {
+        return -1.0f;  // エラー指標
+    }
+    return (float)evaluate((double)under_y, (double)theta);
+}
+
+TEENSY_FAST double StreamingPredictor::evaluate(double under_y, double theta) {
+    double result;
+    if (theta_rows_valid_ && theta == rows_theta_) {
+        stats_.theta_held++;
+        result = evaluate_rows(theta_rows_, under_y) + HORNER_INTERCEPT;
+    } else if (under_y_rows_valid_ && under_y == rows_under_y_) {
+        stats_.under_y_held++;
+        result = evaluate_rows(under_y_rows_, theta) + HORNER_INTERCEPT;
+    } else if (taylor_enabled_ && anchor_valid_ &&
+               fabs(under_y - anchor_under_y_) <= max_delta_under_y_ &&
+               fabs(theta - anchor_theta_) <= max_delta_theta_) {
+        stats_.taylor++;
+        const double du = under_y - anchor_under_y_;
+        const double dt = theta - anchor_theta_;
+        result = anchor_value_ + du * (anchor_du_ + 0.5 * anchor_duu_ * du + anchor_dut_ * dt) +
+                 dt * (anchor_dt_ + 0.5 * anchor_dtt_ * dt);
+    } else {
+        stats_.full++;
+        if (has_last_ && under_y == last_under_y_) {
+            // under_y が続けて同じ (theta だけが動いている) ので theta 方向の行を作る
+            build_under_y_rows(under_y);
+            result = evaluate_rows(under_y_rows_, theta) + HORNER_INTERCEPT;
+        } else if (taylor_enabled_ && has_last_ &&
+                   fabs(under_y - last_under_y_) <= max_delta_under_y_ &&
+                   fabs(theta - last_theta_) <= max_delta_theta_) {
+            build_anchor(under_y, theta);
+            result = anchor_value_;
+        } else {
+            result = evaluate_full(under_y, theta);
+        }
+    }
+    last_under_y_ = under_y;
+    last_theta_ = theta;
+    has_last_ = true;
+    return result;
+}
+
+// evaluate_horner_double と同じ計算順で、内側の結果 q_i(theta) を保持する
+TEENSY_FAST double StreamingPredictor::evaluate_full(double under_y, double theta) {
+    const double* coeff = HORNER_COEFFICIENTS;
+    double acc = 0.0;
+
+    for (int i = POLY_DEGREE; i >= 0; i--) {
+        double q = *coeff++;
+        for (int j = POLY_DEGREE - i; j > 0; j--) {
+            q = q * theta + *coeff++;
+        }
+        theta_rows_[POLY_DEGREE - i] = q;
+        acc = acc * under_y + q;
+    }
+    rows_theta_ = theta;
+    theta_rows_valid_ = true;
+
+    return acc + HORNER_INTERCEPT;
+}
+
+// r_j(under_y) = Σ_i a_ij * under_y^i (係数表を列方向にたどる)
+TEENSY_FAST void StreamingPredictor::build_under_y_rows(double under_y) {
+    for (int j = POLY_DEGREE; j >= 0; j--) {
+        // i = N-j から 0 へ: a_ij の位置は (N-i)(N-i+1)/2 + (N-i-j)
+        double r = HORNER_COEFFICIENTS[j * (j + 1) / 2];
+        for (int i = POLY_DEGREE - j - 1; i >= 0; i--) {
+            const int row = POLY_DEGREE - i;
+            r = r * under_y + HORNER_COEFFICIENTS[row * (row + 1) / 2 + row - j];
+        }
+        under_y_rows_[POLY_DEGREE - j] = r;
+    }
+    rows_under_y_ = under_y;
+    under_y_rows_valid_ = true;
+}
+
+// 値と1階・2階微分を同時に求める (値の計算順は evaluate_full と同じ)
+// 内側: q, q' と q''/2 を theta について、外側: それぞれを under_y について累積する
+TEENSY_FAST void StreamingPredictor::build_anchor(double under_y, double theta) {
+    const double* coeff = HORNER_COEFFICIENTS;
+    double value = 0.0, value_u = 0.0, value_uu_half = 0.0;  // Σ u^i q_i とその u 微分
+    double slope = 0.0, slope_u = 0.0;                       // Σ u^i q_i' とその u 微分
+    double curvature_half = 0.0;                             // Σ u^i q_i'' / 2
+
+    for (int i = POLY_DEGREE; i >= 0; i--) {
+        double q = *coeff++;
+        double dq = 0.0;
+        double ddq_half = 0.0;
+        for (int j = POLY_DEGREE - i; j > 0; j--) {
+            ddq_half = ddq_half * theta + dq;
+            dq = dq * theta + q;
+            q = q * theta + *coeff++;
+        }
+        theta_rows_[POLY_DEGREE - i] = q;
+
+        value_uu_half = value_uu_half * under_y + value_u;
+        value_u = value_u * under_y + value;
+        value = value * under_y + q;
+        slope_u = slope_u * under_y + slope;
+        slope = slope * under_y + dq;
+        curvature_half = curvature_half * under_y + ddq_half;
+    }
+    rows_theta_ = theta;
+    theta_rows_valid_ = true;
+
+    anchor_under_y_ = under_y;
+    anchor_theta_ = theta;
+    anchor_value_ = value + HORNER_INTERCEPT;
+    anchor_du_ = value_u;
+    anchor_dt_ = slope;
+    anchor_duu_ = 2.0 * value_uu_half;
+    anchor_dut_ = slope_u;
+    anchor_dtt_ = 2.0 * curvature_half;
+    anchor_valid_ = true;
+}
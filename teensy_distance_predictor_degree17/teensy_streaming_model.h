@@ -0,0 +1,92 @@
+/*
+ * Teensy 4.1 多項式回帰モデル (17次) - 連続入力用の差分評価
+ *
+ * 追跡ループでは連続するサンプルの (under_y, theta) がわずかしか変わらず、
+ * 特に under_y (カメラの行) は同じ値のまま theta だけが動くことが多い。
+ * StreamingPredictor は前回の部分Horner多項式を保持し、片方の軸が前回と同じなら
+ * もう一方の軸の18項のHorner法 (乗算+加算17回) だけで評価する (結果はHorner法と同じ多項式)
+ *   - theta が同じ: q_i(theta) = Σ_j a_ij * theta^j を再利用して under_y 方向に評価
+ *     (evaluate_horner_double とビット一致)
+ *   - under_y が同じ: r_j(under_y) = Σ_i a_ij * under_y^i を再利用して theta 方向に評価
+ * 任意で、両方が変わった場合に基準点での2次のテイラー展開で近似し、
+ * 基準点からのずれが上限を超えたら全項を評価して基準点を更新する (ドリフト上限付き)
+ * 基準点の計算 (微分を含む) はHorner法の約2倍かかるため、前回からの変化が上限以内のとき
+ * (次の入力も近くにありそうなとき) だけ基準点を作る
+ */
+
+#ifndef TEENSY_STREAMING_MODEL_H
+#define TEENSY_STREAMING_MODEL_H
+
+#include "teensy_horner_model.h"
+
+// テイラー近似の既定のずれ上限 (計測領域で近似誤差 最大 ~0.02cm, p99 ~0.005cm)
+// 3次の剰余はずれの3乗で増えるため、0.1 で最大 ~0.17cm、0.25 で数cm (theta > 50 の隅) になる
+const float STREAMING_TAYLOR_MAX_DELTA_UNDER_Y = 0.05f;
+const float STREAMING_TAYLOR_MAX_DELTA_THETA = 0.05f;
+
+// 評価経路ごとの回数
+struct StreamingStats {
+    uint32_t full;          // 全項の評価 (基準点・行の更新)
+    uint32_t theta_held;    // q_i(theta) の再利用
+    uint32_t under_y_held;  // r_j(under_y) の再利用
+    uint32_t taylor;        // テイラー近似
+};
+
+class StreamingPredictor {
+public:
+    StreamingPredictor();
+
+    // 保持している部分多項式を破棄する (統計は残す)
+    void reset();
+    void reset_stats();
+
+    // テイラー近似の有効化と、基準点からのずれの上限
+    void set_taylor(bool enabled, float max_delta_under_y = STREAMING_TAYLOR_MAX_DELTA_UNDER_Y,
+                    float max_delta_theta = STREAMING_TAYLOR_MAX_DELTA_THETA);
+
+    // 入力検証付き (範囲外は -1.0f, 保持している状態は変えない)
+    float predict(float under_y, float theta);
+
+    // 入力検証なし
+    double evaluate(double under_y, double theta);
+
+    const StreamingStats& stats() const { return stats_; }
+
+private:
+    double evaluate_full(double under_y, double theta);
+    void build_under_y_rows(double under_y);
+    void build_anchor(double under_y, double theta);
+
+    // theta 固定の行 q_i (i = 17..0, 評価順)
+    double theta_rows_[POLY_DEGREE + 1];
+    double rows_theta_;
+    bool theta_rows_valid_;
+
+    // under_y 固定の行 r_j (j = 17..0, 評価順)
+    double under_y_rows_[POLY_DEGREE + 1];
+    double rows_under_y_;
+    bool under_y_rows_valid_;
+
+    // 前回の入力 (under_y が続けて同じなら r_j を作る)
+    double last_under_y_;
+    double last_theta_;
+    bool has_last_;
+
+    // テイラー近似の基準点と値・1階・2階微分
+    bool taylor_enabled_;
+    bool anchor_valid_;
+    double max_delta_under_y_;
+    double max_delta_theta_;
+    double anchor_under_y_;
+    double anchor_theta_;
+    double anchor_value_;
+    double anchor_du_;
+    double anchor_dt_;
+    double anchor_duu_;
+    double anchor_dut_;
+    double anchor_dtt_;
+
+    StreamingStats stats_;
+};
+
+#endif // TEENSY_STREAMING_MODEL_H
@@ -0,0 +1,68 @@
+/*
+ * Teensy 4.1 多項式回帰モデル実装 - 区分多項式 (タイルごとの低次局所多項式)
+ * 係数表: teensy_tiled_model.h (export_teensy_model.py tiled で生成)
+ *
+ * 領域をセルに均一分割し、誤差の大きいセルだけをさらに 2^k × 2^k のタイルに等分している
+ * タイルの特定はセル番号と段数の表引きのみ (探索なしのO(1))、評価は4次15項のHorner法 (単精度)
+ * 表の範囲外 (validate_input_rangeの範囲内) はHorner法で厳密に評価する
+ */
+
+#include "teensy_tiled_model.h"
+#include <pgmspace.h>
+
+// タイル内の正規化座標 (x, y ∈ [-1, 1]) でのHorner評価 (HORNER_COEFFICIENTS と同じ並び)
+static TEENSY_INLINE float evaluate_tile(const float* coeff, float x, float y) {
+    float acc = 0.0f;
+    for (int i = TILED_DEGREE; i >= 0; i--) {
+        float q = *coeff++;
+        for (int j = TILED_DEGREE - i; j > 0; j--) {
+            q = q * y + *coeff++;
+        }
+        acc = acc * x + q;
+    }
+    return acc;
+}
+
+TEENSY_FAST float evaluate_tiled(float under_y, float theta) {
+    // セル番号と端数 (範囲外は端のセルに寄せて外挿)
+    float position_u = (under_y - TILED_UNDER_Y_MIN) * TILED_UNDER_Y_INV_CELL;
+    float position_t = (theta - TILED_THETA_MIN) * TILED_THETA_INV_CELL;
+    int a = (int)position_u;
+    int b = (int)position_t;
+    if (position_u < 0.0f) a = 0;
+    if (a >= TILED_CELLS_U) a = TILED_CELLS_U - 1;
+    if (position_t < 0.0f) b = 0;
+    if (b >= TILED_CELLS_T) b = TILED_CELLS_T - 1;
+    const int cell = a * TILED_CELLS_T + b;
+
+    // セル内のタイル番号 (i, j) と正規化座標
+    const int level = TILED_CELL_LEVEL[cell];
+    const int n = 1 << level;
+    const float scale = (float)n;
+    float sub_u = (position_u - (float)a) * scale;
+    float sub_t = (position_t - (float)b) * scale;
+    int i = (int)sub_u;
+    int j = (int)sub_t;
+    if (sub_u < 0.0f) i = 0;
+    if (i >= n) i = n - 1;
+    if (sub_t < 0.0f) j = 0;
+    if (j >= n) j = n - 1;
+    const int tile = TILED_CELL_OFFSET[cell] + i * n + j;
+
+    float x = 2.0f * (sub_u - (float)i) - 1.0f;
+    float y = 2.0f * (sub_t - (float)j) - 1.0f;
+    return evaluate_tile(TILED_COEFFICIENTS[tile], x, y);
+}
+
+TEENSY_FAST float predict_distance_tiled(float under_y, float theta) {
+    // 入力値検証
+    if (!validate_input_range(under_y, theta)) {
+        return -1.0f;  // エラー指標
+    }
+
+    if (!(under_y >= TILED_UNDER_Y_MIN && under_y <= TILED_UNDER_Y_MAX &&
+          theta >= TILED_THETA_MIN && theta <= TILED_THETA_MAX)) {
+        return (float)evaluate_horner_double((double)under_y, (double)theta);
+    }
+    return evaluate_tiled(under_y, theta);
+}
@@ -0,0 +1,701 @@
+/*
+ * Teensy 4.1 区分多項式モデル - タイルごとの4次局所多項式
+ * 学習データ: data/alloutput_polynomial_degree17_mae0.90(LNN蒸留多項式).csv
+ * 生成日時: 2026-10-17 00:00:19
+ * 生成スクリプト: export_teensy_model.py tiled
+ *
+ * under_y 0..121, theta -49..56 を 8 × 7 のセルに分け、
+ * 各セルを 2^k × 2^k のタイルに等分する (セル数 1x1: 47, 2x2: 7, 4x4: 2, 合計 107 タイル)
+ * タイル内の正規化変数 x, y ∈ [-1, 1] に対する係数:
+ *   distance = Σ c_ij * x^i * y^j
+ * 係数は評価順 (外側x^4→^0, 内側y降順) に格納
+ * 学習点での誤差: 平均 0.0125, 最大 0.2319
+ * 検証MAE (All measurement data.csv): 0.8971
+ */
+
+#ifndef TEENSY_TILED_MODEL_H
+#define TEENSY_TILED_MODEL_H
+
+#include "teensy_horner_model.h"
+
+const int TILED_DEGREE = 4;
+const int TILED_TERM_COUNT = 15;
+const int TILED_CELLS_U = 8;
+const int TILED_CELLS_T = 7;
+const int TILED_TILE_COUNT = 107;
+
+// 表の範囲とセル幅の逆数
+const float TILED_UNDER_Y_MIN = 0.0f;
+const float TILED_UNDER_Y_MAX = 121.0f;
+const float TILED_THETA_MIN = -49.0f;
+const float TILED_THETA_MAX = 56.0f;
+const float TILED_UNDER_Y_INV_CELL = 0.0661157025f;
+const float TILED_THETA_INV_CELL = 0.0666666667f;
+
+// セル (a * TILED_CELLS_T + b) の分割段数 k と先頭タイル番号 (タイル番号 = 先頭 + i * 2^k + j)
+const uint8_t TILED_CELL_LEVEL[TILED_CELLS_U * TILED_CELLS_T] PROGMEM = {
+     0,  2,  1,  1,  1,  2,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  1,  0,  0,  0,  0,  0,  1
+};
+const uint16_t TILED_CELL_OFFSET[TILED_CELLS_U * TILED_CELLS_T] PROGMEM = {
+       0,    1,   17,   21,   25,   29,   45,   46,   47,   51,   52,   53,   54,   58,   59,   60,
+      61,   62,   63,   64,   65,   66,   67,   68,   69,   70,   71,   72,   73,   74,   75,   76,
+      77,   78,   79,   80,   81,   82,   83,   84,   85,   86,   87,   88,   89,   90,   91,   92,
+      93,   94,   98,   99,  100,  101,  102,  103
+};
+
+// タイルごとの正規化係数 (単精度)
+const float TILED_COEFFICIENTS[TILED_TILE_COUNT][TILED_TERM_COUNT] PROGMEM = {
+    { // タイル 0
+    -1.14178763f, -0.763549531f, 0.505413378f, -2.01313982f,
+    5.7617154f, 1.18910279f, -3.05468006f, 15.1857175f,
+    -22.4064894f, -6.79587342f, -2.95958707f, 12.2826432f,
+    -13.7138937f, -9.0687015f, 110.590715f
+    },
+    { // タイル 1
+    -0.255849852f, -0.390823806f, 1.62003626f, -0.0913405012f,
+    1.39173216f, -2.88863726f, -0.0516312302f, 0.302931006f,
+    -0.752137408f, -5.82514824f, 0.0167773724f, -0.0456185412f,
+    0.0689435787f, -3.243522f, 112.467764f
+    },
+    { // タイル 2
+    -0.195232385f, -0.358618449f, 0.788360583f, -0.118338818f,
+    0.941300213f, -0.594092185f, -0.00422173383f, 0.0920744593f,
+    -0.146742928f, -6.49482846f, -0.00057974967f, 0.0217063561f,
+    0.107381921f, -3.00906525f, 106.177863f
+    },
+    { // タイル 3
+    -0.0832811439f, -0.211229787f, 0.19689348f, -0.101608421f,
+    0.467006257f, 0.665041145f, 0.00569023888f, 0.0957411914f,
+    0.0751393852f, -6.56088344f, 0.000257954042f, -0.00346768788f,
+    0.163165749f, -2.3936372f, 100.753002f
+    },
+    { // タイル 4
+    -0.0169272682f, -0.0971773522f, -0.123274998f, -0.0731377101f,
+    0.0907826946f, 1.11196585f, -0.00771359822f, 0.0787013473f,
+    0.348750038f, -6.11526248f, 0.00261107224f, -0.00461447833f,
+    0.110170084f, -1.82416459f, 96.5891548f
+    },
+    { // タイル 5
+    -0.058004115f, -0.051557147f, 0.077016969f, -0.000140137272f,
+    -0.113714161f, 1.06890266f, -0.0479172838f, 0.115303608f,
+    0.687535777f, -6.03567356f, 0.0385301496f, -0.205641046f,
+    0.406186646f, -2.20045013f, 98.1348949f
+    },
+    { // タイル 6
+    -0.0294849574f, -0.031768835f, -0.0517613618f, 0.00880788246f,
+    -0.141982264f, 0.775540637f, -0.00739710344f, -0.0895206516f,
+    0.612519594f, -4.54713275f, 0.0105071592f, 0.00724528839f,
+    -0.0262409305f, -1.86543837f, 94.3365218f
+    },
+    { // タイル 7
+    -0.00169751167f, -0.0081128225f, -0.111478935f, 0.00421849942f,
+    -0.1283115f, 0.479907594f, 0.00663855227f, -0.0742825231f,
+    0.22833625f, -3.71024831f, -0.00359151556f, 0.00929884008f,
+    0.0860390013f, -1.7249546f, 90.6686778f
+    },
+    { // タイル 8
+    0.0121094499f, 0.0111272998f, -0.117905837f, 0.00466002344f,
+    -0.121263859f, 0.216030665f, 0.00448134941f, -0.0365647986f,
+    -0.00241839799f, -3.50525619f, -0.00091747391f, -0.0060941526f,
+    0.0801785929f, -1.35867784f, 87.5926011f
+    },
+    { // タイル 9
+    0.0021657408f, 0.026879098f, -0.164212295f, 0.00292407168f,
+    -0.14926901f, 0.37716852f, -0.0314677748f, 0.0903466942f,
+    -0.122660767f, -2.62273666f, 0.0515737826f, -0.321561164f,
+    0.629995972f, -1.63128925f, 90.0307455f
+    },
+    { // タイル 10
+    0.0064687525f, 0.0230549436f, -0.110328853f, 0.0131314392f,
+    -0.122220801f, 0.0821494675f, -0.00644168119f, -0.0326283535f,
+    -0.0888799891f, -2.75185218f, 0.0160401486f, -0.0155959074f,
+    -0.163757924f, -1.36321422f, 87.5343724f
+    },
+    { // タイル 11
+    0.0102066113f, 0.0201402215f, -0.0632636609f, 0.0138348769f,
+    -0.0674111573f, -0.117073252f, 0.00479737611f, -0.0292830162f,
+    -0.246317397f, -3.09999169f, -0.00254248039f, 0.0205082051f,
+    -0.029028608f, -1.79264412f, 84.2690272f
+    },
+    { // タイル 12
+    0.0105213433f, 0.0184200462f, -0.0242227052f, 0.00961134634f,
+    -0.0215365478f, -0.200979057f, 0.00352763835f, -0.00440362082f,
+    -0.305886834f, -3.66929911f, -0.00115089076f, 0.00234301737f,
+    0.0349132405f, -1.73864722f, 80.6938889f
+    },
+    { // タイル 13
+    0.0147645893f, 0.0226973478f, -0.0567576201f, -0.0105875747f,
+    0.0435910785f, -0.358526458f, -0.00755843279f, 0.0130589975f,
+    -0.276453921f, -2.8506713f, 0.0576878049f, -0.374968866f,
+    0.753874461f, -2.17815531f, 85.0601572f
+    },
+    { // タイル 14
+    0.0119494992f, 0.0182937039f, -0.0143580786f, 0.00231113469f,
+    0.0210260167f, -0.3018177f, 0.00182905225f, -0.00655380517f,
+    -0.286423747f, -3.40187338f, 0.0178334247f, -0.00953282284f,
+    -0.199940441f, -1.85498528f, 81.6353086f
+    },
+    { // タイル 15
+    0.00720132666f, 0.0119599723f, 0.0136381279f, 0.00570578032f,
+    0.0379914038f, -0.240517383f, 0.00300532315f, 0.010305485f,
+    -0.276411544f, -3.97568478f, -0.00264970003f, 0.0288373245f,
+    -0.0390543185f, -2.38973294f, 77.2692327f
+    },
+    { // タイル 16
+    0.00332686542f, 0.0061611728f, 0.029546037f, 0.00288494441f,
+    0.0534505057f, -0.141966994f, 0.000859389551f, 0.0215168807f,
+    -0.201710129f, -4.4597458f, -0.00171725868f, 0.00599350329f,
+    0.0609787991f, -2.29518153f, 72.517696f
+    },
+    { // タイル 17
+    0.345332883f, 0.213170488f, -1.19126162f, -0.00806076937f,
+    -1.07114987f, 0.853398026f, -0.0497733769f, -0.146738858f,
+    0.409764965f, -7.67248132f, -0.000742078012f, 0.0130831385f,
+    0.266960184f, -2.02192951f, 87.8078f
+    },
+    { // タイル 18
+    0.397131555f, 0.260039314f, -0.635490637f, 0.221375231f,
+    -0.488027853f, -0.998726888f, 0.0497755722f, -0.16012967f,
+    -0.528766477f, -7.8485857f, 0.00849802772f, -0.0368942961f,
+    0.0263774018f, -1.3392783f, 84.6597931f
+    },
+    { // タイル 19
+    0.0248704061f, 0.0845073379f, 0.252318983f, 0.0220587206f,
+    0.323807149f, -0.327179438f, -0.00123477466f, 0.120893915f,
+    -0.714012937f, -9.59142986f, -2.47228552e-05f, 0.000723840377f,
+    0.222154615f, -3.4694383f, 71.107293f
+    },
+    { // タイル 20
+    -0.0462704679f, -0.00702815072f, 0.333713324f, -0.0416070107f,
+    0.286452456f, 0.447505008f, -0.00488409543f, 0.111039939f,
+    -0.148398073f, -10.4504696f, 0.00832838835f, 0.00542329347f,
+    0.234114322f, -2.5380534f, 65.0693568f
+    },
+    { // タイル 21
+    0.392880172f, -0.0510038759f, -0.427444189f, 0.0528923772f,
+    0.161364824f, -1.15320314f, 0.0410949237f, 0.173929715f,
+    -0.230741258f, -8.8534821f, 0.00183540647f, 0.0783801282f,
+    0.25240841f, -1.12301298f, 82.0197783f
+    },
+    { // タイル 22
+    0.492749339f, -0.225636074f, -0.747998349f, -0.0611746745f,
+    0.104724949f, -0.881976604f, -0.00290142882f, 0.293781599f,
+    0.974870681f, -8.16079075f, -0.0314350919f, -0.103929012f,
+    0.408244741f, 0.650477093f, 81.4135663f
+    },
+    { // タイル 23
+    -0.0698422599f, -0.013289831f, 0.305345161f, -0.0695624025f,
+    0.0512064891f, 0.846829456f, -0.0238497189f, 0.0174893501f,
+    0.169220201f, -10.3553435f, -0.00317431669f, 0.0812857979f,
+    0.56945197f, -1.12608073f, 61.1634257f
+    },
+    { // タイル 24
+    -0.0635879658f, 0.0455064501f, 0.334796308f, -0.0689520307f,
+    -0.236059392f, 0.652711003f, 0.0186943611f, -0.0290954707f,
+    -0.0319226184f, -10.1728446f, -0.0242399484f, -0.0864465394f,
+    0.670483218f, 1.7492636f, 61.7032007f
+    },
+    { // タイル 25
+    0.627281014f, -0.302850098f, -1.31220806f, 0.146143317f,
+    0.214251074f, -0.913861197f, -0.10009899f, -0.0121902119f,
+    1.85670045f, -5.1067293f, 0.0503220942f, -0.0121450423f,
+    -0.455168822f, 0.390687724f, 83.1362184f
+    },
+    { // タイル 26
+    0.551122436f, -0.151962273f, -1.81712638f, 0.223770453f,
+    1.12954376f, 0.444510825f, -0.0662886319f, -0.700812206f,
+    0.198381205f, -2.48049993f, -0.0164012039f, 0.199375958f,
+    0.473627863f, -0.155552758f, 82.6863411f
+    },
+    { // タイル 27
+    -0.0352400147f, 0.0484185843f, 0.440448558f, -0.0390888365f,
+    -0.471421802f, -0.125152592f, 0.0409909648f, 0.207019497f,
+    0.259740782f, -10.1362703f, 0.0295069749f, -0.05199004f,
+    -0.0489986476f, 2.92178296f, 66.9068719f
+    },
+    { // タイル 28
+    0.0410241841f, -0.121611718f, 0.374384027f, 0.0735317374f,
+    -0.399121718f, -1.21873283f, -0.045657566f, 0.196868776f,
+    1.48034508f, -8.40217857f, -0.00840225797f, 0.0590598165f,
+    0.12019223f, 2.81962404f, 72.5424498f
+    },
+    { // タイル 29
+    -0.0185015398f, 0.143066012f, -0.182045118f, -0.0991500475f,
+    -0.103823645f, 1.3706496f, 0.0402470851f, 0.0631978556f,
+    -0.806688969f, -4.17139633f, -0.00430167185f, -0.0298891536f,
+    0.313398769f, 1.95318162f, 87.0934158f
+    },
+    { // タイル 30
+    -0.1046718f, 0.312340543f, 0.283631306f, -0.198124737f,
+    -0.727524996f, 0.745239f, 0.0263133752f, 0.310515725f,
+    -0.19084927f, -5.35329296f, 0.00195789105f, -0.0259256519f,
+    0.156209604f, 2.8870891f, 92.0143459f
+    },
+    { // タイル 31
+    -0.281271319f, 0.59351517f, 1.22049379f, -0.23896211f,
+    -1.70134777f, -1.4303296f, -0.166459889f, 0.0428844726f,
+    0.74302066f, -4.68875412f, 0.0564473525f, 0.137499761f,
+    0.336003588f, 3.63570252f, 98.3917821f
+    },
+    { // タイル 32
+    -0.19067221f, 0.382021903f, 1.95022999f, -0.0997689183f,
+    -2.05844379f, -5.34954311f, -0.193768901f, -1.115742f,
+    -1.14293558f, -4.04561215f, 0.0782460019f, 0.730228538f,
+    2.7543456f, 8.40941711f, 108.845315f
+    },
+    { // タイル 33
+    0.0160703565f, -0.0154376452f, -0.156888378f, 0.00984196005f,
+    0.212276791f, 0.146282413f, 0.00191702071f, -0.0830276896f,
+    -0.150634171f, -1.23681835f, -0.000619102454f, 0.00883368408f,
+    0.182806049f, 0.818218433f, 82.534758f
+    },
+    { // タイル 34
+    -0.00677696091f, 0.0195850124f, -0.14034976f, -0.008266899f,
+    0.194384886f, 0.59572876f, -0.00491254935f, -0.0688833478f,
+    -0.467084913f, -1.87755219f, -0.00433159688f, -0.0072659708f,
+    0.219613246f, 1.65614231f, 84.9754257f
+    },
+    { // タイル 35
+    -0.0524609677f, 0.0796066534f, -0.0138590622f, 0.0315359427f,
+    0.178745879f, 0.981123084f, -0.0916534699f, -0.311401445f,
+    -1.04294495f, -3.25871638f, -0.0325533621f, -0.127426008f,
+    -0.0923454779f, 2.16029707f, 88.9903579f
+    },
+    { // タイル 36
+    -0.0860565492f, 0.154767388f, 0.364050996f, 0.011779679f,
+    0.0538908444f, 1.17284478f, -0.140980752f, -1.05917149f,
+    -3.72549971f, -7.73895272f, -0.0358281285f, -0.336227169f,
+    -1.29407689f, -0.0152039715f, 91.9571774f
+    },
+    { // タイル 37
+    0.0137820723f, -0.0284078908f, -0.034590097f, 0.01576349f,
+    0.0626354286f, -0.414307175f, -0.0025890763f, -0.0252470446f,
+    0.441148628f, -2.02560541f, 8.00354907e-05f, 0.00722390895f,
+    0.067289897f, 1.21748647f, 79.6433613f
+    },
+    { // タイル 38
+    0.0119779424f, -0.0285248907f, -0.0935676097f, 0.0178075033f,
+    0.126865506f, -0.223844711f, -0.00376211177f, -0.0376694537f,
+    0.317994477f, -1.25955728f, -0.009970487f, -0.0197845165f,
+    0.0908101205f, 1.57117704f, 82.4058631f
+    },
+    { // タイル 39
+    0.00465191779f, -0.0269928165f, -0.155669819f, 0.0492379029f,
+    0.25647249f, 0.13572871f, -0.0293098741f, -0.116168416f,
+    0.094583497f, -0.799222678f, -0.041761292f, -0.240416337f,
+    -0.518974027f, 1.18248568f, 85.5453797f
+    },
+    { // タイル 40
+    0.00407673308f, -0.0271182144f, -0.197352601f, 0.0632501762f,
+    0.481812051f, 0.850772665f, -0.0443855117f, -0.37139661f,
+    -0.854946887f, -1.4063753f, -0.0372194089f, -0.538189808f,
+    -2.8746911f, -5.02373111f, 83.2859939f
+    },
+    { // タイル 41
+    0.00483273396f, -0.0124636039f, 0.038260834f, 0.0044269288f,
+    -0.0630896919f, -0.347820492f, -0.00206628541f, 0.0143244384f,
+    0.393519726f, -3.69060663f, 0.00117717758f, 0.0023971415f,
+    0.0665647362f, 2.13718114f, 73.8735305f
+    },
+    { // タイル 42
+    0.0102765489f, -0.0212115719f, 0.00737001032f, 0.00860080278f,
+    -0.0418638608f, -0.462953579f, 0.00405001635f, 0.0187131429f,
+    0.451119987f, -2.84989343f, -0.0100925536f, -0.0137230632f,
+    0.0836587f, 2.45438827f, 78.4490013f
+    },
+    { // タイル 43
+    0.0158219706f, -0.0357517913f, -0.045001981f, 0.0320574253f,
+    0.0217509727f, -0.510638435f, 0.0139802293f, 0.0769448151f,
+    0.626377048f, -1.81592085f, -0.0592949208f, -0.261891728f,
+    -0.509277604f, 2.08503615f, 83.3554553f
+    },
+    { // タイル 44
+    0.0150458871f, -0.0358455543f, -0.118733315f, 0.0381325729f,
+    0.185179827f, -0.294505853f, 0.00673803364f, 0.0973743345f,
+    0.950104917f, -0.241610984f, -0.0628540835f, -0.739897831f,
+    -3.46129252f, -4.91234719f, 82.4686867f
+    },
+    { // タイル 45
+    -1.84093241f, 3.29854035f, 5.18157293f, 10.1243754f,
+    34.1130095f, 34.2785472f, -8.61301885f, -57.3911796f,
+    -124.82468f, -98.349609f, -91.5920109f, -594.542943f,
+    -1453.0878f, -1577.82962f, -551.146517f
+    },
+    { // タイル 46
+    -0.352728689f, -1.15557079f, 3.10923374f, 0.410064036f,
+    -0.888265826f, 2.59544222f, 2.70259808f, -14.7479844f,
+    29.3379508f, -37.5312183f, 9.33472495f, -60.2045357f,
+    140.576357f, -146.823611f, 121.590693f
+    },
+    { // タイル 47
+    -0.000702607397f, -0.109008919f, 0.405917632f, -0.0725800155f,
+    0.492499142f, -0.381985528f, 0.224079042f, -0.503755458f,
+    0.558916858f, -9.53655905f, 0.491371569f, -0.894812258f,
+    -0.412487481f, -3.64325389f, 71.0927826f
+    },
+    { // タイル 48
+    -0.035026821f, -0.08712833f, 0.220135553f, -0.0320171737f,
+    0.328682341f, 0.438115899f, 0.0062257112f, 0.123165508f,
+    0.386308027f, -8.99497463f, -0.0611672505f, 0.157189917f,
+    0.374222315f, -5.19497564f, 61.283363f
+    },
+    { // タイル 49
+    -0.0519956163f, -0.0621186819f, 0.0162690054f, 0.115285058f,
+    -0.334490196f, 1.15004244f, 0.204756435f, -0.379897248f,
+    0.720293363f, -7.06502206f, 0.288602928f, -0.189141121f,
+    -1.4751148f, -1.77956082f, 53.4348818f
+    },
+    { // タイル 50
+    -0.0199123175f, -0.0272778613f, -0.0711154252f, 0.00163017774f,
+    -0.105791938f, 0.780085989f, -0.0212431983f, 0.0530291226f,
+    0.685949973f, -5.90517553f, -0.0787993131f, 0.144643582f,
+    0.540045281f, -3.80186482f, 46.1710441f
+    },
+    { // タイル 51
+    -0.148010167f, -0.481173699f, -0.648051484f, -0.196133106f,
+    -0.240591924f, 3.08699793f, -0.130142116f, -0.467792998f,
+    2.60294551f, -10.5168484f, 0.0844165097f, -0.243953817f,
+    1.01359431f, -3.67654474f, 43.9462879f
+    },
+    { // タイル 52
+    0.105524666f, 0.0331618253f, -1.04899592f, 0.364472881f,
+    0.0847729055f, 2.02364959f, -0.00935315786f, -0.590826638f,
+    -0.265824178f, -8.26325311f, -0.201935524f, -0.00657024677f,
+    1.54962001f, 0.265660205f, 40.0938989f
+    },
+    { // タイル 53
+    -0.307099299f, 0.664818757f, -0.434641769f, -0.53314903f,
+    0.0805648602f, 3.65016468f, 0.0539619777f, -0.237061159f,
+    -2.75226878f, -11.4978044f, -0.0295887128f, 0.404785417f,
+    1.43753125f, 3.9787334f, 44.6061079f
+    },
+    { // タイル 54
+    -0.0318158629f, 0.100808028f, 0.33876865f, -0.07492788f,
+    -0.585160671f, -0.0134650313f, 0.0331020316f, 0.0599216363f,
+    -0.341070418f, -9.17762307f, 0.00708808858f, 0.0386499084f,
+    0.493614724f, 5.62361303f, 63.6327508f
+    },
+    { // タイル 55
+    0.0220490601f, 0.0371462042f, 0.470662148f, -0.107037507f,
+    -0.956767463f, -1.58408818f, 0.505082466f, 1.74633432f,
+    1.95027946f, -8.71509888f, -0.647191935f, -2.67406013f,
+    -3.65227609f, 4.87339897f, 76.3071984f
+    },
+    { // タイル 56
+    -0.0333591467f, 0.0740057973f, -0.020238283f, -0.00217008685f,
+    0.102126479f, 0.899024494f, -0.00533085657f, -0.129089178f,
+    -1.18563224f, -6.58182032f, 0.043446998f, 0.0657228502f,
+    0.305507303f, 3.58053641f, 47.2875253f
+    },
+    { // タイル 57
+    -0.0615592957f, 0.13347709f, 0.195933951f, -0.145815511f,
+    -0.201227449f, 0.984854928f, 0.305335629f, 0.744859373f,
+    -0.929232333f, -9.27891237f, -0.306133772f, -1.02055246f,
+    -0.462757596f, 5.47495968f, 56.5006678f
+    },
+    { // タイル 58
+    -0.165174654f, 0.517015889f, 2.91701326f, -0.938537608f,
+    -5.91038858f, -7.3923597f, 15.7730591f, 83.5711616f,
+    146.232476f, 65.1009533f, -114.58738f, -767.207701f,
+    -1925.89793f, -2136.09571f, -813.636982f
+    },
+    { // タイル 59
+    0.260082272f, 0.903620036f, -1.91079399f, 0.820134604f,
+    -2.34139089f, 1.5884969f, 0.274714129f, 1.38809563f,
+    -9.10582595f, 2.42302051f, 2.71237425f, -15.6831817f,
+    29.7684698f, -25.4600836f, 49.975185f
+    },
+    { // タイル 60
+    0.234283119f, 0.467106186f, -0.337520689f, -0.189742812f,
+    0.443326544f, 0.24444763f, -1.15482543f, 1.93281518f,
+    0.153343205f, -7.73216271f, -0.835890658f, 2.09162413f,
+    0.737369547f, -7.18729251f, 36.0838982f
+    },
+    { // タイル 61
+    0.0117269299f, 0.0659132105f, 0.147923463f, 0.0833747614f,
+    -0.00886599019f, 0.692917955f, 0.0579469941f, -0.242329842f,
+    0.403647083f, -6.08053174f, 0.150738369f, -0.288597617f,
+    -0.0664402309f, -1.39624201f, 29.0833163f
+    },
+    { // タイル 62
+    -0.0764143082f, -0.0105831642f, 0.200709687f, -0.1238094f,
+    -0.0570877204f, 0.962086278f, 0.0592705566f, -0.056422075f,
+    -0.161878808f, -5.8964015f, -0.232486821f, 0.0550100551f,
+    1.44755445f, -0.00127279891f, 26.3039212f
+    },
+    { // タイル 63
+    0.0620029351f, -0.114894158f, 0.0777304127f, 0.13672746f,
+    -0.0408459638f, 0.413635065f, -0.0359976345f, -0.322550392f,
+    -0.428668553f, -6.19466495f, 0.0895541661f, 0.336561087f,
+    0.0472247114f, 1.60855569f, 29.4307997f
+    },
+    { // タイル 64
+    0.198683033f, -0.549120042f, -0.595308225f, 0.32500575f,
+    0.904439948f, 0.906986814f, -0.276404927f, -0.234474471f,
+    -0.335583557f, -7.38643013f, 0.21439345f, 0.682655134f,
+    1.46482675f, 4.75607284f, 35.3272171f
+    },
+    { // タイル 65
+    0.110024763f, -0.386492867f, -1.29921543f, -0.458131914f,
+    -0.638019769f, 1.62233659f, 1.62581859f, 8.09069087f,
+    12.6030751f, -1.61394979f, 1.54898361f, 8.25304902f,
+    17.8388336f, 25.5680827f, 56.3917173f
+    },
+    { // タイル 66
+    -0.213136499f, -0.894559254f, 1.43928286f, -1.40753544f,
+    4.53438241f, -1.97817634f, 1.28202314f, -3.81447388f,
+    6.41024575f, -11.267775f, 0.414570008f, -4.86774381f,
+    17.0380042f, -29.2921298f, 44.604176f
+    },
+    { // タイル 67
+    -0.120228614f, -0.338431301f, -0.0587233678f, -0.349987552f,
+    -0.284154213f, 1.37075809f, -0.453267469f, -0.532501029f,
+    2.74588709f, -4.42656259f, -0.101270201f, -0.299282269f,
+    1.83054872f, -2.97598397f, 22.7833632f
+    },
+    { // タイル 68
+    0.0332867527f, 0.0557027041f, -0.272673773f, 0.10280123f,
+    -0.282499622f, 0.154170539f, 0.116326508f, 0.0591538793f,
+    -0.214491773f, -2.94006824f, -0.0073731913f, -0.0895456003f,
+    -0.0608217378f, -0.813708661f, 20.4266856f
+    },
+    { // タイル 69
+    0.0855088804f, 0.0229438135f, -0.199225538f, 0.0740492094f,
+    0.062772982f, -0.111123124f, 0.047702219f, -0.164398418f,
+    -0.2325984f, -2.97518096f, -0.166049887f, 0.16777078f,
+    0.931526491f, -0.511241927f, 18.3644151f
+    },
+    { // タイル 70
+    0.00415084369f, 0.00595494745f, -0.172952836f, 0.0611333266f,
+    0.359809672f, 0.429019004f, -0.156032978f, -0.0529708638f,
+    -0.0105355947f, -3.44798851f, 0.164124267f, 0.173649621f,
+    -0.355445489f, 0.608899091f, 19.7563083f
+    },
+    { // タイル 71
+    -0.0840775752f, 0.193759877f, 0.0183811294f, -0.252708139f,
+    -0.186099836f, 1.04318335f, 0.0701848485f, -0.209977148f,
+    -1.4196955f, -4.8023297f, -0.0932400339f, 0.0762769805f,
+    1.65712308f, 3.85312934f, 22.7046204f
+    },
+    { // タイル 72
+    -0.0596890171f, 0.159087606f, 0.312744759f, 0.0510693913f,
+    -0.0942279002f, 0.591332261f, -0.37365464f, -2.13957155f,
+    -5.50996355f, -10.2221474f, 2.15313083f, 13.7652408f,
+    34.2857218f, 44.3998953f, 50.0736497f
+    },
+    { // タイル 73
+    0.107279258f, 0.25112653f, -0.536026273f, 0.760592724f,
+    -2.47219708f, 1.79141278f, 0.871428352f, -4.4915272f,
+    7.29994899f, -6.56451189f, -1.06720632f, 4.57128938f,
+    -6.46218346f, 0.883370599f, 20.7035022f
+    },
+    { // タイル 74
+    0.0932285698f, 0.246712479f, -0.00919839818f, 0.33913071f,
+    -0.169173715f, -0.415220613f, 0.251439684f, -0.23534879f,
+    -0.502750371f, -2.94161119f, -0.0145030614f, -0.401654296f,
+    0.235229322f, -1.04515462f, 16.945022f
+    },
+    { // タイル 75
+    -0.0190845544f, -0.0186293572f, 0.191543099f, -0.100693262f,
+    0.316858897f, 0.331531233f, -0.033851017f, 0.0930596179f,
+    0.221355979f, -3.30203575f, -0.121936192f, -0.0047045337f,
+    0.451795836f, -1.38614923f, 13.9527544f
+    },
+    { // タイル 76
+    -0.0724281897f, -0.0249337701f, 0.133628908f, -0.0545282341f,
+    0.0155240169f, 0.678933022f, -0.00753158116f, -0.13685476f,
+    0.109811782f, -2.76705592f, -0.0676460304f, 0.210069345f,
+    0.634665479f, -0.589199326f, 11.942542f
+    },
+    { // タイル 77
+    -0.0122021605f, -0.0480711014f, 0.074538744f, -0.00566838985f,
+    -0.28189721f, 0.289926938f, -0.0532452605f, 0.111033407f,
+    0.188671954f, -2.80012703f, 0.0755905566f, -0.0837549011f,
+    -0.109369702f, 1.44772338f, 13.5446954f
+    },
+    { // タイル 78
+    0.06212789f, -0.067068034f, -0.0446173633f, 0.113093628f,
+    0.170547088f, -0.0391929454f, 0.0313203018f, -0.381333725f,
+    -0.613628418f, -2.73697832f, -0.0223493911f, 0.291456212f,
+    0.671501523f, 1.53269134f, 16.0759591f
+    },
+    { // タイル 79
+    0.0682049468f, -0.0603734864f, -0.159666974f, 0.587008819f,
+    1.76110591f, 1.43564383f, -5.94670648f, -22.7059409f,
+    -29.9961493f, -17.0213505f, 9.99459665f, 51.7280537f,
+    101.335711f, 91.8684694f, 50.8441376f
+    },
+    { // タイル 80
+    -0.0544366635f, 0.0427725162f, 0.00256179198f, 0.0845291767f,
+    0.0305498808f, 0.249066223f, -1.44627811f, 4.3998689f,
+    -4.14962321f, -1.58559792f, 0.151014372f, 0.262372352f,
+    -1.93750122f, 0.203131327f, 13.9198381f
+    },
+    { // タイル 81
+    -0.0521539968f, -0.0806607263f, -0.0281427742f, -0.110631068f,
+    0.0691591844f, 0.543204814f, 0.0454994705f, 0.0973553205f,
+    0.427832259f, -2.4084128f, -0.140677223f, -0.105050268f,
+    0.721650555f, -1.18461377f, 10.7163507f
+    },
+    { // タイル 82
+    0.0231068559f, -0.00558358468f, -0.123687301f, 0.0263224587f,
+    -0.186294172f, 0.182556889f, 0.0128989301f, -0.149603085f,
+    0.3699912f, -1.28146094f, -0.0593043886f, -0.0474377685f,
+    0.179877126f, -0.282298726f, 9.55964883f
+    },
+    { // タイル 83
+    0.0636460281f, 0.0208761906f, -0.0889135043f, 0.0510510289f,
+    0.0194753347f, -0.0623085268f, -0.0668605525f, -0.114333278f,
+    0.0998426603f, -0.923290613f, -0.0375619179f, 0.130491756f,
+    0.234675446f, -0.383473657f, 8.90974835f
+    },
+    { // タイル 84
+    0.0257157527f, 0.0390014795f, -0.0365839371f, -0.0227763389f,
+    0.0762563541f, 0.157925787f, 0.0987510939f, 0.0235678588f,
+    -0.584649389f, -1.51019748f, 0.0195116098f, -0.00229645682f,
+    0.113609927f, 0.63995332f, 9.35700674f
+    },
+    { // タイル 85
+    -0.0363571399f, -0.035220957f, -0.0348111639f, 0.0129747355f,
+    0.0772204763f, 0.357644802f, -0.116600346f, -0.156815449f,
+    -0.0919084319f, -2.01954425f, -0.0077879263f, 0.178632795f,
+    0.213510695f, 0.837592901f, 10.9448256f
+    },
+    { // タイル 86
+    -0.0541811645f, -0.0883071697f, -0.17324621f, 1.25590305f,
+    2.846246f, 2.03546179f, -3.94272316f, -13.1769625f,
+    -15.0917721f, -8.21120313f, 4.9716015f, 20.7860483f,
+    32.058096f, 23.1908053f, 19.1384388f
+    },
+    { // タイル 87
+    -0.000193147278f, -0.100114878f, 0.0961098625f, -0.407002443f,
+    0.545526005f, 0.00324404801f, 0.197095061f, -0.191544789f,
+    0.309323929f, -2.19272631f, 0.368786154f, -2.55578784f,
+    5.41687935f, -5.75408184f, 10.6987624f
+    },
+    { // タイル 88
+    -0.0143752671f, -0.0150934818f, -0.0189224304f, -0.00889489603f,
+    -0.0129415313f, 0.136099815f, -0.069980265f, -0.127268375f,
+    0.469399554f, -1.34206038f, -0.106314803f, -0.1251638f,
+    0.539697388f, -0.311022969f, 7.29830451f
+    },
+    { // タイル 89
+    -0.0326915277f, -0.0221492401f, -0.0534770509f, 0.0226418663f,
+    -0.0436654293f, 0.0651138343f, 0.0407521538f, 0.0152849569f,
+    -0.0100296322f, -1.06450744f, -0.0189859834f, 0.0187079342f,
+    -0.00135700274f, -0.110743647f, 7.21379771f
+    },
+    { // タイル 90
+    -0.0305857736f, -0.0209780108f, -0.108734201f, 0.0204367411f,
+    -0.00396010085f, 0.0174287933f, -0.0449535285f, -0.0204916026f,
+    0.232454788f, -0.797894582f, -0.0313995276f, 0.010838344f,
+    0.121965701f, -0.0197678931f, 7.00277732f
+    },
+    { // タイル 91
+    -0.0156308622f, 0.0441326676f, -0.0805152215f, -0.046520956f,
+    0.0771132171f, 0.136093325f, -0.000158504774f, -0.139893637f,
+    -0.24274238f, -0.738025579f, 0.0386699761f, 0.11141261f,
+    -0.00346534678f, -0.112741753f, 7.05558902f
+    },
+    { // タイル 92
+    0.00893331839f, 0.0486124653f, 0.0128746007f, 0.0866848763f,
+    -0.0349002533f, 0.00323645469f, -0.113180932f, -0.0374591167f,
+    -0.292129062f, -1.50191554f, 0.0906128446f, -0.0431252065f,
+    -0.191165892f, 0.576048322f, 7.73338338f
+    },
+    { // タイル 93
+    0.00709906999f, -0.0370976966f, 0.0427401835f, 0.183568604f,
+    0.355367239f, 0.22768847f, -1.00040074f, -2.0566078f,
+    -1.64975282f, -2.59206569f, 1.18883944f, 3.79669741f,
+    4.12587935f, 2.1662426f, 8.82197667f
+    },
+    { // タイル 94
+    0.00666212199f, 0.023085776f, -0.0495061514f, -0.0103042095f,
+    0.00667180241f, -0.0465588003f, -0.57071392f, 1.45181612f,
+    -1.01506995f, -0.771744268f, -0.920811461f, 3.31900854f,
+    -3.32590741f, -2.01206148f, 10.6743329f
+    },
+    { // タイル 95
+    0.0129230614f, 0.0192829957f, -0.000602945314f, 0.00833395788f,
+    0.0156909889f, -0.0523283588f, 0.0516567512f, -0.0290643657f,
+    -0.0403514677f, -0.872642325f, 0.0497121995f, -0.170303981f,
+    0.391768596f, -0.912059467f, 6.20929046f
+    },
+    { // タイル 96
+    -0.0901085989f, -0.118505282f, 0.0265379642f, -0.330191888f,
+    0.409058131f, 0.0774369655f, -0.506340836f, 0.953485313f,
+    -0.0693396058f, -1.19601713f, -0.726965584f, 1.77101476f,
+    -0.301014617f, -3.61383603f, 8.65144124f
+    },
+    { // タイル 97
+    -0.171709291f, -0.0748366677f, -0.225068684f, 0.0325816823f,
+    -0.0739292898f, 0.130729181f, 0.0327597389f, -0.0361582941f,
+    0.122335516f, -0.594124124f, 0.0327770812f, -0.0891706831f,
+    0.331339465f, -0.793485479f, 4.51698332f
+    },
+    { // タイル 98
+    -0.0725237933f, 0.0594325765f, 0.0244338701f, 0.0448722458f,
+    -0.110557638f, 0.0510683405f, 0.0449460494f, -0.095557505f,
+    -0.0417415139f, -1.43009939f, 0.0491950196f, -0.206896793f,
+    0.0534937294f, 0.3227024f, 4.72572669f
+    },
+    { // タイル 99
+    -0.020460859f, -0.138272242f, -0.0207629905f, -0.0433349036f,
+    0.000505788533f, -0.01204692f, -0.0350915998f, -0.0355119028f,
+    0.26420852f, -1.27699716f, -0.0108228112f, 0.0256333699f,
+    0.0335272007f, -0.0850847442f, 4.8581569f
+    },
+    { // タイル 100
+    0.010956343f, 0.123517598f, -0.0330522932f, -0.0302224216f,
+    0.0508794538f, -0.0202860547f, -0.00649385275f, -0.00871382871f,
+    -0.0495036776f, -1.13496562f, -0.0148613024f, -0.0193008276f,
+    0.129469395f, 0.204847369f, 4.90085035f
+    },
+    { // タイル 101
+    0.140574783f, -0.13557472f, 0.0348195169f, 0.136622612f,
+    -0.0752844778f, -0.350451632f, -0.100094172f, 0.0387087919f,
+    0.369505298f, -1.02646318f, 0.031246477f, -0.0320281645f,
+    -0.2840604f, 0.109948269f, 5.54898111f
+    },
+    { // タイル 102
+    -0.0293536867f, 0.122197303f, -0.0699189005f, -0.119362078f,
+    0.0595831783f, 0.10376481f, 0.170724859f, -0.0209711133f,
+    -0.719486846f, -1.17640394f, -0.0278829367f, -0.00265471602f,
+    0.131023681f, -0.32528434f, 4.90425719f
+    },
+    { // タイル 103
+    0.0112245872f, -0.00450387958f, -0.017024434f, 0.012274098f,
+    0.000185163958f, -0.0559799474f, 0.0183980951f, 0.0214464108f,
+    -0.0812917804f, -0.901238029f, -0.00270866807f, 0.0273219988f,
+    0.0864524127f, -0.00728885858f, 5.48680316f
+    },
+    { // タイル 104
+    0.0135353372f, -0.0523928991f, -0.0766422829f, 0.470397687f,
+    1.05044599f, 0.524770968f, -0.586474954f, -1.98294397f,
+    -2.15951671f, -1.69431103f, 0.146421953f, 0.865847508f,
+    1.69412641f, 1.55931357f, 6.17824154f
+    },
+    { // タイル 105
+    -0.0827240675f, 0.0198921699f, -0.0293564566f, -0.0423457195f,
+    0.0918550727f, 0.255744105f, -0.0172381426f, -0.00326573597f,
+    0.0612259863f, -0.745264641f, 0.003938702f, 0.0599508644f,
+    0.148260913f, -0.135093306f, 3.58166957f
+    },
+    { // タイル 106
+    -0.181343395f, -0.410018693f, -0.395574134f, -0.269598348f,
+    -0.691479842f, -0.000111550055f, 0.0372308391f, 0.147536966f,
+    0.525737791f, -0.312781609f, 0.0359458492f, -0.0561485379f,
+    0.128888188f, 0.989916127f, 4.41141085f
+    }
+};
+
+// 区分モデルによる予測関数 (入力検証付き, 表の範囲外はHorner法)
+float predict_distance_tiled(float under_y, float theta);
+
+// 入力検証なしの評価関数 (表の範囲外は端のタイルで外挿)
+float evaluate_tiled(float under_y, float theta);
+
+#endif // TEENSY_TILED_MODEL_H
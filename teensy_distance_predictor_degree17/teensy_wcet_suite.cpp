@@ -0,0 +1,276 @@
+/*
+ * Teensy 4.1 多項式回帰モデル - 最悪実行時間 (WCET) とジッタの測定スイートの実装
+ */
+
+#include "teensy_wcet_suite.h"
+#include <math.h>
+#include <string.h>
+#include "teensy_horner_model.h"
+#include "teensy_precision_model.h"
+#include "teensy_fixed_model.h"
+
+const WcetTarget WCET_TARGETS[] = {
+    {"horner", predict_distance_horner, {{HORNER_COEFFICIENTS, sizeof(HORNER_COEFFICIENTS)}, {nullptr, 0}, {nullptr, 0}}},
+    {"teensy", predict_distance_teensy,
+     {{MODEL_COEFFICIENTS, sizeof(MODEL_COEFFICIENTS)}, {SCALER_MEAN, sizeof(SCALER_MEAN)},
+      {SCALER_SCALE, sizeof(SCALER_SCALE)}}},
+    {"float", predict_distance_horner_float,
+     {{PRECISION_COEFFICIENTS_F, sizeof(PRECISION_COEFFICIENTS_F)}, {nullptr, 0}, {nullptr, 0}}},
+    {"fixed", predict_distance_fixed,
+     {{FIXED_COEFFICIENTS, sizeof(FIXED_COEFFICIENTS)}, {FIXED_TERM_SHIFTS, sizeof(FIXED_TERM_SHIFTS)},
+      {FIXED_OUTER_SHIFTS, sizeof(FIXED_OUTER_SHIFTS)}}},
+};
+const int WCET_TARGET_COUNT = sizeof(WCET_TARGETS) / sizeof(WCET_TARGETS[0]);
+
+static const char* const REGION_NAMES[WCET_REGION_COUNT] = {
+    "measured", "full", "boundary", "tiny", "rejected"
+};
+static const char* const CONDITION_NAMES[WCET_CONDITION_COUNT] = {
+    "warm irq-on", "warm irq-off", "cold irq-on", "cold irq-off"
+};
+
+// 大きいため関数のスタックではなく静的領域に置く (約 5KB)
+static StageHistogram condition_histograms[WCET_CONDITION_COUNT];
+static StageHistogram cell_histogram;
+static volatile float wcet_sink;
+
+const char* wcet_region_name(WcetRegion region) {
+    return region >= 0 && region < WCET_REGION_COUNT ? REGION_NAMES[region] : "unknown";
+}
+
+const char* wcet_condition_name(WcetCondition condition) {
+    return condition >= 0 && condition < WCET_CONDITION_COUNT ? CONDITION_NAMES[condition] : "unknown";
+}
+
+// 2次元の低食い違い量列 (R2 列) の index 番目の成分 (0〜1)
+static float sequence_fraction(uint32_t index, double alpha) {
+    double value = 0.5 + alpha * (double)index;
+    return (float)(value - floor(value));
+}
+
+static const double R2_ALPHA1 = 0.7548776662466927;
+static const double R2_ALPHA2 = 0.5698402909980532;
+
+void wcet_region_input(WcetRegion region, uint32_t index, float& under_y, float& theta) {
+    const float r1 = sequence_fraction(index, R2_ALPHA1);
+    const float r2 = sequence_fraction(index, R2_ALPHA2);
+    const float sign = (index >> 2) & 1 ? -1.0f : 1.0f;
+    switch (region) {
+        case WCET_REGION_MEASURED:
+            under_y = 100.0f * r1;
+            theta = -48.1f + 103.3f * r2;
+            return;
+        case WCET_REGION_FULL:
+            under_y = -100.0f + 200.0f * r1;
+            theta = -180.0f + 360.0f * r2;
+            return;
+        case WCET_REGION_BOUNDARY:
+            // 辺の上と、1 ulp 内側
+            under_y = -100.0f + 200.0f * r1;
+            theta = -180.0f + 360.0f * r2;
+            switch (index & 3) {
+                case 0: under_y = sign * 100.0f; break;
+                case 1: under_y = sign * nextafterf(100.0f, 0.0f); break;
+                case 2: theta = sign * 180.0f; break;
+                default: theta = sign * nextafterf(180.0f, 0.0f); break;
+            }
+            return;
+        case WCET_REGION_TINY: {
+            // 絶対値 1e-45 (非正規化数の最小) 〜 1e-1 を対数一様に。片方だけ微小な組と ±0・非正規化数の固定値も含める
+            static const float SPECIALS[] = {0.0f, -0.0f, 1.40129846e-45f, -1.0e-40f, 1.17549435e-38f, 5.0e-39f};
+            const float tiny_u = sign * (float)pow(10.0, -45.0 + 44.0 * r1);
+            const float tiny_t = -sign * (float)pow(10.0, -45.0 + 44.0 * r2);
+            switch (index & 3) {
+                case 0: under_y = tiny_u; theta = tiny_t; break;
+                case 1: under_y = tiny_u; theta = -180.0f + 360.0f * r2; break;
+                case 2: under_y = -100.0f + 200.0f * r1; theta = tiny_t; break;
+                default:
+                    under_y = SPECIALS[(index >> 2) % 6];
+                    theta = SPECIALS[(index >> 3) % 6];
+                    break;
+            }
+            return;
+        }
+        case WCET_REGION_REJECTED:
+        default: {
+            static const float REJECTED[] = {NAN, INFINITY, -INFINITY, 100.5f, -1.0e30f, 3.4e38f};
+            under_y = 100.0f * r1;
+            theta = -48.1f + 103.3f * r2;
+            if (index & 1) {
+                under_y = REJECTED[(index >> 1) % 6];
+            } else {
+                theta = REJECTED[(index >> 1) % 6] * 2.0f;  // 100.5 → 201 (theta の範囲外)
+            }
+            return;
+        }
+    }
+}
+
+// 係数表と評価関数のコードをキャッシュから追い出す
+static void evict_target(const WcetTarget& target) {
+#if defined(__arm__) && defined(ARM_DWT_CYCCNT)
+    for (int i = 0; i < WCET_MAX_TABLES; i++) {
+        if (target.tables[i].data != nullptr) {
+            arm_dcache_flush_delete((void*)target.tables[i].data, target.tables[i].bytes);
+        }
+    }
+    SCB_CACHE_ICIALLU = 0;
+    asm volatile("dsb\n\tisb" ::: "memory");
+#elif defined(__x86_64__) || defined(__i386__)
+    for (int i = 0; i < WCET_MAX_TABLES; i++) {
+        const char* data = (const char*)target.tables[i].data;
+        for (size_t offset = 0; data != nullptr && offset < target.tables[i].bytes; offset += 64) {
+            _mm_clflush(data + offset);
+        }
+    }
+    // 評価関数のコード (先頭 4KB)
+    const char* code = (const char*)(void*)target.predict;
+    for (size_t offset = 0; offset < 4096; offset += 64) {
+        _mm_clflush(code + offset);
+    }
+    _mm_mfence();
+#else
+    (void)target;  // キャッシュ操作の手段がないため warm と同じ
+#endif
+}
+
+static TEENSY_INLINE void disable_interrupts(bool disable) {
+#if defined(__arm__) && defined(ARM_DWT_CYCCNT)
+    if (disable) __disable_irq();
+#else
+    (void)disable;
+#endif
+}
+
+static TEENSY_INLINE void enable_interrupts(bool disable) {
+#if defined(__arm__) && defined(ARM_DWT_CYCCNT)
+    if (disable) __enable_irq();
+#else
+    (void)disable;
+#endif
+}
+
+// 2の冪ごとのヒストグラム (区間の μs と件数の棒)
+static void print_histogram(const char* title, const StageHistogram& histogram) {
+    const int groups = PROFILE_BUCKET_COUNT / PROFILE_SUB_BUCKETS;
+    uint32_t counts[PROFILE_BUCKET_COUNT / PROFILE_SUB_BUCKETS];
+    uint32_t largest = 0;
+    int first = groups;
+    int last = -1;
+    for (int group = 0; group < groups; group++) {
+        counts[group] = 0;
+        for (int sub = 0; sub < PROFILE_SUB_BUCKETS; sub++) {
+            counts[group] += histogram.buckets[group * PROFILE_SUB_BUCKETS + sub];
+        }
+        if (counts[group] > 0) {
+            if (group < first) first = group;
+            last = group;
+            if (counts[group] > largest) largest = counts[group];
+        }
+    }
+    Serial.printf("histogram (%s):\n", title);
+    for (int group = first; group <= last; group++) {
+        const uint32_t lower = histogram_bucket_lower_bound(group * PROFILE_SUB_BUCKETS);
+        const uint32_t upper = group + 1 < groups ? histogram_bucket_lower_bound((group + 1) * PROFILE_SUB_BUCKETS) : 0;
+        char bar[41];
+        const int width = (int)((uint64_t)counts[group] * 40 / largest);
+        memset(bar, '#', width);
+        bar[width] = '\0';
+        Serial.printf("  [%9.3f, %9.3f) us %9u %s\n", (double)profiler_cycles_to_us(lower),
+                      (double)profiler_cycles_to_us(upper), (unsigned)counts[group], bar);
+    }
+}
+
+bool run_wcet_suite(const WcetTarget& target, const WcetOptions& options) {
+    if (profiler_cycles_per_us() == 0.0f) {
+        profiler_calibrate();
+    }
+    const uint32_t overhead = profiler_overhead_cycles();
+    const uint32_t deadline_cycles = (uint32_t)(options.deadline_us * profiler_cycles_per_us());
+
+    Serial.printf("=== WCET / jitter: %s (deadline %.3f us, %.1f cycles/us, timer overhead %u cycles subtracted) ===\n",
+                  target.name, (double)options.deadline_us, (double)profiler_cycles_per_us(), (unsigned)overhead);
+#if !(defined(__arm__) && defined(ARM_DWT_CYCCNT))
+    Serial.println("(host: interrupts cannot be disabled, irq-off runs are the same as irq-on)");
+#endif
+    Serial.printf("%-9s %-13s %7s %9s %9s %9s %9s %9s %7s   %s\n", "region", "condition", "count", "min us",
+                  "p50 us", "p99 us", "max us", "jitter us", "misses", "worst input (under_y, theta)");
+
+    uint32_t region_worst[WCET_REGION_COUNT];
+    memset(region_worst, 0, sizeof(region_worst));
+    uint32_t total_misses = 0;
+    for (int condition = 0; condition < WCET_CONDITION_COUNT; condition++) {
+        const bool cold = condition == WCET_COLD_IRQ_ON || condition == WCET_COLD_IRQ_OFF;
+        const bool irq_off = condition == WCET_WARM_IRQ_OFF || condition == WCET_COLD_IRQ_OFF;
+        const uint32_t samples = cold ? options.cold_samples : options.warm_samples;
+        memset(&condition_histograms[condition], 0, sizeof(StageHistogram));
+
+        for (int region = 0; region < WCET_REGION_COUNT; region++) {
+            memset(&cell_histogram, 0, sizeof(cell_histogram));
+            uint32_t misses = 0;
+            float worst_under_y = 0.0f;
+            float worst_theta = 0.0f;
+            float under_y;
+            float theta;
+
+            // warm: 先頭の数件で係数表とコードをキャッシュに載せておく
+            for (uint32_t i = 0; !cold && i < 16; i++) {
+                wcet_region_input((WcetRegion)region, i, under_y, theta);
+                wcet_sink = target.predict(under_y, theta);
+            }
+            for (uint32_t i = 0; i < samples; i++) {
+                wcet_region_input((WcetRegion)region, i, under_y, theta);
+                if (cold) {
+                    evict_target(target);
+                }
+                disable_interrupts(irq_off);
+                const uint32_t start = profiler_cycles();
+                const float distance = target.predict(under_y, theta);
+                const uint32_t elapsed = profiler_cycles() - start;
+                enable_interrupts(irq_off);
+                wcet_sink = distance;
+
+                const uint32_t cycles = elapsed > overhead ? elapsed - overhead : 0;
+                if (cell_histogram.count == 0 || cycles > cell_histogram.max_cycles) {
+                    worst_under_y = under_y;
+                    worst_theta = theta;
+                }
+                histogram_record(cell_histogram, cycles);
+                if (cycles > deadline_cycles) {
+                    misses++;
+                }
+            }
+
+            Serial.printf("%-9s %-13s %7u %9.3f %9.3f %9.3f %9.3f %9.3f %7u   (%.7g, %.7g)\n",
+                          wcet_region_name((WcetRegion)region), wcet_condition_name((WcetCondition)condition),
+                          (unsigned)cell_histogram.count, (double)profiler_cycles_to_us(cell_histogram.min_cycles),
+                          (double)profiler_cycles_to_us(histogram_percentile(cell_histogram, 0.50f)),
+                          (double)profiler_cycles_to_us(histogram_percentile(cell_histogram, 0.99f)),
+                          (double)profiler_cycles_to_us(cell_histogram.max_cycles),
+                          (double)profiler_cycles_to_us(cell_histogram.max_cycles - cell_histogram.min_cycles),
+                          (unsigned)misses, (double)worst_under_y, (double)worst_theta);
+            histogram_merge(condition_histograms[condition], cell_histogram);
+            if (cell_histogram.max_cycles > region_worst[region]) {
+                region_worst[region] = cell_histogram.max_cycles;
+            }
+            total_misses += misses;
+        }
+    }
+
+    for (int condition = 0; condition < WCET_CONDITION_COUNT; condition++) {
+        print_histogram(wcet_condition_name((WcetCondition)condition), condition_histograms[condition]);
+    }
+
+    uint32_t worst = 0;
+    Serial.print("max per region:");
+    for (int region = 0; region < WCET_REGION_COUNT; region++) {
+        Serial.printf(" %s %.3f us", wcet_region_name((WcetRegion)region),
+                      (double)profiler_cycles_to_us(region_worst[region]));
+        if (region_worst[region] > worst) worst = region_worst[region];
+    }
+    Serial.println();
+    const bool pass = total_misses == 0;
+    Serial.printf("%s: %s max %.3f us, deadline %.3f us, %u misses\n", pass ? "PASS" : "FAIL", target.name,
+                  (double)profiler_cycles_to_us(worst), (double)options.deadline_us, (unsigned)total_misses);
+    return pass;
+}
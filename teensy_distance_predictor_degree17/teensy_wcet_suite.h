@@ -0,0 +1,74 @@
+/*
+ * Teensy 4.1 多項式回帰モデル - 最悪実行時間 (WCET) とジッタの測定スイート
+ *
+ * 1つの入力の平均時間ではなく、入力領域ごとの最悪値とばらつきを制御周期の予算と比べるため、
+ * 入力領域 (実測範囲・入力検証範囲全体・範囲の境界・非正規化数を含む微小値・検証で弾かれる入力) ×
+ * 条件 (キャッシュ warm / cold × 割り込み 有効 / 無効) ごとに1件ずつサイクル数を測り、
+ * 最小・p50・p99・最大・ジッタ (最大 - 最小)・期限超過数と最悪の入力を表示する。
+ * 条件ごとのヒストグラム (2の冪ごと) も表示し、全体の最大が期限以内なら合格とする
+ * - cold: 測定の直前に評価関数の係数表をデータキャッシュから追い出し、命令キャッシュも無効化する
+ *   (実機: arm_dcache_flush_delete と ICIALLU, x86: clflush で表と評価関数のコードの先頭を追い出す)
+ * - 割り込み無効: 実機は1件ごとに __disable_irq で囲む。ホストでは無効化できないため有効と同じ
+ * - 表示は Serial (ホストでは標準出力) へ出すため、実機のメニューとホストのツールで同じ表になる
+ */
+
+#ifndef TEENSY_WCET_SUITE_H
+#define TEENSY_WCET_SUITE_H
+
+#include <stddef.h>
+#include "teensy_profiler.h"
+
+// 入力領域
+enum WcetRegion {
+    WCET_REGION_MEASURED,   // 実測範囲 (学習データの範囲)
+    WCET_REGION_FULL,       // 入力検証範囲全体
+    WCET_REGION_BOUNDARY,   // 入力検証範囲の境界上 (値が最も大きくなる)
+    WCET_REGION_TINY,       // 非正規化数・±0 を含む微小な入力 (累乗が非正規化数になる)
+    WCET_REGION_REJECTED,   // NaN・無限大・範囲外 (入力検証で弾かれる経路)
+    WCET_REGION_COUNT
+};
+
+enum WcetCondition {
+    WCET_WARM_IRQ_ON,
+    WCET_WARM_IRQ_OFF,
+    WCET_COLD_IRQ_ON,
+    WCET_COLD_IRQ_OFF,
+    WCET_CONDITION_COUNT
+};
+
+// cold 条件で追い出すメモリ領域
+struct WcetTable {
+    const void* data;
+    size_t bytes;
+};
+
+const int WCET_MAX_TABLES = 3;
+
+// 測定対象
+struct WcetTarget {
+    const char* name;
+    float (*predict)(float under_y, float theta);
+    WcetTable tables[WCET_MAX_TABLES];  // 使わない要素は {nullptr, 0}
+};
+
+// 組み込みの測定対象 (horner: 倍精度Horner法, teensy: 従来の特徴量生成, float: 単精度Horner法, fixed: 固定小数点)
+extern const WcetTarget WCET_TARGETS[];
+extern const int WCET_TARGET_COUNT;
+
+struct WcetOptions {
+    uint32_t warm_samples;   // 領域・条件ごとの件数 (warm)
+    uint32_t cold_samples;   // 領域・条件ごとの件数 (cold, 1件ごとにキャッシュを追い出す)
+    float deadline_us;       // 1回の予測の期限
+};
+
+const WcetOptions WCET_DEFAULT_OPTIONS = {4000, 1000, 10.0f};
+
+// 領域 region の index 番目の入力 (count 件で領域全体を覆う低食い違い量列)
+void wcet_region_input(WcetRegion region, uint32_t index, float& under_y, float& theta);
+const char* wcet_region_name(WcetRegion region);
+const char* wcet_condition_name(WcetCondition condition);
+
+// 測定して結果を表示し、すべての測定が期限以内なら true
+bool run_wcet_suite(const WcetTarget& target, const WcetOptions& options = WCET_DEFAULT_OPTIONS);
+
+#endif // TEENSY_WCET_SUITE_H
@@ -10,6 +10,7 @@ from utils import (
     load_data,
     create_polynomial_features,
     scale_features,
+    predict_polynomial,
     ensure_dir,
     format_filename
 )
@@ -93,17 +94,13 @@ def main():
         # モデルの学習
         model, scaler = train_polynomial_regression(X_train, y_train, degree)
 
-        # 訓練データでの評価
-        X_train_poly = create_polynomial_features(X_train, degree)
-        X_train_scaled = scaler.transform(X_train_poly)
-        y_train_pred = model.predict(X_train_scaled)
+        # 訓練データでの評価 (実機と同じ C++ 推論エンジンで予測)
+        y_train_pred = predict_polynomial(model, scaler, degree, X_train)
         train_mae = mean_absolute_error(y_train, y_train_pred)
         train_rmse = np.sqrt(np.mean((y_train - y_train_pred) ** 2))
 
         # 検証データでの評価
-        X_val_poly = create_polynomial_features(X_val, degree)
-        X_val_scaled = scaler.transform(X_val_poly)
-        val_predictions = model.predict(X_val_scaled)
+        val_predictions = predict_polynomial(model, scaler, degree, X_val)
         val_mae = mean_absolute_error(y_val, val_predictions)
         val_rmse = np.sqrt(np.mean((y_val - val_predictions) ** 2))
 
@@ -117,12 +114,7 @@ def main():
             'val_rmse': val_rmse
         })
         
-        # 予測値の取得（プロット用）
-        X_train_poly = create_polynomial_features(X_train, degree)
-        X_train_scaled, _ = scale_features(X_train_poly)
-        y_train_pred = model.predict(X_train_scaled)
-        
-        # 可視化
+        # 可視化 (訓練データの予測値は評価時のものを使う)
         plot_predictions_vs_actual(
             y_train, y_train_pred, degree,
             os.path.join(result_dir, f'predictions_degree_{degree}.png')
@@ -187,9 +179,7 @@ def main():
         best_scaler = best_model_data['scaler']
         
         # 検証データでの予測
-        X_val_poly = create_polynomial_features(X_val, best_degree)
-        X_val_scaled = best_scaler.transform(X_val_poly)
-        val_predictions = best_model.predict(X_val_scaled)
+        val_predictions = predict_polynomial(best_model, best_scaler, best_degree, X_val)
         
         # 検証データでの予測vs実測値プロット
         plot_predictions_vs_actual(
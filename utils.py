@@ -55,6 +55,36 @@ def scale_features(X: np.ndarray) -> Tuple[np.ndarray, StandardScaler]:
     X_scaled = scaler.fit_transform(X)
     return X_scaled, scaler
 
+# libdistpredict がない場合の案内を1回だけ表示する
+_distpredict_notice_shown = False
+
+def predict_polynomial(model, scaler: StandardScaler, degree: int, X: np.ndarray) -> np.ndarray:
+    """
+    学習済み多項式回帰モデルで予測する関数
+
+    C++ 推論エンジン (libdistpredict, ビルド済みの場合) で、Teensy と同じ StandardScaler 畳み込み済み係数の
+    Horner評価を行う。特徴量行列を作らないため高次でもメモリを使わず、検証した値と実機の値が同じ評価器から出る。
+    ライブラリがなければ scikit-learn (PolynomialFeatures + StandardScaler + predict) で評価する
+
+    Args:
+        model: 学習済みの LinearRegression
+        scaler (StandardScaler): 多項式特徴量に当てはめたスケーラー
+        degree (int): 多項式の次数
+        X (np.ndarray): 入力特徴量 (under_y, theta の2列)
+
+    Returns:
+        np.ndarray: 予測値
+    """
+    global _distpredict_notice_shown
+    import distpredict
+    if distpredict.available():
+        runtime = distpredict.RuntimeModel.from_model_data({'model': model, 'scaler': scaler, 'degree': degree})
+        return runtime.evaluate(X[:, 0], X[:, 1])
+    if not _distpredict_notice_shown:
+        print("libdistpredict が見つからないため scikit-learn で予測します (cmake --build build でビルドしてください)")
+        _distpredict_notice_shown = True
+    return model.predict(scaler.transform(create_polynomial_features(X, degree)))
+
 def evaluate_model(model, X: np.ndarray, y: np.ndarray, n_splits: int = 5) -> Dict:
     """
     モデルの評価を行う関数